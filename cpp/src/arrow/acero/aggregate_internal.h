@@ -19,22 +19,28 @@
 
 #pragma once
 
+#include <atomic>
 #include <forward_list>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/acero/accumulation_queue.h"
 #include "arrow/acero/aggregate_node.h"
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spill_util_internal.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/row/grouper.h"
+#include "arrow/compute/util_internal.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
 #include "arrow/util/checked_cast.h"
@@ -60,6 +66,23 @@
 // keys. When a segment group end is reached while scanning the input, output is pushed
 // and the accumulating state is cleared. If no segment-keys are given, then the entire
 // input is taken as one segment group. One batch per segment group is sent to output.
+//
+// When the input is sorted on the keys, group-by aggregation without segment-keys runs
+// in a streaming mode instead. Each group is then a run of consecutive rows, so group ids
+// are assigned as the runs are found, without hashing the keys, and groups are output
+// as soon as their run ends. The output keeps the ordering of the input.
+//
+// Group-by aggregation without segment-keys can also spill (hybrid hash aggregation),
+// when enabled by QueryOptions::spill_threshold_bytes. The input is aggregated as usual
+// until the estimated size of the states first crosses the threshold. The per-thread
+// states are then merged into a single resident state which takes no new groups: rows
+// of groups it already holds are still aggregated in memory, while rows of new groups
+// are written to one of several spill files, partitioned by a hash of their keys. Each
+// thread partitions its rows on its own and only locks the resident state and a spill
+// file to hand off a partition once it has buffered enough rows. After all input is
+// received the buffers are handed off, the resident groups are output and released,
+// then each spill file is aggregated and output in turn. A spill file whose groups
+// still don't fit is partitioned again in the same way, on the next bits of the hash.
 
 namespace arrow {
 
@@ -238,7 +261,9 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
   int total_output_batches_ = 0;
 };
 
-class GroupByNode : public ExecNode, public TracedNode {
+class GroupByNode : public ExecNode,
+                    public TracedNode,
+                    util::SerialSequencingQueue::Processor {
  public:
   GroupByNode(ExecNode* input, std::shared_ptr<Schema> output_schema,
               std::vector<int> key_field_ids, std::vector<int> segment_key_field_ids,
@@ -246,9 +271,13 @@ class GroupByNode : public ExecNode, public TracedNode {
               std::vector<std::vector<TypeHolder>> agg_src_types,
               std::vector<std::vector<int>> agg_src_fieldsets,
               std::vector<Aggregate> aggs,
-              std::vector<const HashAggregateKernel*> agg_kernels)
+              std::vector<const HashAggregateKernel*> agg_kernels,
+              bool allow_spilling = false,
+              std::optional<Ordering> streaming_ordering = std::nullopt)
       : ExecNode(input->plan(), {input}, {"groupby"}, std::move(output_schema)),
         TracedNode(this),
+        ordering_(streaming_ordering.value_or(Ordering::Unordered())),
+        streaming_(streaming_ordering.has_value()),
         segmenter_(std::move(segmenter)),
         segmenter_values_(segment_key_field_ids.size()),
         key_field_ids_(std::move(key_field_ids)),
@@ -256,7 +285,8 @@ class GroupByNode : public ExecNode, public TracedNode {
         agg_src_types_(std::move(agg_src_types)),
         agg_src_fieldsets_(std::move(agg_src_fieldsets)),
         aggs_(std::move(aggs)),
-        agg_kernels_(std::move(agg_kernels)) {}
+        agg_kernels_(std::move(agg_kernels)),
+        allow_spilling_(allow_spilling) {}
 
   Status Init() override;
 
@@ -272,6 +302,8 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   const char* kind_name() const override { return "GroupByNode"; }
 
+  const Ordering& ordering() const override { return ordering_; }
+
   Status Consume(ExecSpan batch);
 
   Status Merge();
@@ -286,11 +318,7 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   Status InputFinished(ExecNode* input, int total_batches) override;
 
-  Status StartProducing() override {
-    NoteStartProducing(ToStringExtra(0));
-    local_states_.resize(plan_->query_context()->max_concurrency());
-    return Status::OK();
-  }
+  Status StartProducing() override;
 
   void PauseProducing(ExecNode* output, int32_t counter) override {
     // TODO(ARROW-16260)
@@ -313,6 +341,92 @@ class GroupByNode : public ExecNode, public TracedNode {
     std::vector<std::unique_ptr<KernelState>> agg_states;
   };
 
+  /// \brief A hash partition of the rows of new groups, once spilling
+  struct SpillPartition {
+    std::mutex mutex;
+    /// \brief The spilled rows, created with the first of them
+    std::unique_ptr<SpillFile> file;
+  };
+  using SpillPartitions = std::vector<std::unique_ptr<SpillPartition>>;
+
+  /// \brief The rows of one partition held back by a thread until there are enough of
+  /// them to hand off, so that the shared state is locked once per batch of rows
+  struct PendingRows {
+    RecordBatchVector batches;
+    int64_t num_rows = 0;
+  };
+  using SpillBuffers = std::vector<PendingRows>;
+
+  static constexpr int kLogNumSpillPartitions = 4;
+  static constexpr int kNumSpillPartitions = 1 << kLogNumSpillPartitions;
+  /// \brief The deepest level at which a spill file which doesn't fit is partitioned
+  /// again, each level using the next kLogNumSpillPartitions bits of the key hash
+  static constexpr int kMaxSpillLevel = 4;
+  /// \brief The number of rows a thread buffers for a partition before handing them off
+  static constexpr int64_t kSpillBufferRows = 4096;
+
+  Status ConsumeState(ThreadLocalState* state, const ExecSpan& batch);
+
+  /// \brief Feed the rows of a batch, whose group ids are known, to the aggregates
+  Status ConsumeAggregates(std::vector<std::unique_ptr<KernelState>>* agg_states,
+                           const ExecSpan& batch, const ArraySpan& group_ids,
+                           int64_t num_groups);
+
+  /// \brief Aggregate the next batch of input, in order, then output the last groups
+  /// once all the batches are processed (streaming mode)
+  Status Process(ExecBatch batch) override;
+
+  /// \brief Aggregate the next batch of input, in order (streaming mode)
+  Status ConsumeStreaming(ExecBatch batch);
+
+  /// \brief Aggregate some consecutive segments of a batch (streaming mode)
+  Status ConsumeSegments(const ExecBatch& batch, const ExecBatch& key_batch,
+                         const std::vector<Segment>& segments, size_t begin,
+                         size_t end);
+
+  /// \brief Output the groups aggregated so far, which must be complete (streaming
+  /// mode)
+  Status OutputStreamingGroups();
+
+  Status MergeStates(std::vector<ThreadLocalState>* states);
+
+  Result<ExecBatch> FinalizeState(ThreadLocalState* state);
+
+  /// \brief Aggregate a batch of input, starting to spill once the states are
+  /// estimated to be too big
+  Status ConsumeAllowingSpill(const ExecBatch& batch);
+
+  /// \brief Merge the per-thread states into the resident state and start spilling
+  /// the rows of new groups
+  Status StartSpilling();
+
+  /// \brief Split a batch into `buffers` by the bits of the key hash for `level`,
+  /// handing off those which fill up
+  Status ConsumeResident(ThreadLocalState* resident, const ExecBatch& batch, int level,
+                         SpillPartitions* partitions, SpillBuffers* buffers);
+
+  /// \brief Aggregate the buffered rows of groups held by `resident` and spill the
+  /// others to `partition`
+  Status HandOffRows(ThreadLocalState* resident, PendingRows* pending,
+                     SpillPartition* partition);
+
+  /// \brief Hand off the rows left in `buffers`
+  Status FlushSpillBuffers(ThreadLocalState* resident, SpillBuffers* buffers,
+                           SpillPartitions* partitions);
+
+  /// \brief Output the groups of a state, releasing it
+  Status OutputState(ThreadLocalState* state);
+
+  /// \brief Output the resident groups, then those of each spill file
+  Status OutputSpilledResult();
+
+  /// \brief Aggregate and output the spill files one at a time, deleting each
+  /// once done
+  Status OutputSpilledPartitions(SpillPartitions* partitions, int level);
+
+  /// \brief Aggregate and output the rows of a spill file, partitioned by `level`
+  Status OutputSpilledFile(SpillFile* file, int level);
+
   ThreadLocalState* GetLocalState() {
     size_t thread_index = plan_->query_context()->GetThreadIndex();
     return &local_states_[thread_index];
@@ -330,7 +444,11 @@ class GroupByNode : public ExecNode, public TracedNode {
   }
 
   int output_task_group_id_;
-  /// \brief A segmenter for the segment-keys
+  /// \brief The ordering of the output, only known in streaming mode
+  const Ordering ordering_;
+  /// \brief Whether the input is sorted on the keys, so streaming mode is used
+  const bool streaming_;
+  /// \brief A segmenter for the segment-keys, or for the keys in streaming mode
   std::unique_ptr<RowSegmenter> segmenter_;
   /// \brief Holds values of the current batch that were selected for the segment-keys
   std::vector<Datum> segmenter_values_;
@@ -350,6 +468,36 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   std::vector<ThreadLocalState> local_states_;
   ExecBatch out_data_;
+
+  /// \brief Whether spilling may be used, decided when the node is made
+  const bool allow_spilling_;
+  /// \brief Held shared while consuming into local_states_, and exclusively to start
+  /// spilling
+  std::shared_mutex spill_switch_mutex_;
+  /// \brief Whether the per-thread states were merged into local_states_[0], which
+  /// now takes no new groups
+  bool spilling_ = false;
+  /// \brief Guards the resident state once spilling
+  std::mutex resident_mutex_;
+  /// \brief Partitions of the rows of the groups not resident, once spilling
+  SpillPartitions spill_partitions_;
+  /// \brief Per-thread rows not yet handed off to the resident state or the
+  /// partitions, once spilling
+  std::vector<SpillBuffers> spill_buffers_;
+  /// \brief Number of groups across all local states, before spilling
+  std::atomic<int64_t> num_groups_{0};
+  /// \brief Per-thread temporary stacks for hashing keys when spilling
+  std::vector<arrow::util::TempVectorStack> hash_stacks_;
+  /// \brief Rough size, in bytes, of the state held for one group
+  std::atomic<int64_t> group_bytes_estimate_{0};
+
+  /// \brief Delivers the input batches in order (streaming mode)
+  std::unique_ptr<util::SerialSequencingQueue> sequencer_;
+  /// \brief Aggregate states of the groups not output yet (streaming mode)
+  std::vector<std::unique_ptr<KernelState>> streaming_states_;
+  /// \brief Keys of the groups not output yet, in order (streaming mode)
+  std::vector<ExecBatch> streaming_keys_;
+  int64_t streaming_num_groups_ = 0;
 };
 
 }  // namespace aggregate
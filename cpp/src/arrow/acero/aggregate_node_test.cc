@@ -27,7 +27,9 @@
 #include "arrow/compute/test_util_internal.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
+#include "arrow/testing/builder.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/string.h"
 
@@ -233,6 +235,142 @@ TEST(GroupByNode, BasicParallel) {
                                       out_batches.batches);
 }
 
+TEST(GroupByNode, Spilling) {
+  // Enough rows for each thread to fill and hand off its buffers of spilled rows
+  // before the end of the input
+  constexpr int kNumBatches = 64;
+  constexpr int kRowsPerBatch = 2048;
+  constexpr int kNumKeys = 1000;
+
+  std::shared_ptr<Schema> in_schema =
+      schema({field("key", int32()), field("value", int64())});
+  std::vector<ExecBatch> batches;
+  for (int i = 0; i < kNumBatches; ++i) {
+    std::vector<int32_t> keys(kRowsPerBatch);
+    std::vector<int64_t> values(kRowsPerBatch);
+    for (int j = 0; j < kRowsPerBatch; ++j) {
+      int row = i * kRowsPerBatch + j;
+      keys[j] = (row * 7) % kNumKeys;
+      values[j] = row;
+    }
+    std::shared_ptr<Array> key_array, value_array;
+    ArrayFromVector<Int32Type>(keys, &key_array);
+    ArrayFromVector<Int64Type>(values, &value_array);
+    batches.push_back(ExecBatch({key_array, value_array}, kRowsPerBatch));
+  }
+
+  Declaration plan = Declaration::Sequence(
+      {{"exec_batch_source", ExecBatchSourceNodeOptions(in_schema, std::move(batches))},
+       {"aggregate", AggregateNodeOptions{/*aggregates=*/{{"hash_sum", "value", "sum"},
+                                                          {"hash_mean", "value", "mean"},
+                                                          {"hash_count_all", "count"}},
+                                          /*keys=*/{"key"}}}});
+
+  ASSERT_OK_AND_ASSIGN(BatchesWithCommonSchema expected, DeclarationToExecBatches(plan));
+  ASSERT_OK_AND_ASSIGN(auto spill_dir, SpillDir::Make());
+  // A threshold of 1 byte also partitions the spill files again, down to the deepest
+  // level, while the states of all the groups take about 12KB
+  constexpr int64_t kNoSpillThreshold = int64_t{1} << 40;
+  for (int64_t threshold : {int64_t{1}, int64_t{4 * 1024}, kNoSpillThreshold}) {
+    for (bool use_threads : {false, true}) {
+      ARROW_SCOPED_TRACE("threshold=", threshold, " use_threads=", use_threads);
+      PlanProfile profile;
+      QueryOptions query_options;
+      query_options.use_threads = use_threads;
+      query_options.spill_threshold_bytes = threshold;
+      query_options.profile = &profile;
+      ASSERT_OK_AND_ASSIGN(BatchesWithCommonSchema actual,
+                           DeclarationToExecBatches(plan, query_options));
+      AssertExecBatchesEqualIgnoringOrder(expected.schema, expected.batches,
+                                          actual.batches);
+
+      const NodeProfile* node_profile = FindNodeProfile(profile, "GroupByNode");
+      ASSERT_NE(node_profile, nullptr);
+      if (threshold == kNoSpillThreshold) {
+        ASSERT_EQ(node_profile->spilled_bytes, 0);
+      } else {
+        ASSERT_GT(node_profile->spilled_bytes, 0);
+      }
+      ASSERT_OK_AND_EQ(std::vector<std::string>{}, spill_dir->ListEntries());
+    }
+  }
+}
+
+TEST(GroupByNode, SortedInput) {
+  random::RandomArrayGenerator rng(42);
+  constexpr int64_t kNumRows = 1000;
+  auto table =
+      Table::Make(schema({field("k", int32()), field("s", utf8()), field("v", int64())}),
+                  {rng.Int32(kNumRows, 0, 20, /*null_probability=*/0.1),
+                   rng.StringWithRepeats(kNumRows, /*unique=*/3, /*min_length=*/1,
+                                         /*max_length=*/2, /*null_probability=*/0.1),
+                   rng.Int64(kNumRows, 0, 1000)});
+  std::vector<Aggregate> aggregates = {{"hash_sum", "v", "sum"},
+                                       {"hash_count_all", "count"},
+                                       {"hash_min_max", "v", "min_max"}};
+  std::vector<FieldRef> keys = {"s", "k"};
+  compute::Ordering ordering(
+      {compute::SortKey("k", compute::SortOrder::Descending,
+                        compute::NullPlacement::AtStart),
+       compute::SortKey("s")});
+  compute::Ordering output_ordering(
+      {compute::SortKey(FieldRef(1), compute::SortOrder::Descending,
+                        compute::NullPlacement::AtStart),
+       compute::SortKey(FieldRef(0))});
+
+  // When the input is sorted on the keys, the groups come out in the same order
+  Declaration expected_plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(table, /*max_batch_size=*/64)},
+       {"aggregate", AggregateNodeOptions(aggregates, keys)},
+       {"order_by", OrderByNodeOptions(output_ordering)}});
+  ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(std::move(expected_plan)));
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads=", use_threads);
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(table, /*max_batch_size=*/64)},
+         {"order_by", OrderByNodeOptions(ordering)},
+         {"aggregate", AggregateNodeOptions(aggregates, keys)}});
+    QueryOptions query_options;
+    query_options.use_threads = use_threads;
+    query_options.sequence_output = true;
+    ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(std::move(plan), query_options));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+  // Ordered aggregates are allowed on any number of threads
+  Declaration first_plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(table)},
+       {"order_by", OrderByNodeOptions(ordering)},
+       {"aggregate", AggregateNodeOptions({{"hash_first", "v", "first"}}, keys)}});
+  ASSERT_OK(DeclarationToStatus(std::move(first_plan), /*use_threads=*/true));
+}
+
+TEST(GroupByNode, SortedFloatKeys) {
+  // Sorting doesn't tell -0.0 from 0.0, so a float key sorted in the input doesn't make
+  // its groups runs, and the groups are the same as with hash grouping
+  auto table = TableFromJSON(schema({field("k", float64()), field("v", int64())}),
+                             {R"([[0.0, 1], [-0.0, 10], [0.0, 100]])",
+                              R"([[1.5, 1000], [-0.0, 10000]])"});
+  std::vector<Aggregate> aggregates = {{"hash_sum", "v", "sum"}};
+  compute::Ordering by_sum({compute::SortKey("sum")});
+  Declaration expected_plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(table)},
+       {"aggregate", AggregateNodeOptions(aggregates, {"k"})},
+       {"order_by", OrderByNodeOptions(by_sum)}});
+  ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(std::move(expected_plan)));
+  ASSERT_EQ(expected->num_rows(), 3);
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads=", use_threads);
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(table, /*max_batch_size=*/2)},
+         {"order_by", OrderByNodeOptions(compute::Ordering({compute::SortKey("k")}))},
+         {"aggregate", AggregateNodeOptions(aggregates, {"k"})},
+         {"order_by", OrderByNodeOptions(by_sum)}});
+    ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(std::move(plan), use_threads));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST(ScalarAggregateNode, AnyAll) {
   // GH-43768: boolean_any and boolean_all with constant input should work well
   // when min_count != 0.
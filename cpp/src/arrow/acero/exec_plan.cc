@@ -18,6 +18,7 @@
 #include "arrow/acero/exec_plan.h"
 
 #include <atomic>
+#include <chrono>
 #include <optional>
 #include <sstream>
 #include <unordered_map>
@@ -193,6 +194,9 @@ struct ExecPlanImpl : public ExecPlan {
           StopProducing();
         });
     scheduler_finished.AddCallback([this](const Status& st) {
+      if (PlanProfile* profile = query_context_.options().profile) {
+        *profile = GetProfile();
+      }
       if (st.ok()) {
         if (stopped_.load()) {
           finished_.MarkFinished(Status::Cancelled("Plan was cancelled early."));
@@ -330,6 +334,25 @@ struct ExecPlanImpl : public ExecPlan {
     return ss.str();
   }
 
+  PlanProfile GetProfile() const {
+    PlanProfile profile;
+    std::unordered_map<const ExecNode*, int> indices;
+    for (const auto& node : nodes_) {
+      indices.emplace(node.get(), static_cast<int>(indices.size()));
+    }
+    profile.nodes.resize(nodes_.size());
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+      NodeProfile& node_profile = profile.nodes[i];
+      node_profile.label = nodes_[i]->label();
+      node_profile.kind = nodes_[i]->kind_name();
+      for (const ExecNode* input : nodes_[i]->inputs()) {
+        node_profile.inputs.push_back(indices[input]);
+      }
+      nodes_[i]->profiler()->Fill(&node_profile);
+    }
+    return profile;
+  }
+
   Status error_st_;
   Future<> finished_ = Future<>::Make();
   bool started_ = false;
@@ -352,6 +375,32 @@ const ExecPlanImpl* ToDerived(const ExecPlan* ptr) {
   return checked_cast<const ExecPlanImpl*>(ptr);
 }
 
+int64_t SteadyClockNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void AtomicMax(std::atomic<int64_t>* target, int64_t value) {
+  int64_t current = target->load();
+  while (value > current && !target->compare_exchange_weak(current, value)) {
+  }
+}
+
+std::string FormatNanos(int64_t nanos) {
+  std::stringstream ss;
+  ss.precision(3);
+  ss << std::fixed;
+  if (nanos < 1000000) {
+    ss << nanos / 1e3 << "us";
+  } else if (nanos < 1000000000) {
+    ss << nanos / 1e6 << "ms";
+  } else {
+    ss << nanos / 1e9 << "s";
+  }
+  return ss.str();
+}
+
 std::optional<int> GetNodeIndex(const std::vector<ExecNode*>& nodes,
                                 const ExecNode* node) {
   for (int i = 0; i < static_cast<int>(nodes.size()); ++i) {
@@ -451,6 +500,118 @@ std::shared_ptr<const KeyValueMetadata> ExecPlan::metadata() const {
 
 std::string ExecPlan::ToString() const { return ToDerived(this)->ToString(); }
 
+PlanProfile ExecPlan::GetProfile() const { return ToDerived(this)->GetProfile(); }
+
+void NodeProfiler::RecordReceived(const ExecBatch& batch) {
+  if (!enabled_) return;
+  batches_received_.fetch_add(1);
+  rows_received_.fetch_add(batch.length);
+  bytes_received_.fetch_add(batch.TotalBufferSize());
+}
+
+void NodeProfiler::RecordEmitted(const ExecBatch& batch) {
+  if (!enabled_) return;
+  batches_emitted_.fetch_add(1);
+  rows_emitted_.fetch_add(batch.length);
+  bytes_emitted_.fetch_add(batch.TotalBufferSize());
+}
+
+void NodeProfiler::RecordTime(int64_t cpu_time_nanos, int64_t wall_time_nanos) {
+  if (!enabled_) return;
+  cpu_time_nanos_.fetch_add(cpu_time_nanos);
+  wall_time_nanos_.fetch_add(wall_time_nanos);
+}
+
+void NodeProfiler::RecordQueryMemory(int64_t bytes_allocated) {
+  if (!enabled_) return;
+  AtomicMax(&peak_query_memory_bytes_, bytes_allocated);
+}
+
+void NodeProfiler::RecordSpilled(int64_t bytes) {
+  if (!enabled_) return;
+  spilled_bytes_.fetch_add(bytes);
+}
+
+void NodeProfiler::RecordPaused(int32_t counter) {
+  if (!enabled_) return;
+  std::lock_guard<std::mutex> lock(pause_mutex_);
+  if (counter <= pause_counter_) return;
+  pause_counter_ = counter;
+  if (paused_since_nanos_ < 0) {
+    paused_since_nanos_ = SteadyClockNanos();
+    ++pause_count_;
+  }
+}
+
+void NodeProfiler::RecordResumed(int32_t counter) {
+  if (!enabled_) return;
+  std::lock_guard<std::mutex> lock(pause_mutex_);
+  if (counter <= pause_counter_) return;
+  pause_counter_ = counter;
+  if (paused_since_nanos_ >= 0) {
+    paused_time_nanos_ += SteadyClockNanos() - paused_since_nanos_;
+    paused_since_nanos_ = -1;
+  }
+}
+
+void NodeProfiler::Fill(NodeProfile* profile) const {
+  profile->batches_received = batches_received_.load();
+  profile->rows_received = rows_received_.load();
+  profile->bytes_received = bytes_received_.load();
+  profile->batches_emitted = batches_emitted_.load();
+  profile->rows_emitted = rows_emitted_.load();
+  profile->bytes_emitted = bytes_emitted_.load();
+  profile->cpu_time_nanos = cpu_time_nanos_.load();
+  profile->wall_time_nanos = wall_time_nanos_.load();
+  {
+    std::lock_guard<std::mutex> lock(pause_mutex_);
+    profile->pause_count = pause_count_;
+    profile->paused_time_nanos = paused_time_nanos_;
+    // Include the pause in progress, if any
+    if (paused_since_nanos_ >= 0) {
+      profile->paused_time_nanos += SteadyClockNanos() - paused_since_nanos_;
+    }
+  }
+  profile->peak_query_memory_bytes = peak_query_memory_bytes_.load();
+  profile->spilled_bytes = spilled_bytes_.load();
+}
+
+std::string NodeProfile::ToString() const {
+  std::stringstream ss;
+  ss << label << ":" << kind << "{received=" << batches_received << " batches/"
+     << rows_received << " rows/" << bytes_received << " bytes, emitted="
+     << batches_emitted << " batches/" << rows_emitted << " rows/" << bytes_emitted
+     << " bytes, cpu_time=" << FormatNanos(cpu_time_nanos)
+     << ", wall_time=" << FormatNanos(wall_time_nanos) << ", paused=" << pause_count
+     << " times/" << FormatNanos(paused_time_nanos)
+     << ", peak_query_memory=" << peak_query_memory_bytes
+     << " bytes, spilled=" << spilled_bytes
+     << " bytes}";
+  return ss.str();
+}
+
+std::string PlanProfile::ToString() const {
+  std::stringstream ss;
+  ss << "ExecPlan profile with " << nodes.size() << " nodes:" << std::endl;
+  std::vector<bool> is_input(nodes.size(), false);
+  for (const NodeProfile& node : nodes) {
+    for (int input : node.inputs) {
+      is_input[input] = true;
+    }
+  }
+  std::function<void(int, int)> visit = [&](int index, int indent) {
+    for (int j = 0; j < indent; ++j) ss << "  ";
+    ss << nodes[index].ToString() << std::endl;
+    for (int input : nodes[index].inputs) {
+      visit(input, indent + 1);
+    }
+  };
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    if (!is_input[i]) visit(static_cast<int>(i), 0);
+  }
+  return ss.str();
+}
+
 ExecNode::ExecNode(ExecPlan* plan, NodeVector inputs,
                    std::vector<std::string> input_labels,
                    std::shared_ptr<Schema> output_schema)
@@ -459,6 +620,8 @@ ExecNode::ExecNode(ExecPlan* plan, NodeVector inputs,
       inputs_(std::move(inputs)),
       input_labels_(std::move(input_labels)),
       output_schema_(std::move(output_schema)) {
+  profiler_.set_enabled(plan_ != nullptr &&
+                        plan_->query_context()->options().profile != nullptr);
   for (auto input : inputs_) {
     DCHECK_NE(input, nullptr) << " null input";
     DCHECK_EQ(input->output_, nullptr) << " attempt to add a second output to a node";
@@ -1117,7 +1280,9 @@ ExecFactoryRegistry* default_exec_factory_registry() {
       internal::RegisterSinkNode(this);
       internal::RegisterHashJoinNode(this);
       internal::RegisterAsofJoinNode(this);
+      internal::RegisterMergeJoinNode(this);
       internal::RegisterSortedMergeNode(this);
+      internal::RegisterWindowNode(this);
     }
 
     Result<Factory> GetFactory(const std::string& factory_name) override {
@@ -17,10 +17,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <utility>
@@ -51,6 +53,104 @@ namespace acero {
 /// \addtogroup acero-internals
 /// @{
 
+/// \brief Runtime statistics of one node of an ExecPlan
+///
+/// Received counts cover the batches a node was given by its inputs.  Emitted counts
+/// cover the batches the node gave to its output, as reported by the output node.
+/// Times are totals over all threads; the CPU time is the time the threads spent on
+/// the CPU, which excludes time spent waiting on I/O or locks.  Neither includes the
+/// time spent by other nodes called on the same thread, such as the output.
+struct ARROW_ACERO_EXPORT NodeProfile {
+  std::string label;
+  std::string kind;
+  /// Indices in PlanProfile::nodes of the inputs of the node
+  std::vector<int> inputs;
+
+  int64_t batches_received = 0;
+  int64_t rows_received = 0;
+  int64_t bytes_received = 0;
+  int64_t batches_emitted = 0;
+  int64_t rows_emitted = 0;
+  int64_t bytes_emitted = 0;
+
+  /// CPU time of the work done by the node when receiving batches, starting and
+  /// finishing
+  int64_t cpu_time_nanos = 0;
+  /// Elapsed time of the same work
+  int64_t wall_time_nanos = 0;
+
+  /// The number of times the node was paused by backpressure from its output
+  int64_t pause_count = 0;
+  /// The time the node spent paused by backpressure from its output
+  int64_t paused_time_nanos = 0;
+
+  /// The largest allocation of the memory pool of the query, which is shared by all
+  /// the nodes, seen when the node finished some work
+  int64_t peak_query_memory_bytes = 0;
+  /// The bytes written to spill files
+  int64_t spilled_bytes = 0;
+
+  std::string ToString() const;
+};
+
+/// \brief Runtime statistics of the nodes of an ExecPlan
+struct ARROW_ACERO_EXPORT PlanProfile {
+  /// The nodes, in the order they were added to the plan
+  std::vector<NodeProfile> nodes;
+
+  /// \brief Render the profile as a tree, with each node above its inputs
+  std::string ToString() const;
+};
+
+/// \brief Collects the runtime statistics of an ExecNode
+///
+/// Statistics are only collected if QueryOptions::profile is set, otherwise every call
+/// is a no-op.  All methods may be called concurrently.  Nodes which derive from
+/// TracedNode have their batches and time recorded automatically.
+class ARROW_ACERO_EXPORT NodeProfiler {
+ public:
+  bool enabled() const { return enabled_; }
+  void set_enabled(bool enabled) { enabled_ = enabled; }
+
+  void RecordReceived(const ExecBatch& batch);
+  void RecordEmitted(const ExecBatch& batch);
+  void RecordTime(int64_t cpu_time_nanos, int64_t wall_time_nanos);
+  /// \brief Record the current allocation of the query's memory pool, keeping the
+  /// largest
+  void RecordQueryMemory(int64_t bytes_allocated);
+  void RecordSpilled(int64_t bytes);
+  /// \brief Record that the node was asked to pause producing by its output
+  ///
+  /// `counter` is the one given to ExecNode::PauseProducing.  As with the calls
+  /// themselves, pauses and resumes with a counter no greater than the last one are
+  /// ignored, and so are pauses while paused.
+  void RecordPaused(int32_t counter);
+  /// \brief Record that the node was asked to resume producing by its output
+  void RecordResumed(int32_t counter);
+
+  /// \brief Copy the statistics into a profile
+  void Fill(NodeProfile* profile) const;
+
+ private:
+  bool enabled_ = false;
+  std::atomic<int64_t> batches_received_{0};
+  std::atomic<int64_t> rows_received_{0};
+  std::atomic<int64_t> bytes_received_{0};
+  std::atomic<int64_t> batches_emitted_{0};
+  std::atomic<int64_t> rows_emitted_{0};
+  std::atomic<int64_t> bytes_emitted_{0};
+  std::atomic<int64_t> cpu_time_nanos_{0};
+  std::atomic<int64_t> wall_time_nanos_{0};
+  mutable std::mutex pause_mutex_;
+  int32_t pause_counter_ = 0;
+  int64_t pause_count_ = 0;
+  int64_t paused_time_nanos_ = 0;
+  // The steady clock time of the current pause, or -1 if not paused
+  int64_t paused_since_nanos_ = -1;
+  std::atomic<int64_t> peak_query_memory_bytes_{0};
+  std::atomic<int64_t> spilled_bytes_{0};
+};
+
 class ARROW_ACERO_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan> {
  public:
   // This allows operators to rely on signed 16-bit indices
@@ -116,6 +216,12 @@ class ARROW_ACERO_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan
   std::shared_ptr<const KeyValueMetadata> metadata() const;
 
   std::string ToString() const;
+
+  /// \brief Return the runtime statistics of the nodes
+  ///
+  /// This is empty (but for the labels and kinds of the nodes) unless
+  /// QueryOptions::profile was set.  It may be called while the plan is running.
+  PlanProfile GetProfile() const;
 };
 
 // Acero can be extended by providing custom implementations of ExecNode.  The methods
@@ -202,6 +308,20 @@ class ARROW_ACERO_EXPORT ExecNode {
   /// maintain continuity.
   virtual const Ordering& ordering() const;
 
+  /// \brief Whether the node accepts input batches with a selection vector
+  ///
+  /// A node which accepts them only computes on the rows selected by
+  /// ExecBatch::selection_vector, so its inputs may send it the selected rows of a
+  /// batch rather than a copy of them.  Other nodes are never sent a selection vector.
+  virtual bool accepts_selection_vectors() const { return false; }
+
+  /// \brief Whether the node outputs the rows of its single input which satisfy a
+  /// condition on each row, with the columns of its input
+  ///
+  /// Dropping more rows from the input of such a node only drops the same rows from
+  /// its output, so a filter of its output rows can be applied to its input instead.
+  virtual bool is_row_filter() const { return false; }
+
   /// Upstream API:
   /// These functions are called by input nodes that want to inform this node
   /// about an updated condition (a new input batch or an impending
@@ -329,6 +449,10 @@ class ARROW_ACERO_EXPORT ExecNode {
 
   std::string ToString(int indent = 0) const;
 
+  /// \brief The runtime statistics of this node
+  NodeProfiler* profiler() { return &profiler_; }
+  const NodeProfiler* profiler() const { return &profiler_; }
+
  protected:
   ExecNode(ExecPlan* plan, NodeVector inputs, std::vector<std::string> input_labels,
            std::shared_ptr<Schema> output_schema);
@@ -347,6 +471,8 @@ class ARROW_ACERO_EXPORT ExecNode {
 
   std::shared_ptr<Schema> output_schema_;
   ExecNode* output_ = NULLPTR;
+
+  NodeProfiler profiler_;
 };
 
 /// \brief An extensible registry for factories of ExecNodes
@@ -602,6 +728,34 @@ struct ARROW_ACERO_EXPORT QueryOptions {
   /// If this field is not set then it will be treated as kWarn unless overridden
   /// by the ACERO_ALIGNMENT_HANDLING environment variable
   std::optional<UnalignedBufferHandling> unaligned_buffer_handling;
+
+  /// \brief Soft limit, in bytes, on the data a spilling node may buffer in memory
+  ///
+  /// Nodes that support larger-than-memory execution will write part of their state
+  /// to a temporary file once the data they hold exceeds (approximately) this many
+  /// bytes.  Currently these are:
+  ///  - the order_by and order_by_sink nodes, which spill sorted runs
+  ///  - the aggregate node when grouping without segment keys, which stops taking new
+  ///    groups and spills their input rows, partitioned by hash
+  ///  - the hashjoin node, which partitions both inputs by hash and spills the
+  ///    partitions of the build input that do not fit, along with their probe rows
+  ///
+  /// The files are created in a per-query directory under the system temporary
+  /// directory (which can be controlled with the TMPDIR environment variable) and
+  /// removed when the plan is destroyed.
+  ///
+  /// If this is 0 (the default) then nodes never spill.
+  int64_t spill_threshold_bytes = 0;
+
+  /// \brief Where to store a runtime profile of the plan
+  ///
+  /// If set then every node records the batches and rows it receives and emits, the
+  /// time spent on them, the time it was paused by backpressure and the bytes it
+  /// spilled.  The profile is stored here when the plan finishes (whether or not it
+  /// succeeds), and can also be obtained while it runs with ExecPlan::GetProfile.
+  ///
+  /// Must be null or remain valid for the duration of the plan.
+  PlanProfile* profile = NULLPTR;
 };
 
 /// \brief Calculate the output schema of a declaration
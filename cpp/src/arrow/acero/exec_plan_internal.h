@@ -32,6 +32,8 @@ void RegisterAggregateNode(ExecFactoryRegistry*);
 void RegisterSinkNode(ExecFactoryRegistry*);
 void RegisterHashJoinNode(ExecFactoryRegistry*);
 void RegisterAsofJoinNode(ExecFactoryRegistry*);
+void RegisterMergeJoinNode(ExecFactoryRegistry*);
 void RegisterSortedMergeNode(ExecFactoryRegistry*);
+void RegisterWindowNode(ExecFactoryRegistry*);
 
 }  // namespace arrow::acero::internal
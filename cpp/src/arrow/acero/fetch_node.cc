@@ -142,10 +142,12 @@ class FetchNode : public ExecNode, public TracedNode, util::SequencingQueue::Pro
   }
 
   void PauseProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordPaused(counter);
     inputs_[0]->PauseProducing(this, counter);
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordResumed(counter);
     inputs_[0]->ResumeProducing(this, counter);
   }
 
@@ -20,6 +20,8 @@
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/buffer.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/expression.h"
@@ -35,10 +37,25 @@ namespace arrow {
 using internal::checked_cast;
 
 using compute::FilterOptions;
+using compute::SelectionVector;
 
 namespace acero {
 namespace {
 
+// Maps the indices of `selection`, which are into the rows selected by `outer`, to
+// indices into the values `outer` selects from
+Result<std::shared_ptr<SelectionVector>> ComposeSelections(
+    const SelectionVector& outer, const SelectionVector& selection, MemoryPool* pool) {
+  const int32_t length = selection.length();
+  ARROW_ASSIGN_OR_RAISE(auto indices, AllocateBuffer(length * sizeof(int32_t), pool));
+  auto* out = indices->mutable_data_as<int32_t>();
+  for (int32_t i = 0; i < length; ++i) {
+    out[i] = outer.indices()[selection.indices()[i]];
+  }
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), length, {nullptr, std::move(indices)}, /*null_count=*/0));
+}
+
 class FilterNode : public MapNode {
  public:
   FilterNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
@@ -71,6 +88,19 @@ class FilterNode : public MapNode {
 
   const char* kind_name() const override { return "FilterNode"; }
 
+  bool accepts_selection_vectors() const override { return true; }
+
+  bool is_row_filter() const override { return true; }
+
+  Status Init() override {
+    // Nodes which only compute on the selected rows of the columns they use are sent
+    // the selected rows instead of a filtered copy of every column
+    if (output_ != nullptr) {
+      emit_selection_ = output_->accepts_selection_vectors();
+    }
+    return MapNode::Init();
+  }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
     ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
                           SimplifyWithGuarantee(filter_, batch.guarantee));
@@ -81,28 +111,46 @@ class FilterNode : public MapNode {
                         {"filter.expression.simplified", simplified_filter.ToString()},
                         {"filter.length", batch.length}});
 
+    // Subexpressions which occur several times in the filter are computed once
     ARROW_ASSIGN_OR_RAISE(
-        Datum mask, ExecuteScalarExpression(simplified_filter, batch,
-                                            plan()->query_context()->exec_context()));
+        std::vector<Datum> masks,
+        ExecuteScalarExpressions({simplified_filter}, batch,
+                                 plan()->query_context()->exec_context()));
+    Datum mask = std::move(masks[0]);
 
     if (mask.is_scalar()) {
       const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
-      if (mask_scalar.is_valid && mask_scalar.value) {
-        return batch;
+      if (!mask_scalar.is_valid || !mask_scalar.value) {
+        batch = batch.Slice(0, 0);
       }
-      return batch.Slice(0, 0);
+      return MaybeApplySelection(std::move(batch));
     }
 
     // if the values are all scalar then the mask must also be
     DCHECK(!std::all_of(batch.values.begin(), batch.values.end(),
                         [](const Datum& value) { return value.is_scalar(); }));
 
-    auto values = batch.values;
-    for (auto& value : values) {
-      if (value.is_scalar()) continue;
-      ARROW_ASSIGN_OR_RAISE(value, Filter(value, mask, FilterOptions::Defaults()));
+    if (!emit_selection_ && !batch.selection_vector) {
+      auto values = batch.values;
+      for (auto& value : values) {
+        if (value.is_scalar()) continue;
+        ARROW_ASSIGN_OR_RAISE(value, Filter(value, mask, FilterOptions::Defaults()));
+      }
+      return ExecBatch::Make(std::move(values));
+    }
+
+    // The mask applies to the rows already selected, if any
+    MemoryPool* pool = plan()->query_context()->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<SelectionVector> selection,
+        SelectionVector::FromMask(BooleanArray(mask.array()), pool));
+    if (batch.selection_vector) {
+      ARROW_ASSIGN_OR_RAISE(selection,
+                            ComposeSelections(*batch.selection_vector, *selection, pool));
     }
-    return ExecBatch::Make(std::move(values));
+    batch.selection_vector = std::move(selection);
+    batch.length = batch.selection_vector->length();
+    return MaybeApplySelection(std::move(batch));
   }
 
  protected:
@@ -111,7 +159,16 @@ class FilterNode : public MapNode {
   }
 
  private:
+  Result<ExecBatch> MaybeApplySelection(ExecBatch batch) {
+    if (emit_selection_ || !batch.selection_vector) {
+      return batch;
+    }
+    return batch.ApplySelection(plan()->query_context()->exec_context());
+  }
+
   Expression filter_;
+  // Whether the output is sent as a selection vector over the input values
+  bool emit_selection_ = false;
 };
 }  // namespace
 
@@ -15,7 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
@@ -26,12 +29,20 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spill_util_internal.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/light_array_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/row/grouper.h"
 #include "arrow/datum.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging_internal.h"
@@ -48,17 +59,89 @@ using compute::Function;
 using compute::FunctionOptions;
 using compute::Grouper;
 using compute::HashAggregateKernel;
+using compute::Hashing32;
 using compute::Kernel;
 using compute::KernelContext;
 using compute::KernelInitArgs;
 using compute::KernelState;
+using compute::KeyColumnArray;
 using compute::RowSegmenter;
 using compute::ScalarAggregateKernel;
 using compute::Segment;
+using compute::SortKey;
 
 namespace acero {
 namespace aggregate {
 
+namespace {
+
+// Spilling partitions rows by a hash of their keys, which must be supported by the
+// row hashing utilities.  Segmented aggregation already bounds its state and
+// ordered aggregates depend on the input order, which partitioning doesn't preserve.
+bool CanSpill(QueryContext* ctx, const Schema& input_schema,
+              const std::vector<int>& key_field_ids,
+              const std::vector<int>& segment_key_field_ids,
+              const std::vector<const HashAggregateKernel*>& kernels) {
+  if (ctx->spill_threshold_bytes() <= 0 || key_field_ids.empty() ||
+      !segment_key_field_ids.empty()) {
+    return false;
+  }
+  for (const auto* kernel : kernels) {
+    if (kernel->ordered) {
+      return false;
+    }
+  }
+  for (int key_field_id : key_field_ids) {
+    if (!compute::ColumnMetadataFromDataType(input_schema.field(key_field_id)->type())
+             .ok()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// When the input is sorted on (some permutation of) the keys, each group is a run of
+// consecutive rows and the node can stream.  Returns the ordering of the output in
+// that case, in which the keys are sorted in the same way.
+std::optional<Ordering> GetStreamingOrdering(const ExecNode& input,
+                                             const std::vector<int>& key_field_ids,
+                                             bool has_segment_keys) {
+  const Ordering& input_ordering = input.ordering();
+  if (key_field_ids.empty() || has_segment_keys || input_ordering.is_implicit() ||
+      input_ordering.is_unordered()) {
+    return std::nullopt;
+  }
+  std::vector<SortKey> sort_keys = SortOptions(input_ordering).GetSortKeys();
+  if (sort_keys.size() < key_field_ids.size()) {
+    return std::nullopt;
+  }
+  std::vector<SortKey> output_sort_keys;
+  std::vector<bool> covered(key_field_ids.size(), false);
+  for (size_t i = 0; i < key_field_ids.size(); ++i) {
+    auto match = sort_keys[i].target.FindOne(*input.output_schema());
+    if (!match.ok() || match->indices().size() != 1) {
+      return std::nullopt;
+    }
+    auto it = std::find(key_field_ids.begin(), key_field_ids.end(), (*match)[0]);
+    if (it == key_field_ids.end() || covered[it - key_field_ids.begin()]) {
+      return std::nullopt;
+    }
+    // Sorting views -0.0 as 0.0 and leaves NaNs in no defined order, while the groups
+    // compare floats by their bytes, so a float group may not be a single run
+    if (is_floating(input.output_schema()->field((*match)[0])->type()->id())) {
+      return std::nullopt;
+    }
+    const int key_index = static_cast<int>(it - key_field_ids.begin());
+    covered[key_index] = true;
+    // The keys come first in the output
+    output_sort_keys.emplace_back(FieldRef(key_index), sort_keys[i].order,
+                                  sort_keys[i].null_placement);
+  }
+  return Ordering(std::move(output_sort_keys));
+}
+
+}  // namespace
+
 Status GroupByNode::Init() {
   output_task_group_id_ = plan_->query_context()->RegisterTaskGroup(
       [this](size_t, int64_t task_id) { return OutputNthBatch(task_id); },
@@ -190,15 +273,39 @@ Result<ExecNode*> GroupByNode::Make(ExecPlan* plan, std::vector<ExecNode*> input
 
   const auto& input_schema = input->output_schema();
   auto exec_ctx = plan->query_context()->exec_context();
+
+  std::vector<int> key_field_ids(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto match, keys[i].FindOne(*input_schema));
+    key_field_ids[i] = match[0];
+  }
+  std::optional<Ordering> streaming_ordering =
+      GetStreamingOrdering(*input, key_field_ids, !segment_keys.empty());
+
+  // Streaming mode sequences its input, so it can run ordered aggregates on any number
+  // of threads
   ARROW_ASSIGN_OR_RAISE(
       auto args, MakeAggregateNodeArgs(input_schema, keys, segment_keys, aggs, exec_ctx,
-                                       is_cpu_parallel));
+                                       is_cpu_parallel && !streaming_ordering));
+  bool allow_spilling =
+      !streaming_ordering &&
+      CanSpill(plan->query_context(), *input_schema, args.grouping_key_field_ids,
+               args.segment_key_field_ids, args.kernels);
+  if (streaming_ordering) {
+    std::vector<TypeHolder> key_types;
+    for (int key_field_id : key_field_ids) {
+      key_types.emplace_back(input_schema->field(key_field_id)->type());
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        args.segmenter, RowSegmenter::Make(key_types, /*nullable_keys=*/true, exec_ctx));
+  }
 
   return input->plan()->EmplaceNode<GroupByNode>(
       input, std::move(args.output_schema), std::move(args.grouping_key_field_ids),
       std::move(args.segment_key_field_ids), std::move(args.segmenter),
       std::move(args.kernel_intypes), std::move(args.target_fieldsets),
-      std::move(args.aggregates), std::move(args.kernels));
+      std::move(args.aggregates), std::move(args.kernels), allow_spilling,
+      std::move(streaming_ordering));
 }
 
 Status GroupByNode::ResetKernelStates() {
@@ -214,7 +321,10 @@ Status GroupByNode::Consume(ExecSpan batch) {
                               local_states_.size(), ")");
   }
 
-  auto state = &local_states_[thread_index];
+  return ConsumeState(&local_states_[thread_index], batch);
+}
+
+Status GroupByNode::ConsumeState(ThreadLocalState* state, const ExecSpan& batch) {
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
   // Create a batch with key columns
@@ -227,7 +337,13 @@ Status GroupByNode::Consume(ExecSpan batch) {
   // Create a batch with group ids
   ARROW_ASSIGN_OR_RAISE(Datum id_batch, state->grouper->Consume(key_batch));
 
-  // Execute aggregate kernels
+  return ConsumeAggregates(&state->agg_states, batch, ArraySpan(*id_batch.array()),
+                           state->grouper->num_groups());
+}
+
+Status GroupByNode::ConsumeAggregates(
+    std::vector<std::unique_ptr<KernelState>>* agg_states, const ExecSpan& batch,
+    const ArraySpan& group_ids, int64_t num_groups) {
   for (size_t i = 0; i < agg_kernels_.size(); ++i) {
     arrow::util::tracing::Span span;
     START_COMPUTE_SPAN(span, aggs_[i].function,
@@ -237,28 +353,30 @@ Status GroupByNode::Consume(ExecSpan batch) {
                         {"function.kind", std::string(kind_name()) + "::Consume"}});
     auto ctx = plan_->query_context()->exec_context();
     KernelContext kernel_ctx{ctx};
-    kernel_ctx.SetState(state->agg_states[i].get());
+    kernel_ctx.SetState((*agg_states)[i].get());
 
     std::vector<ExecValue> column_values;
     for (const int field : agg_src_fieldsets_[i]) {
       column_values.push_back(batch[field]);
     }
-    column_values.emplace_back(*id_batch.array());
+    column_values.emplace_back(group_ids);
     ExecSpan agg_batch(std::move(column_values), batch.length);
-    RETURN_NOT_OK(agg_kernels_[i]->resize(&kernel_ctx, state->grouper->num_groups()));
+    RETURN_NOT_OK(agg_kernels_[i]->resize(&kernel_ctx, num_groups));
     RETURN_NOT_OK(agg_kernels_[i]->consume(&kernel_ctx, agg_batch));
   }
 
   return Status::OK();
 }
 
-Status GroupByNode::Merge() {
+Status GroupByNode::Merge() { return MergeStates(&local_states_); }
+
+Status GroupByNode::MergeStates(std::vector<ThreadLocalState>* states) {
   arrow::util::tracing::Span span;
   START_COMPUTE_SPAN(span, "Merge",
                      {{"group_by", ToStringExtra(0)}, {"node.label", label()}});
-  ThreadLocalState* state0 = &local_states_[0];
-  for (size_t i = 1; i < local_states_.size(); ++i) {
-    ThreadLocalState* state = &local_states_[i];
+  ThreadLocalState* state0 = &(*states)[0];
+  for (size_t i = 1; i < states->size(); ++i) {
+    ThreadLocalState* state = &(*states)[i];
     if (!state->grouper) {
       continue;
     }
@@ -297,12 +415,13 @@ Status GroupByNode::Merge() {
   return Status::OK();
 }
 
-Result<ExecBatch> GroupByNode::Finalize() {
+Result<ExecBatch> GroupByNode::Finalize() { return FinalizeState(&local_states_[0]); }
+
+Result<ExecBatch> GroupByNode::FinalizeState(ThreadLocalState* state) {
   arrow::util::tracing::Span span;
   START_COMPUTE_SPAN(span, "Finalize",
                      {{"group_by", ToStringExtra(0)}, {"node.label", label()}});
 
-  ThreadLocalState* state = &local_states_[0];
   // If we never got any batches, then state won't have been initialized
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
@@ -342,6 +461,15 @@ Status GroupByNode::OutputNthBatch(int64_t n) {
 }
 
 Status GroupByNode::OutputResult(bool is_last) {
+  if (streaming_) {
+    DCHECK(is_last);
+    RETURN_NOT_OK(OutputStreamingGroups());
+    return output_->InputFinished(this, total_output_batches_);
+  }
+  if (spilling_) {
+    DCHECK(is_last);
+    return OutputSpilledResult();
+  }
   // To simplify merging, ensure that the first grouper is nonempty
   for (size_t i = 0; i < local_states_.size(); i++) {
     if (local_states_[i].grouper) {
@@ -373,6 +501,21 @@ Status GroupByNode::InputReceived(ExecNode* input, ExecBatch batch) {
 
   DCHECK_EQ(input, inputs_[0]);
 
+  if (streaming_) {
+    // The batches are counted once processed, as another thread may be processing
+    // the sequenced batches
+    return sequencer_->InsertBatch(std::move(batch));
+  }
+
+  if (allow_spilling_) {
+    // Spilling is only allowed without segment keys
+    ARROW_RETURN_NOT_OK(ConsumeAllowingSpill(batch));
+    if (input_counter_.Increment()) {
+      ARROW_RETURN_NOT_OK(OutputResult(/*is_last=*/true));
+    }
+    return Status::OK();
+  }
+
   auto handler = [this](const ExecBatch& full_batch, const Segment& segment) {
     if (!segment.extends && segment.offset == 0)
       RETURN_NOT_OK(OutputResult(/*is_last=*/false));
@@ -393,6 +536,388 @@ Status GroupByNode::InputReceived(ExecNode* input, ExecBatch batch) {
   return Status::OK();
 }
 
+Status GroupByNode::Process(ExecBatch batch) {
+  RETURN_NOT_OK(ConsumeStreaming(std::move(batch)));
+  if (input_counter_.Increment()) {
+    return OutputResult(/*is_last=*/true);
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::ConsumeStreaming(ExecBatch batch) {
+  if (batch.length == 0) {
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, batch.SelectValues(key_field_ids_));
+  ARROW_ASSIGN_OR_RAISE(std::vector<Segment> segments,
+                        segmenter_->GetSegments(ExecSpan(key_batch)));
+  // The last group is complete unless the batch starts with the same keys
+  if (!segments.front().extends) {
+    RETURN_NOT_OK(OutputStreamingGroups());
+  }
+  // Every segment but the last is followed by different keys, so once those are
+  // consumed all groups are complete
+  const size_t num_segments = segments.size();
+  if (num_segments > 1) {
+    RETURN_NOT_OK(ConsumeSegments(batch, key_batch, segments, 0, num_segments - 1));
+    RETURN_NOT_OK(OutputStreamingGroups());
+  }
+  return ConsumeSegments(batch, key_batch, segments, num_segments - 1, num_segments);
+}
+
+Status GroupByNode::ConsumeSegments(const ExecBatch& batch, const ExecBatch& key_batch,
+                                    const std::vector<Segment>& segments, size_t begin,
+                                    size_t end) {
+  QueryContext* ctx = plan_->query_context();
+  const int64_t offset = segments[begin].offset;
+  const int64_t length = segments[end - 1].offset + segments[end - 1].length - offset;
+
+  // Each segment is a group, or the continuation of the last one, so the group ids
+  // follow without looking up the keys
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> group_ids,
+                        AllocateBuffer(length * sizeof(uint32_t), ctx->memory_pool()));
+  auto* ids = group_ids->mutable_data_as<uint32_t>();
+  Int64Builder group_starts(ctx->memory_pool());
+  for (size_t i = begin; i < end; ++i) {
+    const Segment& segment = segments[i];
+    if (!segment.extends || streaming_num_groups_ == 0) {
+      RETURN_NOT_OK(group_starts.Append(segment.offset));
+      ++streaming_num_groups_;
+    }
+    std::fill(ids + (segment.offset - offset),
+              ids + (segment.offset - offset + segment.length),
+              static_cast<uint32_t>(streaming_num_groups_ - 1));
+  }
+
+  if (group_starts.length() > 0) {
+    const int64_t num_new_groups = group_starts.length();
+    ARROW_ASSIGN_OR_RAISE(auto indices, group_starts.Finish());
+    std::vector<Datum> new_keys(key_batch.values.size());
+    for (size_t i = 0; i < new_keys.size(); ++i) {
+      const Datum& key = key_batch.values[i];
+      if (key.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(new_keys[i], MakeArrayFromScalar(*key.scalar(),
+                                                               num_new_groups,
+                                                               ctx->memory_pool()));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(new_keys[i],
+                              compute::Take(key, indices,
+                                            compute::TakeOptions::NoBoundsCheck(),
+                                            ctx->exec_context()));
+      }
+    }
+    streaming_keys_.emplace_back(std::move(new_keys), num_new_groups);
+  }
+
+  ExecBatch rows = batch.Slice(offset, length);
+  ArrayData ids_data(uint32(), length, {nullptr, std::move(group_ids)},
+                     /*null_count=*/0);
+  return ConsumeAggregates(&streaming_states_, ExecSpan(rows), ArraySpan(ids_data),
+                           streaming_num_groups_);
+}
+
+Status GroupByNode::OutputStreamingGroups() {
+  if (streaming_num_groups_ == 0) {
+    return Status::OK();
+  }
+  ExecContext* ctx = plan_->query_context()->exec_context();
+  ExecBatch out_data{{}, streaming_num_groups_};
+  out_data.values.resize(key_field_ids_.size() + agg_kernels_.size());
+  for (size_t i = 0; i < key_field_ids_.size(); ++i) {
+    ArrayVector key_chunks;
+    for (const ExecBatch& keys : streaming_keys_) {
+      key_chunks.push_back(keys.values[i].make_array());
+    }
+    ARROW_ASSIGN_OR_RAISE(out_data.values[i],
+                          Concatenate(key_chunks, ctx->memory_pool()));
+  }
+  for (size_t i = 0; i < agg_kernels_.size(); ++i) {
+    KernelContext batch_ctx{ctx};
+    batch_ctx.SetState(streaming_states_[i].get());
+    RETURN_NOT_OK(agg_kernels_[i]->finalize(
+        &batch_ctx, &out_data.values[key_field_ids_.size() + i]));
+  }
+  ARROW_ASSIGN_OR_RAISE(streaming_states_,
+                        InitKernels(agg_kernels_, ctx, aggs_, agg_src_types_));
+  streaming_keys_.clear();
+  streaming_num_groups_ = 0;
+
+  out_data.index = total_output_batches_++;
+  return output_->InputReceived(this, std::move(out_data));
+}
+
+Status GroupByNode::ConsumeAllowingSpill(const ExecBatch& batch) {
+  if (batch.length == 0) {
+    return Status::OK();
+  }
+  QueryContext* ctx = plan_->query_context();
+  size_t thread_index = ctx->GetThreadIndex();
+  if (thread_index >= local_states_.size()) {
+    return Status::IndexError("thread index ", thread_index, " is out of range [0, ",
+                              local_states_.size(), ")");
+  }
+
+  // The size of an input row is used as a rough estimate of the size of a group
+  if (group_bytes_estimate_.load() == 0) {
+    int64_t row_bytes = std::max<int64_t>(1, batch.TotalBufferSize() / batch.length);
+    int64_t expected = 0;
+    group_bytes_estimate_.compare_exchange_strong(expected, row_bytes);
+  }
+
+  {
+    std::shared_lock<std::shared_mutex> lock(spill_switch_mutex_);
+    if (!spilling_) {
+      ThreadLocalState* state = &local_states_[thread_index];
+      int64_t groups_before = state->grouper ? state->grouper->num_groups() : 0;
+      RETURN_NOT_OK(ConsumeState(state, ExecSpan(batch)));
+      int64_t new_groups = state->grouper->num_groups() - groups_before;
+      int64_t num_groups = num_groups_.fetch_add(new_groups) + new_groups;
+      if (num_groups * group_bytes_estimate_.load() <= ctx->spill_threshold_bytes()) {
+        return Status::OK();
+      }
+      lock.unlock();
+      return StartSpilling();
+    }
+  }
+  return ConsumeResident(&local_states_[0], batch, /*level=*/0, &spill_partitions_,
+                         &spill_buffers_[thread_index]);
+}
+
+Status GroupByNode::StartSpilling() {
+  std::unique_lock<std::shared_mutex> lock(spill_switch_mutex_);
+  if (spilling_) {
+    return Status::OK();
+  }
+  // To simplify merging, ensure that the first grouper is nonempty
+  for (size_t i = 0; i < local_states_.size(); i++) {
+    if (local_states_[i].grouper) {
+      std::swap(local_states_[i], local_states_[0]);
+      break;
+    }
+  }
+  // Merging releases the other states, so only the resident one is left in memory
+  RETURN_NOT_OK(MergeStates(&local_states_));
+  spill_partitions_.resize(kNumSpillPartitions);
+  for (auto& partition : spill_partitions_) {
+    partition = std::make_unique<SpillPartition>();
+  }
+  spilling_ = true;
+  return Status::OK();
+}
+
+Status GroupByNode::ConsumeResident(ThreadLocalState* resident, const ExecBatch& batch,
+                                    int level, SpillPartitions* partitions,
+                                    SpillBuffers* buffers) {
+  if (batch.length == 0) {
+    return Status::OK();
+  }
+  QueryContext* ctx = plan_->query_context();
+  size_t thread_index = ctx->GetThreadIndex();
+  if (thread_index >= hash_stacks_.size()) {
+    return Status::IndexError("thread index ", thread_index, " is out of range [0, ",
+                              hash_stacks_.size(), ")");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto rows,
+                        batch.ToRecordBatch(inputs_[0]->output_schema(),
+                                            ctx->memory_pool()));
+
+  // Hash the keys to find the partition of each row
+  const int64_t length = batch.length;
+  std::vector<Datum> keys(key_field_ids_.size());
+  for (size_t i = 0; i < key_field_ids_.size(); ++i) {
+    keys[i] = batch.values[key_field_ids_[i]];
+  }
+  ExecBatch key_batch(std::move(keys), length);
+  std::vector<uint32_t> hashes(length);
+  std::vector<KeyColumnArray> temp_column_arrays;
+  RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes.data(), temp_column_arrays,
+                                     ctx->hardware_flags(), &hash_stacks_[thread_index],
+                                     0, length));
+
+  // The groupers take their bucket from the high bits of the same hash, so partition
+  // on the low bits first to keep the buckets well distributed
+  const int shift = level * kLogNumSpillPartitions;
+  std::vector<std::vector<int32_t>> partition_rows(kNumSpillPartitions);
+  for (int64_t i = 0; i < length; ++i) {
+    partition_rows[(hashes[i] >> shift) & (kNumSpillPartitions - 1)].push_back(
+        static_cast<int32_t>(i));
+  }
+
+  for (int i = 0; i < kNumSpillPartitions; ++i) {
+    const std::vector<int32_t>& indices = partition_rows[i];
+    if (indices.empty()) {
+      continue;
+    }
+    std::shared_ptr<RecordBatch> partition_batch = rows;
+    if (static_cast<int64_t>(indices.size()) < length) {
+      Int32Builder indices_builder(ctx->memory_pool());
+      RETURN_NOT_OK(indices_builder.AppendValues(indices));
+      ARROW_ASSIGN_OR_RAISE(auto indices_array, indices_builder.Finish());
+      ARROW_ASSIGN_OR_RAISE(Datum taken,
+                            compute::Take(rows, indices_array,
+                                          compute::TakeOptions::NoBoundsCheck(),
+                                          ctx->exec_context()));
+      partition_batch = taken.record_batch();
+    }
+
+    PendingRows* pending = &(*buffers)[i];
+    pending->batches.push_back(std::move(partition_batch));
+    pending->num_rows += static_cast<int64_t>(indices.size());
+    if (pending->num_rows >= kSpillBufferRows) {
+      RETURN_NOT_OK(HandOffRows(resident, pending, (*partitions)[i].get()));
+    }
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::HandOffRows(ThreadLocalState* resident, PendingRows* pending,
+                                SpillPartition* partition) {
+  if (pending->num_rows == 0) {
+    return Status::OK();
+  }
+  QueryContext* ctx = plan_->query_context();
+  RecordBatchVector batches = std::move(pending->batches);
+  pending->batches.clear();
+  pending->num_rows = 0;
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                        ConcatenateRecordBatches(batches, ctx->memory_pool()));
+  batches.clear();
+  ExecBatch batch(*record_batch);
+
+  Int32Builder new_rows(ctx->memory_pool());
+  {
+    std::lock_guard<std::mutex> lock(resident_mutex_);
+    RETURN_NOT_OK(InitLocalStateIfNeeded(resident));
+    ExecSpan rows(batch);
+    std::vector<ExecValue> keys(key_field_ids_.size());
+    for (size_t i = 0; i < key_field_ids_.size(); ++i) {
+      keys[i] = rows[key_field_ids_[i]];
+    }
+    ExecSpan key_batch(std::move(keys), batch.length);
+
+    // The ids of the groups not held by the resident state are null
+    ARROW_ASSIGN_OR_RAISE(Datum ids, resident->grouper->Lookup(key_batch));
+    const ArrayData& ids_data = *ids.array();
+    const int64_t num_groups = resident->grouper->num_groups();
+    if (ids_data.GetNullCount() == 0) {
+      return ConsumeAggregates(&resident->agg_states, rows, ArraySpan(ids_data),
+                               num_groups);
+    }
+    Int32Builder old_rows(ctx->memory_pool());
+    for (int64_t i = 0; i < batch.length; ++i) {
+      RETURN_NOT_OK(ids_data.IsValid(i) ? old_rows.Append(static_cast<int32_t>(i))
+                                        : new_rows.Append(static_cast<int32_t>(i)));
+    }
+    if (old_rows.length() > 0) {
+      ARROW_ASSIGN_OR_RAISE(auto old_indices, old_rows.Finish());
+      ARROW_ASSIGN_OR_RAISE(Datum old_batch,
+                            compute::Take(record_batch, old_indices,
+                                          compute::TakeOptions::NoBoundsCheck(),
+                                          ctx->exec_context()));
+      ARROW_ASSIGN_OR_RAISE(Datum old_ids,
+                            compute::Take(ids, old_indices,
+                                          compute::TakeOptions::NoBoundsCheck(),
+                                          ctx->exec_context()));
+      RETURN_NOT_OK(ConsumeAggregates(&resident->agg_states,
+                                      ExecSpan(ExecBatch(*old_batch.record_batch())),
+                                      ArraySpan(*old_ids.array()), num_groups));
+    }
+  }
+
+  std::shared_ptr<RecordBatch> spilled = record_batch;
+  if (new_rows.length() < batch.length) {
+    ARROW_ASSIGN_OR_RAISE(auto new_indices, new_rows.Finish());
+    ARROW_ASSIGN_OR_RAISE(Datum new_batch,
+                          compute::Take(record_batch, new_indices,
+                                        compute::TakeOptions::NoBoundsCheck(),
+                                        ctx->exec_context()));
+    spilled = new_batch.record_batch();
+  }
+
+  std::lock_guard<std::mutex> lock(partition->mutex);
+  if (!partition->file) {
+    ARROW_ASSIGN_OR_RAISE(
+        partition->file,
+        SpillFile::Make(ctx, inputs_[0]->output_schema(), "group_by", profiler()));
+  }
+  return partition->file->Write(*spilled);
+}
+
+Status GroupByNode::FlushSpillBuffers(ThreadLocalState* resident, SpillBuffers* buffers,
+                                      SpillPartitions* partitions) {
+  for (int i = 0; i < kNumSpillPartitions; ++i) {
+    RETURN_NOT_OK(HandOffRows(resident, &(*buffers)[i], (*partitions)[i].get()));
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::OutputState(ThreadLocalState* state) {
+  ARROW_ASSIGN_OR_RAISE(ExecBatch out_data, FinalizeState(state));
+  int64_t batch_size = output_batch_size();
+  int64_t num_output_batches = bit_util::CeilDiv(out_data.length, batch_size);
+  for (int64_t i = 0; i < num_output_batches; ++i) {
+    RETURN_NOT_OK(
+        output_->InputReceived(this, out_data.Slice(batch_size * i, batch_size)));
+  }
+  total_output_batches_ += static_cast<int>(num_output_batches);
+  return Status::OK();
+}
+
+Status GroupByNode::OutputSpilledResult() {
+  for (auto& buffers : spill_buffers_) {
+    RETURN_NOT_OK(FlushSpillBuffers(&local_states_[0], &buffers, &spill_partitions_));
+  }
+  // The resident groups are complete, as the rows of any other group were spilled
+  RETURN_NOT_OK(OutputState(&local_states_[0]));
+  RETURN_NOT_OK(OutputSpilledPartitions(&spill_partitions_, /*level=*/0));
+  return output_->InputFinished(this, total_output_batches_);
+}
+
+Status GroupByNode::OutputSpilledPartitions(SpillPartitions* partitions, int level) {
+  for (auto& partition : *partitions) {
+    if (partition->file) {
+      RETURN_NOT_OK(OutputSpilledFile(partition->file.get(), level + 1));
+    }
+    // Deletes the spill file
+    partition.reset();
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::OutputSpilledFile(SpillFile* file, int level) {
+  RETURN_NOT_OK(file->Finish());
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> reader, file->OpenReader());
+  const int64_t threshold = plan_->query_context()->spill_threshold_bytes();
+  ThreadLocalState state;
+  SpillPartitions partitions;
+  SpillBuffers buffers;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> spilled, reader->Next());
+    if (!spilled) break;
+    ExecBatch batch(*spilled);
+    if (!partitions.empty()) {
+      RETURN_NOT_OK(ConsumeResident(&state, batch, level, &partitions, &buffers));
+      continue;
+    }
+    RETURN_NOT_OK(ConsumeState(&state, ExecSpan(batch)));
+    // Groups which still don't fit are partitioned again, on the next bits of the hash
+    if (level <= kMaxSpillLevel &&
+        state.grouper->num_groups() * group_bytes_estimate_.load() > threshold) {
+      partitions.resize(kNumSpillPartitions);
+      for (auto& partition : partitions) {
+        partition = std::make_unique<SpillPartition>();
+      }
+      buffers.resize(kNumSpillPartitions);
+    }
+  }
+  reader.reset();
+  if (!partitions.empty()) {
+    RETURN_NOT_OK(FlushSpillBuffers(&state, &buffers, &partitions));
+  }
+  RETURN_NOT_OK(OutputState(&state));
+  return OutputSpilledPartitions(&partitions, level);
+}
+
 Status GroupByNode::InputFinished(ExecNode* input, int total_batches) {
   auto scope = TraceFinish();
   DCHECK_EQ(input, inputs_[0]);
@@ -416,6 +941,27 @@ std::string GroupByNode::ToStringExtra(int indent) const {
   return ss.str();
 }
 
+Status GroupByNode::StartProducing() {
+  NoteStartProducing(ToStringExtra(0));
+  QueryContext* ctx = plan_->query_context();
+  size_t max_concurrency = ctx->max_concurrency();
+  local_states_.resize(max_concurrency);
+  if (streaming_) {
+    sequencer_ = util::SerialSequencingQueue::Make(this);
+    ARROW_ASSIGN_OR_RAISE(
+        streaming_states_,
+        InitKernels(agg_kernels_, ctx->exec_context(), aggs_, agg_src_types_));
+  }
+  if (allow_spilling_) {
+    hash_stacks_.resize(max_concurrency);
+    for (auto& stack : hash_stacks_) {
+      RETURN_NOT_OK(stack.Init(ctx->memory_pool(), Hashing32::kHashBatchTempStackUsage));
+    }
+    spill_buffers_.assign(max_concurrency, SpillBuffers(kNumSpillPartitions));
+  }
+  return Status::OK();
+}
+
 Status GroupByNode::InitLocalStateIfNeeded(ThreadLocalState* state) {
   // Get input schema
   auto input_schema = inputs_[0]->output_schema();
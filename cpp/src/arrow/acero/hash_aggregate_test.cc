@@ -2426,6 +2426,153 @@ TEST_P(GroupBy, CountDistinct) {
   }
 }
 
+TEST_P(GroupBy, ApproxCountDistinct) {
+  auto only_valid = std::make_shared<CountOptions>(CountOptions::ONLY_VALID);
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+
+    auto table =
+        TableFromJSON(schema({field("argument", utf8()), field("key", int64())}), {R"([
+    ["foo",  1],
+    ["foo",  1]
+])",
+                                                                                   R"([
+    ["bar",  2],
+    [null,   3],
+    [null,   3]
+])",
+                                                                                   R"([
+    [null, 4],
+    [null, 4]
+])",
+                                                                                   R"([
+    ["baz",  null],
+    ["foo",  3]
+])",
+                                                                                   R"([
+    ["quux", 2],
+    ["bar",  2]
+])",
+                                                                                   R"([
+    ["spam", null],
+    ["eggs", 3]
+])"});
+
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        AltGroupBy(
+            {
+                table->GetColumnByName("argument"),
+                table->GetColumnByName("argument"),
+            },
+            {
+                table->GetColumnByName("key"),
+            },
+            {},
+            {
+                {"hash_approx_count_distinct", nullptr, "agg_0",
+                 "hash_approx_count_distinct"},
+                {"hash_count_distinct", only_valid, "agg_1", "hash_count_distinct"},
+            },
+            use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    ValidateOutput(aggregated_and_grouped);
+
+    // The estimates of small distinct counts are exact
+    const auto& result = aggregated_and_grouped.array_as<StructArray>();
+    AssertArraysEqual(*result->field(2), *result->field(1), /*verbose=*/true);
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, 2, 0, 2]"), *result->field(1),
+                      /*verbose=*/true);
+  }
+}
+
+TEST_P(GroupBy, Sketches) {
+  auto tdigest_options =
+      std::make_shared<TDigestOptions>(std::vector<double>{0.25, 0.75});
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+
+    auto table =
+        TableFromJSON(schema({field("argument", float64()), field("key", int64())}), {R"([
+    [1.0,  1],
+    [null, 1]
+])",
+                                                                                     R"([
+    [0.0,   2],
+    [null,  3],
+    [4.0,   null],
+    [3.25,  1]
+])",
+                                                                                     R"([
+    [0.125, 2],
+    [-0.25, 2],
+    [0.75,  null],
+    [4.0,   3],
+    [0.0,   2]
+])"});
+
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        AltGroupBy(
+            {
+                table->GetColumnByName("argument"),
+                table->GetColumnByName("argument"),
+                table->GetColumnByName("argument"),
+                table->GetColumnByName("argument"),
+            },
+            {table->GetColumnByName("key")}, {},
+            {
+                {"hash_tdigest_sketch", tdigest_options, "agg_0", "hash_tdigest_sketch"},
+                {"hash_tdigest", tdigest_options, "agg_1", "hash_tdigest"},
+                {"hash_hll_sketch", nullptr, "agg_2", "hash_hll_sketch"},
+                {"hash_approx_count_distinct", nullptr, "agg_3",
+                 "hash_approx_count_distinct"},
+            },
+            use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    ValidateOutput(aggregated_and_grouped);
+    const auto& result = aggregated_and_grouped.array_as<StructArray>();
+
+    // The sketches give the same results as the aggregations they approximate
+    ASSERT_OK_AND_ASSIGN(Datum quantiles,
+                         CallFunction("tdigest_quantile", {result->field(0)},
+                                      tdigest_options.get()));
+    AssertArraysApproxEqual(*result->field(1), *quantiles.make_array(),
+                            /*verbose=*/true);
+    ASSERT_OK_AND_ASSIGN(Datum estimates,
+                         CallFunction("hll_estimate", {result->field(2)}));
+    AssertArraysEqual(*result->field(3), *estimates.make_array(), /*verbose=*/true);
+
+    // Merging the sketches of all the groups gives the sketches of all the values
+    ASSERT_OK_AND_ASSIGN(auto all_keys,
+                         MakeArrayFromScalar(Int64Scalar(0), result->length()));
+    ASSERT_OK_AND_ASSIGN(
+        Datum merged,
+        AltGroupBy({result->field(0), result->field(2)}, {all_keys}, {},
+                   {
+                       {"hash_tdigest_merge", tdigest_options, "agg_0",
+                        "hash_tdigest_merge"},
+                       {"hash_hll_merge", nullptr, "agg_1", "hash_hll_merge"},
+                   },
+                   use_threads));
+    ValidateOutput(merged);
+    const auto& merged_result = merged.array_as<StructArray>();
+    ASSERT_OK_AND_ASSIGN(Datum all_quantiles,
+                         TDigest(table->GetColumnByName("argument"), *tdigest_options));
+    ASSERT_OK_AND_ASSIGN(Datum merged_quantiles,
+                         CallFunction("tdigest_quantile", {merged_result->field(0)},
+                                      tdigest_options.get()));
+    AssertArraysApproxEqual(
+        *all_quantiles.make_array(),
+        *merged_quantiles.array_as<FixedSizeListArray>()->value_slice(0),
+        /*verbose=*/true);
+    ASSERT_OK_AND_ASSIGN(Datum merged_estimate,
+                         CallFunction("hll_estimate", {merged_result->field(1)}));
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[7]"), *merged_estimate.make_array(),
+                      /*verbose=*/true);
+  }
+}
+
 TEST_P(GroupBy, Distinct) {
   auto all = std::make_shared<CountOptions>(CountOptions::ALL);
   auto only_valid = std::make_shared<CountOptions>(CountOptions::ONLY_VALID);
@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_set>
@@ -26,9 +28,16 @@
 #include "arrow/acero/hash_join_dict.h"
 #include "arrow/acero/hash_join_node.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/schema_util.h"
+#include "arrow/acero/spill_util_internal.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/key_hash_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging_internal.h"
@@ -62,6 +71,74 @@ Status ValidateHashJoinNodeOptions(const HashJoinNodeOptions& join_options) {
   return Status::OK();
 }
 
+// Spilled batches are written in the IPC format, which only gives back extension types
+// that are registered, so inputs with extension types are always kept in memory.
+bool CanSpill(QueryContext* ctx, const Schema& left_schema, const Schema& right_schema) {
+  if (ctx->spill_threshold_bytes() <= 0) {
+    return false;
+  }
+  for (const Schema* schema : {&left_schema, &right_schema}) {
+    for (const auto& field : schema->fields()) {
+      if (field->type()->id() == Type::EXTENSION) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// A spilling join partitions both of its inputs on the low bits of the 32-bit hash of
+// their keys, the same hash that its Bloom filter is built from
+constexpr int kLogNumSpillPartitions = 4;
+constexpr int kNumSpillPartitions = 1 << kLogNumSpillPartitions;
+
+// The join type to use when the left and right inputs are swapped
+JoinType SwapJoinSides(JoinType join_type) {
+  switch (join_type) {
+    case JoinType::LEFT_SEMI:
+      return JoinType::RIGHT_SEMI;
+    case JoinType::RIGHT_SEMI:
+      return JoinType::LEFT_SEMI;
+    case JoinType::LEFT_ANTI:
+      return JoinType::RIGHT_ANTI;
+    case JoinType::RIGHT_ANTI:
+      return JoinType::LEFT_ANTI;
+    case JoinType::LEFT_OUTER:
+      return JoinType::RIGHT_OUTER;
+    case JoinType::RIGHT_OUTER:
+      return JoinType::LEFT_OUTER;
+    case JoinType::INNER:
+    case JoinType::FULL_OUTER:
+      break;
+  }
+  return join_type;
+}
+
+// Rewrites the field indices of a filter on the left input followed by the right input
+// so that the filter applies to the right input followed by the left input.  Fields
+// referenced by name need no change.
+Expression SwapFilterSides(const Expression& filter, int left_num_fields,
+                           int right_num_fields) {
+  if (const Expression::Call* c = filter.call()) {
+    std::vector<Expression> args = c->arguments;
+    for (auto& arg : args) {
+      arg = SwapFilterSides(arg, left_num_fields, right_num_fields);
+    }
+    return call(c->function_name, std::move(args), c->options);
+  } else if (const FieldRef* r = filter.field_ref()) {
+    if (const FieldPath* path = r->field_path()) {
+      auto indices = path->indices();
+      if (indices[0] < left_num_fields) {
+        indices[0] += right_num_fields;
+      } else {
+        indices[0] -= left_num_fields;
+      }
+      return field_ref({std::move(indices)});
+    }
+  }
+  return filter;
+}
+
 }  // namespace
 
 // Check if a type is supported in a join (as either a key or non-key column)
@@ -502,6 +579,11 @@ class HashJoinNode;
 // pushdown target. Once a join has received all of its Bloom filters, it will evaluate it
 // on every batch that has been queued so far as well as any new probe-side batch that
 // comes in.
+//
+// If the probe side of the pushdown target is fed, possibly through filter nodes, by a
+// RuntimeFilterReceiver (e.g. a dataset scan) then the Bloom filter is also published
+// to it as a RuntimeFilter, along with the range of each key on the build side. The
+// receiver does not wait for it and may use it to skip data it has not read yet.
 struct BloomFilterPushdownContext {
   using RegisterTaskGroupCallback = std::function<int(
       std::function<Status(size_t, int64_t)>, std::function<Status(size_t)>)>;
@@ -524,18 +606,27 @@ struct BloomFilterPushdownContext {
   Status BuildBloomFilter(size_t thread_index, AccumulationQueue batches,
                           BuildFinishedCallback on_finished);
 
+  // Sets the bitmask of the partitions that the build side spilled, which must be
+  // called before BuildBloomFilter. The Bloom filter is then built from the other
+  // partitions only, and the rows of the spilled ones pass it.
+  void SetSpilledPartitions(uint32_t spilled_partitions) {
+    push_.spilled_partitions_ = spilled_partitions;
+  }
+
   // Sends the Bloom filter to the pushdown target.
   Status PushBloomFilter(size_t thread_index);
 
-  // Receives a Bloom filter and its associated column map.
+  // Receives a Bloom filter and its associated column map, along with the bitmask of
+  // the spilled partitions whose rows the filter doesn't cover.
   Status ReceiveBloomFilter(size_t thread_index,
-                            std::unique_ptr<BlockedBloomFilter> filter,
-                            std::vector<int> column_map) {
+                            std::shared_ptr<BlockedBloomFilter> filter,
+                            std::vector<int> column_map, uint32_t spilled_partitions) {
     bool proceed;
     {
       std::lock_guard<std::mutex> guard(eval_.receive_mutex_);
       eval_.received_filters_.emplace_back(std::move(filter));
       eval_.received_maps_.emplace_back(std::move(column_map));
+      eval_.received_spilled_partitions_.push_back(spilled_partitions);
       proceed = eval_.num_expected_bloom_filters_ == eval_.received_filters_.size();
 
       ARROW_DCHECK_EQ(eval_.received_filters_.size(), eval_.received_maps_.size());
@@ -594,6 +685,14 @@ struct BloomFilterPushdownContext {
 
       eval_.received_filters_[ifilter]->Find(ctx_->cpu_info()->hardware_flags(),
                                              key_batch.length, hashes.data(), bv.data());
+      uint32_t spilled_partitions = eval_.received_spilled_partitions_[ifilter];
+      if (spilled_partitions != 0) {
+        for (int64_t i = 0; i < key_batch.length; i++) {
+          if (spilled_partitions & (1u << (hashes[i] & (kNumSpillPartitions - 1)))) {
+            bit_util::SetBit(bv.data(), i);
+          }
+        }
+      }
       arrow::internal::BitmapAnd(bv.data(), 0, selected.data(), 0, key_batch.length, 0,
                                  selected.data());
     }
@@ -637,6 +736,15 @@ struct BloomFilterPushdownContext {
   // the disable_bloom_filter_ flag.
   std::pair<HashJoinNode*, std::vector<int>> GetPushdownTarget(HashJoinNode* start);
 
+  // Finds the node to publish a RuntimeFilter to, upstream of the pushdown target. The
+  // second part of the pair maps key i to its index in the receiver's output. Returns
+  // nullptr if there is no such node.
+  std::pair<RuntimeFilterReceiver*, std::vector<int>> GetRuntimeFilterTarget(
+      HashJoinNode* owner);
+
+  // Computes the range of each build-side key, for the runtime filter.
+  Status ComputeKeyRanges();
+
   StartTaskGroupCallback start_task_group_callback_;
   bool disable_bloom_filter_;
   HashJoinSchema* schema_mgr_;
@@ -650,17 +758,24 @@ struct BloomFilterPushdownContext {
   } build_;
 
   struct {
-    std::unique_ptr<BlockedBloomFilter> bloom_filter_;
+    std::shared_ptr<BlockedBloomFilter> bloom_filter_;
     HashJoinNode* pushdown_target_;
     std::vector<int> column_map_;
+    RuntimeFilterReceiver* runtime_filter_target_ = NULLPTR;
+    std::vector<int> runtime_filter_key_ids_;
+    std::vector<std::shared_ptr<Scalar>> min_values_;
+    std::vector<std::shared_ptr<Scalar>> max_values_;
+    bool build_side_empty_ = false;
+    uint32_t spilled_partitions_ = 0;
   } push_;
 
   struct {
     int task_id_;
     size_t num_expected_bloom_filters_ = 0;
     std::mutex receive_mutex_;
-    std::vector<std::unique_ptr<BlockedBloomFilter>> received_filters_;
+    std::vector<std::shared_ptr<BlockedBloomFilter>> received_filters_;
     std::vector<std::vector<int>> received_maps_;
+    std::vector<uint32_t> received_spilled_partitions_;
     AccumulationQueue batches_;
     FiltersReceivedCallback all_received_callback_;
     FilterFinishedCallback on_finished_;
@@ -676,6 +791,97 @@ struct BloomFilterPushdownContext {
   std::vector<ThreadLocalData> tld_;
 };
 
+// This is a struct encapsulating the hybrid (grace) hash join used when the build side
+// does not fit in QueryOptions::spill_threshold_bytes. The build side is accumulated as
+// usual until it exceeds the threshold. From then on build-side rows are partitioned by
+// a hash of their keys and, whenever the partitions held in memory exceed the threshold,
+// the largest of them is written to a spill file. Every later row of either side that
+// falls into a spilled partition is written to that partition's files as well. The
+// partitions left in memory are joined by the node's own HashJoinImpl, as if they were
+// the whole build side. Once that is done, each spilled partition is joined by a task
+// of its own with a new HashJoinImpl, after splitting it again if it is still too big.
+struct HashJoinSpillContext {
+  Status Init(HashJoinNode* owner, size_t num_threads);
+
+  // Accumulates a build-side batch, spilling partitions if the threshold is exceeded.
+  Status AddBuildBatch(size_t thread_index, ExecBatch batch);
+
+  // Returns the build-side batches of the partitions that stayed in memory.
+  Result<AccumulationQueue> FinishBuild();
+
+  // Moves the rows of a probe-side batch that belong to spilled partitions to their
+  // partitions' spill files, leaving only the rows to be probed in memory.
+  Status SpillProbeRows(size_t thread_index, ExecBatch* batch);
+
+  bool has_spilled() const { return spilled_partitions_.load() != 0; }
+
+  // The bitmask of the spilled partitions, which is final once the build side is done
+  uint32_t spilled_partitions() const { return spilled_partitions_.load(); }
+
+  // Starts joining the spilled partitions, one task per partition, then finishes the
+  // node's output once all of them are done.  `num_in_memory_batches` is the number of
+  // batches output while joining the partitions kept in memory.
+  Status JoinSpilledPartitions(int64_t num_in_memory_batches);
+
+ private:
+  static constexpr int kLogNumPartitions = kLogNumSpillPartitions;
+  static constexpr int kNumPartitions = kNumSpillPartitions;
+  // Spilled partitions that are still too big to be joined in memory are split on the
+  // next bits of the hash, up to this many times.  The swiss table takes its buckets
+  // from the high bits of the same hash, so partitions use the low bits.
+  static constexpr int kMaxSplits = 3;
+
+  struct Partition {
+    AccumulationQueue build_batches;
+    int64_t build_bytes = 0;
+    std::unique_ptr<SpillFile> build_file;
+    std::mutex probe_mutex;
+    std::unique_ptr<SpillFile> probe_file;
+  };
+
+  using PartitionedBatch = std::vector<std::shared_ptr<RecordBatch>>;
+
+  // Splits a batch of the given side (0 for probe, 1 for build) by partition, using the
+  // hash bits for the given split level. Partitions with no rows get a null batch.
+  Result<PartitionedBatch> PartitionBatch(size_t thread_index, int side, int level,
+                                          const ExecBatch& batch);
+  Status HashKeys(size_t thread_index, int side, const ExecBatch& batch,
+                  std::vector<uint32_t>* hashes);
+  Result<std::shared_ptr<RecordBatch>> TakeRows(int side, const ExecBatch& batch,
+                                                const std::vector<int32_t>& row_ids);
+
+  Status AddPartitionedBuildBatchLocked(PartitionedBatch batch);
+  Status SpillPartitionsLocked();
+
+  Status JoinSpilledPartition(size_t thread_index, int64_t task_id);
+  Status JoinPartition(size_t thread_index, int level,
+                       std::unique_ptr<SpillFile> build_file,
+                       std::unique_ptr<SpillFile> probe_file);
+  Status JoinPartitionInMemory(size_t thread_index, const SpillFile* build_file,
+                               const SpillFile* probe_file);
+
+  HashJoinNode* owner_;
+  QueryContext* ctx_;
+  size_t num_threads_;
+  int64_t threshold_;
+  std::shared_ptr<Schema> schemas_[2];
+
+  std::mutex build_mutex_;
+  bool partitioned_ = false;
+  AccumulationQueue unpartitioned_batches_;
+  int64_t in_memory_bytes_ = 0;
+  Partition partitions_[kNumPartitions];
+  std::atomic<uint32_t> spilled_partitions_{0};
+
+  int task_group_join_;
+  // The indices of the spilled partitions, one per task of task_group_join_
+  std::vector<int> spilled_ids_;
+  int64_t num_in_memory_batches_ = 0;
+  std::atomic<int64_t> num_output_batches_{0};
+
+  std::vector<arrow::util::TempVectorStack> stacks_;
+};
+
 bool HashJoinSchema::HasDictionaries() const {
   for (int side = 0; side <= 1; ++side) {
     for (int icol = 0; icol < proj_maps[side].num_cols(HashJoinProjection::INPUT);
@@ -709,7 +915,9 @@ class HashJoinNode : public ExecNode, public TracedNode {
   HashJoinNode(ExecPlan* plan, NodeVector inputs, const HashJoinNodeOptions& join_options,
                std::shared_ptr<Schema> output_schema,
                std::unique_ptr<HashJoinSchema> schema_mgr, Expression filter,
-               std::unique_ptr<HashJoinImpl> impl)
+               std::unique_ptr<HashJoinImpl> impl, bool allow_spilling,
+               std::unique_ptr<HashJoinSchema> swapped_schema_mgr,
+               Expression swapped_filter, std::unique_ptr<HashJoinImpl> swapped_impl)
       : ExecNode(plan, std::move(inputs), {"left", "right"},
                  /*output_schema=*/std::move(output_schema)),
         TracedNode(this),
@@ -718,7 +926,17 @@ class HashJoinNode : public ExecNode, public TracedNode {
         filter_(std::move(filter)),
         schema_mgr_(std::move(schema_mgr)),
         impl_(std::move(impl)),
-        disable_bloom_filter_(join_options.disable_bloom_filter) {
+        allow_spilling_(allow_spilling),
+        swapped_schema_mgr_(std::move(swapped_schema_mgr)),
+        swapped_filter_(std::move(swapped_filter)),
+        swapped_impl_(std::move(swapped_impl)),
+        choose_build_side_(swapped_impl_ != nullptr),
+        num_right_output_columns_(
+            schema_mgr_->proj_maps[1].num_cols(HashJoinProjection::OUTPUT)),
+        build_side_chosen_(!choose_build_side_),
+        // When the build side is chosen at runtime, the other joins can't be told
+        // which side the filter applies to.
+        disable_bloom_filter_(join_options.disable_bloom_filter || choose_build_side_) {
     complete_.store(false);
   }
 
@@ -776,9 +994,51 @@ class HashJoinNode : public ExecNode, public TracedNode {
       ARROW_ASSIGN_OR_RAISE(impl, HashJoinImpl::MakeBasic());
     }
 
+    // To choose the build side at runtime, the join is also set up with the inputs
+    // swapped.  A filter which is already bound can't be swapped.
+    std::unique_ptr<HashJoinSchema> swapped_schema_mgr;
+    Expression swapped_filter;
+    std::unique_ptr<HashJoinImpl> swapped_impl;
+    if (join_options.choose_build_side && !join_options.filter.IsBound()) {
+      swapped_schema_mgr = std::make_unique<HashJoinSchema>();
+      JoinType swapped_join_type = SwapJoinSides(join_options.join_type);
+      Expression filter_to_swap =
+          SwapFilterSides(join_options.filter, left_schema.num_fields(),
+                          right_schema.num_fields());
+      if (join_options.output_all) {
+        RETURN_NOT_OK(swapped_schema_mgr->Init(
+            swapped_join_type, right_schema, join_options.right_keys, left_schema,
+            join_options.left_keys, filter_to_swap, join_options.output_suffix_for_right,
+            join_options.output_suffix_for_left));
+      } else {
+        RETURN_NOT_OK(swapped_schema_mgr->Init(
+            swapped_join_type, right_schema, join_options.right_keys,
+            join_options.right_output, left_schema, join_options.left_keys,
+            join_options.left_output, filter_to_swap,
+            join_options.output_suffix_for_right, join_options.output_suffix_for_left));
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          swapped_filter,
+          swapped_schema_mgr->BindFilter(std::move(filter_to_swap), right_schema,
+                                         left_schema,
+                                         plan->query_context()->exec_context()));
+      if (use_swiss_join) {
+        ARROW_ASSIGN_OR_RAISE(swapped_impl, HashJoinImpl::MakeSwiss());
+      } else {
+        ARROW_ASSIGN_OR_RAISE(swapped_impl, HashJoinImpl::MakeBasic());
+      }
+    }
+
+    // Only the swiss join can be used on the spilled partitions, and only if the build
+    // side is known in advance
+    bool allow_spilling = use_swiss_join && swapped_impl == nullptr &&
+                          CanSpill(plan->query_context(), left_schema, right_schema);
+
     return plan->EmplaceNode<HashJoinNode>(
         plan, inputs, join_options, std::move(output_schema), std::move(schema_mgr),
-        std::move(filter), std::move(impl));
+        std::move(filter), std::move(impl), allow_spilling,
+        std::move(swapped_schema_mgr), std::move(swapped_filter),
+        std::move(swapped_impl));
   }
 
   const char* kind_name() const override { return "HashJoinNode"; }
@@ -787,12 +1047,19 @@ class HashJoinNode : public ExecNode, public TracedNode {
     if (batch.length == 0) {
       return Status::OK();
     }
+    if (allow_spilling_) {
+      return spill_context_.AddBuildBatch(thread_index, std::move(batch));
+    }
     std::lock_guard<std::mutex> guard(build_side_mutex_);
     build_accumulator_.InsertBatch(std::move(batch));
     return Status::OK();
   }
 
   Status OnBuildSideFinished(size_t thread_index) {
+    if (allow_spilling_) {
+      ARROW_ASSIGN_OR_RAISE(build_accumulator_, spill_context_.FinishBuild());
+      pushdown_context_.SetSpilledPartitions(spill_context_.spilled_partitions());
+    }
     return pushdown_context_.BuildBloomFilter(
         thread_index, std::move(build_accumulator_),
         [this](size_t thread_index, AccumulationQueue batches) {
@@ -821,6 +1088,18 @@ class HashJoinNode : public ExecNode, public TracedNode {
   }
 
   Status OnProbeSideBatch(size_t thread_index, ExecBatch batch) {
+    if (allow_spilling_ && spill_context_.has_spilled()) {
+      // Don't queue rows which are already known to belong to spilled partitions
+      bool queue_batch;
+      {
+        std::lock_guard<std::mutex> guard(probe_side_mutex_);
+        queue_batch = !hash_table_ready_;
+      }
+      if (queue_batch) {
+        RETURN_NOT_OK(spill_context_.SpillProbeRows(thread_index, &batch));
+        if (batch.length == 0) return Status::OK();
+      }
+    }
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
       if (!bloom_filters_ready_) {
@@ -837,8 +1116,16 @@ class HashJoinNode : public ExecNode, public TracedNode {
         return Status::OK();
       }
     }
-    RETURN_NOT_OK(impl_->ProbeSingleBatch(thread_index, std::move(batch)));
-    return Status::OK();
+    return ProbeBatch(thread_index, std::move(batch));
+  }
+
+  Status ProbeBatch(size_t thread_index, ExecBatch batch) {
+    if (allow_spilling_ && spill_context_.has_spilled()) {
+      // The set of spilled partitions is final once the hash table is built
+      RETURN_NOT_OK(spill_context_.SpillProbeRows(thread_index, &batch));
+      if (batch.length == 0) return Status::OK();
+    }
+    return impl_->ProbeSingleBatch(thread_index, std::move(batch));
   }
 
   Status OnProbeSideFinished(size_t thread_index) {
@@ -899,8 +1186,74 @@ class HashJoinNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
+  Status OnInputBatch(size_t thread_index, int side, ExecBatch batch) {
+    if (side == build_input_) {
+      return OnBuildSideBatch(thread_index, std::move(batch));
+    }
+    return OnProbeSideBatch(thread_index, std::move(batch));
+  }
+
+  Status OnInputFinished(size_t thread_index, int side) {
+    if (side == build_input_) {
+      return OnBuildSideFinished(thread_index);
+    }
+    return OnProbeSideFinished(thread_index);
+  }
+
+  // Called with choose_side_mutex_ held whenever a batch or the batch count of an
+  // input is buffered.  Once an input is complete and the other one is known to have
+  // at least as many rows, builds from the smaller one and replays the buffered
+  // batches.
+  Status MaybeChooseBuildSide(size_t thread_index, std::unique_lock<std::mutex> guard) {
+    bool finished[2];
+    int64_t num_rows[2];
+    for (int side = 0; side < 2; ++side) {
+      finished[side] = sampled_total_batches_[side] >= 0 &&
+                       static_cast<int>(sampled_batches_[side].batch_count()) ==
+                           sampled_total_batches_[side];
+      num_rows[side] = sampled_batches_[side].row_count();
+    }
+    int build_input;
+    if (finished[1] && (finished[0] || num_rows[0] >= num_rows[1])) {
+      build_input = 1;
+    } else if (finished[0] && (finished[1] || num_rows[1] > num_rows[0])) {
+      build_input = 0;
+    } else {
+      return Status::OK();
+    }
+
+    build_side_chosen_ = true;
+    if (build_input == 0) {
+      // The swapped join outputs the columns of the right input first, see
+      // OutputSwappedBatch
+      std::swap(schema_mgr_, swapped_schema_mgr_);
+      std::swap(impl_, swapped_impl_);
+      join_type_ = SwapJoinSides(join_type_);
+      build_input_ = 0;
+    }
+    AccumulationQueue batches[2] = {std::move(sampled_batches_[0]),
+                                    std::move(sampled_batches_[1])};
+    const int total_batches[2] = {sampled_total_batches_[0], sampled_total_batches_[1]};
+    guard.unlock();
+
+    // Batches of either input received from now on are counted right away, so those
+    // buffered are only counted once they have been passed on
+    for (int side : {build_input, 1 - build_input}) {
+      for (size_t i = 0; i < batches[side].batch_count(); ++i) {
+        RETURN_NOT_OK(OnInputBatch(thread_index, side, std::move(batches[side][i])));
+        if (batch_count_[side].Increment()) {
+          RETURN_NOT_OK(OnInputFinished(thread_index, side));
+        }
+      }
+      if (total_batches[side] >= 0 && batch_count_[side].SetTotal(total_batches[side])) {
+        RETURN_NOT_OK(OnInputFinished(thread_index, side));
+      }
+    }
+    return Status::OK();
+  }
+
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(batch, input);
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
     if (complete_.load()) {
       return Status::OK();
@@ -909,18 +1262,18 @@ class HashJoinNode : public ExecNode, public TracedNode {
     size_t thread_index = plan_->query_context()->GetThreadIndex();
     int side = (input == inputs_[0]) ? 0 : 1;
 
-    if (side == 0) {
-      ARROW_RETURN_NOT_OK(OnProbeSideBatch(thread_index, std::move(batch)));
-    } else {
-      ARROW_RETURN_NOT_OK(OnBuildSideBatch(thread_index, std::move(batch)));
+    if (choose_build_side_) {
+      std::unique_lock<std::mutex> guard(choose_side_mutex_);
+      if (!build_side_chosen_) {
+        sampled_batches_[side].InsertBatch(std::move(batch));
+        return MaybeChooseBuildSide(thread_index, std::move(guard));
+      }
     }
 
+    ARROW_RETURN_NOT_OK(OnInputBatch(thread_index, side, std::move(batch)));
+
     if (batch_count_[side].Increment()) {
-      if (side == 0) {
-        return OnProbeSideFinished(thread_index);
-      } else {
-        return OnBuildSideFinished(thread_index);
-      }
+      return OnInputFinished(thread_index, side);
     }
     return Status::OK();
   }
@@ -930,13 +1283,17 @@ class HashJoinNode : public ExecNode, public TracedNode {
     size_t thread_index = plan_->query_context()->GetThreadIndex();
     int side = (input == inputs_[0]) ? 0 : 1;
 
-    if (batch_count_[side].SetTotal(total_batches)) {
-      if (side == 0) {
-        return OnProbeSideFinished(thread_index);
-      } else {
-        return OnBuildSideFinished(thread_index);
+    if (choose_build_side_) {
+      std::unique_lock<std::mutex> guard(choose_side_mutex_);
+      if (!build_side_chosen_) {
+        sampled_total_batches_[side] = total_batches;
+        return MaybeChooseBuildSide(thread_index, std::move(guard));
       }
     }
+
+    if (batch_count_[side].SetTotal(total_batches)) {
+      return OnInputFinished(thread_index, side);
+    }
     return Status::OK();
   }
 
@@ -966,6 +1323,10 @@ class HashJoinNode : public ExecNode, public TracedNode {
         [this](size_t thread_index) { return OnFiltersReceived(thread_index); },
         disable_bloom_filter_, use_sync_execution));
 
+    if (allow_spilling_) {
+      RETURN_NOT_OK(spill_context_.Init(this, num_threads));
+    }
+
     RETURN_NOT_OK(impl_->Init(
         ctx, join_type_, num_threads, &(schema_mgr_->proj_maps[0]),
         &(schema_mgr_->proj_maps[1]), key_cmp_, filter_,
@@ -981,10 +1342,29 @@ class HashJoinNode : public ExecNode, public TracedNode {
           return this->FinishedCallback(total_num_batches);
         }));
 
+    if (choose_build_side_) {
+      RETURN_NOT_OK(swapped_impl_->Init(
+          ctx, SwapJoinSides(join_type_), num_threads,
+          &(swapped_schema_mgr_->proj_maps[0]), &(swapped_schema_mgr_->proj_maps[1]),
+          key_cmp_, swapped_filter_,
+          [ctx](std::function<Status(size_t, int64_t)> fn,
+                std::function<Status(size_t)> on_finished) {
+            return ctx->RegisterTaskGroup(std::move(fn), std::move(on_finished));
+          },
+          [ctx](int task_group_id, int64_t num_tasks) {
+            return ctx->StartTaskGroup(task_group_id, num_tasks);
+          },
+          [this](int64_t, ExecBatch batch) {
+            return this->OutputSwappedBatch(std::move(batch));
+          },
+          [this](int64_t total_num_batches) {
+            return this->FinishedCallback(total_num_batches);
+          }));
+    }
+
     task_group_probe_ = ctx->RegisterTaskGroup(
         [this](size_t thread_index, int64_t task_id) -> Status {
-          return impl_->ProbeSingleBatch(thread_index,
-                                         std::move(queued_batches_to_probe_[task_id]));
+          return ProbeBatch(thread_index, std::move(queued_batches_to_probe_[task_id]));
         },
         [this](size_t thread_index) -> Status {
           return OnQueuedBatchesProbed(thread_index);
@@ -1011,7 +1391,11 @@ class HashJoinNode : public ExecNode, public TracedNode {
   Status StopProducingImpl() override {
     bool expected = false;
     if (complete_.compare_exchange_strong(expected, true)) {
+      std::lock_guard<std::mutex> guard(choose_side_mutex_);
       impl_->Abort([]() {});
+      if (choose_build_side_) {
+        swapped_impl_->Abort([]() {});
+      }
     }
     return Status::OK();
   }
@@ -1026,7 +1410,22 @@ class HashJoinNode : public ExecNode, public TracedNode {
     return output_->InputReceived(this, std::move(batch));
   }
 
+  // The join with swapped inputs outputs the columns of the right input first
+  Status OutputSwappedBatch(ExecBatch batch) {
+    std::rotate(batch.values.begin(), batch.values.begin() + num_right_output_columns_,
+                batch.values.end());
+    return OutputBatchCallback(std::move(batch));
+  }
+
   Status FinishedCallback(int64_t total_num_batches) {
+    if (allow_spilling_ && spill_context_.has_spilled()) {
+      // Only the partitions kept in memory have been joined so far
+      return spill_context_.JoinSpilledPartitions(total_num_batches);
+    }
+    return FinishOutput(total_num_batches);
+  }
+
+  Status FinishOutput(int64_t total_num_batches) {
     bool expected = false;
     if (complete_.compare_exchange_strong(expected, true)) {
       return output_->InputFinished(this, static_cast<int>(total_num_batches));
@@ -1042,6 +1441,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
   Expression filter_;
   std::unique_ptr<HashJoinSchema> schema_mgr_;
   std::unique_ptr<HashJoinImpl> impl_;
+  bool allow_spilling_;
   util::AccumulationQueue build_accumulator_;
   util::AccumulationQueue probe_accumulator_;
   util::AccumulationQueue queued_batches_to_probe_;
@@ -1056,9 +1456,26 @@ class HashJoinNode : public ExecNode, public TracedNode {
   bool queued_batches_probed_ = false;
   bool probe_side_finished_ = false;
 
+  // The join with the inputs swapped, used if the left input turns out to be the
+  // smaller one.  The two are swapped once the build side is chosen.
+  std::unique_ptr<HashJoinSchema> swapped_schema_mgr_;
+  Expression swapped_filter_;
+  std::unique_ptr<HashJoinImpl> swapped_impl_;
+  const bool choose_build_side_;
+  const int num_right_output_columns_;
+  // Until the build side is chosen, the batches of both inputs are buffered
+  std::mutex choose_side_mutex_;
+  bool build_side_chosen_;
+  int build_input_ = 1;
+  util::AccumulationQueue sampled_batches_[2];
+  int sampled_total_batches_[2] = {-1, -1};
+
   friend struct BloomFilterPushdownContext;
   bool disable_bloom_filter_;
   BloomFilterPushdownContext pushdown_context_;
+
+  friend struct HashJoinSpillContext;
+  HashJoinSpillContext spill_context_;
 };
 
 Status BloomFilterPushdownContext::Init(
@@ -1074,8 +1491,10 @@ Status BloomFilterPushdownContext::Init(
   eval_.all_received_callback_ = std::move(on_bloom_filters_received);
   if (!disable_bloom_filter_) {
     ARROW_CHECK(push_.pushdown_target_);
-    push_.bloom_filter_ = std::make_unique<BlockedBloomFilter>();
+    push_.bloom_filter_ = std::make_shared<BlockedBloomFilter>();
     push_.pushdown_target_->pushdown_context_.ExpectBloomFilter();
+    std::tie(push_.runtime_filter_target_, push_.runtime_filter_key_ids_) =
+        GetRuntimeFilterTarget(owner);
 
     build_.builder_ = BloomFilterBuilder::Make(
         use_sync_execution ? BloomFilterBuildStrategy::SINGLE_THREADED
@@ -1121,6 +1540,10 @@ Status BloomFilterPushdownContext::BuildBloomFilter(size_t thread_index,
   if (disable_bloom_filter_)
     return build_.on_finished_(thread_index, std::move(build_.batches_));
 
+  if (push_.runtime_filter_target_ && push_.spilled_partitions_ == 0) {
+    RETURN_NOT_OK(ComputeKeyRanges());
+  }
+
   RETURN_NOT_OK(build_.builder_->Begin(
       /*num_threads=*/ctx_->max_concurrency(), ctx_->cpu_info()->hardware_flags(),
       ctx_->memory_pool(), build_.batches_.row_count(), build_.batches_.batch_count(),
@@ -1131,9 +1554,64 @@ Status BloomFilterPushdownContext::BuildBloomFilter(size_t thread_index,
 }
 
 Status BloomFilterPushdownContext::PushBloomFilter(size_t thread_index) {
-  if (!disable_bloom_filter_)
-    return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(
-        thread_index, std::move(push_.bloom_filter_), std::move(push_.column_map_));
+  if (disable_bloom_filter_) return Status::OK();
+  // The key ranges and Bloom filter of a build side which spilled don't cover all of
+  // its rows, and a runtime filter has no way to let the rows of its spilled
+  // partitions through
+  if (push_.runtime_filter_target_ && push_.spilled_partitions_ == 0) {
+    RETURN_NOT_OK(push_.runtime_filter_target_->ReceiveRuntimeFilter(
+        std::make_shared<RuntimeFilter>(
+            std::move(push_.runtime_filter_key_ids_), std::move(push_.min_values_),
+            std::move(push_.max_values_), push_.bloom_filter_,
+            push_.build_side_empty_)));
+  }
+  return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(
+      thread_index, std::move(push_.bloom_filter_), std::move(push_.column_map_),
+      push_.spilled_partitions_);
+}
+
+Status BloomFilterPushdownContext::ComputeKeyRanges() {
+  SchemaProjectionMap key_to_in =
+      schema_mgr_->proj_maps[1].map(HashJoinProjection::KEY, HashJoinProjection::INPUT);
+  push_.build_side_empty_ = build_.batches_.row_count() == 0;
+  push_.min_values_.resize(key_to_in.num_cols);
+  push_.max_values_.resize(key_to_in.num_cols);
+  for (int i = 0; i < key_to_in.num_cols && !push_.build_side_empty_; i++) {
+    const std::shared_ptr<DataType>& type =
+        schema_mgr_->proj_maps[1].data_type(HashJoinProjection::KEY, i);
+    // Floating-point keys are left out, as NaNs are not ordered
+    if (!is_integer(*type) && !is_temporal(*type) && !is_decimal(*type) &&
+        !is_base_binary_like(type->id())) {
+      continue;
+    }
+    int input_idx = key_to_in.get(i);
+    ArrayVector chunks;
+    for (size_t ibatch = 0; ibatch < build_.batches_.batch_count(); ibatch++) {
+      const Datum& value = build_.batches_[ibatch][input_idx];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto chunk, MakeArrayFromScalar(*value.scalar(),
+                                            build_.batches_[ibatch].length,
+                                            ctx_->memory_pool()));
+        chunks.push_back(std::move(chunk));
+      } else {
+        chunks.push_back(value.make_array());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        Datum min_max,
+        compute::MinMax(std::make_shared<ChunkedArray>(std::move(chunks), type),
+                        compute::ScalarAggregateOptions::Defaults(),
+                        ctx_->exec_context()));
+    const auto& min_max_scalar = min_max.scalar_as<StructScalar>();
+    if (!min_max_scalar.value[0]->is_valid) {
+      // Every key is null, and nulls never match
+      push_.build_side_empty_ = true;
+      break;
+    }
+    push_.min_values_[i] = min_max_scalar.value[0];
+    push_.max_values_[i] = min_max_scalar.value[1];
+  }
   return Status::OK();
 }
 
@@ -1235,6 +1713,8 @@ std::pair<HashJoinNode*, std::vector<int>> BloomFilterPushdownContext::GetPushdo
   for (ExecNode* candidate = start->inputs()[0];
        candidate->kind_name() == start->kind_name(); candidate = candidate->inputs()[0]) {
     auto* candidate_as_join = checked_cast<HashJoinNode*>(candidate);
+    // The layout of the probe side of such a join is only known at runtime
+    if (candidate_as_join->choose_build_side_) break;
     SchemaProjectionMap candidate_output_to_input =
         candidate_as_join->schema_mgr_->proj_maps[0].map(HashJoinProjection::OUTPUT,
                                                          HashJoinProjection::INPUT);
@@ -1277,6 +1757,375 @@ std::pair<HashJoinNode*, std::vector<int>> BloomFilterPushdownContext::GetPushdo
 #endif  // ARROW_LITTLE_ENDIAN
 }
 
+std::pair<RuntimeFilterReceiver*, std::vector<int>>
+BloomFilterPushdownContext::GetRuntimeFilterTarget(HashJoinNode* owner) {
+  // Nulls never match the build side only if every key is compared with EQ
+  for (JoinKeyCmp cmp : owner->key_cmp_) {
+    if (cmp != JoinKeyCmp::EQ) return {nullptr, {}};
+  }
+  // Row filters don't change the layout of their input
+  ExecNode* candidate = push_.pushdown_target_->inputs()[0];
+  while (candidate->is_row_filter()) {
+    candidate = candidate->inputs()[0];
+  }
+  auto* receiver = dynamic_cast<RuntimeFilterReceiver*>(candidate);
+  if (receiver == NULLPTR || !receiver->accepts_runtime_filters()) return {nullptr, {}};
+  return {receiver, push_.column_map_};
+}
+
+Status HashJoinSpillContext::Init(HashJoinNode* owner, size_t num_threads) {
+  owner_ = owner;
+  ctx_ = owner->plan_->query_context();
+  num_threads_ = num_threads;
+  threshold_ = ctx_->spill_threshold_bytes();
+  schemas_[0] = owner->inputs_[0]->output_schema();
+  schemas_[1] = owner->inputs_[1]->output_schema();
+  stacks_.resize(num_threads);
+  for (auto& stack : stacks_) {
+    RETURN_NOT_OK(stack.Init(ctx_->memory_pool(), Hashing32::kHashBatchTempStackUsage));
+  }
+  task_group_join_ = ctx_->RegisterTaskGroup(
+      [this](size_t thread_index, int64_t task_id) -> Status {
+        return JoinSpilledPartition(thread_index, task_id);
+      },
+      [this](size_t) -> Status {
+        return owner_->FinishOutput(num_in_memory_batches_ + num_output_batches_.load());
+      });
+  return Status::OK();
+}
+
+Status HashJoinSpillContext::AddBuildBatch(size_t thread_index, ExecBatch batch) {
+  {
+    std::lock_guard<std::mutex> guard(build_mutex_);
+    if (!partitioned_) {
+      in_memory_bytes_ += batch.TotalBufferSize();
+      unpartitioned_batches_.InsertBatch(std::move(batch));
+      if (in_memory_bytes_ <= threshold_) {
+        return Status::OK();
+      }
+      // The build side doesn't fit in memory, partition what we have so far
+      partitioned_ = true;
+      in_memory_bytes_ = 0;
+      AccumulationQueue batches = std::move(unpartitioned_batches_);
+      unpartitioned_batches_.Clear();
+      for (size_t i = 0; i < batches.batch_count(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(
+            PartitionedBatch partitioned,
+            PartitionBatch(thread_index, /*side=*/1, /*level=*/0, batches[i]));
+        RETURN_NOT_OK(AddPartitionedBuildBatchLocked(std::move(partitioned)));
+      }
+      return SpillPartitionsLocked();
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(PartitionedBatch partitioned,
+                        PartitionBatch(thread_index, /*side=*/1, /*level=*/0, batch));
+  std::lock_guard<std::mutex> guard(build_mutex_);
+  RETURN_NOT_OK(AddPartitionedBuildBatchLocked(std::move(partitioned)));
+  return SpillPartitionsLocked();
+}
+
+Status HashJoinSpillContext::AddPartitionedBuildBatchLocked(PartitionedBatch batch) {
+  uint32_t spilled = spilled_partitions_.load();
+  for (int i = 0; i < kNumPartitions; ++i) {
+    if (!batch[i]) continue;
+    Partition& partition = partitions_[i];
+    if (spilled & (1u << i)) {
+      RETURN_NOT_OK(partition.build_file->Write(*batch[i]));
+      continue;
+    }
+    ExecBatch exec_batch(*batch[i]);
+    int64_t num_bytes = exec_batch.TotalBufferSize();
+    partition.build_bytes += num_bytes;
+    in_memory_bytes_ += num_bytes;
+    partition.build_batches.InsertBatch(std::move(exec_batch));
+  }
+  return Status::OK();
+}
+
+Status HashJoinSpillContext::SpillPartitionsLocked() {
+  while (in_memory_bytes_ > threshold_) {
+    uint32_t spilled = spilled_partitions_.load();
+    int largest = -1;
+    for (int i = 0; i < kNumPartitions; ++i) {
+      if ((spilled & (1u << i)) || partitions_[i].build_bytes == 0) continue;
+      if (largest < 0 || partitions_[i].build_bytes > partitions_[largest].build_bytes) {
+        largest = i;
+      }
+    }
+    if (largest < 0) break;
+
+    Partition& partition = partitions_[largest];
+    ARROW_ASSIGN_OR_RAISE(
+        partition.build_file,
+        SpillFile::Make(ctx_, schemas_[1], "hash_join_build", owner_->profiler()));
+    for (size_t i = 0; i < partition.build_batches.batch_count(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<RecordBatch> record_batch,
+          partition.build_batches[i].ToRecordBatch(schemas_[1], ctx_->memory_pool()));
+      RETURN_NOT_OK(partition.build_file->Write(*record_batch));
+    }
+    partition.build_batches.Clear();
+    in_memory_bytes_ -= partition.build_bytes;
+    partition.build_bytes = 0;
+    spilled_partitions_.fetch_or(1u << largest);
+  }
+  return Status::OK();
+}
+
+Result<AccumulationQueue> HashJoinSpillContext::FinishBuild() {
+  std::lock_guard<std::mutex> guard(build_mutex_);
+  if (!partitioned_) {
+    return std::move(unpartitioned_batches_);
+  }
+  uint32_t spilled = spilled_partitions_.load();
+  AccumulationQueue batches;
+  for (int i = 0; i < kNumPartitions; ++i) {
+    if (spilled & (1u << i)) {
+      RETURN_NOT_OK(partitions_[i].build_file->Finish());
+    } else {
+      batches.Concatenate(std::move(partitions_[i].build_batches));
+    }
+  }
+  return batches;
+}
+
+Status HashJoinSpillContext::SpillProbeRows(size_t thread_index, ExecBatch* batch) {
+  uint32_t spilled = spilled_partitions_.load();
+  if (spilled == 0 || batch->length == 0) {
+    return Status::OK();
+  }
+  std::vector<uint32_t> hashes;
+  RETURN_NOT_OK(HashKeys(thread_index, /*side=*/0, *batch, &hashes));
+
+  std::vector<std::vector<int32_t>> spilled_row_ids(kNumPartitions);
+  std::vector<int32_t> kept_row_ids;
+  for (int64_t i = 0; i < batch->length; ++i) {
+    uint32_t partition = hashes[i] & (kNumPartitions - 1);
+    if (spilled & (1u << partition)) {
+      spilled_row_ids[partition].push_back(static_cast<int32_t>(i));
+    } else {
+      kept_row_ids.push_back(static_cast<int32_t>(i));
+    }
+  }
+  if (static_cast<int64_t>(kept_row_ids.size()) == batch->length) {
+    return Status::OK();
+  }
+
+  for (int i = 0; i < kNumPartitions; ++i) {
+    if (spilled_row_ids[i].empty()) continue;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> rows,
+                          TakeRows(/*side=*/0, *batch, spilled_row_ids[i]));
+    Partition& partition = partitions_[i];
+    std::lock_guard<std::mutex> guard(partition.probe_mutex);
+    if (!partition.probe_file) {
+      ARROW_ASSIGN_OR_RAISE(
+          partition.probe_file,
+          SpillFile::Make(ctx_, schemas_[0], "hash_join_probe", owner_->profiler()));
+    }
+    RETURN_NOT_OK(partition.probe_file->Write(*rows));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> kept,
+                        TakeRows(/*side=*/0, *batch, kept_row_ids));
+  *batch = ExecBatch(*kept);
+  return Status::OK();
+}
+
+Status HashJoinSpillContext::HashKeys(size_t thread_index, int side,
+                                      const ExecBatch& batch,
+                                      std::vector<uint32_t>* hashes) {
+  SchemaProjectionMap key_to_in = owner_->schema_mgr_->proj_maps[side].map(
+      HashJoinProjection::KEY, HashJoinProjection::INPUT);
+  std::vector<Datum> key_columns(key_to_in.num_cols);
+  for (size_t i = 0; i < key_columns.size(); i++) {
+    key_columns[i] = batch[key_to_in.get(static_cast<int>(i))];
+    if (key_columns[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(key_columns[i],
+                            MakeArrayFromScalar(*key_columns[i].scalar(), batch.length,
+                                                ctx_->memory_pool()));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(key_columns)));
+  hashes->resize(batch.length);
+  std::vector<KeyColumnArray> temp_column_arrays;
+  return Hashing32::HashBatch(key_batch, hashes->data(), temp_column_arrays,
+                              ctx_->cpu_info()->hardware_flags(), &stacks_[thread_index],
+                              0, key_batch.length);
+}
+
+Result<std::shared_ptr<RecordBatch>> HashJoinSpillContext::TakeRows(
+    int side, const ExecBatch& batch, const std::vector<int32_t>& row_ids) {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                        batch.ToRecordBatch(schemas_[side], ctx_->memory_pool()));
+  if (static_cast<int64_t>(row_ids.size()) == batch.length) {
+    return record_batch;
+  }
+  Int32Builder indices_builder(ctx_->memory_pool());
+  RETURN_NOT_OK(indices_builder.AppendValues(row_ids));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> indices, indices_builder.Finish());
+  ARROW_ASSIGN_OR_RAISE(Datum taken,
+                        compute::Take(record_batch, indices,
+                                      compute::TakeOptions::NoBoundsCheck(),
+                                      ctx_->exec_context()));
+  return taken.record_batch();
+}
+
+Result<HashJoinSpillContext::PartitionedBatch> HashJoinSpillContext::PartitionBatch(
+    size_t thread_index, int side, int level, const ExecBatch& batch) {
+  std::vector<uint32_t> hashes;
+  RETURN_NOT_OK(HashKeys(thread_index, side, batch, &hashes));
+  std::vector<std::vector<int32_t>> row_ids(kNumPartitions);
+  int shift = level * kLogNumPartitions;
+  for (int64_t i = 0; i < batch.length; ++i) {
+    row_ids[(hashes[i] >> shift) & (kNumPartitions - 1)].push_back(
+        static_cast<int32_t>(i));
+  }
+  PartitionedBatch partitioned(kNumPartitions);
+  for (int i = 0; i < kNumPartitions; ++i) {
+    if (row_ids[i].empty()) continue;
+    ARROW_ASSIGN_OR_RAISE(partitioned[i], TakeRows(side, batch, row_ids[i]));
+  }
+  return partitioned;
+}
+
+Status HashJoinSpillContext::JoinSpilledPartitions(int64_t num_in_memory_batches) {
+  num_in_memory_batches_ = num_in_memory_batches;
+  uint32_t spilled = spilled_partitions_.load();
+  for (int i = 0; i < kNumPartitions; ++i) {
+    if (spilled & (1u << i)) {
+      spilled_ids_.push_back(i);
+    }
+  }
+  return ctx_->StartTaskGroup(task_group_join_,
+                              static_cast<int64_t>(spilled_ids_.size()));
+}
+
+Status HashJoinSpillContext::JoinSpilledPartition(size_t thread_index, int64_t task_id) {
+  Partition& partition = partitions_[spilled_ids_[task_id]];
+  if (partition.probe_file) {
+    RETURN_NOT_OK(partition.probe_file->Finish());
+  }
+  return JoinPartition(thread_index, /*level=*/0, std::move(partition.build_file),
+                       std::move(partition.probe_file));
+}
+
+Status HashJoinSpillContext::JoinPartition(size_t thread_index, int level,
+                                           std::unique_ptr<SpillFile> build_file,
+                                           std::unique_ptr<SpillFile> probe_file) {
+  if (owner_->complete_.load()) {
+    return Status::OK();
+  }
+  if (!build_file || build_file->num_bytes() <= threshold_ || level == kMaxSplits) {
+    return JoinPartitionInMemory(thread_index, build_file.get(), probe_file.get());
+  }
+
+  // The partition is still too big, split it on the next bits of the hash
+  std::unique_ptr<SpillFile> split_files[2][kNumPartitions];
+  const SpillFile* files[2] = {probe_file.get(), build_file.get()};
+  for (int side = 0; side <= 1; ++side) {
+    if (!files[side]) continue;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> reader,
+                          files[side]->OpenReader());
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch, reader->Next());
+      if (!record_batch) break;
+      ARROW_ASSIGN_OR_RAISE(
+          PartitionedBatch partitioned,
+          PartitionBatch(thread_index, side, level + 1, ExecBatch(*record_batch)));
+      for (int i = 0; i < kNumPartitions; ++i) {
+        if (!partitioned[i]) continue;
+        if (!split_files[side][i]) {
+          ARROW_ASSIGN_OR_RAISE(
+              split_files[side][i],
+              SpillFile::Make(ctx_, schemas_[side],
+                              side == 0 ? "hash_join_probe" : "hash_join_build",
+                              owner_->profiler()));
+        }
+        RETURN_NOT_OK(split_files[side][i]->Write(*partitioned[i]));
+      }
+    }
+  }
+  build_file.reset();
+  probe_file.reset();
+
+  for (int i = 0; i < kNumPartitions; ++i) {
+    for (int side = 0; side <= 1; ++side) {
+      if (split_files[side][i]) {
+        RETURN_NOT_OK(split_files[side][i]->Finish());
+      }
+    }
+    RETURN_NOT_OK(JoinPartition(thread_index, level + 1, std::move(split_files[1][i]),
+                                std::move(split_files[0][i])));
+  }
+  return Status::OK();
+}
+
+Status HashJoinSpillContext::JoinPartitionInMemory(size_t thread_index,
+                                                   const SpillFile* build_file,
+                                                   const SpillFile* probe_file) {
+  // Nothing to output if both sides are empty
+  if (!build_file && !probe_file) {
+    return Status::OK();
+  }
+
+  AccumulationQueue build_batches;
+  if (build_file) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> reader,
+                          build_file->OpenReader());
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch, reader->Next());
+      if (!record_batch) break;
+      build_batches.InsertBatch(ExecBatch(*record_batch));
+    }
+  }
+
+  // The plan's task scheduler doesn't accept new task groups once it is running, so
+  // the task groups of the partition's join are run directly on this thread.
+  using Task = std::function<Status(size_t, int64_t)>;
+  using TaskGroupContinuation = std::function<Status(size_t)>;
+  std::vector<std::pair<Task, TaskGroupContinuation>> task_groups;
+  bool finished = false;
+
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<HashJoinImpl> impl, HashJoinImpl::MakeSwiss());
+  RETURN_NOT_OK(impl->Init(
+      ctx_, owner_->join_type_, num_threads_, &(owner_->schema_mgr_->proj_maps[0]),
+      &(owner_->schema_mgr_->proj_maps[1]), owner_->key_cmp_, owner_->filter_,
+      [&task_groups](Task task, TaskGroupContinuation on_finished) {
+        task_groups.emplace_back(std::move(task), std::move(on_finished));
+        return static_cast<int>(task_groups.size()) - 1;
+      },
+      [&task_groups, thread_index](int task_group_id, int64_t num_tasks) {
+        const auto& task_group = task_groups[task_group_id];
+        for (int64_t i = 0; i < num_tasks; ++i) {
+          RETURN_NOT_OK(task_group.first(thread_index, i));
+        }
+        return task_group.second(thread_index);
+      },
+      [this](int64_t, ExecBatch batch) {
+        ++num_output_batches_;
+        return owner_->OutputBatchCallback(std::move(batch));
+      },
+      [&finished](int64_t) {
+        finished = true;
+        return Status::OK();
+      }));
+
+  RETURN_NOT_OK(impl->BuildHashTable(thread_index, std::move(build_batches),
+                                     [](size_t) { return Status::OK(); }));
+  if (probe_file) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> reader,
+                          probe_file->OpenReader());
+    while (!owner_->complete_.load()) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch, reader->Next());
+      if (!record_batch) break;
+      RETURN_NOT_OK(impl->ProbeSingleBatch(thread_index, ExecBatch(*record_batch)));
+    }
+  }
+  RETURN_NOT_OK(impl->ProbingFinished(thread_index));
+  DCHECK(finished || owner_->complete_.load());
+  return Status::OK();
+}
+
 namespace internal {
 void RegisterHashJoinNode(ExecFactoryRegistry* registry) {
   DCHECK_OK(registry->AddFactory("hashjoin", HashJoinNode::Make));
@@ -23,9 +23,11 @@
 #include <unordered_set>
 
 #include "arrow/acero/options.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/util.h"
 #include "arrow/api.h"
+#include "arrow/compute/key_hash_internal.h"
 #include "arrow/compute/light_array_internal.h"
 #include "arrow/compute/row/row_encoder_internal.h"
 #include "arrow/compute/test_util_internal.h"
@@ -3106,6 +3108,215 @@ TEST(HashJoin, FineGrainedResidualFilter) {
   }
 }
 
+// Eight batches of 512 rows, about 90KB, with a key, a string and an integer column
+// whose names start with the prefix
+BatchesWithSchema MakeSpillingJoinInput(RandomArrayGenerator* rng,
+                                        const std::string& prefix, int32_t max_key) {
+  constexpr int kNumBatches = 8;
+  constexpr int kRowsPerBatch = 512;
+  BatchesWithSchema batches;
+  batches.schema = schema({field(prefix + "_key", int32()),
+                           field(prefix + "_str", utf8()),
+                           field(prefix + "_i64", int64())});
+  for (int i = 0; i < kNumBatches; ++i) {
+    batches.batches.push_back(ExecBatch(
+        {rng->Int32(kRowsPerBatch, /*min=*/0, max_key, /*null_probability=*/0.01),
+         rng->String(kRowsPerBatch, /*min_length=*/0, /*max_length=*/16,
+                     /*null_probability=*/0.1),
+         rng->Int64(kRowsPerBatch, /*min=*/0, /*max=*/1000)},
+        kRowsPerBatch));
+  }
+  return batches;
+}
+
+// Asserts that every hashjoin node of the plan spilled
+void AssertAllJoinsSpilled(const PlanProfile& profile) {
+  int num_joins = 0;
+  for (const NodeProfile& node : profile.nodes) {
+    if (node.kind != "HashJoinNode") continue;
+    ARROW_SCOPED_TRACE("node=", node.label);
+    ASSERT_GT(node.spilled_bytes, 0);
+    ++num_joins;
+  }
+  ASSERT_GT(num_joins, 0);
+}
+
+TEST(HashJoin, Spilling) {
+  RandomArrayGenerator rng(/*seed=*/42);
+  BatchesWithSchema left = MakeSpillingJoinInput(&rng, "l", /*max_key=*/3000);
+  BatchesWithSchema right = MakeSpillingJoinInput(&rng, "r", /*max_key=*/2000);
+  ASSERT_OK_AND_ASSIGN(auto spill_dir, SpillDir::Make());
+
+  for (JoinType join_type :
+       {JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI, JoinType::LEFT_ANTI,
+        JoinType::RIGHT_ANTI, JoinType::INNER, JoinType::LEFT_OUTER,
+        JoinType::RIGHT_OUTER, JoinType::FULL_OUTER}) {
+    for (JoinKeyCmp key_cmp : {JoinKeyCmp::EQ, JoinKeyCmp::IS}) {
+      ARROW_SCOPED_TRACE("join_type=", ToString(join_type),
+                         " key_cmp=", key_cmp == JoinKeyCmp::EQ ? "EQ" : "IS");
+      HashJoinNodeOptions join_options{join_type, {"l_key"}, {"r_key"}};
+      join_options.key_cmp = {key_cmp};
+      join_options.filter =
+          and_(compute::less_equal(field_ref("l_i64"), literal(int64_t{900})),
+               compute::less_equal(field_ref("r_i64"), literal(int64_t{900})));
+      Declaration left_source{"exec_batch_source",
+                              ExecBatchSourceNodeOptions(left.schema, left.batches)};
+      Declaration right_source{"exec_batch_source",
+                               ExecBatchSourceNodeOptions(right.schema, right.batches)};
+      Declaration join{"hashjoin", {left_source, right_source}, join_options};
+
+      ASSERT_OK_AND_ASSIGN(BatchesWithCommonSchema expected,
+                           DeclarationToExecBatches(join));
+      // The larger threshold spills some of the partitions, the smaller one spills
+      // all of them and splits them again
+      for (int64_t threshold : {1024, 32 * 1024}) {
+        for (bool use_threads : {false, true}) {
+          ARROW_SCOPED_TRACE("threshold=", threshold, " use_threads=", use_threads);
+          PlanProfile profile;
+          QueryOptions query_options;
+          query_options.use_threads = use_threads;
+          query_options.spill_threshold_bytes = threshold;
+          query_options.profile = &profile;
+          ASSERT_OK_AND_ASSIGN(BatchesWithCommonSchema actual,
+                               DeclarationToExecBatches(join, query_options));
+          AssertExecBatchesEqualIgnoringOrder(expected.schema, expected.batches,
+                                              actual.batches);
+          AssertAllJoinsSpilled(profile);
+          ASSERT_OK_AND_EQ(std::vector<std::string>{}, spill_dir->ListEntries());
+        }
+      }
+    }
+  }
+}
+
+TEST(HashJoin, SpillingWithBloomFilter) {
+  // The Bloom filter of the second join is pushed down to the first one, which
+  // evaluates it on the left input.  The second join only keeps part of its build side
+  // in memory, so its filter must let the rows of its spilled partitions through.
+  RandomArrayGenerator rng(/*seed=*/42);
+  BatchesWithSchema left = MakeSpillingJoinInput(&rng, "l", /*max_key=*/3000);
+  BatchesWithSchema right1 = MakeSpillingJoinInput(&rng, "r1", /*max_key=*/3000);
+  BatchesWithSchema right2 = MakeSpillingJoinInput(&rng, "r2", /*max_key=*/500);
+  ASSERT_OK_AND_ASSIGN(auto spill_dir, SpillDir::Make());
+
+  auto make_plan = [&](bool disable_bloom_filter) {
+    HashJoinNodeOptions first_options{JoinType::INNER, {"l_key"}, {"r1_key"}};
+    first_options.disable_bloom_filter = disable_bloom_filter;
+    HashJoinNodeOptions second_options{JoinType::INNER, {"l_key"}, {"r2_key"}};
+    second_options.disable_bloom_filter = disable_bloom_filter;
+    Declaration first_join{
+        "hashjoin",
+        {Declaration{"exec_batch_source",
+                     ExecBatchSourceNodeOptions(left.schema, left.batches)},
+         Declaration{"exec_batch_source",
+                     ExecBatchSourceNodeOptions(right1.schema, right1.batches)}},
+        std::move(first_options)};
+    first_join.label = "first_join";
+    return Declaration{
+        "hashjoin",
+        {std::move(first_join),
+         Declaration{"exec_batch_source",
+                     ExecBatchSourceNodeOptions(right2.schema, right2.batches)}},
+        std::move(second_options)};
+  };
+
+  ASSERT_OK_AND_ASSIGN(
+      BatchesWithCommonSchema expected,
+      DeclarationToExecBatches(make_plan(/*disable_bloom_filter=*/true)));
+  for (bool use_threads : {false, true}) {
+    int64_t first_join_rows[2];
+    for (bool disable_bloom_filter : {false, true}) {
+      ARROW_SCOPED_TRACE("use_threads=", use_threads,
+                         " disable_bloom_filter=", disable_bloom_filter);
+      PlanProfile profile;
+      QueryOptions query_options;
+      query_options.use_threads = use_threads;
+      query_options.spill_threshold_bytes = 32 * 1024;
+      query_options.profile = &profile;
+      ASSERT_OK_AND_ASSIGN(
+          BatchesWithCommonSchema actual,
+          DeclarationToExecBatches(make_plan(disable_bloom_filter), query_options));
+      AssertExecBatchesEqualIgnoringOrder(expected.schema, expected.batches,
+                                          actual.batches);
+      AssertAllJoinsSpilled(profile);
+      ASSERT_OK_AND_EQ(std::vector<std::string>{}, spill_dir->ListEntries());
+      const NodeProfile* first_join = FindNodeProfile(profile, "HashJoinNode");
+      ASSERT_NE(first_join, nullptr);
+      ASSERT_EQ(first_join->label, "first_join");
+      first_join_rows[disable_bloom_filter] = first_join->rows_emitted;
+    }
+    // The filter of the second join removed rows of the partitions it kept in memory
+    ASSERT_LT(first_join_rows[false], first_join_rows[true]);
+  }
+}
+
+TEST(HashJoin, ChooseBuildSide) {
+  constexpr int kRowsPerBatch = 256;
+
+  RandomArrayGenerator rng(/*seed=*/43);
+  auto make_batches = [&](const std::string& prefix, int num_batches) {
+    BatchesWithSchema batches;
+    batches.schema = schema({field(prefix + "_key", int32()),
+                             field(prefix + "_str", utf8()),
+                             field(prefix + "_i64", int64())});
+    for (int i = 0; i < num_batches; ++i) {
+      batches.batches.push_back(ExecBatch(
+          {rng.Int32(kRowsPerBatch, /*min=*/0, /*max=*/1000, /*null_probability=*/0.01),
+           rng.String(kRowsPerBatch, /*min_length=*/0, /*max_length=*/16,
+                      /*null_probability=*/0.1),
+           rng.Int64(kRowsPerBatch, /*min=*/0, /*max=*/1000)},
+          kRowsPerBatch));
+    }
+    return batches;
+  };
+  // Either input may be the smaller one
+  for (int num_left_batches : {1, 8}) {
+    BatchesWithSchema left = make_batches("l", num_left_batches);
+    BatchesWithSchema right = make_batches("r", 9 - num_left_batches);
+    Declaration left_source{"exec_batch_source",
+                            ExecBatchSourceNodeOptions(left.schema, left.batches)};
+    Declaration right_source{"exec_batch_source",
+                             ExecBatchSourceNodeOptions(right.schema, right.batches)};
+    for (JoinType join_type :
+         {JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI, JoinType::LEFT_ANTI,
+          JoinType::RIGHT_ANTI, JoinType::INNER, JoinType::LEFT_OUTER,
+          JoinType::RIGHT_OUTER, JoinType::FULL_OUTER}) {
+      for (bool output_all : {true, false}) {
+        ARROW_SCOPED_TRACE("num_left_batches=", num_left_batches, " join_type=",
+                           ToString(join_type), " output_all=", output_all);
+        HashJoinNodeOptions join_options{join_type, {"l_key"}, {"r_key"}};
+        if (!output_all) {
+          join_options.output_all = false;
+          if (join_type != JoinType::RIGHT_SEMI && join_type != JoinType::RIGHT_ANTI) {
+            join_options.left_output = {"l_i64", "l_key"};
+          }
+          if (join_type != JoinType::LEFT_SEMI && join_type != JoinType::LEFT_ANTI) {
+            join_options.right_output = {"r_str"};
+          }
+        }
+        // The right side is referenced by index into the left fields then right fields
+        join_options.filter =
+            and_(compute::less_equal(field_ref("l_i64"), literal(int64_t{900})),
+                 compute::less_equal(field_ref(FieldRef(5)), literal(int64_t{900})));
+        Declaration join{"hashjoin", {left_source, right_source}, join_options};
+        ASSERT_OK_AND_ASSIGN(BatchesWithCommonSchema expected,
+                             DeclarationToExecBatches(join));
+
+        join_options.choose_build_side = true;
+        join = Declaration{"hashjoin", {left_source, right_source}, join_options};
+        for (bool use_threads : {false, true}) {
+          ARROW_SCOPED_TRACE("use_threads=", use_threads);
+          ASSERT_OK_AND_ASSIGN(BatchesWithCommonSchema actual,
+                               DeclarationToExecBatches(join, use_threads));
+          AssertSchemaEqual(expected.schema, actual.schema);
+          AssertExecBatchesEqualIgnoringOrder(expected.schema, expected.batches,
+                                              actual.batches);
+        }
+      }
+    }
+  }
+}
+
 HashJoinNodeOptions GenerateHashJoinNodeOptions(Random64Bit& rng, int num_left_cols,
                                                 int num_right_cols) {
   HashJoinNodeOptions opts;
@@ -3583,5 +3794,33 @@ TEST(HashJoin, BuildSideLargeRowIds) {
   AssertRowCountEq(std::move(filter), num_match_rows * num_match_rows);
 }
 
+TEST(RuntimeFilter, KeyRange) {
+  ExecBatch batch =
+      ExecBatchFromJSON({int32(), utf8()}, R"([[1, "a"], [2, "b"], [null, "c"],
+                                              [4, "d"], [5, "e"]])");
+  RuntimeFilter filter({0}, {std::make_shared<Int32Scalar>(2)},
+                       {std::make_shared<Int32Scalar>(4)}, /*bloom_filter=*/nullptr);
+  arrow::util::TempVectorStack stack;
+  ASSERT_OK(stack.Init(default_memory_pool(),
+                       compute::Hashing32::kHashBatchTempStackUsage));
+  ASSERT_OK_AND_ASSIGN(ExecBatch filtered,
+                       filter.Apply(batch, default_exec_context(), &stack));
+  ExecBatch expected = ExecBatchFromJSON({int32(), utf8()}, R"([[2, "b"], [4, "d"]])");
+  AssertExecBatchesEqual(schema({field("k", int32()), field("v", utf8())}), {expected},
+                         {filtered});
+  ASSERT_EQ(filter.ToExpression({FieldRef("k")}),
+            and_(compute::greater_equal(field_ref("k"), compute::literal(2)),
+                 compute::less_equal(field_ref("k"), compute::literal(4))));
+  // A key left out of the expression isn't constrained
+  ASSERT_EQ(filter.ToExpression({std::nullopt}), compute::literal(true));
+
+  // A filter built from an empty build side drops everything
+  RuntimeFilter empty({0}, {nullptr}, {nullptr}, /*bloom_filter=*/nullptr,
+                      /*empty=*/true);
+  ASSERT_OK_AND_ASSIGN(filtered, empty.Apply(batch, default_exec_context(), &stack));
+  ASSERT_EQ(0, filtered.length);
+  ASSERT_EQ(empty.ToExpression({FieldRef("k")}), compute::literal(false));
+}
+
 }  // namespace acero
 }  // namespace arrow
@@ -59,23 +59,29 @@ Status MapNode::StartProducing() {
 }
 
 void MapNode::PauseProducing(ExecNode* output, int32_t counter) {
+  profiler()->RecordPaused(counter);
   inputs_[0]->PauseProducing(this, counter);
 }
 
 void MapNode::ResumeProducing(ExecNode* output, int32_t counter) {
+  profiler()->RecordResumed(counter);
   inputs_[0]->ResumeProducing(this, counter);
 }
 
 Status MapNode::StopProducingImpl() { return Status::OK(); }
 
 Status MapNode::InputReceived(ExecNode* input, ExecBatch batch) {
-  auto scope = TraceInputReceived(batch);
   DCHECK_EQ(input, inputs_[0]);
-  compute::Expression guarantee = batch.guarantee;
-  int64_t index = batch.index;
-  ARROW_ASSIGN_OR_RAISE(auto output_batch, ProcessBatch(std::move(batch)));
-  output_batch.guarantee = guarantee;
-  output_batch.index = index;
+  ExecBatch output_batch;
+  {
+    // The time spent by the output is not this node's
+    auto scope = TraceInputReceived(batch);
+    compute::Expression guarantee = batch.guarantee;
+    int64_t index = batch.index;
+    ARROW_ASSIGN_OR_RAISE(output_batch, ProcessBatch(std::move(batch)));
+    output_batch.guarantee = guarantee;
+    output_batch.index = index;
+  }
   ARROW_RETURN_NOT_OK(output_->InputReceived(this, std::move(output_batch)));
   if (input_counter_.Increment()) {
     this->Finish();
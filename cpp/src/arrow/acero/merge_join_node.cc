@@ -0,0 +1,858 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/tracing_internal.h"
+
+// The merge join walks both inputs in key order, in the same way as the merge step of
+// a merge sort.  Rows from the side with the smaller key have no match and are either
+// emitted with nulls for the other side or dropped, depending on the join type.  When
+// the keys are equal, the run of rows with that key is collected on both sides (the
+// runs may span several batches) and their cross product is emitted.
+//
+// Each input goes through a sequencing queue so that batches are seen in order.  The
+// merge itself runs under a mutex on whichever thread delivered the batch that allowed
+// it to make progress.  While the merge waits on one input, the other input is paused
+// once enough of it has been buffered.  Both inputs are also paused while the output
+// is.
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::NullPlacement;
+using compute::SortKey;
+using compute::SortOrder;
+
+namespace acero {
+namespace {
+
+// Rows which may be buffered on an input which the merge is not waiting on, before
+// that input is paused
+constexpr int64_t kPauseThresholdRows = 4 * ExecPlan::kMaxBatchSize;
+
+constexpr std::array<const char*, 2> kSideNames = {"left", "right"};
+
+// Compares the values of one key column, following the sort order of the inputs
+class KeyComparator {
+ public:
+  virtual ~KeyComparator() = default;
+
+  // Returns a negative number, zero or a positive number if `left[i]` sorts before,
+  // together with or after `right[j]`
+  virtual int Compare(const Array& left, int64_t i, const Array& right,
+                      int64_t j) const = 0;
+};
+
+template <typename ArrowType>
+class TypedKeyComparator : public KeyComparator {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  TypedKeyComparator(SortOrder order, NullPlacement null_placement)
+      : descending_(order == SortOrder::Descending),
+        null_rank_(null_placement == NullPlacement::AtStart ? 0 : 2),
+        value_rank_(null_placement == NullPlacement::AtStart ? 2 : 0) {}
+
+  int Compare(const Array& left, int64_t i, const Array& right,
+              int64_t j) const override {
+    const auto& left_array = checked_cast<const ArrayType&>(left);
+    const auto& right_array = checked_cast<const ArrayType&>(right);
+    const int left_rank = Rank(left_array, i);
+    const int right_rank = Rank(right_array, j);
+    if (left_rank != right_rank) {
+      return left_rank - right_rank;
+    }
+    if (left_rank != value_rank_) {
+      return 0;
+    }
+    const auto left_value = left_array.GetView(i);
+    const auto right_value = right_array.GetView(j);
+    const int cmp = left_value < right_value ? -1 : (right_value < left_value ? 1 : 0);
+    return descending_ ? -cmp : cmp;
+  }
+
+ private:
+  // Nulls and NaNs are placed together at one end, with the nulls outermost
+  int Rank(const ArrayType& array, int64_t i) const {
+    if (array.IsNull(i)) {
+      return null_rank_;
+    }
+    if constexpr (is_floating_type<ArrowType>::value) {
+      if (std::isnan(array.Value(i))) {
+        return 1;
+      }
+    }
+    return value_rank_;
+  }
+
+  const bool descending_;
+  const int null_rank_;
+  const int value_rank_;
+};
+
+Result<std::unique_ptr<KeyComparator>> MakeKeyComparator(const DataType& type,
+                                                         const SortKey& sort_key) {
+  switch (type.id()) {
+#define COMPARATOR_CASE(TYPE_CLASS)                                    \
+  case TYPE_CLASS##Type::type_id:                                      \
+    return std::make_unique<TypedKeyComparator<TYPE_CLASS##Type>>(     \
+        sort_key.order, sort_key.null_placement);
+
+    COMPARATOR_CASE(Boolean)
+    COMPARATOR_CASE(Int8)
+    COMPARATOR_CASE(Int16)
+    COMPARATOR_CASE(Int32)
+    COMPARATOR_CASE(Int64)
+    COMPARATOR_CASE(UInt8)
+    COMPARATOR_CASE(UInt16)
+    COMPARATOR_CASE(UInt32)
+    COMPARATOR_CASE(UInt64)
+    COMPARATOR_CASE(Float)
+    COMPARATOR_CASE(Double)
+    COMPARATOR_CASE(Date32)
+    COMPARATOR_CASE(Date64)
+    COMPARATOR_CASE(Time32)
+    COMPARATOR_CASE(Time64)
+    COMPARATOR_CASE(Timestamp)
+    COMPARATOR_CASE(Duration)
+    COMPARATOR_CASE(String)
+    COMPARATOR_CASE(Binary)
+    COMPARATOR_CASE(LargeString)
+    COMPARATOR_CASE(LargeBinary)
+    COMPARATOR_CASE(StringView)
+    COMPARATOR_CASE(BinaryView)
+    COMPARATOR_CASE(FixedSizeBinary)
+
+#undef COMPARATOR_CASE
+    default:
+      return Status::NotImplemented("Merge join on a key of type ", type);
+  }
+}
+
+// The first index in [begin, end) for which `pred` is false, given that `pred` is true
+// for some prefix of the range and false for the rest
+template <typename Predicate>
+int64_t PartitionPoint(int64_t begin, int64_t end, Predicate&& pred) {
+  while (begin < end) {
+    const int64_t mid = begin + (end - begin) / 2;
+    if (pred(mid)) {
+      begin = mid + 1;
+    } else {
+      end = mid;
+    }
+  }
+  return begin;
+}
+
+// A batch of one input, along with its key columns
+struct InputChunk {
+  std::shared_ptr<RecordBatch> batch;
+  std::vector<std::shared_ptr<Array>> keys;
+};
+
+// The rows of one input which share a key, possibly spread over several batches
+struct KeyRun {
+  std::vector<std::shared_ptr<RecordBatch>> slices;
+  int64_t length = 0;
+};
+
+class MergeJoinNode : public ExecNode, public TracedNode {
+ public:
+  MergeJoinNode(ExecPlan* plan, NodeVector inputs, std::shared_ptr<Schema> output_schema,
+                Ordering ordering, MergeJoinNodeOptions options,
+                std::array<std::vector<FieldPath>, 2> key_paths,
+                std::vector<std::unique_ptr<KeyComparator>> comparators,
+                std::array<bool, 2> verify_order)
+      : ExecNode(plan, std::move(inputs), {"left", "right"}, std::move(output_schema)),
+        TracedNode(this),
+        ordering_(std::move(ordering)),
+        options_(std::move(options)),
+        comparators_(std::move(comparators)),
+        output_left_(options_.join_type != JoinType::RIGHT_SEMI &&
+                     options_.join_type != JoinType::RIGHT_ANTI),
+        output_right_(options_.join_type != JoinType::LEFT_SEMI &&
+                      options_.join_type != JoinType::LEFT_ANTI) {
+    for (int side : {0, 1}) {
+      input_states_[side] = std::make_unique<InputState>(
+          this, side, std::move(key_paths[side]), verify_order[side]);
+    }
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 2, "MergeJoinNode"));
+    const auto& join_options = checked_cast<const MergeJoinNodeOptions&>(options);
+
+    const size_t num_keys = join_options.left_keys.size();
+    if (num_keys == 0) {
+      return Status::Invalid("Merge join requires at least one key");
+    }
+    if (join_options.right_keys.size() != num_keys) {
+      return Status::Invalid("left and right key lists have different lengths");
+    }
+
+    std::array<std::vector<FieldPath>, 2> key_paths;
+    for (int side : {0, 1}) {
+      const auto& keys = side == 0 ? join_options.left_keys : join_options.right_keys;
+      for (const FieldRef& key : keys) {
+        ARROW_ASSIGN_OR_RAISE(FieldPath path,
+                              key.FindOne(*inputs[side]->output_schema()));
+        key_paths[side].push_back(std::move(path));
+      }
+    }
+
+    // Check that the inputs are sorted on the keys, and in the same way
+    std::array<std::optional<std::vector<SortKey>>, 2> input_sort_keys;
+    for (int side : {0, 1}) {
+      const Ordering& ordering = inputs[side]->ordering();
+      if (ordering.is_unordered()) {
+        return Status::Invalid("The ", kSideNames[side],
+                               " input of the merge join is unordered, it must be "
+                               "sorted on the join keys");
+      }
+      if (ordering.is_implicit()) {
+        continue;
+      }
+      std::vector<SortKey> sort_keys = SortOptions(ordering).GetSortKeys();
+      bool ordered_on_keys = sort_keys.size() >= num_keys;
+      for (size_t i = 0; ordered_on_keys && i < num_keys; ++i) {
+        auto path = sort_keys[i].target.FindOne(*inputs[side]->output_schema());
+        ordered_on_keys = path.ok() && *path == key_paths[side][i];
+      }
+      if (!ordered_on_keys) {
+        return Status::Invalid("The ", kSideNames[side], " input of the merge join is ",
+                               ordering.ToString(), " which does not start with ",
+                               "the join keys");
+      }
+      sort_keys.erase(sort_keys.begin() + num_keys, sort_keys.end());
+      input_sort_keys[side] = std::move(sort_keys);
+    }
+    if (input_sort_keys[0] && input_sort_keys[1]) {
+      for (size_t i = 0; i < num_keys; ++i) {
+        const SortKey& left = (*input_sort_keys[0])[i];
+        const SortKey& right = (*input_sort_keys[1])[i];
+        if (left.order != right.order || left.null_placement != right.null_placement) {
+          return Status::Invalid("The inputs of the merge join are not sorted the same ",
+                                 "way on key ", i);
+        }
+      }
+    }
+    std::vector<SortKey> sort_keys;
+    if (input_sort_keys[0]) {
+      sort_keys = *input_sort_keys[0];
+    } else if (input_sort_keys[1]) {
+      sort_keys = *input_sort_keys[1];
+    } else {
+      for (const FieldRef& key : join_options.left_keys) {
+        sort_keys.emplace_back(key, SortOrder::Ascending, NullPlacement::AtEnd);
+      }
+    }
+
+    std::vector<std::unique_ptr<KeyComparator>> comparators;
+    for (size_t i = 0; i < num_keys; ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto left_field,
+                            key_paths[0][i].Get(*inputs[0]->output_schema()));
+      ARROW_ASSIGN_OR_RAISE(auto right_field,
+                            key_paths[1][i].Get(*inputs[1]->output_schema()));
+      if (!left_field->type()->Equals(*right_field->type())) {
+        return Status::Invalid("Data types of corresponding keys must match, got ",
+                               *left_field->type(), " and ", *right_field->type());
+      }
+      ARROW_ASSIGN_OR_RAISE(auto comparator,
+                            MakeKeyComparator(*left_field->type(), sort_keys[i]));
+      comparators.push_back(std::move(comparator));
+    }
+
+    const JoinType join_type = join_options.join_type;
+    const bool output_left =
+        join_type != JoinType::RIGHT_SEMI && join_type != JoinType::RIGHT_ANTI;
+    const bool output_right =
+        join_type != JoinType::LEFT_SEMI && join_type != JoinType::LEFT_ANTI;
+    FieldVector fields;
+    if (output_left) {
+      for (const auto& field : inputs[0]->output_schema()->fields()) {
+        fields.push_back(
+            field->WithName(field->name() + join_options.output_suffix_for_left));
+      }
+    }
+    if (output_right) {
+      for (const auto& field : inputs[1]->output_schema()->fields()) {
+        fields.push_back(
+            field->WithName(field->name() + join_options.output_suffix_for_right));
+      }
+    }
+
+    // Rows come out in key order, except for the unmatched right rows of right and
+    // full outer joins, whose left keys are null
+    Ordering ordering = Ordering::Unordered();
+    if (join_type != JoinType::RIGHT_OUTER && join_type != JoinType::FULL_OUTER) {
+      const int side = output_left ? 0 : 1;
+      std::vector<SortKey> output_sort_keys;
+      for (size_t i = 0; i < num_keys; ++i) {
+        output_sort_keys.emplace_back(FieldRef(key_paths[side][i]), sort_keys[i].order,
+                                      sort_keys[i].null_placement);
+      }
+      ordering = Ordering(std::move(output_sort_keys));
+    }
+
+    return plan->EmplaceNode<MergeJoinNode>(
+        plan, std::move(inputs), schema(std::move(fields)), std::move(ordering),
+        join_options, std::move(key_paths), std::move(comparators),
+        std::array<bool, 2>{!input_sort_keys[0], !input_sort_keys[1]});
+  }
+
+  const char* kind_name() const override { return "MergeJoinNode"; }
+
+  const Ordering& ordering() const override { return ordering_; }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch, input);
+    return input_states_[SideOf(input)]->sequencer->InsertBatch(std::move(batch));
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    std::vector<ExecBatch> out;
+    std::optional<int> total_out;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      input_states_[SideOf(input)]->total_batches = total_batches;
+      RETURN_NOT_OK(Advance(&out, &total_out));
+    }
+    return Emit(std::move(out), total_out);
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  // Backpressure from the output is forwarded to both inputs, in addition to the
+  // backpressure the merge applies itself, see Advance
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (counter <= output_backpressure_counter_) return;
+    output_backpressure_counter_ = counter;
+    output_paused_ = true;
+    for (int side : {0, 1}) {
+      UpdateBackpressure(side);
+    }
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (counter <= output_backpressure_counter_) return;
+    output_backpressure_counter_ = counter;
+    output_paused_ = false;
+    for (int side : {0, 1}) {
+      UpdateBackpressure(side);
+    }
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "type=" << acero::ToString(options_.join_type);
+    for (int side : {0, 1}) {
+      const auto& keys = side == 0 ? options_.left_keys : options_.right_keys;
+      ss << ", " << kSideNames[side] << "_keys=[";
+      for (size_t i = 0; i < keys.size(); ++i) {
+        ss << (i > 0 ? ", " : "") << keys[i].ToString();
+      }
+      ss << "]";
+    }
+    return ss.str();
+  }
+
+ private:
+  struct InputState : public util::SerialSequencingQueue::Processor {
+    InputState(MergeJoinNode* node, int side, std::vector<FieldPath> key_paths,
+               bool verify_order)
+        : node(node),
+          side(side),
+          key_paths(std::move(key_paths)),
+          verify_order(verify_order),
+          sequencer(util::SerialSequencingQueue::Make(this)) {}
+
+    Status Process(ExecBatch batch) override {
+      return node->ProcessBatch(side, std::move(batch));
+    }
+
+    bool finished() const { return num_processed == total_batches; }
+
+    MergeJoinNode* node;
+    const int side;
+    const std::vector<FieldPath> key_paths;
+    // Whether the input's ordering is implicit, so its order must be checked
+    const bool verify_order;
+    std::unique_ptr<util::SerialSequencingQueue> sequencer;
+    // The last non-empty batch, only accessed from Process
+    std::shared_ptr<InputChunk> last_chunk;
+
+    // The following are guarded by the node's mutex
+    std::deque<std::shared_ptr<InputChunk>> chunks;
+    // The first row of chunks.front() which has not been joined yet
+    int64_t offset = 0;
+    int64_t buffered_rows = 0;
+    int num_processed = 0;
+    int total_batches = -1;
+    // Whether the merge has buffered enough of this input while waiting on the other
+    bool merge_paused = false;
+    // Whether the input is currently paused, by the merge or by the output
+    bool paused = false;
+  };
+
+  // A row of one input
+  struct RowRef {
+    const InputChunk* chunk;
+    int64_t row;
+  };
+
+  int SideOf(ExecNode* input) const { return input == inputs_[0] ? 0 : 1; }
+
+  int CompareRows(const RowRef& left, const RowRef& right) const {
+    for (size_t i = 0; i < comparators_.size(); ++i) {
+      const int cmp = comparators_[i]->Compare(*left.chunk->keys[i], left.row,
+                                               *right.chunk->keys[i], right.row);
+      if (cmp != 0) {
+        return cmp;
+      }
+    }
+    return 0;
+  }
+
+  static bool HasNullKey(const RowRef& row) {
+    return std::any_of(row.chunk->keys.begin(), row.chunk->keys.end(),
+                       [&](const auto& key) { return key->IsNull(row.row); });
+  }
+
+  RowRef Front(int side) const {
+    const InputState& input = *input_states_[side];
+    return {input.chunks.front().get(), input.offset};
+  }
+
+  // Whether the rows of `side` which have no match appear in the output
+  bool EmitsUnmatched(int side) const {
+    switch (options_.join_type) {
+      case JoinType::LEFT_OUTER:
+      case JoinType::LEFT_ANTI:
+        return side == 0;
+      case JoinType::RIGHT_OUTER:
+      case JoinType::RIGHT_ANTI:
+        return side == 1;
+      case JoinType::FULL_OUTER:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  Status ProcessBatch(int side, ExecBatch batch) {
+    InputState& input = *input_states_[side];
+    std::shared_ptr<InputChunk> chunk;
+    if (batch.length > 0) {
+      chunk = std::make_shared<InputChunk>();
+      ARROW_ASSIGN_OR_RAISE(chunk->batch, batch.ToRecordBatch(
+                                              inputs_[side]->output_schema(),
+                                              plan_->query_context()->memory_pool()));
+      for (const FieldPath& path : input.key_paths) {
+        ARROW_ASSIGN_OR_RAISE(auto key,
+                              path.GetFlattened(*chunk->batch,
+                                                plan_->query_context()->memory_pool()));
+        chunk->keys.push_back(std::move(key));
+      }
+      if (input.verify_order) {
+        RETURN_NOT_OK(VerifyOrder(input, *chunk));
+      }
+      input.last_chunk = chunk;
+    }
+
+    std::vector<ExecBatch> out;
+    std::optional<int> total_out;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (chunk) {
+        input.buffered_rows += chunk->batch->num_rows();
+        input.chunks.push_back(std::move(chunk));
+      }
+      ++input.num_processed;
+      RETURN_NOT_OK(Advance(&out, &total_out));
+    }
+    return Emit(std::move(out), total_out);
+  }
+
+  Status VerifyOrder(const InputState& input, const InputChunk& chunk) const {
+    const InputChunk* last = input.last_chunk.get();
+    bool sorted =
+        !last || CompareRows({last, last->batch->num_rows() - 1}, {&chunk, 0}) <= 0;
+    for (int64_t i = 1; sorted && i < chunk.batch->num_rows(); ++i) {
+      sorted = CompareRows({&chunk, i - 1}, {&chunk, i}) <= 0;
+    }
+    if (!sorted) {
+      return Status::Invalid("The ", kSideNames[input.side],
+                             " input of the merge join is not sorted on the join keys");
+    }
+    return Status::OK();
+  }
+
+  Status Emit(std::vector<ExecBatch> out, std::optional<int> total_out) {
+    for (ExecBatch& batch : out) {
+      RETURN_NOT_OK(output_->InputReceived(this, std::move(batch)));
+    }
+    if (total_out) {
+      return output_->InputFinished(this, *total_out);
+    }
+    return Status::OK();
+  }
+
+  // Joins as many of the buffered rows as possible, and pauses or resumes the inputs
+  // depending on which of them the merge is waiting on.  mutex_ must be held.
+  Status Advance(std::vector<ExecBatch>* out, std::optional<int>* total_out) {
+    InputState& left = *input_states_[0];
+    InputState& right = *input_states_[1];
+    std::array<bool, 2> waiting = {false, false};
+    while (true) {
+      if (left.chunks.empty() && left.finished()) {
+        RETURN_NOT_OK(EmitRemaining(1));
+        waiting[1] = !right.finished();
+        break;
+      }
+      if (right.chunks.empty() && right.finished()) {
+        RETURN_NOT_OK(EmitRemaining(0));
+        waiting[0] = !left.finished();
+        break;
+      }
+      if (left.chunks.empty() || right.chunks.empty()) {
+        waiting = {left.chunks.empty(), right.chunks.empty()};
+        break;
+      }
+      const int cmp = CompareRows(Front(0), Front(1));
+      if (cmp != 0) {
+        RETURN_NOT_OK(EmitUnmatchedBefore(cmp < 0 ? 0 : 1));
+        continue;
+      }
+      std::array<KeyRun, 2> runs;
+      for (int side : {0, 1}) {
+        waiting[side] = !FindRun(side, &runs[side]);
+      }
+      if (waiting[0] || waiting[1]) {
+        break;
+      }
+      RETURN_NOT_OK(EmitRuns(std::move(runs)));
+    }
+
+    if (left.chunks.empty() && right.chunks.empty() && left.finished() &&
+        right.finished()) {
+      if (!finished_) {
+        finished_ = true;
+        RETURN_NOT_OK(FlushPending());
+        *total_out = batches_emitted_;
+      }
+    } else {
+      for (int side : {0, 1}) {
+        InputState& input = *input_states_[side];
+        input.merge_paused =
+            !waiting[side] && input.buffered_rows >= kPauseThresholdRows;
+        UpdateBackpressure(side);
+      }
+    }
+    *out = std::move(ready_);
+    ready_.clear();
+    return Status::OK();
+  }
+
+  // Pauses or resumes an input to match the merge's and the output's backpressure.
+  // mutex_ must be held.
+  void UpdateBackpressure(int side) {
+    InputState& input = *input_states_[side];
+    const bool pause = input.merge_paused || output_paused_;
+    if (pause == input.paused) return;
+    input.paused = pause;
+    if (pause) {
+      inputs_[side]->PauseProducing(this, ++backpressure_counter_);
+    } else {
+      inputs_[side]->ResumeProducing(this, ++backpressure_counter_);
+    }
+  }
+
+  // Drops the first `length` buffered rows of `side`
+  void Consume(int side, int64_t length) {
+    InputState& input = *input_states_[side];
+    input.buffered_rows -= length;
+    while (length > 0) {
+      const int64_t remaining = input.chunks.front()->batch->num_rows() - input.offset;
+      if (length < remaining) {
+        input.offset += length;
+        return;
+      }
+      length -= remaining;
+      input.chunks.pop_front();
+      input.offset = 0;
+    }
+  }
+
+  // Emits the rows at the front of the first batch of `side` whose keys sort before the
+  // first key of the other side
+  Status EmitUnmatchedBefore(int side) {
+    const RowRef bound = Front(1 - side);
+    const RowRef front = Front(side);
+    const int64_t end =
+        PartitionPoint(front.row, front.chunk->batch->num_rows(), [&](int64_t row) {
+          return CompareRows({front.chunk, row}, bound) < 0;
+        });
+    if (EmitsUnmatched(side)) {
+      RETURN_NOT_OK(
+          EmitRows(side, front.chunk->batch->Slice(front.row, end - front.row)));
+    }
+    Consume(side, end - front.row);
+    return Status::OK();
+  }
+
+  // Emits everything which is buffered on `side`, once the other side is exhausted
+  Status EmitRemaining(int side) {
+    InputState& input = *input_states_[side];
+    if (EmitsUnmatched(side)) {
+      for (const auto& chunk : input.chunks) {
+        RETURN_NOT_OK(EmitRows(side, chunk->batch->Slice(input.offset)));
+        input.offset = 0;
+      }
+    }
+    input.chunks.clear();
+    input.offset = 0;
+    input.buffered_rows = 0;
+    return Status::OK();
+  }
+
+  // Collects the rows of `side` whose key is the same as its first row.  Returns false
+  // if more rows with that key may still arrive.
+  bool FindRun(int side, KeyRun* run) const {
+    const InputState& input = *input_states_[side];
+    const RowRef first = Front(side);
+    int64_t begin = input.offset;
+    for (const auto& chunk : input.chunks) {
+      const int64_t num_rows = chunk->batch->num_rows();
+      const int64_t end = PartitionPoint(begin, num_rows, [&](int64_t row) {
+        return CompareRows({chunk.get(), row}, first) == 0;
+      });
+      if (end > begin) {
+        run->slices.push_back(chunk->batch->Slice(begin, end - begin));
+        run->length += end - begin;
+      }
+      if (end < num_rows) {
+        return true;
+      }
+      begin = 0;
+    }
+    return input.finished();
+  }
+
+  // Emits the join of two runs of rows with the same key
+  Status EmitRuns(std::array<KeyRun, 2> runs) {
+    const bool matches = !HasNullKey(Front(0));
+    for (int side : {0, 1}) {
+      Consume(side, runs[side].length);
+    }
+    if (!matches) {
+      for (int side : {0, 1}) {
+        if (EmitsUnmatched(side)) {
+          for (auto& slice : runs[side].slices) {
+            RETURN_NOT_OK(EmitRows(side, std::move(slice)));
+          }
+        }
+      }
+      return Status::OK();
+    }
+
+    switch (options_.join_type) {
+      case JoinType::LEFT_ANTI:
+      case JoinType::RIGHT_ANTI:
+        return Status::OK();
+      case JoinType::LEFT_SEMI:
+      case JoinType::RIGHT_SEMI: {
+        const int side = options_.join_type == JoinType::LEFT_SEMI ? 0 : 1;
+        for (auto& slice : runs[side].slices) {
+          RETURN_NOT_OK(EmitRows(side, std::move(slice)));
+        }
+        return Status::OK();
+      }
+      default:
+        break;
+    }
+
+    std::array<std::shared_ptr<RecordBatch>, 2> rows;
+    for (int side : {0, 1}) {
+      if (runs[side].slices.size() == 1) {
+        rows[side] = std::move(runs[side].slices[0]);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            rows[side], ConcatenateRecordBatches(runs[side].slices,
+                                                 plan_->query_context()->memory_pool()));
+      }
+    }
+
+    // Emit the cross product of the runs, in order of the left rows
+    const int64_t right_length = runs[1].length;
+    const int64_t total = runs[0].length * right_length;
+    for (int64_t begin = 0; begin < total; begin += ExecPlan::kMaxBatchSize) {
+      const int64_t length = std::min<int64_t>(ExecPlan::kMaxBatchSize, total - begin);
+      std::array<std::shared_ptr<Buffer>, 2> indices;
+      for (int side : {0, 1}) {
+        ARROW_ASSIGN_OR_RAISE(indices[side],
+                              AllocateBuffer(length * sizeof(int64_t),
+                                             plan_->query_context()->memory_pool()));
+      }
+      auto* left_indices = indices[0]->mutable_data_as<int64_t>();
+      auto* right_indices = indices[1]->mutable_data_as<int64_t>();
+      for (int64_t i = 0; i < length; ++i) {
+        left_indices[i] = (begin + i) / right_length;
+        right_indices[i] = (begin + i) % right_length;
+      }
+      ArrayVector columns;
+      for (int side : {0, 1}) {
+        auto side_indices =
+            std::make_shared<Int64Array>(length, std::move(indices[side]));
+        ARROW_ASSIGN_OR_RAISE(
+            Datum taken,
+            compute::Take(rows[side], side_indices, compute::TakeOptions::NoBoundsCheck(),
+                          plan_->query_context()->exec_context()));
+        const ArrayVector& side_columns = taken.record_batch()->columns();
+        columns.insert(columns.end(), side_columns.begin(), side_columns.end());
+      }
+      RETURN_NOT_OK(AddPending(RecordBatch::Make(output_schema_, length, columns)));
+    }
+    return Status::OK();
+  }
+
+  // Emits rows of one side, with nulls for the other side if it is part of the output
+  Status EmitRows(int side, std::shared_ptr<RecordBatch> rows) {
+    const int64_t length = rows->num_rows();
+    if (length == 0) {
+      return Status::OK();
+    }
+    ArrayVector columns;
+    for (int column_side : {0, 1}) {
+      if (!(column_side == 0 ? output_left_ : output_right_)) {
+        continue;
+      }
+      if (column_side == side) {
+        columns.insert(columns.end(), rows->columns().begin(), rows->columns().end());
+        continue;
+      }
+      for (const auto& field : inputs_[column_side]->output_schema()->fields()) {
+        ARROW_ASSIGN_OR_RAISE(auto nulls,
+                              MakeArrayOfNull(field->type(), length,
+                                              plan_->query_context()->memory_pool()));
+        columns.push_back(std::move(nulls));
+      }
+    }
+    return AddPending(RecordBatch::Make(output_schema_, length, std::move(columns)));
+  }
+
+  Status AddPending(std::shared_ptr<RecordBatch> rows) {
+    if (pending_rows_ + rows->num_rows() > ExecPlan::kMaxBatchSize) {
+      RETURN_NOT_OK(FlushPending());
+    }
+    pending_rows_ += rows->num_rows();
+    pending_.push_back(std::move(rows));
+    if (pending_rows_ >= ExecPlan::kMaxBatchSize) {
+      return FlushPending();
+    }
+    return Status::OK();
+  }
+
+  Status FlushPending() {
+    if (pending_.empty()) {
+      return Status::OK();
+    }
+    std::shared_ptr<RecordBatch> batch;
+    if (pending_.size() == 1) {
+      batch = std::move(pending_[0]);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(batch, ConcatenateRecordBatches(
+                                       pending_, plan_->query_context()->memory_pool()));
+    }
+    pending_.clear();
+    pending_rows_ = 0;
+    ExecBatch out(*batch);
+    out.index = batches_emitted_++;
+    ready_.push_back(std::move(out));
+    return Status::OK();
+  }
+
+  const Ordering ordering_;
+  const MergeJoinNodeOptions options_;
+  const std::vector<std::unique_ptr<KeyComparator>> comparators_;
+  const bool output_left_;
+  const bool output_right_;
+  std::array<std::unique_ptr<InputState>, 2> input_states_;
+
+  std::mutex mutex_;
+  // Output rows not yet gathered into a batch
+  std::vector<std::shared_ptr<RecordBatch>> pending_;
+  int64_t pending_rows_ = 0;
+  // Batches to deliver once mutex_ is released
+  std::vector<ExecBatch> ready_;
+  int batches_emitted_ = 0;
+  int32_t backpressure_counter_ = 0;
+  int32_t output_backpressure_counter_ = 0;
+  bool output_paused_ = false;
+  bool finished_ = false;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterMergeJoinNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(MergeJoinNodeOptions::kName),
+                                 MergeJoinNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,230 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/acero/util.h"
+#include "arrow/table.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using compute::NullPlacement;
+using compute::Ordering;
+using compute::SortKey;
+using compute::SortOrder;
+
+namespace acero {
+
+constexpr JoinType kJoinTypes[] = {JoinType::LEFT_SEMI,  JoinType::RIGHT_SEMI,
+                                   JoinType::LEFT_ANTI,  JoinType::RIGHT_ANTI,
+                                   JoinType::INNER,      JoinType::LEFT_OUTER,
+                                   JoinType::RIGHT_OUTER, JoinType::FULL_OUTER};
+
+std::shared_ptr<Table> RandomTable(int64_t num_rows, double null_probability,
+                                   random::SeedType seed) {
+  random::RandomArrayGenerator rng(seed);
+  auto payload = rng.Int64(num_rows, 0, 1000);
+  auto key = rng.Int32(num_rows, 0, 20, null_probability);
+  auto str_key = rng.StringWithRepeats(num_rows, /*unique=*/3, /*min_length=*/1,
+                                       /*max_length=*/2, null_probability);
+  return Table::Make(schema({field("k", int32()), field("s", utf8()),
+                             field("v", int64())}),
+                     {key, str_key, payload});
+}
+
+Declaration SortedSource(std::shared_ptr<Table> table, std::vector<SortKey> keys) {
+  return Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(std::move(table), /*max_batch_size=*/16)},
+       {"order_by", OrderByNodeOptions(Ordering(std::move(keys)))}});
+}
+
+void CheckAgainstHashJoin(const std::shared_ptr<Table>& left,
+                          const std::shared_ptr<Table>& right,
+                          const std::vector<FieldRef>& keys,
+                          const std::vector<SortKey>& sort_keys) {
+  for (JoinType join_type : kJoinTypes) {
+    ARROW_SCOPED_TRACE("join_type=", ToString(join_type));
+    Declaration merge_join{
+        "mergejoin",
+        {SortedSource(left, sort_keys), SortedSource(right, sort_keys)},
+        MergeJoinNodeOptions(join_type, keys, keys, "_l", "_r")};
+    Declaration hash_join{
+        "hashjoin",
+        {Declaration("table_source", TableSourceNodeOptions(left)),
+         Declaration("table_source", TableSourceNodeOptions(right))},
+        HashJoinNodeOptions(join_type, keys, keys, compute::literal(true), "_l", "_r")};
+    ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(std::move(hash_join)));
+    for (bool use_threads : {false, true}) {
+      ARROW_SCOPED_TRACE("use_threads=", use_threads);
+      ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(merge_join, use_threads));
+      AssertSchemaEqual(*expected->schema(), *actual->schema());
+      AssertTablesEqualIgnoringOrder(expected, actual);
+    }
+  }
+}
+
+TEST(MergeJoinNode, MatchesHashJoin) {
+  auto left = RandomTable(300, 0.1, 42);
+  auto right = RandomTable(200, 0.1, 43);
+  CheckAgainstHashJoin(left, right, {"k"}, {SortKey("k")});
+  CheckAgainstHashJoin(
+      left, right, {"k", "s"},
+      {SortKey("k", SortOrder::Descending, NullPlacement::AtStart), SortKey("s")});
+}
+
+TEST(MergeJoinNode, LongKeyRuns) {
+  // Runs of equal keys span many batches on both sides
+  auto left = RandomTable(500, 0.0, 44);
+  auto right = RandomTable(400, 0.0, 45);
+  CheckAgainstHashJoin(left, right, {"s"}, {SortKey("s")});
+}
+
+TEST(MergeJoinNode, OutputOrdering) {
+  auto left = TableFromJSON(schema({field("k", int32()), field("a", utf8())}),
+                            {R"([[1, "a"], [3, "b"], [3, "c"], [null, "d"]])"});
+  auto right = TableFromJSON(schema({field("k", int32()), field("b", utf8())}),
+                             {R"([[3, "x"], [0, "y"], [3, "z"], [1, "w"]])"});
+  Declaration plan{
+      "mergejoin",
+      {SortedSource(left, {SortKey("k")}), SortedSource(right, {SortKey("k")})},
+      MergeJoinNodeOptions(JoinType::LEFT_OUTER, {"k"}, {"k"}, "", "_r")};
+  QueryOptions query_options;
+  query_options.sequence_output = true;
+  ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(std::move(plan), query_options));
+  // Rows with equal keys come out in the order of the left input, then the right input
+  auto expected = TableFromJSON(
+      schema({field("k", int32()), field("a", utf8()), field("k_r", int32()),
+              field("b", utf8())}),
+      {R"([[1, "a", 1, "w"],
+           [3, "b", 3, "x"],
+           [3, "b", 3, "z"],
+           [3, "c", 3, "x"],
+           [3, "c", 3, "z"],
+           [null, "d", null, null]])"});
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(MergeJoinNode, ImplicitOrdering) {
+  // Inputs which are already sorted can be joined without an order_by node
+  auto left = TableFromJSON(schema({field("k", int32()), field("a", int32())}),
+                            {R"([[1, 10], [2, 20]])", R"([[2, 21], [5, 50]])"});
+  auto right = TableFromJSON(schema({field("k", int32()), field("b", int32())}),
+                             {R"([[0, 0], [2, 200], [5, 500]])"});
+  auto make_plan = [](std::shared_ptr<Table> left, std::shared_ptr<Table> right) {
+    return Declaration{"mergejoin",
+                       {Declaration("table_source", TableSourceNodeOptions(left)),
+                        Declaration("table_source", TableSourceNodeOptions(right))},
+                       MergeJoinNodeOptions(JoinType::INNER, {"k"}, {"k"}, "", "_r")};
+  };
+  ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(make_plan(left, right)));
+  auto expected =
+      TableFromJSON(schema({field("k", int32()), field("a", int32()),
+                            field("k_r", int32()), field("b", int32())}),
+                    {R"([[2, 20, 2, 200], [2, 21, 2, 200], [5, 50, 5, 500]])"});
+  AssertTablesEqualIgnoringOrder(expected, actual);
+
+  auto unsorted = TableFromJSON(schema({field("k", int32()), field("b", int32())}),
+                                {R"([[0, 0], [5, 500]])", R"([[2, 200]])"});
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("right input of the merge join is not sorted"),
+      DeclarationToStatus(make_plan(left, unsorted)));
+}
+
+TEST(MergeJoinNode, ForwardsBackpressure) {
+  auto left = RandomTable(300, 0.1, 48);
+  auto right = RandomTable(200, 0.1, 49);
+  Declaration hash_join{
+      "hashjoin",
+      {Declaration("table_source", TableSourceNodeOptions(left)),
+       Declaration("table_source", TableSourceNodeOptions(right))},
+      HashJoinNodeOptions(JoinType::INNER, {"k"}, {"k"}, compute::literal(true), "_l",
+                          "_r")};
+  ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(std::move(hash_join)));
+
+  PlanProfile profile;
+  QueryOptions query_options;
+  query_options.profile = &profile;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ExecPlan> plan, ExecPlan::Make(query_options));
+  // The sink pauses the join after every output batch.  The inputs are too small for
+  // the merge to pause them itself, so they are only paused by the sink.
+  AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+  std::shared_ptr<Schema> output_schema;
+  ASSERT_OK(Declaration::Sequence(
+                {Declaration{"mergejoin",
+                             {SortedSource(left, {SortKey("k")}),
+                              SortedSource(right, {SortKey("k")})},
+                             MergeJoinNodeOptions(JoinType::INNER, {"k"}, {"k"}, "_l",
+                                                  "_r")},
+                 {"sink", SinkNodeOptions(&sink_gen, &output_schema,
+                                          BackpressureOptions(1, 2))}})
+                .AddToPlan(plan.get()));
+  ASSERT_FINISHES_OK_AND_ASSIGN(std::vector<ExecBatch> batches,
+                                StartAndCollect(plan.get(), sink_gen));
+  ASSERT_OK_AND_ASSIGN(auto actual, TableFromExecBatches(output_schema, batches));
+  AssertTablesEqualIgnoringOrder(expected, actual);
+
+  int num_inputs = 0;
+  for (const NodeProfile& node : profile.nodes) {
+    if (node.kind == "OrderByNode") {
+      ++num_inputs;
+      ASSERT_GT(node.pause_count, 0);
+    }
+  }
+  ASSERT_EQ(num_inputs, 2);
+}
+
+TEST(MergeJoinNode, Invalid) {
+  auto left = RandomTable(10, 0.1, 46);
+  auto right = RandomTable(10, 0.1, 47);
+  auto check = [&](Declaration left_input, Declaration right_input,
+                   std::vector<FieldRef> keys) {
+    return DeclarationToStatus(
+        Declaration{"mergejoin",
+                    {std::move(left_input), std::move(right_input)},
+                    MergeJoinNodeOptions(JoinType::INNER, keys, keys)});
+  };
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("does not start with the join keys"),
+      check(SortedSource(left, {SortKey("s"), SortKey("k")}),
+            SortedSource(right, {SortKey("k")}), {"k"}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("not sorted the same way on key 0"),
+      check(SortedSource(left, {SortKey("k")}),
+            SortedSource(right, {SortKey("k", SortOrder::Descending)}), {"k"}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("left input of the merge join is unordered"),
+      check(Declaration("union",
+                        {Declaration("table_source", TableSourceNodeOptions(left)),
+                         Declaration("table_source", TableSourceNodeOptions(left))},
+                        ExecNodeOptions{}),
+            SortedSource(right, {SortKey("k")}), {"k"}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("at least one key"),
+      check(SortedSource(left, {SortKey("k")}), SortedSource(right, {SortKey("k")}),
+            {}));
+}
+
+}  // namespace acero
+}  // namespace arrow
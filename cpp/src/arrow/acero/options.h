@@ -103,6 +103,11 @@ class ARROW_ACERO_EXPORT SourceNodeOptions : public ExecNodeOptions {
   std::function<Future<std::optional<ExecBatch>>()> generator;
   /// \brief the order of the data, defaults to Ordering::Unordered
   Ordering ordering;
+  /// \brief receives the runtime filters of downstream hash joins, if set
+  ///
+  /// This lets the producer of `generator` skip data which cannot join, e.g. the files
+  /// or row groups of a dataset.
+  std::shared_ptr<RuntimeFilterReceiver> runtime_filter_receiver;
 };
 
 /// \brief a node that generates data from a table already loaded in memory
@@ -518,6 +523,10 @@ class ARROW_ACERO_EXPORT ConsumingSinkNodeOptions : public ExecNodeOptions {
 ///
 /// All batches pushed to this node will be accumulated, then sorted, by the given
 /// fields. Then sorted batches will be forwarded to the generator in sorted order.
+///
+/// If QueryOptions::spill_threshold_bytes is set the sort may spill to disk, in which
+/// case the sorted runs are merged as the generator is consumed and the plan does not
+/// finish until the generator has been read to the end.
 class ARROW_ACERO_EXPORT OrderBySinkNodeOptions : public SinkNodeOptions {
  public:
   /// \brief create an instance from values
@@ -535,7 +544,11 @@ class ARROW_ACERO_EXPORT OrderBySinkNodeOptions : public SinkNodeOptions {
 /// Currently this node works by accumulating all data, sorting, and then emitting
 /// the new data with an updated batch index.
 ///
-/// Larger-than-memory sort is not currently supported.
+/// If QueryOptions::spill_threshold_bytes is set then the accumulated data is
+/// periodically sorted and spilled to disk, and the sorted runs are merged once all
+/// input has arrived.  This allows sorting more data than fits in memory.  The merged
+/// output is produced as it is consumed and stops while the output applies
+/// backpressure.
 class ARROW_ACERO_EXPORT OrderByNodeOptions : public ExecNodeOptions {
  public:
   static constexpr std::string_view kName = "order_by";
@@ -545,6 +558,83 @@ class ARROW_ACERO_EXPORT OrderByNodeOptions : public ExecNodeOptions {
   Ordering ordering;
 };
 
+/// \brief How the bounds of a WindowFrame are measured
+enum class WindowFrameUnits {
+  /// The bounds are a number of rows before and after the current row
+  ROWS,
+  /// The bounds are a distance from the ordering key of the current row
+  ///
+  /// Rows with equal ordering keys (peers) always share the same frame.  Bounds
+  /// other than 0 and unbounded require a single ordering key of an integer,
+  /// floating-point or temporal type.  Temporal keys are measured in their own unit.
+  RANGE
+};
+
+/// \brief The rows, relative to the current row, a window aggregate is computed over
+///
+/// The frame of a row spans from `preceding` before the current row to `following`
+/// after it (both inclusive), within the row's partition.  A bound that is not set
+/// means the frame extends to the start (or end) of the partition.  Bounds may be
+/// negative, e.g. preceding = 3 and following = -1 is the frame of the three rows before
+/// the current row.
+///
+/// The default frame is the running frame from the start of the partition to the
+/// current row.
+struct ARROW_ACERO_EXPORT WindowFrame {
+  WindowFrameUnits units = WindowFrameUnits::ROWS;
+  std::optional<int64_t> preceding = std::nullopt;
+  std::optional<int64_t> following = 0;
+
+  /// \brief A frame spanning the whole partition of the current row
+  static WindowFrame Unbounded() {
+    return {WindowFrameUnits::ROWS, std::nullopt, std::nullopt};
+  }
+};
+
+/// \brief a node which computes window functions
+///
+/// Input rows are divided into partitions by `partition_keys` and sorted within each
+/// partition by `ordering`.  For each function, one value is computed for every row
+/// from the rows of its partition.  The output contains the input columns followed by
+/// one column per function, and is sorted by the partition keys (ascending) and then by
+/// `ordering`.
+///
+/// The following functions are supported:
+///  - "row_number", "rank" and "dense_rank", which take no target and don't depend on
+///    the frame.  Ranks are computed from the `ordering` keys.
+///  - hash aggregate functions, computed over the `frame` of each row.  If the frame
+///    spans the whole partition, any hash aggregate function can be used.  Other frames
+///    are computed incrementally, with a single pass over the partition, and support
+///    "hash_count" and, for numeric targets, "hash_sum", "hash_mean", "hash_min" and
+///    "hash_max".
+///
+/// This node is a pipeline breaker.  The sort may spill if
+/// QueryOptions::spill_threshold_bytes is set, but each partition is held in memory
+/// while its functions are computed.
+class ARROW_ACERO_EXPORT WindowNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "window";
+  explicit WindowNodeOptions(std::vector<Aggregate> functions,
+                             std::vector<FieldRef> partition_keys = {},
+                             Ordering ordering = Ordering::Unordered(),
+                             WindowFrame frame = {})
+      : functions(std::move(functions)),
+        partition_keys(std::move(partition_keys)),
+        ordering(std::move(ordering)),
+        frame(std::move(frame)) {}
+
+  /// \brief The window functions to compute
+  ///
+  /// The name of each function is used as the name of its output column.
+  std::vector<Aggregate> functions;
+  /// \brief The keys that divide the input into partitions (optional)
+  std::vector<FieldRef> partition_keys;
+  /// \brief The order of rows within a partition (optional)
+  Ordering ordering;
+  /// \brief The frame aggregate functions are computed over
+  WindowFrame frame;
+};
+
 enum class JoinType {
   LEFT_SEMI,
   RIGHT_SEMI,
@@ -561,6 +651,26 @@ std::string ToString(JoinType t);
 enum class JoinKeyCmp { EQ, IS };
 
 /// \brief a node which implements a join operation using a hash table
+///
+/// The hash table is built from the right (build) input.  If
+/// QueryOptions::spill_threshold_bytes is set and the build input does not fit in it,
+/// both inputs are partitioned by a hash of their keys and the partitions that do not
+/// fit are written to temporary files and joined one at a time once the in-memory
+/// partitions have been joined.  The Bloom filter of a join that spilled is only
+/// built from the partitions that stayed in memory, so it lets all the rows of the
+/// spilled partitions through, and it is not published to the scans as a runtime
+/// filter.  Spilling is not supported if either input has dictionary, large binary or
+/// extension columns.
+///
+/// Unless disable_bloom_filter is set, a join which does not output unmatched
+/// probe-side rows and whose keys are all compared with EQ also publishes its Bloom
+/// filter and the range of its build-side keys as a RuntimeFilter to the node feeding
+/// its probe side (e.g. a dataset scan), looking through filter nodes.
+///
+/// If choose_build_side is set, the node instead buffers both inputs until one of them
+/// is complete and the other one is known to have at least as many rows, and builds the
+/// hash table from the smaller one.  The output is the same whichever side is chosen.
+/// Such a join neither spills nor uses Bloom filters.
 class ARROW_ACERO_EXPORT HashJoinNodeOptions : public ExecNodeOptions {
  public:
   static constexpr const char* default_output_suffix_for_left = "";
@@ -680,6 +790,9 @@ class ARROW_ACERO_EXPORT HashJoinNodeOptions : public ExecNodeOptions {
   Expression filter = literal(true);
   // whether or not to disable Bloom filters in this join
   bool disable_bloom_filter = false;
+  // whether to build the hash table from the smaller input, as found at runtime,
+  // instead of always from the right input
+  bool choose_build_side = false;
 };
 
 /// \brief a node which implements the asof join operation
@@ -737,6 +850,47 @@ class ARROW_ACERO_EXPORT AsofJoinNodeOptions : public ExecNodeOptions {
   int64_t tolerance;
 };
 
+/// \brief a node which implements an equi-join on inputs which are sorted on the keys
+///
+/// Unlike the hash join, this node does not build a hash table.  It walks both inputs
+/// in key order and only buffers the rows of the current key on each side, plus
+/// whatever arrives on one input while the node is waiting on the other.
+///
+/// If an input has an explicit ordering (e.g. it is the output of an order_by node)
+/// then its first sort keys must be the join keys, in the same order.  If an input's
+/// ordering is implicit (e.g. a file which was written sorted) then it is assumed to
+/// be sorted like the other input, or ascending with nulls at the end if neither input
+/// has an explicit ordering, and this is verified as the batches arrive.  Unordered
+/// inputs are rejected.
+///
+/// Keys are compared for equality only and nulls never match.  The output is ordered
+/// on the left keys for inner and left joins, on the right keys for right semi and
+/// right anti joins, and unordered for right and full outer joins.
+class ARROW_ACERO_EXPORT MergeJoinNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "mergejoin";
+  MergeJoinNodeOptions(JoinType join_type, std::vector<FieldRef> left_keys,
+                       std::vector<FieldRef> right_keys,
+                       std::string output_suffix_for_left = "",
+                       std::string output_suffix_for_right = "")
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)),
+        output_suffix_for_left(std::move(output_suffix_for_left)),
+        output_suffix_for_right(std::move(output_suffix_for_right)) {}
+
+  /// \brief the type of join to perform
+  JoinType join_type;
+  /// \brief key fields from the left input, which must be sorted on them
+  std::vector<FieldRef> left_keys;
+  /// \brief key fields from the right input, which must be sorted on them
+  std::vector<FieldRef> right_keys;
+  /// \brief suffix added to the names of the left fields in the output
+  std::string output_suffix_for_left;
+  /// \brief suffix added to the names of the right fields in the output
+  std::string output_suffix_for_right;
+};
+
 /// \brief a node which select top_k/bottom_k rows passed through it
 ///
 /// All batches pushed to this node will be accumulated, then selected, by the given
@@ -17,36 +17,333 @@
 
 #include "arrow/acero/order_by_impl.h"
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <vector>
+#include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/spill_util_internal.h"
+#include "arrow/array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/visit_type_inline.h"
 
 namespace arrow {
 
 using internal::checked_cast;
 
+using compute::NullPlacement;
+using compute::SortKey;
+using compute::SortOrder;
 using compute::TakeOptions;
 
 namespace acero {
 
+Result<std::shared_ptr<RecordBatchReader>> OrderByImpl::DoFinishAsReader(
+    int64_t max_batch_size) {
+  ARROW_ASSIGN_OR_RAISE(Datum sorted, DoFinish());
+  auto reader = std::make_shared<TableBatchReader>(sorted.table());
+  reader->set_chunksize(max_batch_size);
+  return reader;
+}
+
+namespace {
+
+// Compare two non-null values, returns -1, 0 or 1
+using ValueCompareFn = int (*)(const Array& left, int64_t left_index,
+                               const Array& right, int64_t right_index, SortOrder order,
+                               NullPlacement null_placement);
+
+template <typename Value>
+int CompareOrderedValues(const Value& left, const Value& right, SortOrder order) {
+  int compared = 0;
+  if (left < right) {
+    compared = -1;
+  } else if (right < left) {
+    compared = 1;
+  }
+  return order == SortOrder::Descending ? -compared : compared;
+}
+
+template <typename Type>
+int CompareViews(const Array& left, int64_t left_index, const Array& right,
+                 int64_t right_index, SortOrder order, NullPlacement null_placement) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  const auto left_value = checked_cast<const ArrayType&>(left).GetView(left_index);
+  const auto right_value = checked_cast<const ArrayType&>(right).GetView(right_index);
+  if constexpr (is_floating_type<Type>::value) {
+    // NaNs are placed like nulls, regardless of the sort order
+    const bool left_nan = std::isnan(left_value);
+    const bool right_nan = std::isnan(right_value);
+    if (left_nan || right_nan) {
+      if (left_nan && right_nan) {
+        return 0;
+      }
+      return (left_nan == (null_placement == NullPlacement::AtStart)) ? -1 : 1;
+    }
+  }
+  return CompareOrderedValues(left_value, right_value, order);
+}
+
+template <typename Type>
+int CompareDecimals(const Array& left, int64_t left_index, const Array& right,
+                    int64_t right_index, SortOrder order, NullPlacement) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using CType = typename TypeTraits<Type>::CType;
+  const CType left_value(checked_cast<const ArrayType&>(left).GetValue(left_index));
+  const CType right_value(checked_cast<const ArrayType&>(right).GetValue(right_index));
+  return CompareOrderedValues(left_value, right_value, order);
+}
+
+int CompareNulls(const Array&, int64_t, const Array&, int64_t, SortOrder,
+                 NullPlacement) {
+  return 0;
+}
+
+struct ValueCompareFnFactory {
+  template <typename Type>
+  Status Visit(const Type& type) {
+    if constexpr (std::is_same_v<Type, NullType>) {
+      fn = &CompareNulls;
+    } else if constexpr (std::is_same_v<Type, HalfFloatType> ||
+                         std::is_same_v<Type, DayTimeIntervalType> ||
+                         std::is_same_v<Type, MonthDayNanoIntervalType>) {
+      return Unsupported(type);
+    } else if constexpr (is_decimal_type<Type>::value) {
+      fn = &CompareDecimals<Type>;
+    } else if constexpr (is_boolean_type<Type>::value || is_number_type<Type>::value ||
+                         is_temporal_type<Type>::value ||
+                         is_base_binary_type<Type>::value ||
+                         is_binary_view_like_type<Type>::value ||
+                         is_fixed_size_binary_type<Type>::value) {
+      fn = &CompareViews<Type>;
+    } else {
+      return Unsupported(type);
+    }
+    return Status::OK();
+  }
+
+  Status Unsupported(const DataType& type) {
+    return Status::NotImplemented("Spilling sort does not support sort keys of type ",
+                                  type.ToString());
+  }
+
+  ValueCompareFn fn = nullptr;
+};
+
+// Compares rows of (possibly different) record batches with a common schema
+class BatchRowComparator {
+ public:
+  static Result<BatchRowComparator> Make(const Schema& schema,
+                                         const std::vector<SortKey>& sort_keys) {
+    BatchRowComparator comparator;
+    for (const SortKey& sort_key : sort_keys) {
+      ARROW_ASSIGN_OR_RAISE(FieldPath path, sort_key.target.FindOne(schema));
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Field> field, path.Get(schema));
+      ValueCompareFnFactory factory;
+      RETURN_NOT_OK(VisitTypeInline(*field->type(), &factory));
+      comparator.keys_.push_back(
+          {std::move(path), factory.fn, sort_key.order, sort_key.null_placement});
+    }
+    return comparator;
+  }
+
+  /// Extract the sort key columns of a batch, in sort key order
+  Result<ArrayVector> ResolveKeys(const RecordBatch& batch) const {
+    ArrayVector columns;
+    columns.reserve(keys_.size());
+    for (const auto& key : keys_) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> column, key.path.GetFlattened(batch));
+      columns.push_back(std::move(column));
+    }
+    return columns;
+  }
+
+  int Compare(const ArrayVector& left, int64_t left_index, const ArrayVector& right,
+              int64_t right_index) const {
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      const Key& key = keys_[i];
+      const Array& left_column = *left[i];
+      const Array& right_column = *right[i];
+      const bool left_null = left_column.IsNull(left_index);
+      const bool right_null = right_column.IsNull(right_index);
+      if (left_null || right_null) {
+        if (left_null && right_null) {
+          continue;
+        }
+        return (left_null == (key.null_placement == NullPlacement::AtStart)) ? -1 : 1;
+      }
+      const int compared = key.compare(left_column, left_index, right_column,
+                                       right_index, key.order, key.null_placement);
+      if (compared != 0) {
+        return compared;
+      }
+    }
+    return 0;
+  }
+
+ private:
+  struct Key {
+    FieldPath path;
+    ValueCompareFn compare;
+    SortOrder order;
+    NullPlacement null_placement;
+  };
+
+  std::vector<Key> keys_;
+};
+
+// Merges several streams of batches, each sorted on the same keys, into a
+// single sorted stream.  Only the current batch of each stream is held in memory and
+// each output batch is only merged when it is read.
+class SortedRunMerger : public RecordBatchReader {
+ public:
+  SortedRunMerger(std::shared_ptr<Schema> schema, BatchRowComparator comparator,
+                  std::vector<std::shared_ptr<RecordBatchReader>> runs,
+                  std::vector<std::unique_ptr<SpillFile>> files, int64_t max_batch_size,
+                  MemoryPool* pool)
+      : schema_(std::move(schema)),
+        comparator_(std::move(comparator)),
+        files_(std::move(files)),
+        max_batch_size_(max_batch_size),
+        pool_(pool) {
+    cursors_.resize(runs.size());
+    for (size_t i = 0; i < runs.size(); ++i) {
+      cursors_[i].reader = std::move(runs[i]);
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    *out = nullptr;
+    if (!initialized_) {
+      RETURN_NOT_OK(Init());
+    }
+    auto greater = [this](size_t left, size_t right) { return Greater(left, right); };
+    std::vector<std::shared_ptr<RecordBatch>> pending;
+    int64_t pending_rows = 0;
+    while (!heap_.empty() && pending_rows < max_batch_size_) {
+      std::pop_heap(heap_.begin(), heap_.end(), greater);
+      const size_t index = heap_.back();
+      heap_.pop_back();
+      Cursor& cursor = cursors_[index];
+
+      // Take a run of rows from this cursor for as long as they sort before the
+      // next smallest cursor, so consecutive rows become a single slice
+      const int64_t start = cursor.row;
+      const int64_t limit =
+          std::min(cursor.batch->num_rows(), start + max_batch_size_ - pending_rows);
+      cursor.row++;
+      while (cursor.row < limit && (heap_.empty() || !Greater(index, heap_.front()))) {
+        cursor.row++;
+      }
+      pending.push_back(cursor.batch->Slice(start, cursor.row - start));
+      pending_rows += cursor.row - start;
+
+      bool has_rows = true;
+      if (cursor.row == cursor.batch->num_rows()) {
+        ARROW_ASSIGN_OR_RAISE(has_rows, Advance(&cursor));
+      }
+      if (has_rows) {
+        heap_.push_back(index);
+        std::push_heap(heap_.begin(), heap_.end(), greater);
+      }
+    }
+    if (heap_.empty()) {
+      // All runs are exhausted, remove the spill files without waiting for the
+      // reader to be destroyed
+      cursors_.clear();
+      files_.clear();
+    }
+    if (pending.size() == 1) {
+      *out = std::move(pending.front());
+    } else if (!pending.empty()) {
+      ARROW_ASSIGN_OR_RAISE(*out, ConcatenateRecordBatches(pending, pool_));
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Cursor {
+    std::shared_ptr<RecordBatchReader> reader;
+    std::shared_ptr<RecordBatch> batch;
+    ArrayVector keys;
+    int64_t row = 0;
+  };
+
+  Status Init() {
+    initialized_ = true;
+    for (size_t i = 0; i < cursors_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(bool has_rows, Advance(&cursors_[i]));
+      if (has_rows) {
+        heap_.push_back(i);
+      }
+    }
+    std::make_heap(heap_.begin(), heap_.end(),
+                   [this](size_t left, size_t right) { return Greater(left, right); });
+    return Status::OK();
+  }
+
+  // Load the next non-empty batch, returns false if the stream is exhausted
+  Result<bool> Advance(Cursor* cursor) {
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(cursor->batch, cursor->reader->Next());
+      if (!cursor->batch) {
+        cursor->keys.clear();
+        return false;
+      }
+      if (cursor->batch->num_rows() > 0) {
+        ARROW_ASSIGN_OR_RAISE(cursor->keys, comparator_.ResolveKeys(*cursor->batch));
+        cursor->row = 0;
+        return true;
+      }
+    }
+  }
+
+  // Ties are broken by stream index so that the merge is stable
+  bool Greater(size_t left, size_t right) const {
+    const Cursor& l = cursors_[left];
+    const Cursor& r = cursors_[right];
+    const int compared = comparator_.Compare(l.keys, l.row, r.keys, r.row);
+    return compared > 0 || (compared == 0 && left > right);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  BatchRowComparator comparator_;
+  // Declared before the cursors so that the run readers are closed before the
+  // files are removed
+  std::vector<std::unique_ptr<SpillFile>> files_;
+  int64_t max_batch_size_;
+  MemoryPool* pool_;
+  bool initialized_ = false;
+  std::vector<Cursor> cursors_;
+  std::vector<size_t> heap_;
+};
+
+}  // namespace
+
 class SortBasicImpl : public OrderByImpl {
  public:
   SortBasicImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
                 const SortOptions& options = SortOptions{})
       : ctx_(ctx), output_schema_(output_schema), options_(options) {}
 
-  void InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+  Status InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
     std::unique_lock<std::mutex> lock(mutex_);
     batches_.push_back(batch);
+    return Status::OK();
   }
 
   Result<Datum> DoFinish() override {
@@ -89,6 +386,121 @@ class SelectKBasicImpl : public SortBasicImpl {
   const SelectKOptions options_;
 };
 
+// A sort which keeps a bounded amount of input in memory
+//
+// Input is buffered until it exceeds the query's spill threshold.  The buffered
+// rows are then sorted and written to a spill file as a "run".  When all input has
+// arrived, the runs and whatever is still buffered are combined with a k-way merge.
+class SortSpillingImpl : public OrderByImpl {
+ public:
+  SortSpillingImpl(QueryContext* ctx, const std::shared_ptr<Schema>& output_schema,
+                   const SortOptions& options, BatchRowComparator comparator)
+      : ctx_(ctx),
+        output_schema_(output_schema),
+        options_(options),
+        comparator_(std::move(comparator)) {}
+
+  Status InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+    std::vector<std::shared_ptr<RecordBatch>> to_spill;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      buffered_bytes_ += ::arrow::util::TotalBufferSize(*batch);
+      batches_.push_back(batch);
+      if (buffered_bytes_ < ctx_->spill_threshold_bytes()) {
+        return Status::OK();
+      }
+      to_spill.swap(batches_);
+      buffered_bytes_ = 0;
+    }
+    return SpillRun(std::move(to_spill));
+  }
+
+  Result<Datum> DoFinish() override {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> reader,
+                          DoFinishAsReader(ExecPlan::kMaxBatchSize));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> table, reader->ToTable());
+    return Datum(std::move(table));
+  }
+
+  Result<std::shared_ptr<RecordBatchReader>> DoFinishAsReader(
+      int64_t max_batch_size) override {
+    // All input has been received so the state only needs to be guarded while it is
+    // taken, the sort and the merge run without holding the lock
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    std::vector<std::unique_ptr<SpillFile>> files;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      batches.swap(batches_);
+      files.swap(runs_);
+      buffered_bytes_ = 0;
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> in_memory,
+                          SortBatches(std::move(batches)));
+    auto in_memory_reader = std::make_shared<TableBatchReader>(std::move(in_memory));
+    in_memory_reader->set_chunksize(max_batch_size);
+    streams_output_ = !files.empty();
+    if (files.empty()) {
+      return in_memory_reader;
+    }
+
+    std::vector<std::shared_ptr<RecordBatchReader>> runs;
+    runs.reserve(files.size() + 1);
+    for (const auto& file : files) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> reader,
+                            file->OpenReader());
+      runs.push_back(std::move(reader));
+    }
+    runs.push_back(std::move(in_memory_reader));
+    return std::make_shared<SortedRunMerger>(output_schema_, comparator_,
+                                             std::move(runs), std::move(files),
+                                             max_batch_size, ctx_->memory_pool());
+  }
+
+  bool streams_output() const override { return streams_output_; }
+
+  std::string ToString() const override { return options_.ToString(); }
+
+ private:
+  Result<std::shared_ptr<Table>> SortBatches(
+      std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ExecContext* exec_ctx = ctx_->exec_context();
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, options_, exec_ctx));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), exec_ctx));
+    return sorted.table();
+  }
+
+  Status SpillRun(std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted, SortBatches(std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<SpillFile> run,
+                          SpillFile::Make(ctx_, output_schema_, "order_by", profiler_));
+    TableBatchReader reader(*sorted);
+    reader.set_chunksize(ExecPlan::kMaxBatchSize);
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
+      if (!next) break;
+      RETURN_NOT_OK(run->Write(*next));
+    }
+    RETURN_NOT_OK(run->Finish());
+    std::lock_guard<std::mutex> lock(mutex_);
+    runs_.push_back(std::move(run));
+    return Status::OK();
+  }
+
+  QueryContext* ctx_;
+  std::shared_ptr<Schema> output_schema_;
+  const SortOptions options_;
+  BatchRowComparator comparator_;
+
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+  int64_t buffered_bytes_ = 0;
+  std::vector<std::unique_ptr<SpillFile>> runs_;
+  bool streams_output_ = false;
+};
+
 Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSort(
     ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
     const SortOptions& options) {
@@ -96,6 +508,24 @@ Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSort(
   return impl;
 }
 
+Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSort(
+    QueryContext* ctx, const std::shared_ptr<Schema>& output_schema,
+    const SortOptions& options) {
+  if (ctx->spill_threshold_bytes() <= 0) {
+    return MakeSort(ctx->exec_context(), output_schema, options);
+  }
+  Result<BatchRowComparator> comparator =
+      BatchRowComparator::Make(*output_schema, options.GetSortKeys());
+  if (comparator.status().IsNotImplemented()) {
+    // The merge can't compare these keys, sort in memory instead
+    return MakeSort(ctx->exec_context(), output_schema, options);
+  }
+  RETURN_NOT_OK(comparator.status());
+  std::unique_ptr<OrderByImpl> impl{
+      new SortSpillingImpl(ctx, output_schema, options, comparator.MoveValueUnsafe())};
+  return impl;
+}
+
 Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSelectK(
     ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
     const SelectKOptions& options) {
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -37,19 +38,50 @@ class OrderByImpl {
  public:
   virtual ~OrderByImpl() = default;
 
-  virtual void InputReceived(const std::shared_ptr<RecordBatch>& batch) = 0;
+  virtual Status InputReceived(const std::shared_ptr<RecordBatch>& batch) = 0;
 
   virtual Result<Datum> DoFinish() = 0;
 
+  /// \brief Return a reader over the ordered output
+  ///
+  /// The reader yields batches of at most `max_batch_size` rows.  The default
+  /// implementation slices the table returned by DoFinish.  Implementations which do
+  /// not hold all of their input in memory override this so that the output is only
+  /// produced as the reader is consumed.
+  virtual Result<std::shared_ptr<RecordBatchReader>> DoFinishAsReader(
+      int64_t max_batch_size);
+
+  /// \brief Whether the reader returned by DoFinishAsReader produces its batches
+  /// lazily, in which case callers should apply backpressure while consuming it
+  virtual bool streams_output() const { return false; }
+
   virtual std::string ToString() const = 0;
 
+  /// \brief Set the profiler of the node, to which spilled bytes are reported
+  void set_profiler(NodeProfiler* profiler) { profiler_ = profiler; }
+
   static Result<std::unique_ptr<OrderByImpl>> MakeSort(
       ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
       const SortOptions& options);
 
+  /// \brief Make a sort which respects the query's spill threshold
+  ///
+  /// If QueryContext::spill_threshold_bytes is set then input is buffered until
+  /// it exceeds the threshold, at which point the buffered rows are sorted and
+  /// written to a temporary file.  When input is finished the sorted runs are
+  /// merged, holding only one batch per run in memory.  Otherwise, or if the sort
+  /// keys have a type the merge cannot compare (e.g. dictionaries), this is the same
+  /// as MakeSort(ctx->exec_context(), ...).
+  static Result<std::unique_ptr<OrderByImpl>> MakeSort(
+      QueryContext* ctx, const std::shared_ptr<Schema>& output_schema,
+      const SortOptions& options);
+
   static Result<std::unique_ptr<OrderByImpl>> MakeSelectK(
       ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
       const SelectKOptions& options);
+
+ protected:
+  NodeProfiler* profiler_ = NULLPTR;
 };
 
 }  // namespace acero
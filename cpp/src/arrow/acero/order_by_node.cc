@@ -25,6 +25,7 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/exec_plan_internal.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/order_by_impl.h"
 #include "arrow/acero/query_context.h"
 #include "arrow/acero/util.h"
 #include "arrow/result.h"
@@ -37,18 +38,20 @@ namespace arrow {
 
 using internal::checked_cast;
 
-using compute::TakeOptions;
-
 namespace acero {
 namespace {
 
 class OrderByNode : public ExecNode, public TracedNode {
  public:
   OrderByNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-              std::shared_ptr<Schema> output_schema, Ordering new_ordering)
+              std::shared_ptr<Schema> output_schema, Ordering new_ordering,
+              std::unique_ptr<OrderByImpl> impl)
       : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
         TracedNode(this),
-        ordering_(std::move(new_ordering)) {}
+        ordering_(std::move(new_ordering)),
+        impl_(std::move(impl)) {
+    impl_->set_profiler(profiler());
+  }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -61,8 +64,13 @@ class OrderByNode : public ExecNode, public TracedNode {
     }
 
     std::shared_ptr<Schema> output_schema = inputs[0]->output_schema();
-    return plan->EmplaceNode<OrderByNode>(
-        plan, std::move(inputs), std::move(output_schema), order_options.ordering);
+    ARROW_ASSIGN_OR_RAISE(
+        std::unique_ptr<OrderByImpl> impl,
+        OrderByImpl::MakeSort(plan->query_context(), output_schema,
+                              SortOptions(order_options.ordering)));
+    return plan->EmplaceNode<OrderByNode>(plan, std::move(inputs),
+                                          std::move(output_schema),
+                                          order_options.ordering, std::move(impl));
   }
 
   const char* kind_name() const override { return "OrderByNode"; }
@@ -86,14 +94,50 @@ class OrderByNode : public ExecNode, public TracedNode {
   }
 
   void PauseProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordPaused(counter);
     inputs_[0]->PauseProducing(this, counter);
+    std::lock_guard<std::mutex> lock(emit_mutex_);
+    if (counter <= backpressure_counter_) {
+      return;
+    }
+    backpressure_counter_ = counter;
+    paused_ = true;
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordResumed(counter);
     inputs_[0]->ResumeProducing(this, counter);
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      if (counter <= backpressure_counter_) {
+        return;
+      }
+      backpressure_counter_ = counter;
+      paused_ = false;
+      if (!emit_done_.is_valid() || emitting_ || finished_ || stopped_) {
+        return;
+      }
+      emitting_ = true;
+    }
+    plan_->query_context()->ScheduleTask([this] { return EmitSorted(); },
+                                         "OrderByNode::EmitSorted");
   }
 
-  Status StopProducingImpl() override { return Status::OK(); }
+  Status StopProducingImpl() override {
+    Future<> emit_done;
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      stopped_ = true;
+      if (!emit_done_.is_valid() || emitting_ || finished_) {
+        // A running EmitSorted notices the stop and finishes by itself
+        return Status::OK();
+      }
+      finished_ = true;
+      emit_done = emit_done_;
+    }
+    emit_done.MarkFinished();
+    return Status::OK();
+  }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
     auto scope = TraceInputReceived(batch);
@@ -102,10 +146,7 @@ class OrderByNode : public ExecNode, public TracedNode {
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
                           batch.ToRecordBatch(output_schema_));
 
-    {
-      std::lock_guard lk(mutex_);
-      accumulation_queue_.push_back(std::move(record_batch));
-    }
+    RETURN_NOT_OK(impl_->InputReceived(std::move(record_batch)));
 
     if (counter_.Increment()) {
       return DoFinish();
@@ -114,32 +155,93 @@ class OrderByNode : public ExecNode, public TracedNode {
   }
 
   Status DoFinish() {
-    ARROW_ASSIGN_OR_RAISE(
-        auto table,
-        Table::FromRecordBatches(output_schema_, std::move(accumulation_queue_)));
-    SortOptions sort_options(ordering_);
-    ExecContext* ctx = plan_->query_context()->exec_context();
-    ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, sort_options, ctx));
-    ARROW_ASSIGN_OR_RAISE(Datum sorted,
-                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx));
-    const std::shared_ptr<Table>& sorted_table = sorted.table();
-    TableBatchReader reader(*sorted_table);
-    reader.set_chunksize(ExecPlan::kMaxBatchSize);
-    int batch_index = 0;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> sorted,
+                          impl_->DoFinishAsReader(ExecPlan::kMaxBatchSize));
+    if (!impl_->streams_output()) {
+      int batch_index = 0;
+      while (true) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, sorted->Next());
+        if (!next) {
+          break;
+        }
+        int index = batch_index++;
+        plan_->query_context()->ScheduleTask(
+            [this, batch = std::move(next), index]() mutable {
+              ExecBatch exec_batch(*batch);
+              exec_batch.index = index;
+              return output_->InputReceived(this, std::move(exec_batch));
+            },
+            "OrderByNode::ProcessBatch");
+      }
+      return output_->InputFinished(this, batch_index);
+    }
+
+    // The output is merged from spilled runs as it is read, so it is emitted one
+    // batch at a time and emission stops while the output applies backpressure.
+    // The external task keeps the plan alive while paused.
+    ARROW_ASSIGN_OR_RAISE(Future<> emit_done, plan_->query_context()->BeginExternalTask(
+                                                  "OrderByNode::EmitSorted"));
+    if (!emit_done.is_valid()) {
+      // The plan is already ending
+      return Status::OK();
+    }
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      sorted_ = std::move(sorted);
+      emit_done_ = emit_done;
+      if (paused_ && !stopped_) {
+        // ResumeProducing starts the emission
+        return Status::OK();
+      }
+      emitting_ = true;
+    }
+    return EmitSorted();
+  }
+
+  // Only one call runs at a time, guarded by emitting_, so sorted_ and
+  // batch_index_ are only accessed by that call
+  Status EmitSorted() {
     while (true) {
-      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
-      if (!next) {
-        return output_->InputFinished(this, batch_index);
+      {
+        std::lock_guard<std::mutex> lock(emit_mutex_);
+        if (stopped_) {
+          break;
+        }
+        if (paused_) {
+          emitting_ = false;
+          return Status::OK();
+        }
       }
-      int index = batch_index++;
-      plan_->query_context()->ScheduleTask(
-          [this, batch = std::move(next), index]() mutable {
-            ExecBatch exec_batch(*batch);
-            exec_batch.index = index;
-            return output_->InputReceived(this, std::move(exec_batch));
-          },
-          "OrderByNode::ProcessBatch");
+      Result<std::shared_ptr<RecordBatch>> next = sorted_->Next();
+      if (!next.ok()) {
+        return FinishEmitting(next.status());
+      }
+      if (*next == nullptr) {
+        return FinishEmitting(output_->InputFinished(this, batch_index_));
+      }
+      ExecBatch batch(**next);
+      batch.index = batch_index_++;
+      Status status = output_->InputReceived(this, std::move(batch));
+      if (!status.ok()) {
+        return FinishEmitting(std::move(status));
+      }
+    }
+    return FinishEmitting(Status::OK());
+  }
+
+  Status FinishEmitting(Status status) {
+    // Releasing the reader removes any spill files that are left
+    sorted_.reset();
+    Future<> emit_done;
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      emitting_ = false;
+      finished_ = true;
+      emit_done = emit_done_;
     }
+    // Errors are reported by the returned status
+    emit_done.MarkFinished();
+    return status;
   }
 
  protected:
@@ -152,8 +254,18 @@ class OrderByNode : public ExecNode, public TracedNode {
  private:
   AtomicCounter counter_;
   Ordering ordering_;
-  std::vector<std::shared_ptr<RecordBatch>> accumulation_queue_;
-  std::mutex mutex_;
+  std::unique_ptr<OrderByImpl> impl_;
+
+  // State of the streamed emission of a spilled sort
+  std::mutex emit_mutex_;
+  std::shared_ptr<RecordBatchReader> sorted_;
+  Future<> emit_done_;
+  int batch_index_ = 0;
+  int32_t backpressure_counter_ = 0;
+  bool paused_ = false;
+  bool emitting_ = false;
+  bool finished_ = false;
+  bool stopped_ = false;
 };
 
 }  // namespace
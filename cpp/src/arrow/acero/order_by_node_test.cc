@@ -22,7 +22,11 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/test_nodes.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/acero/util.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/table.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -32,8 +36,12 @@ namespace arrow {
 
 using internal::checked_pointer_cast;
 
+using compute::NullPlacement;
+using compute::SortIndices;
 using compute::SortKey;
+using compute::SortOptions;
 using compute::SortOrder;
+using compute::Take;
 
 namespace acero {
 
@@ -110,6 +118,149 @@ TEST(OrderByNode, Large) {
   }
 }
 
+TEST(OrderByNode, Spilling) {
+  constexpr random::SeedType kSeed = 42;
+  constexpr int kJitterMod = 4;
+  constexpr int64_t kNumRows = 2000;
+  RegisterTestNodes();
+
+  auto schema = arrow::schema({field("i", int32()), field("f", float64()),
+                               field("s", utf8()), field("payload", int64())});
+  std::shared_ptr<RecordBatch> batch =
+      random::GenerateBatch(schema->fields(), kNumRows, kSeed);
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> input, Table::FromRecordBatches({batch}));
+
+  for (const auto& ordering :
+       {Ordering({SortKey("i")}),
+        Ordering({SortKey("f", SortOrder::Descending, NullPlacement::AtStart)}),
+        Ordering({SortKey("s", SortOrder::Descending), SortKey("i"), SortKey("f")})}) {
+    ARROW_SCOPED_TRACE(ordering.ToString());
+    ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(input, SortOptions(ordering)));
+    ASSERT_OK_AND_ASSIGN(Datum expected, Take(input, indices));
+
+    // Use small batches so that many sorted runs are spilled
+    Declaration plan =
+        Declaration::Sequence({{"table_source", TableSourceNodeOptions(input, 64)},
+                               {"jitter", JitterNodeOptions(kSeed, kJitterMod)},
+                               {"order_by", OrderByNodeOptions(ordering)}});
+    ASSERT_OK_AND_ASSIGN(auto spill_dir, SpillDir::Make());
+    for (int64_t threshold : {1, 4096}) {
+      for (bool use_threads : {false, true}) {
+        ARROW_SCOPED_TRACE("threshold=", threshold, " use_threads=", use_threads);
+        PlanProfile profile;
+        QueryOptions query_options;
+        query_options.sequence_output = true;
+        query_options.use_threads = use_threads;
+        query_options.spill_threshold_bytes = threshold;
+        query_options.profile = &profile;
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                             DeclarationToTable(plan, query_options));
+        const NodeProfile* node_profile = FindNodeProfile(profile, "OrderByNode");
+        ASSERT_NE(node_profile, nullptr);
+        ASSERT_GT(node_profile->spilled_bytes, 0);
+        ASSERT_OK_AND_EQ(std::vector<std::string>{}, spill_dir->ListEntries());
+        // Rows that compare equal may be emitted in any order, so only compare
+        // the sort key columns
+        for (const auto& sort_key : ordering.sort_keys()) {
+          ASSERT_OK_AND_ASSIGN(auto expected_column,
+                               sort_key.target.GetOneOrNone(*expected.table()));
+          ASSERT_OK_AND_ASSIGN(auto actual_column,
+                               sort_key.target.GetOneOrNone(*actual));
+          AssertChunkedEquivalent(*expected_column, *actual_column);
+        }
+      }
+    }
+  }
+}
+
+TEST(OrderByNode, SpillingBackpressure) {
+  constexpr int64_t kNumRows = 2000;
+  auto schema = arrow::schema({field("i", int32()), field("payload", int64())});
+  std::shared_ptr<RecordBatch> batch =
+      random::GenerateBatch(schema->fields(), kNumRows, /*seed=*/42);
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> input, Table::FromRecordBatches({batch}));
+  ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(input, SortOptions({SortKey("i")})));
+  ASSERT_OK_AND_ASSIGN(Datum expected, Take(input, indices));
+  ASSERT_OK_AND_ASSIGN(auto spill_dir, SpillDir::Make());
+
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads=", use_threads);
+    QueryOptions query_options;
+    query_options.use_threads = use_threads;
+    query_options.spill_threshold_bytes = 1024;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<ExecPlan> plan, ExecPlan::Make(query_options));
+    // The sink pauses the merge after every output batch
+    AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+    ASSERT_OK(
+        Declaration::Sequence(
+            {{"table_source", TableSourceNodeOptions(input, 64)},
+             {"order_by", OrderByNodeOptions(Ordering({SortKey("i")}))},
+             {"sink", SinkNodeOptions(&sink_gen, BackpressureOptions(1, 2))}})
+            .AddToPlan(plan.get()));
+    ASSERT_FINISHES_OK_AND_ASSIGN(std::vector<ExecBatch> batches,
+                                  StartAndCollect(plan.get(), sink_gen));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         TableFromExecBatches(schema, batches));
+    AssertChunkedEquivalent(*expected.table()->GetColumnByName("i"),
+                            *actual->GetColumnByName("i"));
+    ASSERT_OK_AND_EQ(std::vector<std::string>{}, spill_dir->ListEntries());
+  }
+}
+
+TEST(OrderBySinkNode, Spilling) {
+  constexpr int64_t kNumRows = 2000;
+  auto schema = arrow::schema({field("s", utf8()), field("payload", int64())});
+  std::shared_ptr<RecordBatch> batch =
+      random::GenerateBatch(schema->fields(), kNumRows, /*seed=*/42);
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> input, Table::FromRecordBatches({batch}));
+  SortOptions sort_options({SortKey("s", SortOrder::Descending)});
+  ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(input, sort_options));
+  ASSERT_OK_AND_ASSIGN(Datum expected, Take(input, indices));
+  ASSERT_OK_AND_ASSIGN(auto spill_dir, SpillDir::Make());
+
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads=", use_threads);
+    PlanProfile profile;
+    QueryOptions query_options;
+    query_options.use_threads = use_threads;
+    query_options.spill_threshold_bytes = 1024;
+    query_options.profile = &profile;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<ExecPlan> plan, ExecPlan::Make(query_options));
+    AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+    ASSERT_OK(Declaration::Sequence(
+                  {{"table_source", TableSourceNodeOptions(input, 64)},
+                   {"order_by_sink", OrderBySinkNodeOptions(sort_options, &sink_gen)}})
+                  .AddToPlan(plan.get()));
+    ASSERT_FINISHES_OK_AND_ASSIGN(std::vector<ExecBatch> batches,
+                                  StartAndCollect(plan.get(), sink_gen));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         TableFromExecBatches(schema, batches));
+    AssertChunkedEquivalent(*expected.table()->GetColumnByName("s"),
+                            *actual->GetColumnByName("s"));
+
+    const NodeProfile* node_profile = FindNodeProfile(profile, "OrderBySinkNode");
+    ASSERT_NE(node_profile, nullptr);
+    ASSERT_GT(node_profile->spilled_bytes, 0);
+    ASSERT_OK_AND_EQ(std::vector<std::string>{}, spill_dir->ListEntries());
+  }
+}
+
+TEST(OrderByNode, SpillingUnsupportedKeyType) {
+  // Keys which the merge of spilled runs cannot compare are sorted in memory, so
+  // spilling makes no difference to the result
+  auto input = TableFromJSON(schema({field("h", float16())}), {"[1, 2]"});
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(input)},
+       {"order_by", OrderByNodeOptions(Ordering({SortKey("h")}))}});
+  Status expected = DeclarationToStatus(plan);
+  ASSERT_RAISES(NotImplemented, expected);
+  QueryOptions query_options;
+  query_options.spill_threshold_bytes = 1;
+  Status actual = DeclarationToStatus(plan, query_options);
+  ASSERT_EQ(expected.code(), actual.code());
+  ASSERT_EQ(expected.message(), actual.message());
+}
+
 TEST(OrderByNode, Invalid) {
   CheckOrderByInvalid(OrderByNodeOptions(Ordering::Implicit()),
                       "`ordering` must be an explicit non-empty ordering");
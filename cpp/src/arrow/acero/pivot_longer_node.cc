@@ -200,10 +200,12 @@ class PivotLongerNode : public ExecNode, public TracedNode {
   }
 
   void PauseProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordPaused(counter);
     inputs_[0]->PauseProducing(this, counter);
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordResumed(counter);
     inputs_[0]->ResumeProducing(this, counter);
   }
 
@@ -228,10 +230,17 @@ class PivotLongerNode : public ExecNode, public TracedNode {
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
     DCHECK_EQ(input, inputs_[0]);
-    for (const auto& row_template : templates_) {
-      ExecBatch template_batch = ApplyTemplate(row_template, batch);
+    std::vector<ExecBatch> template_batches;
+    {
+      // The time spent by the output is not this node's
+      auto scope = TraceInputReceived(batch);
+      template_batches.reserve(templates_.size());
+      for (const auto& row_template : templates_) {
+        template_batches.push_back(ApplyTemplate(row_template, batch));
+      }
+    }
+    for (ExecBatch& template_batch : template_batches) {
       ARROW_RETURN_NOT_OK(output_->InputReceived(this, std::move(template_batch)));
     }
     return Status::OK();
@@ -563,6 +563,100 @@ custom_sink_label:OrderBySinkNode{by={sort_keys=[FieldRef.Name(sum(multiply(i32,
 )a");
 }
 
+TEST(ExecPlan, Profile) {
+  auto table = TableFromJSON(schema({field("i", int32())}),
+                             {R"([[3], [-1], [2], [0], [-4], [1]])"});
+  Declaration declaration = Declaration::Sequence({
+      {"table_source", TableSourceNodeOptions(table, /*max_batch_size=*/2), "source"},
+      {"filter", FilterNodeOptions{greater_equal(field_ref("i"), literal(0))}, "filter"},
+      {"order_by", OrderByNodeOptions(Ordering({SortKey("i")})), "sort"},
+  });
+  PlanProfile profile;
+  QueryOptions query_options;
+  query_options.profile = &profile;
+  query_options.spill_threshold_bytes = 1;
+  ASSERT_OK_AND_ASSIGN(auto out,
+                       DeclarationToTable(std::move(declaration), query_options));
+  ASSERT_EQ(out->num_rows(), 4);
+
+  // The sink is added last
+  ASSERT_EQ(profile.nodes.size(), 4);
+  const NodeProfile& source = profile.nodes[0];
+  const NodeProfile& filter = profile.nodes[1];
+  const NodeProfile& sort = profile.nodes[2];
+  const NodeProfile& sink = profile.nodes[3];
+  EXPECT_EQ(source.kind, "TableSourceNode");
+  EXPECT_THAT(source.inputs, ElementsAre());
+  EXPECT_EQ(source.batches_emitted, 3);
+  EXPECT_EQ(source.rows_emitted, 6);
+  EXPECT_GT(source.bytes_emitted, 0);
+
+  EXPECT_THAT(filter.inputs, ElementsAre(0));
+  EXPECT_EQ(filter.batches_received, 3);
+  EXPECT_EQ(filter.rows_received, 6);
+  EXPECT_EQ(filter.bytes_received, source.bytes_emitted);
+  EXPECT_EQ(filter.rows_emitted, 4);
+  EXPECT_GT(filter.wall_time_nanos, 0);
+
+  EXPECT_THAT(sort.inputs, ElementsAre(1));
+  EXPECT_EQ(sort.rows_received, 4);
+  EXPECT_EQ(sort.rows_emitted, 4);
+  EXPECT_GT(sort.spilled_bytes, 0);
+  EXPECT_GT(sort.peak_query_memory_bytes, 0);
+
+  EXPECT_THAT(sink.inputs, ElementsAre(2));
+  EXPECT_EQ(sink.rows_received, 4);
+  EXPECT_EQ(sink.batches_emitted, 0);
+
+  const std::string text = profile.ToString();
+  EXPECT_THAT(text, HasSubstr("ExecPlan profile with 4 nodes:\n"));
+  EXPECT_THAT(text, HasSubstr("\n  sort:OrderByNode{received=3 batches/4 rows/"));
+  EXPECT_THAT(text, HasSubstr("\n    filter:FilterNode{received=3 batches/6 rows/"));
+  EXPECT_THAT(text, HasSubstr("\n      source:TableSourceNode{received=0 batches/0 "
+                              "rows/0 bytes, emitted=3 batches/6 rows/"));
+
+  // Nothing is collected unless requested
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK(Declaration("table_source", TableSourceNodeOptions(table))
+                .AddToPlan(plan.get()));
+  PlanProfile empty_profile = plan->GetProfile();
+  ASSERT_EQ(empty_profile.nodes.size(), 1);
+  EXPECT_EQ(empty_profile.nodes[0].kind, "TableSourceNode");
+  EXPECT_EQ(empty_profile.nodes[0].rows_emitted, 0);
+}
+
+TEST(ExecPlan, ProfileTimesAndPauses) {
+  PlanProfile profile;
+  QueryOptions query_options;
+  query_options.profile = &profile;
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(query_options));
+  ExecNode* input = MakeDummyNode(plan.get(), "input", /*inputs=*/{});
+  ExecNode* output = MakeDummyNode(plan.get(), "output", {input});
+
+  // The time of the output, called by the input, is only the output's
+  {
+    ProfileTimer input_timer(input);
+    ProfileTimer output_timer(output);
+    SleepFor(0.05);
+  }
+
+  // Pauses and resumes may arrive out of order
+  input->profiler()->RecordPaused(1);
+  input->profiler()->RecordPaused(3);
+  input->profiler()->RecordResumed(2);
+  input->profiler()->RecordPaused(4);
+  output->profiler()->RecordPaused(1);
+  output->profiler()->RecordResumed(2);
+  output->profiler()->RecordPaused(3);
+
+  PlanProfile result = plan->GetProfile();
+  ASSERT_EQ(result.nodes.size(), 2);
+  EXPECT_GE(result.nodes[1].wall_time_nanos, 50'000'000);
+  EXPECT_LT(result.nodes[0].wall_time_nanos, 50'000'000);
+  EXPECT_EQ(result.nodes[0].pause_count, 1);
+  EXPECT_EQ(result.nodes[1].pause_count, 2);
+}
+
 TEST(ExecPlanExecution, CustomFieldNames) {
   auto generator = gen::Gen({{"x", gen::Step()}})->FailOnError();
   std::vector<::arrow::compute::ExecBatch> ebatches =
@@ -1026,6 +1120,38 @@ TEST(ExecPlanExecution, SourceFilterSink) {
   AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
 }
 
+TEST(ExecPlanExecution, SourceFilterFilterProjectSink) {
+  // The first filter sends a selection vector to the second, which sends one to the
+  // project node
+  auto basic_data = MakeBasicBatches();
+  for (bool with_project : {false, true}) {
+    ARROW_SCOPED_TRACE("with_project=", with_project);
+    std::vector<Declaration> nodes = {
+        {"source",
+         SourceNodeOptions{basic_data.schema,
+                           basic_data.gen(/*parallel=*/false, /*slow=*/false)}},
+        {"filter", FilterNodeOptions{greater(field_ref("i32"), literal(4))}},
+        {"filter", FilterNodeOptions{not_(field_ref("bool"))}}};
+    std::vector<ExecBatch> exp_batches;
+    if (with_project) {
+      nodes.push_back(
+          {"project", ProjectNodeOptions{{call("add", {field_ref("i32"), literal(1)})},
+                                         {"i32 + 1"}}});
+      exp_batches = {ExecBatchFromJSON({int32()}, "[]"),
+                     ExecBatchFromJSON({int32()}, "[[7], [8]]")};
+    } else {
+      exp_batches = {ExecBatchFromJSON({int32(), boolean()}, "[]"),
+                     ExecBatchFromJSON({int32(), boolean()}, "[[6, false], [7, false]]")};
+    }
+    ASSERT_OK_AND_ASSIGN(auto result,
+                         DeclarationToExecBatches(Declaration::Sequence(nodes)));
+    for (const auto& batch : result.batches) {
+      ASSERT_EQ(batch.selection_vector, nullptr);
+    }
+    AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
+  }
+}
+
 TEST(ExecPlanExecution, SourceProjectSink) {
   auto basic_data = MakeBasicBatches();
   Declaration plan = Declaration::Sequence(
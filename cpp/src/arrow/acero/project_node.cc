@@ -83,21 +83,24 @@ class ProjectNode : public MapNode {
 
   const char* kind_name() const override { return "ProjectNode"; }
 
+  bool accepts_selection_vectors() const override { return true; }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
-    std::vector<Datum> values{exprs_.size()};
+    std::vector<Expression> simplified_exprs(exprs_.size());
     for (size_t i = 0; i < exprs_.size(); ++i) {
-      arrow::util::tracing::Span span;
-      START_COMPUTE_SPAN(span, "Project",
-                         {{"project.type", exprs_[i].type()->ToString()},
-                          {"project.length", batch.length},
-                          {"project.expression", exprs_[i].ToString()}});
-      ARROW_ASSIGN_OR_RAISE(Expression simplified_expr,
+      ARROW_ASSIGN_OR_RAISE(simplified_exprs[i],
                             SimplifyWithGuarantee(exprs_[i], batch.guarantee));
-
-      ARROW_ASSIGN_OR_RAISE(
-          values[i], ExecuteScalarExpression(simplified_expr, batch,
-                                             plan()->query_context()->exec_context()));
     }
+    arrow::util::tracing::Span span;
+    START_COMPUTE_SPAN(span, "Project",
+                       {{"project.length", batch.length},
+                        {"project.expressions", ToStringExtra()}});
+    // Subexpressions shared by the expressions are computed once.  If the batch has a
+    // selection vector, the selected rows of the fields they use are gathered once.
+    ARROW_ASSIGN_OR_RAISE(
+        std::vector<Datum> values,
+        ExecuteScalarExpressions(simplified_exprs, batch,
+                                 plan()->query_context()->exec_context()));
     return ExecBatch{std::move(values), batch.length};
   }
 
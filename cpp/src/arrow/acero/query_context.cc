@@ -16,11 +16,16 @@
 // under the License.
 
 #include "arrow/acero/query_context.h"
+
+#include <mutex>
+#include <string>
+
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/io_util.h"
 
 namespace arrow {
 using arrow::internal::CpuInfo;
+using arrow::internal::TemporaryDir;
 namespace acero {
 
 namespace {
@@ -37,6 +42,8 @@ QueryContext::QueryContext(QueryOptions opts, ExecContext exec_context)
       exec_context_(exec_context),
       io_context_(GetIoContext(options_, exec_context_)) {}
 
+QueryContext::~QueryContext() = default;
+
 const CpuInfo* QueryContext::cpu_info() const { return CpuInfo::GetInstance(); }
 int64_t QueryContext::hardware_flags() const { return cpu_info()->hardware_flags(); }
 
@@ -87,5 +94,16 @@ int QueryContext::RegisterTaskGroup(std::function<Status(size_t, int64_t)> task,
 Status QueryContext::StartTaskGroup(int task_group_id, int64_t num_tasks) {
   return task_scheduler_->StartTaskGroup(GetThreadIndex(), task_group_id, num_tasks);
 }
+
+Result<std::string> QueryContext::NewSpillFilePath(std::string_view prefix) {
+  std::lock_guard<std::mutex> lk(spill_mutex_);
+  if (!spill_dir_) {
+    ARROW_ASSIGN_OR_RAISE(spill_dir_, TemporaryDir::Make("arrow-acero-spill-"));
+  }
+  std::string file_name =
+      std::string(prefix) + "-" + std::to_string(spill_file_counter_++) + ".arrows";
+  ARROW_ASSIGN_OR_RAISE(auto path, spill_dir_->path().Join(file_name));
+  return path.ToString();
+}
 }  // namespace acero
 }  // namespace arrow
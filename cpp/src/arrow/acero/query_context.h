@@ -16,6 +16,8 @@
 // under the License.
 #pragma once
 
+#include <mutex>
+#include <string>
 #include <string_view>
 
 #include "arrow/acero/exec_plan.h"
@@ -28,6 +30,10 @@
 
 namespace arrow {
 
+namespace internal {
+class TemporaryDir;
+}  // namespace internal
+
 using compute::default_exec_context;
 using io::IOContext;
 
@@ -37,6 +43,7 @@ class ARROW_ACERO_EXPORT QueryContext {
  public:
   QueryContext(QueryOptions opts = {},
                ExecContext exec_context = *default_exec_context());
+  ~QueryContext();
 
   Status Init(arrow::util::AsyncTaskScheduler* scheduler);
 
@@ -133,6 +140,19 @@ class ARROW_ACERO_EXPORT QueryContext {
 
   size_t GetCurrentTempFileIO() { return in_flight_bytes_to_disk_.load(); }
 
+  /// \brief The number of bytes a node may buffer before it should spill to disk
+  ///
+  /// Returns 0 if spilling is disabled for this query.
+  int64_t spill_threshold_bytes() const { return options_.spill_threshold_bytes; }
+
+  /// \brief Return a new, unique path for a temporary spill file
+  ///
+  /// All paths live in a per-query directory which is created on first use and
+  /// deleted, along with any remaining files, when the QueryContext is destroyed.
+  ///
+  /// \param prefix A prefix for the file name, for debugging
+  Result<std::string> NewSpillFilePath(std::string_view prefix);
+
  private:
   QueryOptions options_;
   // To be replaced with Acero-specific context once scheduler is done and
@@ -146,6 +166,10 @@ class ARROW_ACERO_EXPORT QueryContext {
   ThreadIndexer thread_indexer_;
 
   std::atomic<size_t> in_flight_bytes_to_disk_{0};
+
+  std::mutex spill_mutex_;
+  std::unique_ptr<::arrow::internal::TemporaryDir> spill_dir_;
+  int64_t spill_file_counter_ = 0;
 };
 }  // namespace acero
 }  // namespace arrow
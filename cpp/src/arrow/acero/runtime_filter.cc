@@ -0,0 +1,215 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/runtime_filter.h"
+
+#include <utility>
+
+#include "arrow/acero/query_context.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/util_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+
+using compute::Hashing32;
+using compute::KeyColumnArray;
+
+namespace acero {
+
+RuntimeFilter::RuntimeFilter(std::vector<int> key_ids,
+                             std::vector<std::shared_ptr<Scalar>> min_values,
+                             std::vector<std::shared_ptr<Scalar>> max_values,
+                             std::shared_ptr<BlockedBloomFilter> bloom_filter, bool empty)
+    : key_ids_(std::move(key_ids)),
+      min_values_(std::move(min_values)),
+      max_values_(std::move(max_values)),
+      bloom_filter_(std::move(bloom_filter)),
+      empty_(empty) {
+  DCHECK_EQ(key_ids_.size(), min_values_.size());
+  DCHECK_EQ(key_ids_.size(), max_values_.size());
+}
+
+compute::Expression RuntimeFilter::ToExpression(
+    const std::vector<std::optional<FieldRef>>& key_refs) const {
+  DCHECK_EQ(key_refs.size(), key_ids_.size());
+  if (empty_) {
+    return compute::literal(false);
+  }
+  std::vector<compute::Expression> conjuncts;
+  for (size_t i = 0; i < key_ids_.size(); ++i) {
+    if (!key_refs[i]) {
+      continue;
+    }
+    if (min_values_[i]) {
+      conjuncts.push_back(compute::greater_equal(compute::field_ref(*key_refs[i]),
+                                                 compute::literal(min_values_[i])));
+    }
+    if (max_values_[i]) {
+      conjuncts.push_back(compute::less_equal(compute::field_ref(*key_refs[i]),
+                                              compute::literal(max_values_[i])));
+    }
+  }
+  return compute::and_(conjuncts);
+}
+
+namespace {
+
+// Combines two selections, where a null or false value drops the row
+Result<Datum> AndSelection(Datum selection, Datum other, ExecContext* ctx) {
+  if (!selection.is_value()) {
+    return other;
+  }
+  return compute::CallFunction("and", {std::move(selection), std::move(other)}, ctx);
+}
+
+}  // namespace
+
+Result<ExecBatch> RuntimeFilter::Apply(const ExecBatch& batch, ExecContext* ctx,
+                                       arrow::util::TempVectorStack* stack) const {
+  if (batch.length == 0) {
+    return batch;
+  }
+  if (empty_) {
+    return batch.Slice(0, 0);
+  }
+
+  Datum selection;
+  std::vector<Datum> keys(key_ids_.size());
+  for (size_t i = 0; i < key_ids_.size(); ++i) {
+    keys[i] = batch[key_ids_[i]];
+    if (min_values_[i]) {
+      ARROW_ASSIGN_OR_RAISE(Datum in_range,
+                            compute::CallFunction("greater_equal",
+                                                  {keys[i], Datum(min_values_[i])}, ctx));
+      ARROW_ASSIGN_OR_RAISE(selection, AndSelection(std::move(selection),
+                                                    std::move(in_range), ctx));
+    }
+    if (max_values_[i]) {
+      ARROW_ASSIGN_OR_RAISE(Datum in_range,
+                            compute::CallFunction("less_equal",
+                                                  {keys[i], Datum(max_values_[i])}, ctx));
+      ARROW_ASSIGN_OR_RAISE(selection, AndSelection(std::move(selection),
+                                                    std::move(in_range), ctx));
+    }
+    if (keys[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(keys[i], MakeArrayFromScalar(*keys[i].scalar(), batch.length,
+                                                         ctx->memory_pool()));
+    }
+  }
+
+  if (bloom_filter_) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(keys, batch.length));
+    std::vector<uint32_t> hashes(batch.length);
+    const int64_t hardware_flags = ctx->cpu_info()->hardware_flags();
+    std::vector<KeyColumnArray> temp_column_arrays;
+    RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes.data(), temp_column_arrays,
+                                       hardware_flags, stack, 0, batch.length));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> found,
+                          AllocateBitmap(batch.length, ctx->memory_pool()));
+    bloom_filter_->Find(hardware_flags, batch.length, hashes.data(),
+                        found->mutable_data());
+    // Null keys never match, but their hashes may collide with the build side
+    for (const Datum& key : keys) {
+      const ArrayData& key_data = *key.array();
+      if (key_data.GetNullCount() > 0) {
+        arrow::internal::BitmapAnd(found->data(), 0, key_data.buffers[0]->data(),
+                                   key_data.offset, batch.length, 0,
+                                   found->mutable_data());
+      }
+    }
+    auto found_array = std::make_shared<BooleanArray>(batch.length, std::move(found));
+    ARROW_ASSIGN_OR_RAISE(selection, AndSelection(std::move(selection),
+                                                  Datum(std::move(found_array)), ctx));
+  }
+
+  if (!selection.is_value()) {
+    return batch;
+  }
+  if (selection.is_scalar()) {
+    const auto& passes = selection.scalar_as<BooleanScalar>();
+    return passes.is_valid && passes.value ? batch : batch.Slice(0, 0);
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum indices,
+                        compute::CallFunction("indices_nonzero", {selection}, ctx));
+  if (indices.length() == batch.length) {
+    return batch;
+  }
+  ExecBatch out = batch;
+  out.length = indices.length();
+  for (Datum& value : out.values) {
+    if (value.is_array()) {
+      ARROW_ASSIGN_OR_RAISE(value, compute::Take(value, indices,
+                                                 compute::TakeOptions::NoBoundsCheck(),
+                                                 ctx));
+    }
+  }
+  return out;
+}
+
+RuntimeFilterSet::RuntimeFilterSet(QueryContext* ctx)
+    : ctx_(ctx), stacks_(ctx->max_concurrency()) {}
+
+void RuntimeFilterSet::Add(std::shared_ptr<RuntimeFilter> filter,
+                           compute::Expression expression) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  expression_ = compute::and_(std::move(expression_), std::move(expression));
+  filters_.push_back(std::move(filter));
+}
+
+std::optional<compute::Expression> RuntimeFilterSet::expression() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (filters_.empty()) {
+    return std::nullopt;
+  }
+  return expression_;
+}
+
+Result<ExecBatch> RuntimeFilterSet::Apply(ExecBatch batch) {
+  std::vector<std::shared_ptr<RuntimeFilter>> filters;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    filters = filters_;
+  }
+  if (filters.empty()) {
+    return batch;
+  }
+  size_t thread_index = ctx_->GetThreadIndex();
+  if (thread_index >= stacks_.size()) {
+    return Status::IndexError("thread index ", thread_index, " is out of range [0, ",
+                              stacks_.size(), ")");
+  }
+  std::unique_ptr<arrow::util::TempVectorStack>& stack = stacks_[thread_index];
+  if (!stack) {
+    stack = std::make_unique<arrow::util::TempVectorStack>();
+    RETURN_NOT_OK(
+        stack->Init(ctx_->memory_pool(), Hashing32::kHashBatchTempStackUsage));
+  }
+  for (const auto& filter : filters) {
+    ARROW_ASSIGN_OR_RAISE(batch, filter->Apply(batch, ctx_->exec_context(), stack.get()));
+  }
+  return batch;
+}
+
+}  // namespace acero
+}  // namespace arrow
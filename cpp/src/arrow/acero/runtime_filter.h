@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "arrow/acero/bloom_filter.h"
+#include "arrow/acero/type_fwd.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+
+using compute::ExecBatch;
+using compute::ExecContext;
+
+namespace acero {
+
+/// \brief A filter on some columns of a node's output, which is only known once the
+/// plan is running
+///
+/// A hash join publishes one of these once its build side has been accumulated.  It
+/// holds the Bloom filter and the range of the build-side keys: a probe-side row which
+/// fails it has no match on the build side, so nodes upstream of the join may drop it
+/// without changing the result.  Rows with a null key always fail the filter.
+class ARROW_ACERO_EXPORT RuntimeFilter {
+ public:
+  /// \param key_ids the indices of the key columns in the receiving node's output
+  /// \param min_values the smallest value of each key, or null if unknown
+  /// \param max_values the largest value of each key, or null if unknown
+  /// \param bloom_filter a Bloom filter over the hashes of the keys, may be null
+  /// \param empty whether no row at all passes the filter
+  RuntimeFilter(std::vector<int> key_ids,
+                std::vector<std::shared_ptr<Scalar>> min_values,
+                std::vector<std::shared_ptr<Scalar>> max_values,
+                std::shared_ptr<BlockedBloomFilter> bloom_filter, bool empty = false);
+
+  const std::vector<int>& key_ids() const { return key_ids_; }
+
+  /// \brief Whether no row passes the filter, e.g. because the build side was empty
+  bool empty() const { return empty_; }
+
+  /// \brief An expression which is true for every row which may pass the filter
+  ///
+  /// The expression only covers the key ranges, as the Bloom filter cannot be
+  /// expressed with the available compute functions.  It can be used to prune
+  /// files and row groups using their statistics.
+  ///
+  /// \param key_refs how to refer to each key in the expression, or nullopt to leave
+  /// the key out, e.g. because the data the expression prunes doesn't have it
+  compute::Expression ToExpression(
+      const std::vector<std::optional<FieldRef>>& key_refs) const;
+
+  /// \brief Drop the rows of `batch` which fail the filter
+  ///
+  /// `batch` must have the layout of the receiving node's output.  `stack` holds the
+  /// temporary vectors of the key hashing, see RuntimeFilterSet.
+  Result<ExecBatch> Apply(const ExecBatch& batch, ExecContext* ctx,
+                          arrow::util::TempVectorStack* stack) const;
+
+ private:
+  std::vector<int> key_ids_;
+  std::vector<std::shared_ptr<Scalar>> min_values_;
+  std::vector<std::shared_ptr<Scalar>> max_values_;
+  std::shared_ptr<BlockedBloomFilter> bloom_filter_;
+  bool empty_;
+};
+
+/// \brief An ExecNode which can make use of the runtime filters of downstream nodes
+///
+/// A hash join looks for a receiver by walking up its probe side through nodes which
+/// pass their input columns through unchanged (filters and other hash joins).
+/// Receivers are free to apply a filter to as much or as little of their output as
+/// is convenient, since the join still evaluates its own condition on every row.
+class ARROW_ACERO_EXPORT RuntimeFilterReceiver {
+ public:
+  virtual ~RuntimeFilterReceiver() = default;
+
+  /// \brief Receive a runtime filter
+  ///
+  /// This may be called from any thread, at any time between StartProducing and the
+  /// end of the plan.
+  virtual Status ReceiveRuntimeFilter(std::shared_ptr<RuntimeFilter> filter) = 0;
+
+  /// \brief Whether the node makes use of runtime filters at all
+  ///
+  /// Joins don't compute the key ranges of their build side for a receiver which
+  /// doesn't.
+  virtual bool accepts_runtime_filters() const { return true; }
+};
+
+/// \brief The runtime filters received by a node
+///
+/// Combines the key ranges of the filters, for pruning, and applies the filters to
+/// batches on any thread of the plan, reusing the temporary vectors of each thread.
+/// All methods may be called concurrently.
+class ARROW_ACERO_EXPORT RuntimeFilterSet {
+ public:
+  explicit RuntimeFilterSet(QueryContext* ctx);
+
+  /// \brief Add a filter
+  ///
+  /// \param filter the filter
+  /// \param expression the key ranges of the filter, from RuntimeFilter::ToExpression
+  void Add(std::shared_ptr<RuntimeFilter> filter, compute::Expression expression);
+
+  /// \brief The conjunction of the key ranges of the filters, or nullopt if there are
+  /// no filters yet
+  std::optional<compute::Expression> expression() const;
+
+  /// \brief Drop the rows of `batch` which fail any of the filters
+  Result<ExecBatch> Apply(ExecBatch batch);
+
+ private:
+  QueryContext* ctx_;
+  mutable std::mutex mutex_;
+  std::vector<std::shared_ptr<RuntimeFilter>> filters_;
+  compute::Expression expression_ = compute::literal(true);
+  // One per thread index, made on the first use by the thread, which is the only one
+  // to touch it
+  std::vector<std::unique_ptr<arrow::util::TempVectorStack>> stacks_;
+};
+
+}  // namespace acero
+}  // namespace arrow
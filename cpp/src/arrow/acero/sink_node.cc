@@ -128,7 +128,7 @@ class SinkNode : public ExecNode,
       }
       return push_gen_().Then([this](const std::optional<ExecBatch>& batch) {
         if (batch) {
-          RecordBackpressureBytesFreed(*batch);
+          BatchConsumed(*batch);
         }
         return batch;
       });
@@ -257,6 +257,11 @@ class SinkNode : public ExecNode,
     return Status::OK();
   }
 
+  // Called when the consumer of the generator takes a batch
+  virtual void BatchConsumed(const ExecBatch& batch) {
+    RecordBackpressureBytesFreed(batch);
+  }
+
   static Status ValidateOptions(const SinkNodeOptions& sink_options) {
     if (!sink_options.generator) {
       return Status::Invalid(
@@ -442,7 +447,9 @@ struct OrderBySinkNode final : public SinkNode {
       : SinkNode(plan, std::move(inputs), generator, /*schema=*/nullptr,
                  /*backpressure=*/{},
                  /*backpressure_monitor_out=*/nullptr, /*sequence_output=*/false),
-        impl_(std::move(impl)) {}
+        impl_(std::move(impl)) {
+    impl_->set_profiler(profiler());
+  }
 
   const char* kind_name() const override { return "OrderBySinkNode"; }
 
@@ -458,8 +465,8 @@ struct OrderBySinkNode final : public SinkNode {
     RETURN_NOT_OK(ValidateOrderByOptions(sink_options));
     ARROW_ASSIGN_OR_RAISE(
         std::unique_ptr<OrderByImpl> impl,
-        OrderByImpl::MakeSort(plan->query_context()->exec_context(),
-                              inputs[0]->output_schema(), sink_options.sort_options));
+        OrderByImpl::MakeSort(plan->query_context(), inputs[0]->output_schema(),
+                              sink_options.sort_options));
     return plan->EmplaceNode<OrderBySinkNode>(plan, std::move(inputs), std::move(impl),
                                               sink_options.generator);
   }
@@ -512,7 +519,7 @@ struct OrderBySinkNode final : public SinkNode {
                           batch.ToRecordBatch(inputs_[0]->output_schema(),
                                               plan()->query_context()->memory_pool()));
 
-    impl_->InputReceived(std::move(record_batch));
+    RETURN_NOT_OK(impl_->InputReceived(std::move(record_batch)));
     if (input_counter_.Increment()) {
       return Finish();
     }
@@ -520,24 +527,121 @@ struct OrderBySinkNode final : public SinkNode {
   }
 
  protected:
+  // The number of batches a spilled sort merges ahead of the consumer
+  static constexpr int kMaxUnconsumedBatches = 4;
+
   Status DoFinish() {
     auto scope = TraceFinish();
-    ARROW_ASSIGN_OR_RAISE(Datum sorted, impl_->DoFinish());
-    TableBatchReader reader(*sorted.table());
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> sorted,
+                          impl_->DoFinishAsReader(ExecPlan::kMaxBatchSize));
+    if (!impl_->streams_output()) {
+      while (true) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, sorted->Next());
+        // producer_ may have been Closed already, in which case the batch is dropped
+        if (!next || !producer_.Push(ExecBatch(*next))) {
+          break;
+        }
+      }
+      return SinkNode::Finish();
+    }
+
+    // The output is merged from spilled runs as it is read, so only a few batches are
+    // merged ahead of the consumer.  The external task keeps the plan alive until the
+    // merge is done.
+    ARROW_ASSIGN_OR_RAISE(Future<> emit_done, plan_->query_context()->BeginExternalTask(
+                                                  "OrderBySinkNode::EmitSorted"));
+    if (!emit_done.is_valid()) {
+      // The plan is already ending
+      return SinkNode::Finish();
+    }
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      sorted_ = std::move(sorted);
+      emit_done_ = std::move(emit_done);
+      emitting_ = true;
+    }
+    return EmitSorted();
+  }
+
+  // Only one call runs at a time, guarded by emitting_, so sorted_ is only accessed
+  // by that call
+  Status EmitSorted() {
     while (true) {
-      std::shared_ptr<RecordBatch> batch;
-      RETURN_NOT_OK(reader.ReadNext(&batch));
-      if (!batch) break;
-      bool did_push = producer_.Push(ExecBatch(*batch));
-      if (!did_push) break;  // producer_ was Closed already
+      {
+        std::lock_guard<std::mutex> lock(emit_mutex_);
+        if (stopped_) {
+          break;
+        }
+        if (unconsumed_batches_ >= kMaxUnconsumedBatches) {
+          emitting_ = false;
+          return Status::OK();
+        }
+        ++unconsumed_batches_;
+      }
+      Result<std::shared_ptr<RecordBatch>> next = sorted_->Next();
+      if (!next.ok()) {
+        return FinishEmitting(next.status());
+      }
+      if (*next == nullptr || !producer_.Push(ExecBatch(**next))) {
+        break;
+      }
     }
+    return FinishEmitting(Status::OK());
+  }
+
+  Status FinishEmitting(Status status) {
+    // Releasing the reader removes any spill files that are left
+    sorted_.reset();
+    Future<> emit_done;
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      emitting_ = false;
+      finished_ = true;
+      emit_done = emit_done_;
+    }
+    producer_.Close();
+    // Errors are reported by the returned status
+    emit_done.MarkFinished();
+    return status;
+  }
+
+  void BatchConsumed(const ExecBatch& batch) override {
+    SinkNode::BatchConsumed(batch);
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      if (!emit_done_.is_valid() || finished_) {
+        return;
+      }
+      --unconsumed_batches_;
+      if (emitting_ || stopped_ || unconsumed_batches_ >= kMaxUnconsumedBatches) {
+        return;
+      }
+      emitting_ = true;
+    }
+    plan_->query_context()->ScheduleTask([this] { return EmitSorted(); },
+                                         "OrderBySinkNode::EmitSorted");
+  }
+
+  Status StopProducingImpl() override {
+    RETURN_NOT_OK(SinkNode::StopProducingImpl());
+    Future<> emit_done;
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      stopped_ = true;
+      if (!emit_done_.is_valid() || emitting_ || finished_) {
+        // A running EmitSorted notices the stop and finishes by itself
+        return Status::OK();
+      }
+      finished_ = true;
+      emit_done = emit_done_;
+    }
+    emit_done.MarkFinished();
     return Status::OK();
   }
 
   Status Finish() override {
     arrow::util::tracing::Span span;
-    ARROW_RETURN_NOT_OK(DoFinish());
-    return SinkNode::Finish();
+    return DoFinish();
   }
 
  protected:
@@ -547,6 +651,15 @@ struct OrderBySinkNode final : public SinkNode {
 
  private:
   std::unique_ptr<OrderByImpl> impl_;
+
+  // State of the streamed output of a spilled sort
+  std::mutex emit_mutex_;
+  std::shared_ptr<RecordBatchReader> sorted_;
+  Future<> emit_done_;
+  int unconsumed_batches_ = 0;
+  bool emitting_ = false;
+  bool finished_ = false;
+  bool stopped_ = false;
 };
 
 }  // namespace
@@ -352,6 +352,8 @@ class SortedMergeNode : public ExecNode {
   arrow::Status InputReceived(arrow::acero::ExecNode* input,
                               arrow::ExecBatch batch) override {
     ARROW_DCHECK(std_has(inputs_, input));
+    profiler()->RecordReceived(batch);
+    input->profiler()->RecordEmitted(batch);
     const size_t index = std_find(inputs_, input) - inputs_.begin();
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> rb,
                           batch.ToRecordBatch(output_schema_));
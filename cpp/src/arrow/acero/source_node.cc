@@ -23,6 +23,7 @@
 #include "arrow/acero/exec_plan_internal.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
@@ -93,26 +94,40 @@ Status HandleUnalignedBuffers(ExecBatch* batch, UnalignedBufferHandling handling
   return Status::OK();
 }
 
-struct SourceNode : ExecNode, public TracedNode {
+struct SourceNode : ExecNode, public TracedNode, public RuntimeFilterReceiver {
   SourceNode(ExecPlan* plan, std::shared_ptr<Schema> output_schema,
              AsyncGenerator<std::optional<ExecBatch>> generator,
-             Ordering ordering = Ordering::Unordered())
+             Ordering ordering = Ordering::Unordered(),
+             std::shared_ptr<RuntimeFilterReceiver> runtime_filter_receiver = NULLPTR)
       : ExecNode(plan, {}, {}, std::move(output_schema)),
         TracedNode(this),
         generator_(std::move(generator)),
-        ordering_(std::move(ordering)) {}
+        ordering_(std::move(ordering)),
+        runtime_filter_receiver_(std::move(runtime_filter_receiver)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
     RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 0, "SourceNode"));
     const auto& source_options = checked_cast<const SourceNodeOptions&>(options);
-    return plan->EmplaceNode<SourceNode>(plan, source_options.output_schema,
-                                         source_options.generator,
-                                         source_options.ordering);
+    return plan->EmplaceNode<SourceNode>(
+        plan, source_options.output_schema, source_options.generator,
+        source_options.ordering, source_options.runtime_filter_receiver);
   }
 
   const char* kind_name() const override { return "SourceNode"; }
 
+  Status ReceiveRuntimeFilter(std::shared_ptr<RuntimeFilter> filter) override {
+    if (runtime_filter_receiver_) {
+      return runtime_filter_receiver_->ReceiveRuntimeFilter(std::move(filter));
+    }
+    return Status::OK();
+  }
+
+  bool accepts_runtime_filters() const override {
+    return runtime_filter_receiver_ != NULLPTR &&
+           runtime_filter_receiver_->accepts_runtime_filters();
+  }
+
   [[noreturn]] static void NoInputs() {
     Unreachable("no inputs; this should never be called");
   }
@@ -247,6 +262,7 @@ struct SourceNode : ExecNode, public TracedNode {
       return;
     }
     backpressure_future_ = Future<>::Make();
+    profiler()->RecordPaused(counter);
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
@@ -263,6 +279,7 @@ struct SourceNode : ExecNode, public TracedNode {
       to_finish = backpressure_future_;
       backpressure_future_ = Future<>::MakeFinished();
     }
+    profiler()->RecordResumed(counter);
     to_finish.MarkFinished();
   }
 
@@ -298,6 +315,7 @@ struct SourceNode : ExecNode, public TracedNode {
   int batch_count_{0};
   const AsyncGenerator<std::optional<ExecBatch>> generator_;
   const Ordering ordering_;
+  const std::shared_ptr<RuntimeFilterReceiver> runtime_filter_receiver_;
 };
 
 struct TableSourceNode : public SourceNode {
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/spill_util_internal.h"
+
+#include <utility>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+
+using internal::DeleteFile;
+using internal::PlatformFilename;
+
+namespace acero {
+
+SpillFile::SpillFile(QueryContext* ctx, std::shared_ptr<Schema> schema, std::string path,
+                     NodeProfiler* profiler)
+    : ctx_(ctx),
+      schema_(std::move(schema)),
+      path_(std::move(path)),
+      profiler_(profiler) {}
+
+SpillFile::~SpillFile() {
+  if (writer_) {
+    ARROW_WARN_NOT_OK(writer_->Close(), "When closing an unfinished spill file");
+  }
+  auto maybe_path = PlatformFilename::FromString(path_);
+  if (maybe_path.ok()) {
+    ARROW_WARN_NOT_OK(DeleteFile(*maybe_path).status(),
+                      "When trying to delete a spill file");
+  }
+}
+
+Result<std::unique_ptr<SpillFile>> SpillFile::Make(QueryContext* ctx,
+                                                   std::shared_ptr<Schema> schema,
+                                                   std::string_view prefix,
+                                                   NodeProfiler* profiler) {
+  ARROW_ASSIGN_OR_RAISE(std::string path, ctx->NewSpillFilePath(prefix));
+  std::unique_ptr<SpillFile> file(
+      new SpillFile(ctx, std::move(schema), std::move(path), profiler));
+  ARROW_ASSIGN_OR_RAISE(file->sink_, io::FileOutputStream::Open(file->path_));
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.memory_pool = ctx->memory_pool();
+  write_options.use_threads = false;
+  ARROW_ASSIGN_OR_RAISE(file->writer_,
+                        ipc::MakeStreamWriter(file->sink_, file->schema_, write_options));
+  return file;
+}
+
+Status SpillFile::Write(const RecordBatch& batch) {
+  if (!writer_) {
+    return Status::Invalid("Cannot write to a spill file that has been finished");
+  }
+  auto io_mark =
+      ctx_->ReportTempFileIO(static_cast<size_t>(::arrow::util::TotalBufferSize(batch)));
+  RETURN_NOT_OK(writer_->WriteRecordBatch(batch));
+  num_rows_ += batch.num_rows();
+  ARROW_ASSIGN_OR_RAISE(num_bytes_, sink_->Tell());
+  return Status::OK();
+}
+
+Status SpillFile::Finish() {
+  if (!writer_) {
+    return Status::Invalid("Spill file has already been finished");
+  }
+  RETURN_NOT_OK(writer_->Close());
+  writer_.reset();
+  ARROW_ASSIGN_OR_RAISE(num_bytes_, sink_->Tell());
+  RETURN_NOT_OK(sink_->Close());
+  sink_.reset();
+  if (profiler_) {
+    profiler_->RecordSpilled(num_bytes_);
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<RecordBatchReader>> SpillFile::OpenReader() const {
+  if (writer_) {
+    return Status::Invalid("Cannot read a spill file before it has been finished");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto source,
+                        io::ReadableFile::Open(path_, ctx_->memory_pool()));
+  auto read_options = ipc::IpcReadOptions::Defaults();
+  read_options.memory_pool = ctx_->memory_pool();
+  read_options.use_threads = false;
+  return ipc::RecordBatchStreamReader::Open(std::move(source), read_options);
+}
+
+}  // namespace acero
+}  // namespace arrow
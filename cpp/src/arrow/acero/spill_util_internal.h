@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/io/type_fwd.h"
+#include "arrow/ipc/type_fwd.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+/// \brief A temporary, on-disk sequence of record batches
+///
+/// A spill file is written once, from start to end, and then read back
+/// sequentially (possibly several times).  Batches are stored in the Arrow IPC
+/// stream format in the query's spill directory (see QueryContext::NewSpillFilePath).
+/// The file is deleted when the SpillFile is destroyed.
+///
+/// Writing is not thread-safe; callers must serialize calls to Write and Finish.
+class ARROW_ACERO_EXPORT SpillFile {
+ public:
+  ~SpillFile();
+
+  /// \brief Create a new, empty spill file
+  ///
+  /// \param ctx The query context, used for the file location and memory pool
+  /// \param schema The schema of all batches that will be written
+  /// \param prefix A prefix for the file name, for debugging
+  /// \param profiler If not null, the profiler of the node spilling, to which the
+  /// size of the file is reported when it is finished
+  static Result<std::unique_ptr<SpillFile>> Make(QueryContext* ctx,
+                                                 std::shared_ptr<Schema> schema,
+                                                 std::string_view prefix,
+                                                 NodeProfiler* profiler = NULLPTR);
+
+  /// \brief Append a batch to the file
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Flush and close the file for writing
+  ///
+  /// Must be called exactly once, after the last call to Write and before
+  /// any call to OpenReader.
+  Status Finish();
+
+  /// \brief Open a reader which yields the written batches in order
+  Result<std::shared_ptr<RecordBatchReader>> OpenReader() const;
+
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+  const std::string& path() const { return path_; }
+  /// The number of rows written so far
+  int64_t num_rows() const { return num_rows_; }
+  /// The number of bytes written so far
+  int64_t num_bytes() const { return num_bytes_; }
+
+ private:
+  SpillFile(QueryContext* ctx, std::shared_ptr<Schema> schema, std::string path,
+            NodeProfiler* profiler);
+
+  QueryContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::string path_;
+  NodeProfiler* profiler_;
+  std::shared_ptr<io::FileOutputStream> sink_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+  int64_t num_rows_ = 0;
+  int64_t num_bytes_ = 0;
+};
+
+}  // namespace acero
+}  // namespace arrow
@@ -50,6 +50,7 @@
 #include "arrow/type.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/unreachable.h"
@@ -639,5 +640,34 @@ Result<std::shared_ptr<Table>> RunEndEncodeTableColumns(
   return Table::Make(std::move(updated_schema), std::move(encoded_columns));
 }
 
+Result<std::unique_ptr<SpillDir>> SpillDir::Make() {
+  ARROW_ASSIGN_OR_RAISE(auto dir, ::arrow::internal::TemporaryDir::Make("spill-test-"));
+  return std::unique_ptr<SpillDir>(new SpillDir(std::move(dir)));
+}
+
+// TMPDIR is looked up first on POSIX and TMP on Windows
+SpillDir::SpillDir(std::unique_ptr<::arrow::internal::TemporaryDir> dir)
+    : dir_(std::move(dir)),
+      tmpdir_guard_("TMPDIR", dir_->path().ToString()),
+      tmp_guard_("TMP", dir_->path().ToString()) {}
+
+Result<std::vector<std::string>> SpillDir::ListEntries() const {
+  ARROW_ASSIGN_OR_RAISE(auto entries, ::arrow::internal::ListDir(dir_->path()));
+  std::vector<std::string> paths;
+  for (const auto& entry : entries) {
+    paths.push_back(entry.ToString());
+  }
+  return paths;
+}
+
+const NodeProfile* FindNodeProfile(const PlanProfile& profile, std::string_view kind) {
+  for (const NodeProfile& node : profile.nodes) {
+    if (node.kind == kind) {
+      return &node;
+    }
+  }
+  return nullptr;
+}
+
 }  // namespace acero
 }  // namespace arrow
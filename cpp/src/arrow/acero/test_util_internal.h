@@ -33,6 +33,7 @@
 #include "arrow/table.h"
 #include "arrow/testing/visibility.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/pcg_random.h"
 
 namespace arrow::acero {
@@ -190,4 +191,24 @@ Result<std::shared_ptr<Table>> MakeRandomTimeSeriesTable(
 Result<std::shared_ptr<Table>> RunEndEncodeTableColumns(
     const Table& table, const std::vector<int>& column_indices);
 
+/// \brief Directs the spill files of the plans run while it exists to a fresh
+/// temporary directory, so that tests can check they were written and removed
+class SpillDir {
+ public:
+  static Result<std::unique_ptr<SpillDir>> Make();
+
+  /// \brief The paths of the files and directories left in the directory
+  Result<std::vector<std::string>> ListEntries() const;
+
+ private:
+  explicit SpillDir(std::unique_ptr<::arrow::internal::TemporaryDir> dir);
+
+  std::unique_ptr<::arrow::internal::TemporaryDir> dir_;
+  EnvVarGuard tmpdir_guard_;
+  EnvVarGuard tmp_guard_;
+};
+
+/// \brief The profile of the first node of the given kind, or null if there is none
+const NodeProfile* FindNodeProfile(const PlanProfile& profile, std::string_view kind);
+
 }  // namespace arrow::acero
@@ -25,11 +25,15 @@ namespace acero {
 
 class ExecNode;
 class ExecPlan;
+class NodeProfiler;
 class ExecNodeOptions;
 class ExecFactoryRegistry;
 class QueryContext;
+class RuntimeFilterReceiver;
 struct QueryOptions;
 struct Declaration;
+struct NodeProfile;
+struct PlanProfile;
 class SinkNodeConsumer;
 
 }  // namespace acero
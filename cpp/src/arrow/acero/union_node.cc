@@ -78,7 +78,7 @@ class UnionNode : public ExecNode, public TracedNode {
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    NoteInputReceived(batch);
+    NoteInputReceived(batch, input);
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
 
     if (inputs_.size() > 1) {
@@ -105,12 +105,14 @@ class UnionNode : public ExecNode, public TracedNode {
   }
 
   void PauseProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordPaused(counter);
     for (auto* input : inputs_) {
       input->PauseProducing(this, counter);
     }
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordResumed(counter);
     for (auto* input : inputs_) {
       input->ResumeProducing(this, counter);
     }
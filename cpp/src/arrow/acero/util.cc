@@ -17,13 +17,18 @@
 
 #include "arrow/acero/util.h"
 
+#include <chrono>
+#include <ctime>
+
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/query_context.h"
 #include "arrow/table.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/tracing_internal.h"
 #include "arrow/util/ubsan.h"
+#include "arrow/util/windows_compatibility.h"
 
 namespace arrow {
 namespace acero {
@@ -97,13 +102,91 @@ Future<> TableSinkNodeConsumer::Finish() {
   return Status::OK();
 }
 
-[[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceStartProducing(
+namespace {
+
+// The CPU time consumed by the calling thread
+int64_t ThreadCpuTimeNanos() {
+#ifdef _WIN32
+  FILETIME creation_time, exit_time, kernel_time, user_time;
+  if (!GetThreadTimes(GetCurrentThread(), &creation_time, &exit_time, &kernel_time,
+                      &user_time)) {
+    return 0;
+  }
+  auto to_nanos = [](const FILETIME& time) {
+    // FILETIME counts 100 nanosecond intervals
+    return ((static_cast<int64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) *
+           100;
+  };
+  return to_nanos(kernel_time) + to_nanos(user_time);
+#else
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    return 0;
+  }
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+int64_t WallTimeNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// The innermost running ProfileTimer of this thread
+thread_local ProfileTimer* current_profile_timer = NULLPTR;
+
+}  // namespace
+
+// Only allocate a tracing scope if it does something
+#ifdef ARROW_WITH_OPENTELEMETRY
+#  define MAKE_TRACE_SCOPE(...) \
+    std::unique_ptr<::arrow::internal::tracing::Scope>( \
+        new ::arrow::internal::tracing::Scope(START_SCOPED_SPAN(__VA_ARGS__)))
+#else
+#  define MAKE_TRACE_SCOPE(...) nullptr
+#endif
+
+ProfileTimer::ProfileTimer(ExecNode* node)
+    : node_(node->profiler()->enabled() ? node : NULLPTR) {
+  if (node_) {
+    parent_ = current_profile_timer;
+    current_profile_timer = this;
+    cpu_start_nanos_ = ThreadCpuTimeNanos();
+    wall_start_nanos_ = WallTimeNanos();
+  }
+}
+
+ProfileTimer::~ProfileTimer() {
+  if (node_) {
+    const int64_t cpu_nanos = ThreadCpuTimeNanos() - cpu_start_nanos_;
+    const int64_t wall_nanos = WallTimeNanos() - wall_start_nanos_;
+    NodeProfiler* profiler = node_->profiler();
+    profiler->RecordTime(cpu_nanos - nested_cpu_nanos_, wall_nanos - nested_wall_nanos_);
+    profiler->RecordQueryMemory(
+        node_->plan()->query_context()->memory_pool()->bytes_allocated());
+    current_profile_timer = parent_;
+    if (parent_) {
+      parent_->nested_cpu_nanos_ += cpu_nanos;
+      parent_->nested_wall_nanos_ += wall_nanos;
+    }
+  }
+}
+
+TracedScope::TracedScope(ExecNode* node,
+                         std::unique_ptr<::arrow::internal::tracing::Scope> trace_scope)
+    : timer_(node), trace_scope_(std::move(trace_scope)) {}
+
+TracedScope::~TracedScope() = default;
+
+[[nodiscard]] TracedScope TracedNode::TraceStartProducing(
     std::string extra_details) const {
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
-  return START_SCOPED_SPAN(
-      span, node_kind + "::StartProducing",
-      {{"node.details", extra_details}, {"node.label", node_->label()}});
+  return TracedScope(
+      node_, MAKE_TRACE_SCOPE(span, node_kind + "::StartProducing",
+                              {{"node.details", extra_details},
+                               {"node.label", node_->label()}}));
 }
 
 void TracedNode::NoteStartProducing(std::string extra_details) const {
@@ -112,28 +195,45 @@ void TracedNode::NoteStartProducing(std::string extra_details) const {
                                                          {"node.label", node_->label()}});
 }
 
-[[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceInputReceived(
-    const ExecBatch& batch) const {
+void TracedNode::ProfileInputReceived(const ExecBatch& batch, ExecNode* input) const {
+  if (!node_->profiler()->enabled()) return;
+  node_->profiler()->RecordReceived(batch);
+  if (input == NULLPTR && node_->num_inputs() == 1) {
+    input = node_->inputs()[0];
+  }
+  if (input != NULLPTR) {
+    input->profiler()->RecordEmitted(batch);
+  }
+}
+
+[[nodiscard]] TracedScope TracedNode::TraceInputReceived(const ExecBatch& batch,
+                                                         ExecNode* input) const {
+  ProfileInputReceived(batch, input);
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
-  return START_SCOPED_SPAN(
-      span, node_kind + "::InputReceived",
-      {{"node.label", node_->label()}, {"node.batch_length", batch.length}});
+  return TracedScope(
+      node_,
+      MAKE_TRACE_SCOPE(
+          span, node_kind + "::InputReceived",
+          {{"node.label", node_->label()}, {"node.batch_length", batch.length}}));
 }
 
-void TracedNode::NoteInputReceived(const ExecBatch& batch) const {
+void TracedNode::NoteInputReceived(const ExecBatch& batch, ExecNode* input) const {
+  ProfileInputReceived(batch, input);
   std::string node_kind(node_->kind_name());
   EVENT_ON_CURRENT_SPAN(
       node_kind + "::InputReceived",
       {{"node.label", node_->label()}, {"node.batch_length", batch.length}});
 }
 
-[[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceFinish() const {
+[[nodiscard]] TracedScope TracedNode::TraceFinish() const {
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
-  return START_SCOPED_SPAN(span, node_kind + "::Finish",
-                           {{"node.label", node_->label()}});
+  return TracedScope(node_, MAKE_TRACE_SCOPE(span, node_kind + "::Finish",
+                                             {{"node.label", node_->label()}}));
 }
 
+#undef MAKE_TRACE_SCOPE
+
 }  // namespace acero
 }  // namespace arrow
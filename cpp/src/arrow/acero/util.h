@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <thread>
 #include <unordered_map>
@@ -141,6 +142,43 @@ class ARROW_ACERO_EXPORT NullSinkNodeConsumer : public SinkNodeConsumer {
   }
 };
 
+/// \brief Adds the CPU and wall time of a scope to the profile of a node
+///
+/// The time of the timers nested in it on the same thread, which are those of other
+/// nodes called synchronously (usually the output), is left out.
+class ARROW_ACERO_EXPORT ProfileTimer {
+ public:
+  explicit ProfileTimer(ExecNode* node);
+  ~ProfileTimer();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ProfileTimer);
+
+ private:
+  // Null if the node is not being profiled
+  ExecNode* node_;
+  // The timer this one is nested in, if any
+  ProfileTimer* parent_ = NULLPTR;
+  int64_t cpu_start_nanos_ = 0;
+  int64_t wall_start_nanos_ = 0;
+  int64_t nested_cpu_nanos_ = 0;
+  int64_t nested_wall_nanos_ = 0;
+};
+
+/// \brief A span of node work, which is both traced and profiled
+class ARROW_ACERO_EXPORT TracedScope {
+ public:
+  // trace_scope may be null if tracing is disabled
+  TracedScope(ExecNode* node,
+              std::unique_ptr<::arrow::internal::tracing::Scope> trace_scope);
+  ~TracedScope();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TracedScope);
+
+ private:
+  ProfileTimer timer_;
+  std::unique_ptr<::arrow::internal::tracing::Scope> trace_scope_;
+};
+
 /// CRTP helper for tracing helper functions
 
 class ARROW_ACERO_EXPORT TracedNode {
@@ -152,8 +190,7 @@ class ARROW_ACERO_EXPORT TracedNode {
   explicit TracedNode(ExecNode* node) : node_(node) {}
 
   // Create a span to record the StartProducing work
-  [[nodiscard]] ::arrow::internal::tracing::Scope TraceStartProducing(
-      std::string extra_details) const;
+  [[nodiscard]] TracedScope TraceStartProducing(std::string extra_details) const;
 
   // Record a call to StartProducing without creating with a span
   void NoteStartProducing(std::string extra_details) const;
@@ -162,21 +199,26 @@ class ARROW_ACERO_EXPORT TracedNode {
   // should track the time spent processing the batch.  NoteInputReceived is available
   // but usually won't be used unless a node is simply adding batches to a trivial queue.
 
+  // These also add the batch to the node's profile, and to the profile of the input
+  // which emitted it.  Nodes with more than one input must pass the input.
+
   // Create a span to record the InputReceived work
-  [[nodiscard]] ::arrow::internal::tracing::Scope TraceInputReceived(
-      const ExecBatch& batch) const;
+  [[nodiscard]] TracedScope TraceInputReceived(const ExecBatch& batch,
+                                               ExecNode* input = NULLPTR) const;
 
   // Record a call to InputReceived without creating with a span
-  void NoteInputReceived(const ExecBatch& batch) const;
+  void NoteInputReceived(const ExecBatch& batch, ExecNode* input = NULLPTR) const;
 
   // Create a span to record any "finish" work.  This should NOT be called as part of
   // InputFinished and many nodes may not need to call this at all.  This should be used
   // when a node has some extra work that has to be done once it has received all of its
   // data.  For example, an aggregation node calculating aggregations.  This will
   // typically be called as a result of InputFinished OR InputReceived.
-  [[nodiscard]] ::arrow::internal::tracing::Scope TraceFinish() const;
+  [[nodiscard]] TracedScope TraceFinish() const;
 
  private:
+  void ProfileInputReceived(const ExecBatch& batch, ExecNode* input) const;
+
   ExecNode* node_;
 };
 
@@ -0,0 +1,1194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/aggregate_internal.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/order_by_impl.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util_overflow.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/tracing_internal.h"
+
+// The window node computes, for every input row, a value derived from the other rows
+// of its partition (the rows with the same partition keys).  Rows are sorted by the
+// partition keys and the window ordering, using the same sort as the order_by node,
+// and partitions are then processed one at a time as they come out of the sort.  The
+// sorted rows are only read while the output isn't paused, so a spilled sort is
+// merged as the output is consumed.
+//
+// Ranking functions only depend on where each run of rows with equal ordering keys
+// (peers) starts.  Aggregates over a frame spanning the whole partition are computed
+// with the hash aggregate kernels, using a single group.  Aggregates over other frames
+// are computed in a single pass over the partition: the bounds of each row's frame
+// only ever move forward, so sums and counts are taken from prefix sums and minimums,
+// maximums and floating-point sums from a segment tree built over the partition.
+
+namespace arrow {
+
+using internal::AddWithOverflow;
+using internal::checked_cast;
+using internal::SubtractWithOverflow;
+
+using compute::CountOptions;
+using compute::NullPlacement;
+using compute::ScalarAggregateOptions;
+using compute::SortKey;
+using compute::SortOrder;
+
+namespace acero {
+namespace {
+
+constexpr std::string_view kRowNumber = "row_number";
+constexpr std::string_view kRank = "rank";
+constexpr std::string_view kDenseRank = "dense_rank";
+
+enum class WindowFunctionKind {
+  kRowNumber,
+  kRank,
+  kDenseRank,
+  // Any hash aggregate, over a frame spanning the whole partition
+  kPartitionAggregate,
+  // Aggregates over any other frame
+  kCount,
+  kSum,
+  kMean,
+  kMin,
+  kMax,
+};
+
+struct WindowFunction {
+  WindowFunctionKind kind;
+  Aggregate aggregate;
+  std::vector<int> target_field_ids;
+  std::vector<TypeHolder> in_types;
+  std::shared_ptr<DataType> out_type;
+  // Only set for kPartitionAggregate
+  const HashAggregateKernel* kernel = nullptr;
+  // Only set for kCount
+  CountOptions count_options;
+  // Only set for kSum, kMean, kMin and kMax
+  ScalarAggregateOptions aggregate_options;
+};
+
+bool IsFrameAggregateType(const DataType& type) {
+  return is_integer(type.id()) || type.id() == Type::FLOAT || type.id() == Type::DOUBLE;
+}
+
+bool IsRangeKeyType(const DataType& type) {
+  switch (type.id()) {
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIMESTAMP:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::DURATION:
+      return true;
+    default:
+      return IsFrameAggregateType(type);
+  }
+}
+
+bool IsUnboundedFrame(const WindowFrame& frame) {
+  return !frame.preceding.has_value() && !frame.following.has_value();
+}
+
+// Whether a bound of a RANGE frame depends on the value of the ordering key, rather
+// than only on the partition or the peers of the current row
+bool IsValueBound(const std::optional<int64_t>& bound) {
+  return bound.has_value() && *bound != 0;
+}
+
+Result<WindowFunction> ResolveWindowFunction(ExecContext* ctx, const Schema& schema,
+                                             const Aggregate& aggregate,
+                                             const WindowFrame& frame) {
+  WindowFunction function;
+  function.aggregate = aggregate;
+  for (const auto& target : aggregate.target) {
+    ARROW_ASSIGN_OR_RAISE(auto match, target.FindOne(schema));
+    function.target_field_ids.push_back(match[0]);
+    function.in_types.emplace_back(schema.field(match[0])->type());
+  }
+
+  if (aggregate.function == kRowNumber || aggregate.function == kRank ||
+      aggregate.function == kDenseRank) {
+    if (!aggregate.target.empty()) {
+      return Status::Invalid("The window function ", aggregate.function,
+                             " does not take any arguments");
+    }
+    function.kind = aggregate.function == kRowNumber ? WindowFunctionKind::kRowNumber
+                    : aggregate.function == kRank    ? WindowFunctionKind::kRank
+                                                     : WindowFunctionKind::kDenseRank;
+    function.out_type = int64();
+    return function;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(function.kernel,
+                        aggregate::GetKernel(ctx, aggregate, function.in_types));
+  std::vector<std::unique_ptr<KernelState>> states(1);
+  ARROW_ASSIGN_OR_RAISE(states[0], aggregate::InitKernel(function.kernel, ctx, aggregate,
+                                                         function.in_types));
+  ARROW_ASSIGN_OR_RAISE(FieldVector fields,
+                        aggregate::ResolveKernels({aggregate}, {function.kernel}, states,
+                                                  ctx, {function.in_types}));
+  function.out_type = fields[0]->type();
+  if (IsUnboundedFrame(frame)) {
+    function.kind = WindowFunctionKind::kPartitionAggregate;
+    return function;
+  }
+  function.kernel = nullptr;
+
+  ARROW_ASSIGN_OR_RAISE(auto registered_function,
+                        ctx->func_registry()->GetFunction(aggregate.function));
+  const FunctionOptions* options = aggregate.options
+                                       ? aggregate.options.get()
+                                       : registered_function->default_options();
+  if (aggregate.function == "hash_count") {
+    function.kind = WindowFunctionKind::kCount;
+    function.count_options = checked_cast<const CountOptions&>(*options);
+    return function;
+  }
+  if (aggregate.function == "hash_sum") {
+    function.kind = WindowFunctionKind::kSum;
+  } else if (aggregate.function == "hash_mean") {
+    function.kind = WindowFunctionKind::kMean;
+  } else if (aggregate.function == "hash_min") {
+    function.kind = WindowFunctionKind::kMin;
+  } else if (aggregate.function == "hash_max") {
+    function.kind = WindowFunctionKind::kMax;
+  } else {
+    return Status::NotImplemented("The window function ", aggregate.function,
+                                  " is only supported over unbounded frames");
+  }
+  if (!IsFrameAggregateType(*function.in_types[0])) {
+    return Status::NotImplemented("The window function ", aggregate.function,
+                                  " is only supported over unbounded frames for type ",
+                                  *function.in_types[0]);
+  }
+  function.aggregate_options = checked_cast<const ScalarAggregateOptions&>(*options);
+  return function;
+}
+
+int64_t SaturatingAdd(int64_t left, int64_t right) {
+  int64_t out;
+  if (AddWithOverflow(left, right, &out)) {
+    return right > 0 ? std::numeric_limits<int64_t>::max()
+                     : std::numeric_limits<int64_t>::min();
+  }
+  return out;
+}
+
+int64_t SaturatingSubtract(int64_t left, int64_t right) {
+  int64_t out;
+  if (SubtractWithOverflow(left, right, &out)) {
+    return right < 0 ? std::numeric_limits<int64_t>::max()
+                     : std::numeric_limits<int64_t>::min();
+  }
+  return out;
+}
+
+// The magnitude of an int64, which is also valid for the minimum int64
+uint64_t Magnitude(int64_t value) {
+  return value < 0 ? uint64_t{0} - static_cast<uint64_t>(value)
+                   : static_cast<uint64_t>(value);
+}
+
+uint64_t SaturatingAdd(uint64_t left, int64_t right) {
+  constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+  const uint64_t magnitude = Magnitude(right);
+  if (right < 0) {
+    return left < magnitude ? 0 : left - magnitude;
+  }
+  return left > kMax - magnitude ? kMax : left + magnitude;
+}
+
+uint64_t SaturatingSubtract(uint64_t left, int64_t right) {
+  constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+  const uint64_t magnitude = Magnitude(right);
+  if (right < 0) {
+    return left > kMax - magnitude ? kMax : left + magnitude;
+  }
+  return left < magnitude ? 0 : left - magnitude;
+}
+
+double SaturatingAdd(double left, double right) { return left + right; }
+double SaturatingSubtract(double left, double right) { return left - right; }
+
+// Computes the value-dependent bounds of a RANGE frame for the rows in [begin, end),
+// which must have non-null and non-NaN ordering keys.  Each bound is found by moving
+// a cursor forward, since the rows are sorted by these values.
+template <typename T>
+void ComputeRangeBounds(const T* values, int64_t begin, int64_t end, bool descending,
+                        const WindowFrame& frame, int64_t* frame_begin,
+                        int64_t* frame_end) {
+  using OffsetType = std::conditional_t<std::is_floating_point_v<T>, T, int64_t>;
+  if (IsValueBound(frame.preceding)) {
+    auto offset = static_cast<OffsetType>(*frame.preceding);
+    int64_t cursor = begin;
+    for (int64_t i = begin; i < end; ++i) {
+      // The first row which isn't more than `offset` before the current row
+      if (descending) {
+        T limit = SaturatingAdd(values[i], offset);
+        while (cursor < end && values[cursor] > limit) ++cursor;
+      } else {
+        T limit = SaturatingSubtract(values[i], offset);
+        while (cursor < end && values[cursor] < limit) ++cursor;
+      }
+      frame_begin[i] = cursor;
+    }
+  }
+  if (IsValueBound(frame.following)) {
+    auto offset = static_cast<OffsetType>(*frame.following);
+    int64_t cursor = begin;
+    for (int64_t i = begin; i < end; ++i) {
+      // The first row which is more than `offset` after the current row
+      if (descending) {
+        T limit = SaturatingSubtract(values[i], offset);
+        while (cursor < end && values[cursor] >= limit) ++cursor;
+      } else {
+        T limit = SaturatingAdd(values[i], offset);
+        while (cursor < end && values[cursor] <= limit) ++cursor;
+      }
+      frame_end[i] = cursor;
+    }
+  }
+}
+
+// A segment tree over the rows of a partition, answering queries over any range of
+// rows in O(log(n)).  `Combine` must be associative, with `identity` as its identity.
+template <typename T, typename Combine>
+class SegmentTree {
+ public:
+  SegmentTree(std::vector<T> leaves, T identity, Combine combine)
+      : length_(static_cast<int64_t>(leaves.size())),
+        identity_(identity),
+        combine_(std::move(combine)),
+        nodes_(2 * leaves.size(), identity) {
+    std::move(leaves.begin(), leaves.end(), nodes_.begin() + length_);
+    for (int64_t i = length_ - 1; i > 0; --i) {
+      nodes_[i] = combine_(nodes_[2 * i], nodes_[2 * i + 1]);
+    }
+  }
+
+  /// Combine the leaves in [begin, end)
+  T Query(int64_t begin, int64_t end) const {
+    T left = identity_;
+    T right = identity_;
+    for (begin += length_, end += length_; begin < end; begin >>= 1, end >>= 1) {
+      if (begin & 1) left = combine_(left, nodes_[begin++]);
+      if (end & 1) right = combine_(nodes_[--end], right);
+    }
+    return combine_(left, right);
+  }
+
+ private:
+  int64_t length_;
+  T identity_;
+  Combine combine_;
+  std::vector<T> nodes_;
+};
+
+template <typename T, typename Combine>
+SegmentTree<T, Combine> MakeSegmentTree(const T* values, const ArraySpan& span,
+                                        T identity, Combine combine) {
+  std::vector<T> leaves(span.length, identity);
+  for (int64_t i = 0; i < span.length; ++i) {
+    if (span.IsValid(i)) leaves[i] = values[i];
+  }
+  return SegmentTree<T, Combine>(std::move(leaves), identity, std::move(combine));
+}
+
+struct Frames {
+  std::vector<int64_t> begin;
+  std::vector<int64_t> end;
+};
+
+// Computes a sum, mean, minimum or maximum over the frame of each row.  The values
+// have been cast to int64, uint64 or double.
+template <typename CType>
+Result<std::shared_ptr<ArrayData>> ComputeNumericFrameAggregate(
+    const WindowFunction& function, const ArraySpan& span, const Frames& frames,
+    MemoryPool* pool) {
+  using OutType = std::conditional_t<std::is_integral_v<CType>, CType, double>;
+  const int64_t length = span.length;
+  const CType* values = span.GetValues<CType>(1);
+  const ScalarAggregateOptions& options = function.aggregate_options;
+
+  std::vector<int64_t> valid_prefix(length + 1, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    valid_prefix[i + 1] = valid_prefix[i] + (span.IsValid(i) ? 1 : 0);
+  }
+
+  // Integer sums wrap around on overflow, like the sum kernels
+  using UnsignedType = std::make_unsigned_t<
+      std::conditional_t<std::is_integral_v<CType>, CType, int64_t>>;
+  std::vector<UnsignedType> prefix_sums;
+  std::optional<SegmentTree<double, std::plus<double>>> sum_tree;
+  auto min = [](CType left, CType right) {
+    if constexpr (std::is_floating_point_v<CType>) {
+      return std::fmin(left, right);
+    } else {
+      return std::min(left, right);
+    }
+  };
+  auto max = [](CType left, CType right) {
+    if constexpr (std::is_floating_point_v<CType>) {
+      return std::fmax(left, right);
+    } else {
+      return std::max(left, right);
+    }
+  };
+  std::optional<SegmentTree<CType, decltype(min)>> min_tree;
+  std::optional<SegmentTree<CType, decltype(max)>> max_tree;
+  // fmin and fmax ignore NaNs, so a frame of valid values which are all NaN has the
+  // minimum and maximum NaN, like the min_max kernel
+  std::vector<int64_t> nan_prefix;
+  if constexpr (std::is_floating_point_v<CType>) {
+    if (function.kind == WindowFunctionKind::kMin ||
+        function.kind == WindowFunctionKind::kMax) {
+      nan_prefix.resize(length + 1, 0);
+      for (int64_t i = 0; i < length; ++i) {
+        nan_prefix[i + 1] =
+            nan_prefix[i] + (span.IsValid(i) && std::isnan(values[i]) ? 1 : 0);
+      }
+    }
+  }
+
+  switch (function.kind) {
+    case WindowFunctionKind::kSum:
+    case WindowFunctionKind::kMean:
+      if constexpr (std::is_integral_v<CType>) {
+        prefix_sums.resize(length + 1, 0);
+        for (int64_t i = 0; i < length; ++i) {
+          prefix_sums[i + 1] =
+              prefix_sums[i] + (span.IsValid(i) ? static_cast<UnsignedType>(values[i])
+                                                : UnsignedType{0});
+        }
+      } else {
+        // Prefix sums would lose precision when subtracted, so floating-point sums
+        // go through a segment tree
+        sum_tree.emplace(MakeSegmentTree<double>(values, span, 0.0, std::plus<double>()));
+      }
+      break;
+    case WindowFunctionKind::kMin:
+      min_tree.emplace(MakeSegmentTree<CType>(
+          values, span,
+          std::is_floating_point_v<CType> ? std::numeric_limits<CType>::infinity()
+                                          : std::numeric_limits<CType>::max(),
+          min));
+      break;
+    case WindowFunctionKind::kMax:
+      max_tree.emplace(MakeSegmentTree<CType>(
+          values, span,
+          std::is_floating_point_v<CType> ? -std::numeric_limits<CType>::infinity()
+                                          : std::numeric_limits<CType>::lowest(),
+          max));
+      break;
+    default:
+      return Status::UnknownError("Unexpected window function ",
+                                  function.aggregate.function);
+  }
+
+  const bool is_mean = function.kind == WindowFunctionKind::kMean;
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> validity,
+                        AllocateEmptyBitmap(length, pool));
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<Buffer> out_values,
+      AllocateBuffer(length * (is_mean ? sizeof(double) : sizeof(OutType)), pool));
+  uint8_t* out_validity = validity->mutable_data();
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    const int64_t begin = frames.begin[i];
+    const int64_t end = frames.end[i];
+    const int64_t count = valid_prefix[end] - valid_prefix[begin];
+    const int64_t num_nulls = (end - begin) - count;
+    bool valid = (options.skip_nulls || num_nulls == 0) && count >= options.min_count &&
+                 (function.kind == WindowFunctionKind::kSum || count > 0);
+    if (!valid) {
+      ++null_count;
+      continue;
+    }
+    bit_util::SetBit(out_validity, i);
+    switch (function.kind) {
+      case WindowFunctionKind::kSum:
+      case WindowFunctionKind::kMean: {
+        if constexpr (std::is_integral_v<CType>) {
+          auto sum = static_cast<CType>(prefix_sums[end] - prefix_sums[begin]);
+          if (is_mean) {
+            out_values->mutable_data_as<double>()[i] =
+                static_cast<double>(sum) / static_cast<double>(count);
+          } else {
+            out_values->mutable_data_as<OutType>()[i] = sum;
+          }
+        } else {
+          double sum = sum_tree->Query(begin, end);
+          out_values->mutable_data_as<double>()[i] =
+              is_mean ? sum / static_cast<double>(count) : sum;
+        }
+        break;
+      }
+      case WindowFunctionKind::kMin:
+      case WindowFunctionKind::kMax: {
+        if constexpr (std::is_floating_point_v<CType>) {
+          if (nan_prefix[end] - nan_prefix[begin] == count) {
+            out_values->mutable_data_as<OutType>()[i] =
+                std::numeric_limits<OutType>::quiet_NaN();
+            break;
+          }
+        }
+        out_values->mutable_data_as<OutType>()[i] = static_cast<OutType>(
+            function.kind == WindowFunctionKind::kMin ? min_tree->Query(begin, end)
+                                                      : max_tree->Query(begin, end));
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  std::shared_ptr<DataType> out_type =
+      is_mean ? float64() : CTypeTraits<OutType>::type_singleton();
+  return ArrayData::Make(std::move(out_type), length,
+                         {null_count > 0 ? std::move(validity) : nullptr,
+                          std::move(out_values)},
+                         null_count);
+}
+
+Result<std::shared_ptr<ArrayData>> ComputeFrameCount(const WindowFunction& function,
+                                                     const ArraySpan& span,
+                                                     const Frames& frames,
+                                                     MemoryPool* pool) {
+  const int64_t length = span.length;
+  std::vector<int64_t> valid_prefix(length + 1, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    valid_prefix[i + 1] = valid_prefix[i] + (span.IsValid(i) ? 1 : 0);
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out_values,
+                        AllocateBuffer(length * sizeof(int64_t), pool));
+  auto* counts = out_values->mutable_data_as<int64_t>();
+  for (int64_t i = 0; i < length; ++i) {
+    const int64_t begin = frames.begin[i];
+    const int64_t end = frames.end[i];
+    const int64_t num_valid = valid_prefix[end] - valid_prefix[begin];
+    switch (function.count_options.mode) {
+      case CountOptions::ONLY_VALID:
+        counts[i] = num_valid;
+        break;
+      case CountOptions::ONLY_NULL:
+        counts[i] = (end - begin) - num_valid;
+        break;
+      case CountOptions::ALL:
+        counts[i] = end - begin;
+        break;
+    }
+  }
+  return ArrayData::Make(int64(), length, {nullptr, std::move(out_values)},
+                         /*null_count=*/0);
+}
+
+// Sorting views -0.0 as 0.0 and all NaNs as equal, but the segmenters compare float
+// keys by their bytes.  Equal float keys are given the same bytes before segmenting,
+// so that the partitions and peers are the runs of the sort.
+template <typename CType>
+CType CanonicalFloat(CType value) {
+  if constexpr (std::is_same_v<CType, uint16_t>) {
+    // Half floats: 0x8000 is -0 and NaNs have all exponent bits set and a nonzero
+    // mantissa
+    if (value == 0x8000) return 0;
+    if ((value & 0x7c00) == 0x7c00 && (value & 0x03ff) != 0) return 0x7e00;
+    return value;
+  } else {
+    if (value == 0) return 0;
+    if (std::isnan(value)) return std::numeric_limits<CType>::quiet_NaN();
+    return value;
+  }
+}
+
+template <typename CType>
+Result<std::shared_ptr<ArrayData>> CanonicalizeFloats(const ArrayData& data,
+                                                     MemoryPool* pool) {
+  // The values keep the offset of the array, which the validity bitmap shares
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<Buffer> buffer,
+      AllocateBuffer((data.offset + data.length) * sizeof(CType), pool));
+  const CType* values = data.GetValues<CType>(1);
+  CType* out = buffer->mutable_data_as<CType>() + data.offset;
+  for (int64_t i = 0; i < data.length; ++i) {
+    out[i] = CanonicalFloat(values[i]);
+  }
+  return ArrayData::Make(data.type, data.length, {data.buffers[0], std::move(buffer)},
+                         data.null_count, data.offset);
+}
+
+Status CanonicalizeFloatKeys(ExecBatch* keys, MemoryPool* pool) {
+  for (Datum& key : keys->values) {
+    const ArrayData& data = *key.array();
+    switch (data.type->id()) {
+      case Type::HALF_FLOAT: {
+        ARROW_ASSIGN_OR_RAISE(key, CanonicalizeFloats<uint16_t>(data, pool));
+        break;
+      }
+      case Type::FLOAT: {
+        ARROW_ASSIGN_OR_RAISE(key, CanonicalizeFloats<float>(data, pool));
+        break;
+      }
+      case Type::DOUBLE: {
+        ARROW_ASSIGN_OR_RAISE(key, CanonicalizeFloats<double>(data, pool));
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  return Status::OK();
+}
+
+class WindowNode : public ExecNode, public TracedNode {
+ public:
+  WindowNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+             std::shared_ptr<Schema> output_schema, Ordering output_ordering,
+             std::vector<int> partition_key_field_ids, std::vector<SortKey> order_keys,
+             std::vector<int> order_key_field_ids, WindowFrame frame,
+             std::vector<WindowFunction> functions, std::unique_ptr<OrderByImpl> sort,
+             std::unique_ptr<RowSegmenter> partition_segmenter,
+             std::unique_ptr<RowSegmenter> peer_segmenter)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        ordering_(std::move(output_ordering)),
+        partition_key_field_ids_(std::move(partition_key_field_ids)),
+        order_keys_(std::move(order_keys)),
+        order_key_field_ids_(std::move(order_key_field_ids)),
+        frame_(std::move(frame)),
+        functions_(std::move(functions)),
+        sort_(std::move(sort)),
+        partition_segmenter_(std::move(partition_segmenter)),
+        peer_segmenter_(std::move(peer_segmenter)) {
+    if (sort_) {
+      sort_->set_profiler(profiler());
+    }
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "WindowNode"));
+
+    const auto& window_options = checked_cast<const WindowNodeOptions&>(options);
+    if (window_options.ordering.is_implicit()) {
+      return Status::Invalid("`ordering` must be an explicit ordering or unordered");
+    }
+    if (window_options.functions.empty()) {
+      return Status::Invalid("At least one window function is required");
+    }
+
+    const std::shared_ptr<Schema>& input_schema = inputs[0]->output_schema();
+    ExecContext* ctx = plan->query_context()->exec_context();
+
+    std::vector<SortKey> sort_keys;
+    std::vector<int> partition_key_field_ids;
+    std::vector<TypeHolder> partition_key_types;
+    for (const FieldRef& key : window_options.partition_keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(*input_schema));
+      partition_key_field_ids.push_back(match[0]);
+      partition_key_types.emplace_back(input_schema->field(match[0])->type());
+      sort_keys.emplace_back(key);
+    }
+    std::vector<SortKey> order_keys = SortOptions(window_options.ordering).GetSortKeys();
+    std::vector<int> order_key_field_ids;
+    std::vector<TypeHolder> order_key_types;
+    for (const SortKey& key : order_keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.target.FindOne(*input_schema));
+      order_key_field_ids.push_back(match[0]);
+      order_key_types.emplace_back(input_schema->field(match[0])->type());
+      sort_keys.push_back(key);
+    }
+
+    const WindowFrame& frame = window_options.frame;
+    if (frame.units == WindowFrameUnits::RANGE &&
+        (IsValueBound(frame.preceding) || IsValueBound(frame.following))) {
+      if (order_keys.size() != 1 || !IsRangeKeyType(*order_key_types[0])) {
+        return Status::Invalid(
+            "A RANGE window frame with offsets requires a single ordering key of an "
+            "integer, floating-point or temporal type");
+      }
+    }
+
+    std::vector<WindowFunction> functions;
+    FieldVector output_fields = input_schema->fields();
+    for (const Aggregate& aggregate : window_options.functions) {
+      ARROW_ASSIGN_OR_RAISE(WindowFunction function,
+                            ResolveWindowFunction(ctx, *input_schema, aggregate, frame));
+      output_fields.push_back(field(aggregate.name, function.out_type));
+      functions.push_back(std::move(function));
+    }
+
+    std::unique_ptr<OrderByImpl> sort;
+    if (!sort_keys.empty()) {
+      ARROW_ASSIGN_OR_RAISE(sort, OrderByImpl::MakeSort(plan->query_context(),
+                                                        input_schema,
+                                                        SortOptions(sort_keys)));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        std::unique_ptr<RowSegmenter> partition_segmenter,
+        RowSegmenter::Make(partition_key_types, /*nullable_keys=*/true, ctx));
+    ARROW_ASSIGN_OR_RAISE(
+        std::unique_ptr<RowSegmenter> peer_segmenter,
+        RowSegmenter::Make(order_key_types, /*nullable_keys=*/true, ctx));
+
+    Ordering output_ordering =
+        sort_keys.empty() ? Ordering::Unordered() : Ordering(sort_keys);
+    return plan->EmplaceNode<WindowNode>(
+        plan, std::move(inputs), schema(std::move(output_fields)),
+        std::move(output_ordering), std::move(partition_key_field_ids),
+        std::move(order_keys), std::move(order_key_field_ids), frame,
+        std::move(functions), std::move(sort), std::move(partition_segmenter),
+        std::move(peer_segmenter));
+  }
+
+  const char* kind_name() const override { return "WindowNode"; }
+
+  const Ordering& ordering() const override { return ordering_; }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                          batch.ToRecordBatch(inputs_[0]->output_schema()));
+    if (sort_) {
+      RETURN_NOT_OK(sort_->InputReceived(std::move(record_batch)));
+    } else {
+      std::lock_guard<std::mutex> lock(mutex_);
+      unsorted_batches_.push_back(std::move(record_batch));
+    }
+
+    if (counter_.Increment()) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (counter_.SetTotal(total_batches)) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordPaused(counter);
+    inputs_[0]->PauseProducing(this, counter);
+    std::lock_guard<std::mutex> lock(emit_mutex_);
+    if (counter <= backpressure_counter_) {
+      return;
+    }
+    backpressure_counter_ = counter;
+    paused_ = true;
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    profiler()->RecordResumed(counter);
+    inputs_[0]->ResumeProducing(this, counter);
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      if (counter <= backpressure_counter_) {
+        return;
+      }
+      backpressure_counter_ = counter;
+      paused_ = false;
+      if (!emit_done_.is_valid() || emitting_ || finished_ || stopped_) {
+        return;
+      }
+      emitting_ = true;
+    }
+    plan_->query_context()->ScheduleTask([this] { return EmitWindows(); },
+                                         "WindowNode::EmitWindows");
+  }
+
+  Status StopProducingImpl() override {
+    Future<> emit_done;
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      stopped_ = true;
+      if (!emit_done_.is_valid() || emitting_ || finished_) {
+        // A running EmitWindows notices the stop and finishes by itself
+        return Status::OK();
+      }
+      finished_ = true;
+      emit_done = emit_done_;
+    }
+    emit_done.MarkFinished();
+    return Status::OK();
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    const auto& input_schema = inputs_[0]->output_schema();
+    ss << "partition_keys=[";
+    for (size_t i = 0; i < partition_key_field_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << input_schema->field(partition_key_field_ids_[i])->name() << '"';
+    }
+    ss << "], ordering=" << ordering_.ToString() << ", frame="
+       << (frame_.units == WindowFrameUnits::ROWS ? "ROWS(" : "RANGE(");
+    if (frame_.preceding) {
+      ss << *frame_.preceding;
+    } else {
+      ss << "unbounded";
+    }
+    ss << ", ";
+    if (frame_.following) {
+      ss << *frame_.following;
+    } else {
+      ss << "unbounded";
+    }
+    ss << "), ";
+    std::vector<Aggregate> aggregates;
+    std::vector<std::vector<int>> target_fieldsets;
+    for (const auto& function : functions_) {
+      aggregates.push_back(function.aggregate);
+      target_fieldsets.push_back(function.target_field_ids);
+    }
+    aggregate::AggregatesToString(&ss, *input_schema, aggregates, target_fieldsets,
+                                  indent);
+    return ss.str();
+  }
+
+ private:
+  Status DoFinish() {
+    std::shared_ptr<RecordBatchReader> sorted;
+    if (sort_) {
+      ARROW_ASSIGN_OR_RAISE(sorted, sort_->DoFinishAsReader(ExecPlan::kMaxBatchSize));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(sorted,
+                            RecordBatchReader::Make(std::move(unsorted_batches_),
+                                                    inputs_[0]->output_schema()));
+    }
+
+    // The sorted rows are read and the windows emitted one batch at a time, which
+    // stops while the output applies backpressure.  The external task keeps the plan
+    // alive while paused.
+    ARROW_ASSIGN_OR_RAISE(Future<> emit_done, plan_->query_context()->BeginExternalTask(
+                                                  "WindowNode::EmitWindows"));
+    if (!emit_done.is_valid()) {
+      // The plan is already ending
+      return Status::OK();
+    }
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      sorted_ = std::move(sorted);
+      emit_done_ = emit_done;
+      if (paused_ && !stopped_) {
+        // ResumeProducing starts the emission
+        return Status::OK();
+      }
+      emitting_ = true;
+    }
+    return EmitWindows();
+  }
+
+  // Only one call runs at a time, guarded by emitting_, so sorted_, the partition
+  // state and the pending output are only accessed by that call
+  Status EmitWindows() {
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(emit_mutex_);
+        if (stopped_) {
+          break;
+        }
+        if (paused_) {
+          emitting_ = false;
+          return Status::OK();
+        }
+      }
+      Status status;
+      if (!pending_output_.empty()) {
+        ExecBatch out = std::move(pending_output_.front());
+        pending_output_.pop_front();
+        status = output_->InputReceived(this, std::move(out));
+      } else if (sorted_ == nullptr) {
+        return FinishEmitting(output_->InputFinished(this, num_output_batches_));
+      } else {
+        Result<std::shared_ptr<RecordBatch>> next = sorted_->Next();
+        if (!next.ok()) {
+          status = next.status();
+        } else if (*next == nullptr) {
+          // Releasing the reader removes any spill files that are left
+          sorted_.reset();
+          if (!partition_batches_.empty()) {
+            status = ProcessPartition();
+          }
+        } else {
+          status = ConsumeSorted(*next);
+        }
+      }
+      if (!status.ok()) {
+        return FinishEmitting(std::move(status));
+      }
+    }
+    return FinishEmitting(Status::OK());
+  }
+
+  Status FinishEmitting(Status status) {
+    sorted_.reset();
+    pending_output_.clear();
+    Future<> emit_done;
+    {
+      std::lock_guard<std::mutex> lock(emit_mutex_);
+      emitting_ = false;
+      finished_ = true;
+      emit_done = emit_done_;
+    }
+    // Errors are reported by the returned status
+    emit_done.MarkFinished();
+    return status;
+  }
+
+  static ExecBatch SelectColumns(const ExecBatch& batch, const std::vector<int>& ids) {
+    std::vector<Datum> values;
+    values.reserve(ids.size());
+    for (int id : ids) {
+      values.push_back(batch[id]);
+    }
+    return ExecBatch(std::move(values), batch.length);
+  }
+
+  // Cuts sorted batches into partitions, processing each one once it is complete
+  Status ConsumeSorted(const std::shared_ptr<RecordBatch>& batch) {
+    if (batch->num_rows() == 0) {
+      return Status::OK();
+    }
+    ExecBatch keys = SelectColumns(ExecBatch(*batch), partition_key_field_ids_);
+    RETURN_NOT_OK(CanonicalizeFloatKeys(&keys, plan_->query_context()->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(std::vector<Segment> segments,
+                          partition_segmenter_->GetSegments(ExecSpan(keys)));
+    for (const Segment& segment : segments) {
+      if (!segment.extends && !partition_batches_.empty()) {
+        RETURN_NOT_OK(ProcessPartition());
+      }
+      partition_batches_.push_back(batch->Slice(segment.offset, segment.length));
+    }
+    return Status::OK();
+  }
+
+  Status ProcessPartition() {
+    MemoryPool* pool = plan_->query_context()->memory_pool();
+    std::shared_ptr<RecordBatch> partition;
+    if (partition_batches_.size() == 1) {
+      partition = std::move(partition_batches_[0]);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(partition,
+                            ConcatenateRecordBatches(partition_batches_, pool));
+    }
+    partition_batches_.clear();
+
+    ExecBatch batch(*partition);
+    // Find the runs of peers, which don't carry over from the previous partition
+    RETURN_NOT_OK(peer_segmenter_->Reset());
+    ExecBatch order_keys = SelectColumns(batch, order_key_field_ids_);
+    RETURN_NOT_OK(CanonicalizeFloatKeys(&order_keys, pool));
+    ARROW_ASSIGN_OR_RAISE(std::vector<Segment> peers,
+                          peer_segmenter_->GetSegments(ExecSpan(order_keys)));
+
+    std::optional<Frames> frames;
+    for (const WindowFunction& function : functions_) {
+      Datum column;
+      switch (function.kind) {
+        case WindowFunctionKind::kRowNumber:
+        case WindowFunctionKind::kRank:
+        case WindowFunctionKind::kDenseRank: {
+          ARROW_ASSIGN_OR_RAISE(column, ComputeRank(function.kind, peers, batch.length));
+          break;
+        }
+        case WindowFunctionKind::kPartitionAggregate: {
+          ARROW_ASSIGN_OR_RAISE(column, ComputePartitionAggregate(function, batch));
+          break;
+        }
+        default: {
+          if (!frames) {
+            ARROW_ASSIGN_OR_RAISE(frames, ComputeFrames(batch, peers));
+          }
+          ARROW_ASSIGN_OR_RAISE(column, ComputeFrameAggregate(function, batch, *frames));
+          break;
+        }
+      }
+      batch.values.push_back(std::move(column));
+    }
+
+    // The output is emitted by EmitWindows, which checks for backpressure between
+    // batches
+    for (int64_t offset = 0; offset < batch.length; offset += ExecPlan::kMaxBatchSize) {
+      ExecBatch out = batch.Slice(offset, ExecPlan::kMaxBatchSize);
+      out.index = num_output_batches_++;
+      pending_output_.push_back(std::move(out));
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> ComputeRank(WindowFunctionKind kind, const std::vector<Segment>& peers,
+                            int64_t length) {
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> values,
+        AllocateBuffer(length * sizeof(int64_t), plan_->query_context()->memory_pool()));
+    auto* ranks = values->mutable_data_as<int64_t>();
+    int64_t dense_rank = 0;
+    for (const Segment& peer : peers) {
+      ++dense_rank;
+      for (int64_t i = peer.offset; i < peer.offset + peer.length; ++i) {
+        switch (kind) {
+          case WindowFunctionKind::kRowNumber:
+            ranks[i] = i + 1;
+            break;
+          case WindowFunctionKind::kRank:
+            ranks[i] = peer.offset + 1;
+            break;
+          default:
+            ranks[i] = dense_rank;
+            break;
+        }
+      }
+    }
+    return ArrayData::Make(int64(), length, {nullptr, std::move(values)},
+                           /*null_count=*/0);
+  }
+
+  Result<Datum> ComputePartitionAggregate(const WindowFunction& function,
+                                          const ExecBatch& batch) {
+    ExecContext* ctx = plan_->query_context()->exec_context();
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<KernelState> state,
+                          aggregate::InitKernel(function.kernel, ctx, function.aggregate,
+                                                function.in_types));
+    KernelContext kernel_ctx{ctx};
+    kernel_ctx.SetState(state.get());
+    RETURN_NOT_OK(function.kernel->resize(&kernel_ctx, 1));
+
+    // The whole partition is a single group
+    ExecBatch agg_batch = SelectColumns(batch, function.target_field_ids);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> group_ids,
+                          MakeArrayFromScalar(UInt32Scalar(0), batch.length,
+                                              ctx->memory_pool()));
+    agg_batch.values.emplace_back(std::move(group_ids));
+    RETURN_NOT_OK(function.kernel->consume(&kernel_ctx, ExecSpan(agg_batch)));
+
+    Datum result;
+    RETURN_NOT_OK(function.kernel->finalize(&kernel_ctx, &result));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Scalar> value,
+                          result.make_array()->GetScalar(0));
+    return MakeArrayFromScalar(*value, batch.length, ctx->memory_pool());
+  }
+
+  Result<Frames> ComputeFrames(const ExecBatch& batch,
+                               const std::vector<Segment>& peers) {
+    const int64_t length = batch.length;
+    Frames frames;
+    frames.begin.resize(length);
+    frames.end.resize(length);
+
+    if (frame_.units == WindowFrameUnits::ROWS) {
+      for (int64_t i = 0; i < length; ++i) {
+        int64_t begin =
+            frame_.preceding ? SaturatingSubtract(i, *frame_.preceding) : int64_t{0};
+        int64_t end =
+            frame_.following ? SaturatingAdd(i + 1, *frame_.following) : length;
+        frames.begin[i] = std::clamp<int64_t>(begin, 0, length);
+        frames.end[i] = std::clamp<int64_t>(end, frames.begin[i], length);
+      }
+      return frames;
+    }
+
+    // RANGE frames: start with the bounds given by the partition and the peers
+    for (const Segment& peer : peers) {
+      for (int64_t i = peer.offset; i < peer.offset + peer.length; ++i) {
+        frames.begin[i] = frame_.preceding ? peer.offset : 0;
+        frames.end[i] = frame_.following ? peer.offset + peer.length : length;
+      }
+    }
+    if (IsValueBound(frame_.preceding) || IsValueBound(frame_.following)) {
+      RETURN_NOT_OK(ComputeRangeValueBounds(batch, &frames));
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      frames.end[i] = std::max(frames.end[i], frames.begin[i]);
+    }
+    return frames;
+  }
+
+  Status ComputeRangeValueBounds(const ExecBatch& batch, Frames* frames) {
+    ExecContext* ctx = plan_->query_context()->exec_context();
+    std::shared_ptr<Array> key = batch[order_key_field_ids_[0]].make_array();
+    const bool descending = order_keys_[0].order == SortOrder::Descending;
+
+    // Rows with a null key are peers, whose frame was set from the peer bounds.
+    // The other rows are framed among themselves.
+    int64_t begin = 0;
+    int64_t end = batch.length;
+    if (order_keys_[0].null_placement == NullPlacement::AtStart) {
+      begin = key->null_count();
+    } else {
+      end -= key->null_count();
+    }
+
+    if (is_floating(key->type_id())) {
+      ARROW_ASSIGN_OR_RAISE(Datum values, compute::Cast(key, float64(),
+                                                        compute::CastOptions::Safe(),
+                                                        ctx));
+      const double* doubles = values.array()->GetValues<double>(1);
+      // NaNs are sorted next to the nulls, and like them are only framed among their
+      // peers
+      if (order_keys_[0].null_placement == NullPlacement::AtStart) {
+        while (begin < end && std::isnan(doubles[begin])) ++begin;
+      } else {
+        while (end > begin && std::isnan(doubles[end - 1])) --end;
+      }
+      ComputeRangeBounds(doubles, begin, end, descending, frame_, frames->begin.data(),
+                         frames->end.data());
+      return Status::OK();
+    }
+    // uint64 keys may not fit in int64
+    if (key->type_id() == Type::UINT64) {
+      ComputeRangeBounds(key->data()->GetValues<uint64_t>(1), begin, end, descending,
+                         frame_, frames->begin.data(), frames->end.data());
+      return Status::OK();
+    }
+    // Temporal keys are compared by their physical value
+    if (!is_integer(key->type_id())) {
+      const int bit_width = checked_cast<const FixedWidthType&>(*key->type()).bit_width();
+      ARROW_ASSIGN_OR_RAISE(key, key->View(bit_width == 32 ? int32() : int64()));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        Datum values, compute::Cast(key, int64(), compute::CastOptions::Safe(), ctx));
+    ComputeRangeBounds(values.array()->GetValues<int64_t>(1), begin, end, descending,
+                       frame_, frames->begin.data(), frames->end.data());
+    return Status::OK();
+  }
+
+  Result<Datum> ComputeFrameAggregate(const WindowFunction& function,
+                                      const ExecBatch& batch, const Frames& frames) {
+    ExecContext* ctx = plan_->query_context()->exec_context();
+    MemoryPool* pool = ctx->memory_pool();
+    const Datum& target = batch[function.target_field_ids[0]];
+    if (function.kind == WindowFunctionKind::kCount) {
+      return ComputeFrameCount(function, ArraySpan(*target.array()), frames, pool);
+    }
+
+    // Compute in the widest type of the same kind, and cast the result to the type
+    // the hash aggregate kernel would output
+    const DataType& type = *target.type();
+    std::shared_ptr<DataType> wide_type = is_floating(type.id())       ? float64()
+                                          : is_signed_integer(type.id()) ? int64()
+                                                                         : uint64();
+    ARROW_ASSIGN_OR_RAISE(Datum values, compute::Cast(target, wide_type,
+                                                      compute::CastOptions::Safe(), ctx));
+    ArraySpan span(*values.array());
+    std::shared_ptr<ArrayData> result;
+    switch (wide_type->id()) {
+      case Type::INT64: {
+        ARROW_ASSIGN_OR_RAISE(
+            result, ComputeNumericFrameAggregate<int64_t>(function, span, frames, pool));
+        break;
+      }
+      case Type::UINT64: {
+        ARROW_ASSIGN_OR_RAISE(
+            result, ComputeNumericFrameAggregate<uint64_t>(function, span, frames, pool));
+        break;
+      }
+      default: {
+        ARROW_ASSIGN_OR_RAISE(
+            result, ComputeNumericFrameAggregate<double>(function, span, frames, pool));
+        break;
+      }
+    }
+    if (result->type->Equals(*function.out_type)) {
+      return result;
+    }
+    return compute::Cast(result, function.out_type, compute::CastOptions::Safe(), ctx);
+  }
+
+  AtomicCounter counter_;
+  Ordering ordering_;
+  std::vector<int> partition_key_field_ids_;
+  std::vector<SortKey> order_keys_;
+  std::vector<int> order_key_field_ids_;
+  WindowFrame frame_;
+  std::vector<WindowFunction> functions_;
+
+  // Null if there are neither partition keys nor ordering keys
+  std::unique_ptr<OrderByImpl> sort_;
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<RecordBatch>> unsorted_batches_;
+
+  std::unique_ptr<RowSegmenter> partition_segmenter_;
+  std::unique_ptr<RowSegmenter> peer_segmenter_;
+  // The rows of the current partition, which may span several sorted batches
+  std::vector<std::shared_ptr<RecordBatch>> partition_batches_;
+  // The output batches of the processed partitions which are yet to be emitted
+  std::deque<ExecBatch> pending_output_;
+  int num_output_batches_ = 0;
+
+  // State of the emission of the windows
+  std::mutex emit_mutex_;
+  std::shared_ptr<RecordBatchReader> sorted_;
+  Future<> emit_done_;
+  int32_t backpressure_counter_ = 0;
+  bool paused_ = false;
+  bool emitting_ = false;
+  bool finished_ = false;
+  bool stopped_ = false;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterWindowNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(
+      registry->AddFactory(std::string(WindowNodeOptions::kName), WindowNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
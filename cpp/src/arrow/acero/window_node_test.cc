@@ -0,0 +1,374 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/acero/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/table.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using compute::Aggregate;
+using compute::NullPlacement;
+using compute::Ordering;
+using compute::SortKey;
+using compute::SortOrder;
+
+namespace acero {
+
+// Rows which tie on the partition and ordering keys are identical, so the output is
+// deterministic regardless of the order in which batches arrive
+std::shared_ptr<Table> RankTable() {
+  return TableFromJSON(schema({field("g", int32()), field("t", int64()),
+                               field("v", int64())}),
+                       {R"([[1, 5, 40], [2, 1, 5], [1, 2, 20]])",
+                        R"([[2, 4, 1], [1, 1, 10], [1, 2, 20]])",
+                        R"([[2, 2, 7], [1, 3, null]])"});
+}
+
+std::shared_ptr<Table> SlidingTable() {
+  return TableFromJSON(schema({field("g", int32()), field("t", int64()),
+                               field("v", int64())}),
+                       {R"([[1, 3, 3], [2, 2, 20], [1, 1, 1]])",
+                        R"([[1, 5, 5], [1, 2, null], [2, 1, 10], [1, 4, 4]])"});
+}
+
+void CheckWindow(const std::shared_ptr<Table>& input, WindowNodeOptions options,
+                 const std::shared_ptr<Table>& expected) {
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(input, /*max_batch_size=*/2)},
+       {"window", std::move(options)}});
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads=", use_threads);
+    QueryOptions query_options;
+    query_options.sequence_output = true;
+    query_options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         DeclarationToTable(plan, query_options));
+    AssertSchemaEqual(*expected->schema(), *actual->schema());
+    // Compare single chunks so that NaNs are viewed as equal
+    ASSERT_OK_AND_ASSIGN(auto expected_combined, expected->CombineChunks());
+    ASSERT_OK_AND_ASSIGN(auto actual_combined, actual->CombineChunks());
+    AssertTablesEqual(*expected_combined, *actual_combined);
+  }
+}
+
+WindowNodeOptions PartitionedByG(std::vector<Aggregate> functions,
+                                 WindowFrame frame = {}) {
+  return WindowNodeOptions(std::move(functions), {"g"}, Ordering({SortKey("t")}),
+                           std::move(frame));
+}
+
+TEST(WindowNode, Ranking) {
+  auto options = PartitionedByG({{"row_number", "rn"},
+                                 {"rank", "rank"},
+                                 {"dense_rank", "dense_rank"}});
+  auto expected = TableFromJSON(
+      schema({field("g", int32()), field("t", int64()), field("v", int64()),
+              field("rn", int64()), field("rank", int64()),
+              field("dense_rank", int64())}),
+      {R"([[1, 1, 10, 1, 1, 1],
+           [1, 2, 20, 2, 2, 2],
+           [1, 2, 20, 3, 2, 2],
+           [1, 3, null, 4, 4, 3],
+           [1, 5, 40, 5, 5, 4],
+           [2, 1, 5, 1, 1, 1],
+           [2, 2, 7, 2, 2, 2],
+           [2, 4, 1, 3, 3, 3]])"});
+  CheckWindow(RankTable(), std::move(options), expected);
+}
+
+TEST(WindowNode, RunningAggregates) {
+  // The default frame runs from the start of the partition to the current row
+  auto options =
+      PartitionedByG({{"hash_sum", "v", "sum"}, {"hash_count", "v", "count"}});
+  auto expected = TableFromJSON(
+      schema({field("g", int32()), field("t", int64()), field("v", int64()),
+              field("sum", int64()), field("count", int64())}),
+      {R"([[1, 1, 10, 10, 1],
+           [1, 2, 20, 30, 2],
+           [1, 2, 20, 50, 3],
+           [1, 3, null, 50, 3],
+           [1, 5, 40, 90, 4],
+           [2, 1, 5, 5, 1],
+           [2, 2, 7, 12, 2],
+           [2, 4, 1, 13, 3]])"});
+  CheckWindow(RankTable(), std::move(options), expected);
+}
+
+TEST(WindowNode, SlidingRowsFrame) {
+  auto options = PartitionedByG(
+      {{"hash_min", "v", "min"}, {"hash_max", "v", "max"}, {"hash_mean", "v", "mean"}},
+      WindowFrame{WindowFrameUnits::ROWS, 1, 1});
+  auto expected = TableFromJSON(
+      schema({field("g", int32()), field("t", int64()), field("v", int64()),
+              field("min", int64()), field("max", int64()), field("mean", float64())}),
+      {R"([[1, 1, 1, 1, 1, 1.0],
+           [1, 2, null, 1, 3, 2.0],
+           [1, 3, 3, 3, 4, 3.5],
+           [1, 4, 4, 3, 5, 4.0],
+           [1, 5, 5, 4, 5, 4.5],
+           [2, 1, 10, 10, 20, 15.0],
+           [2, 2, 20, 10, 20, 15.0]])"});
+  CheckWindow(SlidingTable(), std::move(options), expected);
+}
+
+TEST(WindowNode, RangeFrame) {
+  auto input =
+      TableFromJSON(schema({field("t", int64()), field("v", int64())}),
+                    {R"([[5, 5], [1, 1], [9, 9]])", R"([[2, 2], [5, 5], [4, 4]])"});
+  auto expected_schema = schema({field("t", int64()), field("v", int64()),
+                                 field("sum", int64()), field("count", int64())});
+
+  // Rows whose key is at most 1 less than the current row's, up to its last peer
+  WindowNodeOptions preceding_options(
+      {{"hash_sum", "v", "sum"}, {"hash_count", "v", "count"}}, {},
+      Ordering({SortKey("t")}), WindowFrame{WindowFrameUnits::RANGE, 1, 0});
+  CheckWindow(input, preceding_options,
+              TableFromJSON(expected_schema, {R"([[1, 1, 1, 1],
+                                                  [2, 2, 3, 2],
+                                                  [4, 4, 4, 1],
+                                                  [5, 5, 14, 3],
+                                                  [5, 5, 14, 3],
+                                                  [9, 9, 9, 1]])"}));
+
+  // Rows whose key is at most 2 more than the current row's
+  WindowNodeOptions following_options(
+      {{"hash_sum", "v", "sum"}, {"hash_count", "v", "count"}}, {},
+      Ordering({SortKey("t")}), WindowFrame{WindowFrameUnits::RANGE, std::nullopt, 2});
+  CheckWindow(input, following_options,
+              TableFromJSON(expected_schema, {R"([[1, 1, 3, 2],
+                                                  [2, 2, 7, 3],
+                                                  [4, 4, 17, 5],
+                                                  [5, 5, 17, 5],
+                                                  [5, 5, 17, 5],
+                                                  [9, 9, 26, 6]])"}));
+
+  // Descending keys look the other way
+  WindowNodeOptions descending_options(
+      {{"hash_sum", "v", "sum"}}, {}, Ordering({SortKey("t", SortOrder::Descending)}),
+      WindowFrame{WindowFrameUnits::RANGE, 1, 0});
+  CheckWindow(input, descending_options,
+              TableFromJSON(schema({field("t", int64()), field("v", int64()),
+                                    field("sum", int64())}),
+                            {R"([[9, 9, 9],
+                                 [5, 5, 10],
+                                 [5, 5, 10],
+                                 [4, 4, 14],
+                                 [2, 2, 2],
+                                 [1, 1, 3]])"}));
+}
+
+TEST(WindowNode, NaNMinMax) {
+  // A frame whose valid values are all NaN has the minimum and maximum NaN
+  auto input = TableFromJSON(schema({field("t", int64()), field("v", float64())}),
+                             {R"([[1, NaN], [2, NaN], [3, 1.5]])",
+                              R"([[4, NaN], [5, null]])"});
+  WindowNodeOptions options({{"hash_min", "v", "min"}, {"hash_max", "v", "max"}}, {},
+                            Ordering({SortKey("t")}),
+                            WindowFrame{WindowFrameUnits::ROWS, 1, 0});
+  CheckWindow(input, std::move(options),
+              TableFromJSON(schema({field("t", int64()), field("v", float64()),
+                                    field("min", float64()), field("max", float64())}),
+                            {R"([[1, NaN, NaN, NaN],
+                                 [2, NaN, NaN, NaN],
+                                 [3, 1.5, 1.5, 1.5],
+                                 [4, NaN, 1.5, 1.5],
+                                 [5, null, NaN, NaN]])"}));
+}
+
+TEST(WindowNode, RangeFrameUInt64) {
+  // Keys above the largest int64 are framed without overflowing
+  auto input = TableFromJSON(schema({field("t", uint64()), field("v", int64())}),
+                             {R"([[18446744073709551615, 1],
+                                  [18446744073709551614, 2],
+                                  [1, 3]])"});
+  auto expected_schema =
+      schema({field("t", uint64()), field("v", int64()), field("sum", int64())});
+
+  WindowNodeOptions preceding_options({{"hash_sum", "v", "sum"}}, {},
+                                      Ordering({SortKey("t")}),
+                                      WindowFrame{WindowFrameUnits::RANGE, 1, 0});
+  CheckWindow(input, preceding_options,
+              TableFromJSON(expected_schema, {R"([[1, 3, 3],
+                                                  [18446744073709551614, 2, 2],
+                                                  [18446744073709551615, 1, 3]])"}));
+
+  WindowNodeOptions following_options({{"hash_sum", "v", "sum"}}, {},
+                                      Ordering({SortKey("t")}),
+                                      WindowFrame{WindowFrameUnits::RANGE, 0, 1});
+  CheckWindow(input, following_options,
+              TableFromJSON(expected_schema, {R"([[1, 3, 3],
+                                                  [18446744073709551614, 2, 3],
+                                                  [18446744073709551615, 1, 1]])"}));
+}
+
+TEST(WindowNode, RangeFrameNaNKeys) {
+  // Rows with a NaN key are sorted next to the nulls and framed among their peers
+  auto input = TableFromJSON(schema({field("t", float64()), field("v", int64())}),
+                             {R"([[1.0, 1], [NaN, 10], [null, 100]])",
+                              R"([[2.0, 2], [NaN, 10]])"});
+  auto expected_schema =
+      schema({field("t", float64()), field("v", int64()), field("sum", int64())});
+
+  WindowNodeOptions at_end_options(
+      {{"hash_sum", "v", "sum"}}, {},
+      Ordering({SortKey("t", SortOrder::Ascending, NullPlacement::AtEnd)}),
+      WindowFrame{WindowFrameUnits::RANGE, 1, 0});
+  CheckWindow(input, at_end_options,
+              TableFromJSON(expected_schema, {R"([[1.0, 1, 1],
+                                                  [2.0, 2, 3],
+                                                  [NaN, 10, 20],
+                                                  [NaN, 10, 20],
+                                                  [null, 100, 100]])"}));
+
+  WindowNodeOptions at_start_options(
+      {{"hash_sum", "v", "sum"}}, {},
+      Ordering({SortKey("t", SortOrder::Ascending, NullPlacement::AtStart)}),
+      WindowFrame{WindowFrameUnits::RANGE, 1, 0});
+  CheckWindow(input, at_start_options,
+              TableFromJSON(expected_schema, {R"([[null, 100, 100],
+                                                  [NaN, 10, 20],
+                                                  [NaN, 10, 20],
+                                                  [1.0, 1, 1],
+                                                  [2.0, 2, 3]])"}));
+}
+
+TEST(WindowNode, WholePartition) {
+  auto options = PartitionedByG({{"hash_max", "v", "max"},
+                                 {"hash_count", "v", "count"},
+                                 {"hash_count_distinct", "v", "distinct"}},
+                                WindowFrame::Unbounded());
+  auto expected = TableFromJSON(
+      schema({field("g", int32()), field("t", int64()), field("v", int64()),
+              field("max", int64()), field("count", int64()),
+              field("distinct", int64())}),
+      {R"([[1, 1, 1, 5, 4, 4],
+           [1, 2, null, 5, 4, 4],
+           [1, 3, 3, 5, 4, 4],
+           [1, 4, 4, 5, 4, 4],
+           [1, 5, 5, 5, 4, 4],
+           [2, 1, 10, 20, 2, 2],
+           [2, 2, 20, 20, 2, 2]])"});
+  CheckWindow(SlidingTable(), std::move(options), expected);
+}
+
+TEST(WindowNode, FloatKeys) {
+  // The sort views -0.0 as 0.0, and so do the partitions and peers
+  auto input = TableFromJSON(
+      schema({field("g", float64()), field("t", int64()), field("v", int64())}),
+      {R"([[0.0, 1, 1], [-0.0, 2, 2]])", R"([[1.5, 1, 4], [0.0, 3, 8]])"});
+  WindowNodeOptions partition_options(
+      {{"row_number", "rn"}, {"hash_sum", "v", "sum"}}, {"g"}, Ordering({SortKey("t")}),
+      WindowFrame::Unbounded());
+  CheckWindow(input, std::move(partition_options),
+              TableFromJSON(schema({field("g", float64()), field("t", int64()),
+                                    field("v", int64()), field("rn", int64()),
+                                    field("sum", int64())}),
+                            {R"([[0.0, 1, 1, 1, 11],
+                                 [-0.0, 2, 2, 2, 11],
+                                 [0.0, 3, 8, 3, 11],
+                                 [1.5, 1, 4, 1, 4]])"}));
+
+  auto keys = TableFromJSON(schema({field("k", float64())}),
+                            {R"([[0.0], [-0.0]])", R"([[1.0], [-0.0]])"});
+  WindowNodeOptions peer_options({{"rank", "rank"}}, {}, Ordering({SortKey("k")}));
+  CheckWindow(keys, std::move(peer_options),
+              TableFromJSON(schema({field("k", float64()), field("rank", int64())}),
+                            {R"([[0.0, 1], [0.0, 1], [0.0, 1], [1.0, 4]])"}));
+}
+
+TEST(WindowNode, SpillingBackpressure) {
+  constexpr int64_t kNumRows = 2000;
+  random::RandomArrayGenerator rng(42);
+  auto input = Table::Make(schema({field("g", int32()), field("v", int64())}),
+                           {rng.Int32(kNumRows, 0, 20), rng.Int64(kNumRows, 0, 1000)});
+  WindowNodeOptions options({{"hash_sum", "v", "sum"}}, {"g"}, Ordering::Unordered(),
+                            WindowFrame::Unbounded());
+  ASSERT_OK_AND_ASSIGN(
+      std::shared_ptr<Table> expected,
+      DeclarationToTable(Declaration::Sequence(
+          {{"table_source", TableSourceNodeOptions(input, /*max_batch_size=*/64)},
+           {"window", options}})));
+  ASSERT_OK_AND_ASSIGN(auto spill_dir, SpillDir::Make());
+
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads=", use_threads);
+    PlanProfile profile;
+    QueryOptions query_options;
+    query_options.use_threads = use_threads;
+    query_options.spill_threshold_bytes = 1024;
+    query_options.profile = &profile;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<ExecPlan> plan, ExecPlan::Make(query_options));
+    // The sink pauses the window node after every output batch
+    AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+    ASSERT_OK(Declaration::Sequence(
+                  {{"table_source", TableSourceNodeOptions(input, /*max_batch_size=*/64)},
+                   {"window", options},
+                   {"sink", SinkNodeOptions(&sink_gen, BackpressureOptions(1, 2))}})
+                  .AddToPlan(plan.get()));
+    ASSERT_FINISHES_OK_AND_ASSIGN(std::vector<ExecBatch> batches,
+                                  StartAndCollect(plan.get(), sink_gen));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         TableFromExecBatches(expected->schema(), batches));
+    // Rows of a partition may come out in any order, but the partitions are sorted and
+    // all their rows have the same sum
+    for (const std::string& name : {"g", "sum"}) {
+      AssertChunkedEquivalent(*expected->GetColumnByName(name),
+                              *actual->GetColumnByName(name));
+    }
+
+    const NodeProfile* node_profile = FindNodeProfile(profile, "WindowNode");
+    ASSERT_NE(node_profile, nullptr);
+    ASSERT_GT(node_profile->spilled_bytes, 0);
+    ASSERT_OK_AND_EQ(std::vector<std::string>{}, spill_dir->ListEntries());
+  }
+}
+
+TEST(WindowNode, Invalid) {
+  auto check = [](WindowNodeOptions options) {
+    return DeclarationToStatus(Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(SlidingTable())},
+         {"window", std::move(options)}}));
+  };
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("does not take any arguments"),
+      check(PartitionedByG({{"row_number", "v", "rn"}})));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, testing::HasSubstr("only supported over unbounded frames"),
+      check(PartitionedByG({{"hash_product", "v", "product"}})));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("single ordering key"),
+      check(WindowNodeOptions({{"hash_sum", "v", "sum"}}, {"g"},
+                              Ordering({SortKey("t"), SortKey("v")}),
+                              WindowFrame{WindowFrameUnits::RANGE, 1, 1})));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("explicit ordering"),
+      check(WindowNodeOptions({{"row_number", "rn"}}, {}, Ordering::Implicit())));
+}
+
+}  // namespace acero
+}  // namespace arrow
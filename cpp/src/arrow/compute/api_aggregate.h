@@ -194,6 +194,21 @@ class ARROW_EXPORT TDigestOptions : public FunctionOptions {
   uint32_t min_count;
 };
 
+/// \brief Control approximate distinct count kernel behavior
+///
+/// The distinct values are counted with a HyperLogLog sketch of 2^precision
+/// one-byte registers, whose relative standard error is about
+/// 1.04 / sqrt(2^precision). Null values are ignored.
+class ARROW_EXPORT ApproxCountDistinctOptions : public FunctionOptions {
+ public:
+  explicit ApproxCountDistinctOptions(int32_t precision = 12);
+  static constexpr const char kTypeName[] = "ApproxCountDistinctOptions";
+  static ApproxCountDistinctOptions Defaults() { return ApproxCountDistinctOptions{}; }
+
+  /// log2 of the number of registers, between 4 and 18
+  int32_t precision;
+};
+
 /// \brief Control Pivot kernel behavior
 ///
 /// These options apply to the "pivot_wider" and "hash_pivot_wider" functions.
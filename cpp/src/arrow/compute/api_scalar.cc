@@ -342,6 +342,10 @@ static auto kMapLookupOptionsType = GetFunctionOptionsType<MapLookupOptions>(
 static auto kMatchSubstringOptionsType = GetFunctionOptionsType<MatchSubstringOptions>(
     DataMember("pattern", &MatchSubstringOptions::pattern),
     DataMember("ignore_case", &MatchSubstringOptions::ignore_case));
+static auto kMatchAnySubstringOptionsType =
+    GetFunctionOptionsType<MatchAnySubstringOptions>(
+        DataMember("patterns", &MatchAnySubstringOptions::patterns),
+        DataMember("ignore_case", &MatchAnySubstringOptions::ignore_case));
 static auto kNullOptionsType = GetFunctionOptionsType<NullOptions>(
     DataMember("nan_is_null", &NullOptions::nan_is_null));
 static auto kPadOptionsType = GetFunctionOptionsType<PadOptions>(
@@ -490,6 +494,15 @@ MatchSubstringOptions::MatchSubstringOptions(std::string pattern, bool ignore_ca
 MatchSubstringOptions::MatchSubstringOptions() : MatchSubstringOptions("", false) {}
 constexpr char MatchSubstringOptions::kTypeName[];
 
+MatchAnySubstringOptions::MatchAnySubstringOptions(std::vector<std::string> patterns,
+                                                   bool ignore_case)
+    : FunctionOptions(internal::kMatchAnySubstringOptionsType),
+      patterns(std::move(patterns)),
+      ignore_case(ignore_case) {}
+MatchAnySubstringOptions::MatchAnySubstringOptions()
+    : MatchAnySubstringOptions({}, false) {}
+constexpr char MatchAnySubstringOptions::kTypeName[];
+
 NullOptions::NullOptions(bool nan_is_null)
     : FunctionOptions(internal::kNullOptionsType), nan_is_null(nan_is_null) {}
 constexpr char NullOptions::kTypeName[];
@@ -710,6 +723,7 @@ void RegisterScalarOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kMakeStructOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMapLookupOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMatchSubstringOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kMatchAnySubstringOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kNullOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kPadOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kZeroFillOptionsType));
@@ -200,6 +200,24 @@ class ARROW_EXPORT MatchSubstringOptions : public FunctionOptions {
   bool ignore_case;
 };
 
+/// \brief Options for matching strings against several patterns at once
+///
+/// The patterns are compiled into a single automaton, so that each string is
+/// scanned once whatever the number of patterns.
+class ARROW_EXPORT MatchAnySubstringOptions : public FunctionOptions {
+ public:
+  explicit MatchAnySubstringOptions(std::vector<std::string> patterns,
+                                    bool ignore_case = false);
+  MatchAnySubstringOptions();
+  static constexpr const char kTypeName[] = "MatchAnySubstringOptions";
+
+  /// The exact substrings (or regexes, depending on kernel) to look for inside
+  /// input values.
+  std::vector<std::string> patterns;
+  /// Whether to perform a case-insensitive match.
+  bool ignore_case;
+};
+
 class ARROW_EXPORT SplitOptions : public FunctionOptions {
  public:
   explicit SplitOptions(int64_t max_splits = -1, bool reverse = false);
@@ -204,6 +204,10 @@ Result<const Kernel*> CastFunction::DispatchExact(
   return candidate_kernels[0];
 }
 
+Result<const Kernel*> CastFunction::DispatchBest(std::vector<TypeHolder>* types) const {
+  return DispatchExact(*types);
+}
+
 Result<std::shared_ptr<CastFunction>> GetCastFunction(const DataType& to_type) {
   internal::EnsureInitCastTable();
   auto it = internal::g_cast_table.find(static_cast<int>(to_type.id()));
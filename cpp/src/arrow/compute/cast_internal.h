@@ -51,6 +51,10 @@ class CastFunction : public ScalarFunction {
   Result<const Kernel*> DispatchExact(
       const std::vector<TypeHolder>& types) const override;
 
+  // Casts are not dispatched on the values of encoded arguments, since their output
+  // type is given by the options
+  Result<const Kernel*> DispatchBest(std::vector<TypeHolder>* types) const override;
+
  private:
   std::vector<Type::type> in_type_ids_;
   const Type::type out_type_id_;
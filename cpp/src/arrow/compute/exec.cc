@@ -20,17 +20,22 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/array_dict.h"
 #include "arrow/array/array_primitive.h"
+#include "arrow/array/array_run_end.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/data.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/function_internal.h"
@@ -43,11 +48,13 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
@@ -132,6 +139,14 @@ std::string ExecBatch::ToString() const {
 
 ExecBatch ExecBatch::Slice(int64_t offset, int64_t length) const {
   ExecBatch out = *this;
+  if (selection_vector) {
+    // The selected rows are sliced, the values they refer to are kept as they are
+    length = std::min(length, this->length - offset);
+    out.selection_vector = std::make_shared<SelectionVector>(
+        selection_vector->data()->Slice(offset, length));
+    out.length = length;
+    return out;
+  }
   for (auto& value : out.values) {
     if (value.is_scalar()) {
       // keep value as is
@@ -156,7 +171,28 @@ Result<ExecBatch> ExecBatch::SelectValues(const std::vector<int>& ids) const {
     }
     selected_values.push_back(values[id]);
   }
-  return ExecBatch(std::move(selected_values), length);
+  ExecBatch out(std::move(selected_values), length);
+  out.selection_vector = selection_vector;
+  return out;
+}
+
+Result<ExecBatch> ExecBatch::ApplySelection(ExecContext* ctx) const {
+  if (!selection_vector) {
+    return *this;
+  }
+  if (ctx == nullptr) {
+    ctx = default_exec_context();
+  }
+  ExecBatch out = *this;
+  out.selection_vector = nullptr;
+  out.length = selection_vector->length();
+  const auto take_options = TakeOptions::NoBoundsCheck();
+  for (auto& value : out.values) {
+    if (!value.is_arraylike()) continue;
+    ARROW_ASSIGN_OR_RAISE(value, CallFunction("take", {value, selection_vector->data()},
+                                              &take_options, ctx));
+  }
+  return out;
 }
 
 namespace {
@@ -708,6 +744,113 @@ bool HaveChunkedArray(const std::vector<Datum>& values) {
   return false;
 }
 
+const std::shared_ptr<DataType>& DictionaryValueType(const TypeHolder& type) {
+  return checked_cast<const DictionaryType&>(*type).value_type();
+}
+
+// Whether the only argument is dictionary-encoded while the kernel takes its values
+bool IsDictionaryOfKernelValues(const Kernel& kernel,
+                                const std::vector<TypeHolder>& types) {
+  if (types.size() != 1 || types[0].id() != Type::DICTIONARY) {
+    return false;
+  }
+  return !kernel.signature->MatchesInputs(types) &&
+         kernel.signature->MatchesInputs({DictionaryValueType(types[0])});
+}
+
+std::vector<TypeHolder> RunEndDecodedTypes(const std::vector<TypeHolder>& types) {
+  std::vector<TypeHolder> value_types = types;
+  for (auto& type : value_types) {
+    if (type.id() == Type::RUN_END_ENCODED) {
+      type = checked_cast<const RunEndEncodedType&>(*type).value_type();
+    }
+  }
+  return value_types;
+}
+
+// Whether some arguments are run-end encoded while the kernel takes their values
+bool IsRunEndEncodedOfKernelValues(const Kernel& kernel,
+                                   const std::vector<TypeHolder>& types) {
+  if (std::none_of(types.begin(), types.end(), [](const TypeHolder& type) {
+        return type.id() == Type::RUN_END_ENCODED;
+      })) {
+    return false;
+  }
+  return !kernel.signature->MatchesInputs(types) &&
+         kernel.signature->MatchesInputs(RunEndDecodedTypes(types));
+}
+
+// The runs of an array argument within an ExecSpan: their logical ends and the
+// physical index of the first one. A plain array has runs of length 1.
+struct ArgumentRuns {
+  bool run_end_encoded = false;
+  std::vector<int64_t> run_ends;
+  int64_t physical_offset = 0;
+};
+
+template <typename RunEndCType>
+void CollectRuns(const ArraySpan& span, ArgumentRuns* out) {
+  const ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(span);
+  auto it = ree_span.begin();
+  out->run_end_encoded = true;
+  out->physical_offset = it.index_into_array();
+  for (; !it.is_end(ree_span); ++it) {
+    out->run_ends.push_back(it.run_end());
+  }
+}
+
+void CollectRuns(const ArraySpan& span, ArgumentRuns* out) {
+  switch (ree_util::RunEndsArray(span).type->id()) {
+    case Type::INT16:
+      return CollectRuns<int16_t>(span, out);
+    case Type::INT32:
+      return CollectRuns<int32_t>(span, out);
+    default:
+      DCHECK_EQ(ree_util::RunEndsArray(span).type->id(), Type::INT64);
+      return CollectRuns<int64_t>(span, out);
+  }
+}
+
+template <typename RunEndCType>
+Result<std::shared_ptr<ArrayData>> MakeRunEnds(std::shared_ptr<DataType> type,
+                                               const std::vector<int64_t>& run_ends,
+                                               MemoryPool* pool) {
+  const auto length = static_cast<int64_t>(run_ends.size());
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                        AllocateBuffer(length * sizeof(RunEndCType), pool));
+  std::transform(run_ends.begin(), run_ends.end(),
+                 buffer->mutable_data_as<RunEndCType>(),
+                 [](int64_t run_end) { return static_cast<RunEndCType>(run_end); });
+  return ArrayData::Make(std::move(type), length, {NULLPTR, std::move(buffer)},
+                         /*null_count=*/0);
+}
+
+Result<std::shared_ptr<ArrayData>> MakeRunEnds(const std::shared_ptr<DataType>& type,
+                                               const std::vector<int64_t>& run_ends,
+                                               MemoryPool* pool) {
+  switch (type->id()) {
+    case Type::INT16:
+      return MakeRunEnds<int16_t>(type, run_ends, pool);
+    case Type::INT32:
+      return MakeRunEnds<int32_t>(type, run_ends, pool);
+    default:
+      DCHECK_EQ(type->id(), Type::INT64);
+      return MakeRunEnds<int64_t>(type, run_ends, pool);
+  }
+}
+
+Result<std::shared_ptr<Array>> ConcatenateResults(const std::vector<Datum>& results,
+                                                  MemoryPool* pool) {
+  ArrayVector arrays;
+  for (const auto& result : results) {
+    arrays.push_back(result.make_array());
+  }
+  if (arrays.size() == 1) {
+    return arrays[0];
+  }
+  return Concatenate(arrays, pool);
+}
+
 template <typename KernelType>
 class KernelExecutorImpl : public KernelExecutor {
  public:
@@ -780,7 +923,36 @@ class KernelExecutorImpl : public KernelExecutor {
 
 class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
  public:
+  Status Init(KernelContext* kernel_ctx, KernelInitArgs args) override {
+    if (IsDictionaryOfKernelValues(*args.kernel, args.inputs)) {
+      // See ExecuteDictionary: the output is that of the dictionary values
+      const std::vector<TypeHolder> value_types{DictionaryValueType(args.inputs[0])};
+      return KernelExecutorImpl<ScalarKernel>::Init(
+          kernel_ctx, {args.kernel, value_types, args.options});
+    }
+    if (IsRunEndEncodedOfKernelValues(*args.kernel, args.inputs)) {
+      // See ExecuteRunEndEncoded: the kernel is executed by values_executor_ and the
+      // output is run-end encoded
+      const std::vector<TypeHolder> value_types = RunEndDecodedTypes(args.inputs);
+      values_executor_ = std::make_unique<ScalarExecutor>();
+      RETURN_NOT_OK(
+          values_executor_->Init(kernel_ctx, {args.kernel, value_types, args.options}));
+      RETURN_NOT_OK(KernelExecutorImpl<ScalarKernel>::Init(
+          kernel_ctx, {args.kernel, value_types, args.options}));
+      output_type_ = RunEndEncodedOutputType(args.inputs, values_executor_->output_type_);
+      return Status::OK();
+    }
+    return KernelExecutorImpl<ScalarKernel>::Init(kernel_ctx, std::move(args));
+  }
+
   Status Execute(const ExecBatch& batch, ExecListener* listener) override {
+    if (batch.length > 0 && batch.num_values() == 1 &&
+        IsDictionaryOfKernelValues(*kernel_, {batch[0].type()})) {
+      return ExecuteDictionary(batch[0], listener);
+    }
+    if (batch.length > 0 && values_executor_) {
+      return ExecuteRunEndEncoded(batch, listener);
+    }
     RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize()));
 
     if (batch.length == 0) {
@@ -835,6 +1007,169 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     }
   }
 
+  // Evaluate the kernel on a dictionary-encoded argument whose type it does not
+  // accept, see CanExecuteOnDictionaryValues. The kernel is evaluated once per
+  // dictionary value rather than once per row, and its results are gathered
+  // through the indices (e.g. a predicate yields one boolean per dictionary value).
+  Status ExecuteDictionary(const Datum& arg, ExecListener* listener) {
+    ExecContext* ctx = exec_context();
+    if (arg.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Scalar> value,
+          checked_cast<const DictionaryScalar&>(*arg.scalar()).GetEncodedValue());
+      return Execute(ExecBatch({Datum(std::move(value))}, /*length=*/1), listener);
+    }
+    const ArrayVector chunks =
+        arg.is_array() ? ArrayVector{arg.make_array()} : arg.chunked_array()->chunks();
+    for (const auto& chunk : chunks) {
+      const auto& dict_array = checked_cast<const DictionaryArray&>(*chunk);
+      const auto& dictionary = dict_array.dictionary();
+      if (kernel_->null_handling == NullHandling::INTERSECTION &&
+          dictionary->length() <= dict_array.length()) {
+        DatumAccumulator values_listener;
+        // The kernel may fail on a dictionary value which no index references, in
+        // which case only the referenced values are evaluated below
+        if (Execute(ExecBatch({Datum(dictionary)}, dictionary->length()),
+                    &values_listener)
+                .ok()) {
+          ARROW_ASSIGN_OR_RAISE(
+              std::shared_ptr<Array> values,
+              ConcatenateResults(values_listener.values(), ctx->memory_pool()));
+          ARROW_ASSIGN_OR_RAISE(
+              Datum out, Take(values, dict_array.indices(), TakeOptions::Defaults(), ctx));
+          RETURN_NOT_OK(listener->OnResult(std::move(out)));
+          continue;
+        }
+      }
+      // Null indices may not map to null outputs, evaluating the whole dictionary
+      // costs more than decoding it, or the dictionary holds invalid values
+      ARROW_ASSIGN_OR_RAISE(
+          Datum decoded,
+          Take(dictionary, dict_array.indices(), TakeOptions::Defaults(), ctx));
+      RETURN_NOT_OK(
+          Execute(ExecBatch({std::move(decoded)}, dict_array.length()), listener));
+    }
+    return Status::OK();
+  }
+
+  // Evaluate the kernel on run-end encoded arguments whose types it does not
+  // accept, see CanExecuteOnRunEndValues. The runs of all arguments are merged and
+  // the kernel is evaluated once per merged run, its results being the values of
+  // the run-end encoded output.
+  Status ExecuteRunEndEncoded(const ExecBatch& batch, ExecListener* listener) {
+    if (std::all_of(batch.values.begin(), batch.values.end(),
+                    [](const Datum& value) { return value.is_scalar(); })) {
+      std::vector<Datum> values;
+      for (const auto& value : batch.values) {
+        if (value.type()->id() == Type::RUN_END_ENCODED) {
+          values.emplace_back(value.scalar_as<RunEndEncodedScalar>().value);
+        } else {
+          values.push_back(value);
+        }
+      }
+      DatumAccumulator values_listener;
+      RETURN_NOT_OK(values_executor_->Execute(ExecBatch(std::move(values), batch.length),
+                                              &values_listener));
+      return listener->OnResult(std::make_shared<RunEndEncodedScalar>(
+          values_listener.values()[0].scalar(), output_type_.GetSharedPtr()));
+    }
+    ExecSpanIterator span_iterator;
+    RETURN_NOT_OK(span_iterator.Init(batch, exec_context()->exec_chunksize(),
+                                     /*promote_if_all_scalars=*/false));
+    ExecSpan span;
+    while (span_iterator.Next(&span)) {
+      RETURN_NOT_OK(ExecuteRunEndEncodedSpan(span, listener));
+    }
+    return Status::OK();
+  }
+
+  Status ExecuteRunEndEncodedSpan(const ExecSpan& span, ExecListener* listener) {
+    ExecContext* ctx = exec_context();
+    const int num_args = span.num_values();
+    std::vector<ArgumentRuns> arg_runs(num_args);
+    // A plain array argument has runs of length 1, so the merged runs are then its
+    // values, which are passed as is
+    bool has_plain_array = false;
+    for (int i = 0; i < num_args; ++i) {
+      if (!span[i].is_array()) continue;
+      if (span[i].type()->id() == Type::RUN_END_ENCODED) {
+        CollectRuns(span[i].array, &arg_runs[i]);
+      } else {
+        has_plain_array = true;
+      }
+    }
+
+    // Merge the runs of all run-end encoded array arguments, recording the physical
+    // index of each merged run in every one of them
+    std::vector<int64_t> run_ends;
+    std::vector<std::vector<int64_t>> physical_indices(num_args);
+    std::vector<int64_t> current_runs(num_args, 0);
+    for (int64_t position = 0; position < span.length;) {
+      int64_t run_end = has_plain_array ? position + 1 : span.length;
+      for (int i = 0; i < num_args; ++i) {
+        if (!arg_runs[i].run_end_encoded) continue;
+        run_end = std::min(run_end, arg_runs[i].run_ends[current_runs[i]]);
+      }
+      for (int i = 0; i < num_args; ++i) {
+        const ArgumentRuns& runs = arg_runs[i];
+        if (!runs.run_end_encoded) continue;
+        physical_indices[i].push_back(runs.physical_offset + current_runs[i]);
+        if (runs.run_ends[current_runs[i]] == run_end) {
+          ++current_runs[i];
+        }
+      }
+      run_ends.push_back(run_end);
+      position = run_end;
+    }
+
+    // Gather the values of each merged run, zero-copy if an argument has no run
+    // split by the runs of other arguments
+    const auto num_runs = static_cast<int64_t>(run_ends.size());
+    std::vector<Datum> values(num_args);
+    for (int i = 0; i < num_args; ++i) {
+      if (span[i].is_scalar()) {
+        values[i] = span[i].type()->id() == Type::RUN_END_ENCODED
+                        ? checked_cast<const RunEndEncodedScalar&>(*span[i].scalar).value
+                        : span[i].scalar->GetSharedPtr();
+        continue;
+      }
+      if (!arg_runs[i].run_end_encoded) {
+        values[i] = span[i].array.ToArrayData();
+        continue;
+      }
+      ArraySpan physical = ree_util::ValuesArray(span[i].array);
+      const std::vector<int64_t>& indices = physical_indices[i];
+      bool contiguous = true;
+      for (int64_t j = 1; j < num_runs && contiguous; ++j) {
+        contiguous = indices[j] == indices[j - 1] + 1;
+      }
+      if (contiguous) {
+        physical.SetSlice(physical.offset + indices[0], num_runs);
+        values[i] = physical.ToArrayData();
+        continue;
+      }
+      auto indices_array = std::make_shared<Int64Array>(
+          num_runs, Buffer::FromVector(std::move(physical_indices[i])));
+      ARROW_ASSIGN_OR_RAISE(values[i], Take(physical.ToArray(), indices_array,
+                                            TakeOptions::NoBoundsCheck(), ctx));
+    }
+
+    DatumAccumulator values_listener;
+    RETURN_NOT_OK(values_executor_->Execute(ExecBatch(std::move(values), num_runs),
+                                            &values_listener));
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Array> output_values,
+        ConcatenateResults(values_listener.values(), ctx->memory_pool()));
+
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<ArrayData> output_run_ends,
+        MakeRunEnds(checked_cast<const RunEndEncodedType&>(*output_type_).run_end_type(),
+                    run_ends, ctx->memory_pool()));
+    return listener->OnResult(ArrayData::Make(
+        output_type_.GetSharedPtr(), span.length, {NULLPTR},
+        {std::move(output_run_ends), output_values->data()}, /*null_count=*/0));
+  }
+
   Status ExecuteSpans(ExecListener* listener) {
     // We put the preallocation in an ArraySpan to be passed to the
     // kernel which is expecting to receive that. More
@@ -998,6 +1333,9 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
   bool preallocate_contiguous_ = false;
 
   ExecSpanIterator span_iterator_;
+
+  // Executes the kernel on the values of run-end encoded arguments, if any
+  std::unique_ptr<ScalarExecutor> values_executor_;
 };
 
 namespace {
@@ -1330,6 +1668,73 @@ int64_t InferBatchLength(const std::vector<Datum>& values, bool* all_same) {
   return length;
 }
 
+bool CanExecuteOnDictionaryValues(const Function& func,
+                                  const std::vector<TypeHolder>& arg_types,
+                                  const std::vector<TypeHolder>& kernel_types) {
+  if (func.kind() != Function::SCALAR || !func.is_pure() || arg_types.size() != 1 ||
+      kernel_types.size() != 1 || arg_types[0].id() != Type::DICTIONARY) {
+    return false;
+  }
+  return DictionaryValueType(arg_types[0])->Equals(*kernel_types[0].type);
+}
+
+bool CanExecuteOnRunEndValues(const Function& func,
+                              const std::vector<TypeHolder>& arg_types,
+                              const std::vector<TypeHolder>& kernel_types) {
+  if (func.kind() != Function::SCALAR || !func.is_pure() ||
+      arg_types.size() != kernel_types.size()) {
+    return false;
+  }
+  bool have_run_end_encoded = false;
+  for (size_t i = 0; i < arg_types.size(); ++i) {
+    if (arg_types[i].id() != Type::RUN_END_ENCODED) continue;
+    const auto& value_type =
+        checked_cast<const RunEndEncodedType&>(*arg_types[i]).value_type();
+    if (!value_type->Equals(*kernel_types[i].type)) {
+      return false;
+    }
+    have_run_end_encoded = true;
+  }
+  return have_run_end_encoded;
+}
+
+std::shared_ptr<DataType> RunEndEncodedOutputType(
+    const std::vector<TypeHolder>& arg_types, const TypeHolder& value_type) {
+  for (const auto& type : arg_types) {
+    if (type.id() == Type::RUN_END_ENCODED) {
+      return run_end_encoded(
+          checked_cast<const RunEndEncodedType&>(*type).run_end_type(),
+          value_type.GetSharedPtr());
+    }
+  }
+  return value_type.GetSharedPtr();
+}
+
+bool HasRunEndEncodedAndPlainArrays(const std::vector<Datum>& args) {
+  bool has_run_end_encoded = false;
+  bool has_plain_array = false;
+  for (const auto& arg : args) {
+    if (arg.type()->id() == Type::RUN_END_ENCODED) {
+      has_run_end_encoded = true;
+    } else if (!arg.is_scalar()) {
+      has_plain_array = true;
+    }
+  }
+  return has_run_end_encoded && has_plain_array;
+}
+
+Status DecodeRunEndEncoded(std::vector<Datum>* args, ExecContext* ctx) {
+  for (auto& arg : *args) {
+    if (arg.type()->id() != Type::RUN_END_ENCODED) continue;
+    if (arg.is_scalar()) {
+      arg = arg.scalar_as<RunEndEncodedScalar>().value;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(arg, RunEndDecode(arg, ctx));
+    }
+  }
+  return Status::OK();
+}
+
 }  // namespace detail
 
 ExecContext::ExecContext(MemoryPool* pool, ::arrow::internal::Executor* executor,
@@ -1355,8 +1760,38 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Mask of length ", arr.length(),
+                           " is too long for a selection vector");
+  }
+  const ArrayData& data = *arr.data();
+  const uint8_t* selected = data.buffers[1]->data();
+  int64_t selected_offset = data.offset;
+  // Nulls are not selected
+  std::shared_ptr<Buffer> valid_and_true;
+  if (arr.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        valid_and_true,
+        arrow::internal::BitmapAnd(pool, data.buffers[0]->data(), data.offset, selected,
+                                   data.offset, data.length, /*out_offset=*/0));
+    selected = valid_and_true->data();
+    selected_offset = 0;
+  }
+  const int64_t num_selected =
+      arrow::internal::CountSetBits(selected, selected_offset, data.length);
+  ARROW_ASSIGN_OR_RAISE(auto indices,
+                        AllocateBuffer(num_selected * sizeof(int32_t), pool));
+  auto* out = indices->mutable_data_as<int32_t>();
+  arrow::internal::VisitSetBitRunsVoid(
+      selected, selected_offset, data.length, [&](int64_t position, int64_t length) {
+        for (int64_t i = 0; i < length; ++i) {
+          *out++ = static_cast<int32_t>(position + i);
+        }
+      });
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), num_selected, {nullptr, std::move(indices)},
+                      /*null_count=*/0));
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
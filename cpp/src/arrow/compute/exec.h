@@ -48,6 +48,11 @@ namespace compute {
 // the future once parallel execution is implemented
 static constexpr int64_t kDefaultExecChunksize = UINT16_MAX;
 
+// The default number of rows over which a nested expression is evaluated at a time.
+// The intermediate results of 8K rows of 8-byte values take 64KB, which stays in L2
+// cache between one kernel and the next.
+static constexpr int64_t kDefaultExpressionChunksize = 8192;
+
 /// \brief Context for expression-global variables and options used by
 /// function evaluation
 class ARROW_EXPORT ExecContext {
@@ -82,6 +87,20 @@ class ARROW_EXPORT ExecContext {
   // smaller chunks.
   int64_t exec_chunksize() const { return exec_chunksize_; }
 
+  /// \brief Set the number of rows over which ExecuteScalarExpression evaluates a
+  /// whole expression at a time.
+  ///
+  /// Larger inputs are evaluated one chunk at a time, so that the intermediate
+  /// results of nested calls stay small enough to remain in cache between one kernel
+  /// and the next; only the final results are assembled to the full length. A few
+  /// thousand rows is a reasonable value for arithmetic-heavy expressions. The
+  /// default is kDefaultExpressionChunksize; INT64_MAX evaluates expressions over the
+  /// whole input.
+  void set_expression_chunksize(int64_t chunksize) { expression_chunksize_ = chunksize; }
+
+  /// \brief Maximum number of rows over which an expression is evaluated at a time.
+  int64_t expression_chunksize() const { return expression_chunksize_; }
+
   /// \brief Set whether to use multiple threads for function execution. This
   /// is not yet used.
   void set_use_threads(bool use_threads = true) { use_threads_ = use_threads; }
@@ -115,6 +134,7 @@ class ARROW_EXPORT ExecContext {
   ::arrow::internal::Executor* executor_;
   FunctionRegistry* func_registry_;
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
+  int64_t expression_chunksize_ = kDefaultExpressionChunksize;
   bool preallocate_contiguous_ = true;
   bool use_threads_ = true;
 };
@@ -131,7 +151,9 @@ class ARROW_EXPORT ExecContext {
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// Functions called on an ExecBatch and ExecuteScalarExpression apply the selection
+/// to the values they use before evaluating, so that only the selected rows of the
+/// referenced columns are computed on.
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -141,11 +163,17 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  ///
+  /// Null values of the mask are not selected.
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
 
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
+  /// \brief The indices as an int32 array without nulls
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
+
  private:
   std::shared_ptr<ArrayData> data_;
   const int32_t* indices_;
@@ -248,6 +276,12 @@ struct ARROW_EXPORT ExecBatch {
 
   Result<ExecBatch> SelectValues(const std::vector<int>& ids) const;
 
+  /// \brief Materialize the selection vector, if any
+  ///
+  /// Returns a batch with the selected rows of the array values and no selection
+  /// vector.  Scalar values are kept as they are.
+  Result<ExecBatch> ApplySelection(ExecContext* ctx = NULLPTR) const;
+
   /// \brief A convenience for returning the types from the batch.
   std::vector<TypeHolder> GetTypes() const {
     std::vector<TypeHolder> result;
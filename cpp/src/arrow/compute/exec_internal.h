@@ -165,6 +165,57 @@ Status PropagateNulls(KernelContext* ctx, const ExecSpan& batch, ArrayData* out)
 ARROW_EXPORT
 void PropagateNullsSpans(const ExecSpan& batch, ArraySpan* out);
 
+/// \brief Whether a dictionary-encoded argument can be passed as is to a kernel
+/// dispatched for its value type, instead of being cast to it.
+///
+/// This holds for calls of unary, pure scalar functions: the scalar executor then
+/// evaluates the kernel once per dictionary value and gathers the results through
+/// the dictionary indices.
+///
+/// \param[in] func the function being called
+/// \param[in] arg_types the types of the call arguments
+/// \param[in] kernel_types the input types of the dispatched kernel
+ARROW_EXPORT
+bool CanExecuteOnDictionaryValues(const Function& func,
+                                  const std::vector<TypeHolder>& arg_types,
+                                  const std::vector<TypeHolder>& kernel_types);
+
+/// \brief Whether run-end encoded arguments can be passed as is to a kernel
+/// dispatched for their value types, instead of being cast to them.
+///
+/// This holds for calls of pure scalar functions whose run-end encoded arguments
+/// have the exact value types of the kernel inputs: the scalar executor then
+/// evaluates the kernel once per run and outputs a run-end encoded array, see
+/// RunEndEncodedOutputType.
+///
+/// \param[in] func the function being called
+/// \param[in] arg_types the types of the call arguments
+/// \param[in] kernel_types the input types of the dispatched kernel
+ARROW_EXPORT
+bool CanExecuteOnRunEndValues(const Function& func,
+                              const std::vector<TypeHolder>& arg_types,
+                              const std::vector<TypeHolder>& kernel_types);
+
+/// \brief The output type of a call executed on run-end encoded values: the output
+/// type of the kernel, run-end encoded like the first run-end encoded argument
+///
+/// \param[in] arg_types the types of the call arguments
+/// \param[in] value_type the output type of the kernel
+ARROW_EXPORT
+std::shared_ptr<DataType> RunEndEncodedOutputType(
+    const std::vector<TypeHolder>& arg_types, const TypeHolder& value_type);
+
+/// \brief Whether a call has run-end encoded arguments as well as plain array ones.
+///
+/// Executing it on run-end encoded values would output a run per row, so the
+/// run-end encoded arguments are decoded instead, see DecodeRunEndEncoded.
+ARROW_EXPORT
+bool HasRunEndEncodedAndPlainArrays(const std::vector<Datum>& args);
+
+/// \brief Replace the run-end encoded arguments by their decoded values
+ARROW_EXPORT
+Status DecodeRunEndEncoded(std::vector<Datum>* args, ExecContext* ctx);
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
@@ -153,6 +153,41 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, null, true, true, false, true]");
+  const auto& bool_mask = checked_cast<const BooleanArray&>(*mask);
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(bool_mask));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4, 6]"),
+                    *MakeArray(sel_vector->data()));
+
+  auto sliced = mask->Slice(2);
+  ASSERT_OK_AND_ASSIGN(
+      sel_vector, SelectionVector::FromMask(checked_cast<const BooleanArray&>(*sliced)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 4]"), *MakeArray(sel_vector->data()));
+}
+
+TEST(ExecBatch, ApplySelection) {
+  ExecBatch batch{{Int32Scalar(0), ArrayFromJSON(utf8(), R"(["a", "b", "c", "d"])"),
+                   ChunkedArrayFromJSON(float64(), {"[1.1, 2.2]", "[3.3, 4.4]"})},
+                  /*length=*/3};
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 2, 3]"));
+
+  ASSERT_OK_AND_ASSIGN(auto selected, batch.ApplySelection());
+  ASSERT_EQ(selected.selection_vector, nullptr);
+  ASSERT_EQ(selected.length, 3);
+  AssertDatumsEqual(Datum(Int32Scalar(0)), selected.values[0]);
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["a", "c", "d"])"), selected.values[1]);
+  AssertDatumsEqual(ChunkedArrayFromJSON(float64(), {"[1.1, 3.3, 4.4]"}),
+                    selected.values[2]);
+
+  // Slicing a batch with a selection vector slices the selection
+  ExecBatch sliced = batch.Slice(1, 2);
+  ASSERT_EQ(sliced.length, 2);
+  ASSERT_OK_AND_ASSIGN(selected, sliced.ApplySelection());
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["c", "d"])"), selected.values[1]);
+}
+
 void AssertValidityZeroExtraBits(const uint8_t* data, int64_t length, int64_t offset) {
   const int64_t bit_extent = ((offset + length + 7) / 8) * 8;
   for (int64_t i = offset + length; i < bit_extent; ++i) {
@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_vector.h"
@@ -535,6 +536,30 @@ inline std::vector<TypeHolder> GetTypesWithSmallestLiteralRepresentation(
   return types;
 }
 
+// Dispatch a call whose encoded arguments need no cast to the value types of the
+// kernel, see compute::detail::CanExecuteOnDictionaryValues and
+// compute::detail::CanExecuteOnRunEndValues.
+const Kernel* DispatchOnEncodedValues(const Function& function,
+                                      std::vector<TypeHolder>* types) {
+  std::vector<TypeHolder> kernel_types = *types;
+  Result<const Kernel*> maybe_kernel = function.DispatchBest(&kernel_types);
+  if (!maybe_kernel.ok()) return nullptr;
+  if (!compute::detail::CanExecuteOnDictionaryValues(function, *types, kernel_types) &&
+      !compute::detail::CanExecuteOnRunEndValues(function, *types, kernel_types)) {
+    return nullptr;
+  }
+  // Other arguments may still need a cast
+  for (size_t i = 0; i < types->size(); ++i) {
+    const Type::type id = (*types)[i].id();
+    if (id != Type::DICTIONARY && id != Type::RUN_END_ENCODED &&
+        (*types)[i] != kernel_types[i]) {
+      return nullptr;
+    }
+  }
+  *types = std::move(kernel_types);
+  return *maybe_kernel;
+}
+
 // Produce a bound Expression from unbound Call and bound arguments.
 Result<Expression> BindNonRecursive(Expression::Call call, bool insert_implicit_casts,
                                     compute::ExecContext* exec_context) {
@@ -548,6 +573,8 @@ Result<Expression> BindNonRecursive(Expression::Call call, bool insert_implicit_
   Result<const Kernel*> maybe_exact_match = call.function->DispatchExact(types);
   if (maybe_exact_match.ok()) {
     call.kernel = *maybe_exact_match;
+  } else if (const Kernel* kernel = DispatchOnEncodedValues(*call.function, &types)) {
+    call.kernel = kernel;
   } else {
     if (!insert_implicit_casts) {
       return maybe_exact_match.status();
@@ -558,9 +585,14 @@ Result<Expression> BindNonRecursive(Expression::Call call, bool insert_implicit_
     // first down-cast the literals as much as possible
     types = GetTypesWithSmallestLiteralRepresentation(call.arguments);
     ARROW_ASSIGN_OR_RAISE(call.kernel, call.function->DispatchBest(&types));
+    const bool on_run_end_values = compute::detail::CanExecuteOnRunEndValues(
+        *call.function, GetTypes(call.arguments), types);
 
     for (size_t i = 0; i < types.size(); ++i) {
       if (types[i] == call.arguments[i].type()) continue;
+      if (on_run_end_values && call.arguments[i].type()->id() == Type::RUN_END_ENCODED) {
+        continue;
+      }
 
       if (const Datum* lit = call.arguments[i].literal()) {
         ARROW_ASSIGN_OR_RAISE(Datum new_lit,
@@ -598,6 +630,17 @@ Result<Expression> BindNonRecursive(Expression::Call call, bool insert_implicit_
 
   ARROW_ASSIGN_OR_RAISE(
       call.type, call.kernel->signature->out_type().Resolve(&kernel_context, types));
+  const std::vector<TypeHolder> arg_types = GetTypes(call.arguments);
+  // Plain array arguments would output a run per row, so the output is only run-end
+  // encoded if the other arguments are literals, see ExecuteCall
+  if (compute::detail::CanExecuteOnRunEndValues(*call.function, arg_types, types) &&
+      std::all_of(call.arguments.begin(), call.arguments.end(),
+                  [](const Expression& argument) {
+                    return argument.type()->id() == Type::RUN_END_ENCODED ||
+                           argument.literal() != nullptr;
+                  })) {
+    call.type = compute::detail::RunEndEncodedOutputType(arg_types, call.type);
+  }
 
   return Expression(std::move(call));
 }
@@ -719,22 +762,88 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full
   return ExecuteScalarExpression(expr, input, exec_context);
 }
 
-Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
-                                      compute::ExecContext* exec_context) {
-  if (exec_context == nullptr) {
-    compute::ExecContext exec_context;
-    return ExecuteScalarExpression(expr, input, &exec_context);
+namespace {
+
+void MarkReferencedValues(const Expression& expr, std::vector<bool>* referenced) {
+  if (auto param = expr.parameter()) {
+    if (!param->indices.empty() &&
+        static_cast<size_t>(param->indices[0]) < referenced->size()) {
+      (*referenced)[param->indices[0]] = true;
+    }
+    return;
   }
+  if (auto call = expr.call()) {
+    for (const Expression& arg : call->arguments) {
+      MarkReferencedValues(arg, referenced);
+    }
+  }
+}
 
+// Gathers the selected rows of the values which are referenced by the expressions,
+// leaving the other values out
+Result<ExecBatch> SelectReferencedValues(const std::vector<Expression>& exprs,
+                                         const ExecBatch& input,
+                                         compute::ExecContext* exec_context) {
+  std::vector<bool> referenced(input.values.size(), false);
+  for (const Expression& expr : exprs) {
+    MarkReferencedValues(expr, &referenced);
+  }
+  ExecBatch referenced_input = input;
+  for (size_t i = 0; i < referenced.size(); ++i) {
+    if (!referenced[i]) referenced_input.values[i] = Datum();
+  }
+  return referenced_input.ApplySelection(exec_context);
+}
+
+Status CheckExecutable(const Expression& expr) {
   if (!expr.IsBound()) {
     return Status::Invalid("Cannot Execute unbound expression.");
   }
-
   if (!expr.IsScalarExpression()) {
     return Status::Invalid(
         "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
   }
+  return Status::OK();
+}
+
+// The distinct calls of a set of expressions, with the number of times each one is
+// used.  Equal calls form a single node of the resulting DAG, so their arguments are
+// only counted once, but only calls whose whole subtree is pure are recorded since
+// equal calls to impure functions (e.g. random) produce different results.
+using CallUseCounts = std::unordered_map<Expression, int, Expression::Hash>;
+
+// Returns whether the expression only calls pure functions
+bool CountCallUses(const Expression& expr, CallUseCounts* uses) {
+  auto call = expr.call();
+  if (call == nullptr) return true;
+  auto counted = uses->find(expr);
+  if (counted != uses->end()) {
+    ++counted->second;
+    return true;
+  }
+  bool pure = call->function->is_pure();
+  for (const Expression& arg : call->arguments) {
+    pure &= CountCallUses(arg, uses);
+  }
+  if (pure) {
+    (*uses)[expr] = 1;
+  }
+  return pure;
+}
 
+// The results of the calls used more than once, while evaluating a set of expressions
+// on one batch.  A result is dropped once it has been used as many times as counted.
+struct CallMemo {
+  CallUseCounts remaining_uses;
+  std::unordered_map<Expression, Datum, Expression::Hash> results;
+};
+
+Result<Datum> ExecuteCall(const Expression& expr, const ExecBatch& input,
+                          compute::ExecContext* exec_context, CallMemo* memo);
+
+Result<Datum> ExecuteScalarExpressionImpl(const Expression& expr, const ExecBatch& input,
+                                          compute::ExecContext* exec_context,
+                                          CallMemo* memo) {
   if (auto lit = expr.literal()) return *lit;
 
   if (auto param = expr.parameter()) {
@@ -758,14 +867,41 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
     return field;
   }
 
+  if (memo == nullptr) {
+    return ExecuteCall(expr, input, exec_context, memo);
+  }
+  // Calls which aren't pure weren't counted and are evaluated for each use
+  auto uses = memo->remaining_uses.find(expr);
+  if (uses == memo->remaining_uses.end()) {
+    return ExecuteCall(expr, input, exec_context, memo);
+  }
+  auto result = memo->results.find(expr);
+  if (result != memo->results.end()) {
+    Datum out = result->second;
+    if (--uses->second == 0) {
+      // This was the last use of the result
+      memo->results.erase(result);
+    }
+    return out;
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum out, ExecuteCall(expr, input, exec_context, memo));
+  if (--uses->second > 0) {
+    memo->results.emplace(expr, out);
+  }
+  return out;
+}
+
+Result<Datum> ExecuteCall(const Expression& expr, const ExecBatch& input,
+                          compute::ExecContext* exec_context, CallMemo* memo) {
   auto call = CallNotNull(expr);
 
   std::vector<Datum> arguments(call->arguments.size());
 
   bool all_scalar = true;
   for (size_t i = 0; i < arguments.size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(
-        arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
+    ARROW_ASSIGN_OR_RAISE(arguments[i],
+                          ExecuteScalarExpressionImpl(call->arguments[i], input,
+                                                      exec_context, memo));
     all_scalar &= arguments[i].is_scalar();
   }
 
@@ -778,13 +914,21 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
     input_length = input.length;
   }
 
+  const Kernel* kernel = call->kernel;
+  std::vector<TypeHolder> types = GetTypes(arguments);
+  if (call->type.id() != Type::RUN_END_ENCODED &&
+      !kernel->signature->MatchesInputs(types)) {
+    // A call on run-end encoded values which outputs plain arrays, see
+    // BindNonRecursive
+    RETURN_NOT_OK(compute::detail::DecodeRunEndEncoded(&arguments, exec_context));
+    types = GetTypes(arguments);
+  }
+
   auto executor = compute::detail::KernelExecutor::MakeScalar();
 
   compute::KernelContext kernel_context(exec_context, call->kernel);
   kernel_context.SetState(call->kernel_state.get());
 
-  const Kernel* kernel = call->kernel;
-  std::vector<TypeHolder> types = GetTypes(arguments);
   auto options = call->options.get();
   RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, types, options}));
 
@@ -797,6 +941,147 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
   return out;
 }
 
+}  // namespace
+
+namespace {
+
+// Evaluates the expressions on the whole input.  If share_calls is set, repeated
+// calls which only involve pure functions are only evaluated once.
+Result<std::vector<Datum>> ExecuteOnBatch(const std::vector<Expression>& exprs,
+                                          const ExecBatch& input,
+                                          compute::ExecContext* exec_context,
+                                          bool share_calls) {
+  std::optional<CallMemo> memo;
+  if (share_calls) {
+    memo.emplace();
+    for (const Expression& expr : exprs) {
+      CountCallUses(expr, &memo->remaining_uses);
+    }
+  }
+  std::vector<Datum> results(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(results[i],
+                          ExecuteScalarExpressionImpl(exprs[i], input, exec_context,
+                                                      memo ? &*memo : nullptr));
+  }
+  return results;
+}
+
+bool HasIntermediateResults(const Expression& expr) {
+  auto call = expr.call();
+  if (call == nullptr) return false;
+  for (const Expression& arg : call->arguments) {
+    if (arg.call()) return true;
+  }
+  return false;
+}
+
+// Evaluates the expressions over chunks of at most ExecContext::expression_chunksize()
+// rows, so that the intermediate results of each chunk are still in cache when the
+// next kernel reads them.  The chunks of each final result are then concatenated.
+// Field references and literals are not calls, so they are returned as they are
+// without being sliced and concatenated again.
+Result<std::vector<Datum>> ExecuteInChunks(const std::vector<Expression>& exprs,
+                                           const ExecBatch& input,
+                                           compute::ExecContext* exec_context,
+                                           bool share_calls) {
+  const int64_t chunksize = exec_context->expression_chunksize();
+  bool chunk = input.length > chunksize &&
+               std::any_of(exprs.begin(), exprs.end(), HasIntermediateResults);
+  for (const Datum& value : input.values) {
+    // The results of chunked inputs are already chunked
+    chunk &= !value.is_chunked_array();
+  }
+  if (!chunk) {
+    return ExecuteOnBatch(exprs, input, exec_context, share_calls);
+  }
+
+  std::vector<Datum> results(exprs.size());
+  std::vector<Expression> calls;
+  std::vector<size_t> call_indices;
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    if (exprs[i].call() == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(results[i],
+                            ExecuteScalarExpressionImpl(exprs[i], input, exec_context,
+                                                        /*memo=*/nullptr));
+    } else {
+      calls.push_back(exprs[i]);
+      call_indices.push_back(i);
+    }
+  }
+
+  std::vector<ArrayVector> result_chunks(calls.size());
+  for (int64_t offset = 0; offset < input.length; offset += chunksize) {
+    ExecBatch input_chunk =
+        input.Slice(offset, std::min(chunksize, input.length - offset));
+    ARROW_ASSIGN_OR_RAISE(
+        std::vector<Datum> chunk_results,
+        ExecuteOnBatch(calls, input_chunk, exec_context, share_calls));
+    for (size_t i = 0; i < calls.size(); ++i) {
+      if (chunk_results[i].is_scalar()) {
+        // The result does not depend on the rows of the input
+        results[call_indices[i]] = std::move(chunk_results[i]);
+      } else {
+        result_chunks[i].push_back(chunk_results[i].make_array());
+      }
+    }
+  }
+  for (size_t i = 0; i < calls.size(); ++i) {
+    if (result_chunks[i].empty()) continue;
+    ARROW_ASSIGN_OR_RAISE(results[call_indices[i]],
+                          Concatenate(result_chunks[i], exec_context->memory_pool()));
+  }
+  return results;
+}
+
+}  // namespace
+
+Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
+                                      compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpression(expr, input, &exec_context);
+  }
+
+  RETURN_NOT_OK(CheckExecutable(expr));
+
+  if (auto lit = expr.literal()) return *lit;
+
+  if (input.selection_vector) {
+    // Only gather the selected rows of the values which are referenced, and evaluate
+    // the expression on those
+    ARROW_ASSIGN_OR_RAISE(ExecBatch selected,
+                          SelectReferencedValues({expr}, input, exec_context));
+    return ExecuteScalarExpression(expr, selected, exec_context);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      std::vector<Datum> results,
+      ExecuteInChunks({expr}, input, exec_context, /*share_calls=*/false));
+  return std::move(results[0]);
+}
+
+Result<std::vector<Datum>> ExecuteScalarExpressions(const std::vector<Expression>& exprs,
+                                                    const ExecBatch& input,
+                                                    compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpressions(exprs, input, &exec_context);
+  }
+
+  for (const Expression& expr : exprs) {
+    RETURN_NOT_OK(CheckExecutable(expr));
+  }
+
+  if (input.selection_vector) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch selected,
+                          SelectReferencedValues(exprs, input, exec_context));
+    return ExecuteScalarExpressions(exprs, selected, exec_context);
+  }
+
+  return ExecuteInChunks(exprs, input, exec_context, /*share_calls=*/true);
+}
+
 namespace {
 
 std::array<std::pair<const Expression&, const Expression&>, 2>
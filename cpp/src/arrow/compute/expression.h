@@ -252,6 +252,16 @@ ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Schema& full_schema,
                                       const Datum& partial_input, ExecContext* = NULLPTR);
 
+/// Execute several scalar expressions against the same input ExecBatch.  The
+/// expressions must be bound.
+///
+/// Calls to pure functions which occur more than once, within one expression or across
+/// them, are only computed once.  Their results are released after their last use.
+ARROW_EXPORT
+Result<std::vector<Datum>> ExecuteScalarExpressions(const std::vector<Expression>&,
+                                                    const ExecBatch& input,
+                                                    ExecContext* = NULLPTR);
+
 // Serialization
 
 ARROW_EXPORT
@@ -17,6 +17,7 @@
 
 #include "arrow/compute/expression.h"
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <memory>
@@ -28,6 +29,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/expression_internal.h"
 #include "arrow/compute/function_internal.h"
 #include "arrow/compute/registry.h"
@@ -888,9 +890,12 @@ TEST(Expression, BindWithImplicitCasts) {
 
   compute::SetLookupOptions in_a{ArrayFromJSON(utf8(), R"(["a"])")};
 
-  // cast dictionary to value type
-  ExpectBindsTo(call("is_in", {field_ref("dict_str")}, in_a),
-                call("is_in", {cast(field_ref("dict_str"), utf8())}, in_a));
+  // unary functions are evaluated on the dictionary values, without a cast
+  for (auto expr : {call("is_in", {field_ref("dict_str")}, in_a),
+                    call("utf8_upper", {field_ref("dict_str")})}) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*kBoringSchema));
+    EXPECT_NE(expr.call()->arguments[0].field_ref(), nullptr) << expr.ToString();
+  }
 }
 
 TEST(Expression, BindWithImplicitCastsForCaseWhenOnDecimal) {
@@ -1127,6 +1132,166 @@ TEST(Expression, ExecuteCall) {
   ])"));
 }
 
+TEST(Expression, ExecuteCallOnRunEndEncoded) {
+  ASSERT_OK_AND_ASSIGN(Datum encoded,
+                       RunEndEncode(ArrayFromJSON(int32(), "[1, 1, 1, 2, 2, null]")));
+  auto plain = ArrayFromJSON(int32(), "[0, 1, 2, 3, 4, 5]");
+  auto batch = RecordBatch::Make(
+      schema({field("ree", encoded.type()), field("plain", int32())}), 6,
+      {encoded.make_array(), plain});
+
+  // The output is run-end encoded if the other arguments are literals
+  ASSERT_OK_AND_ASSIGN(auto expr,
+                       add(field_ref("ree"), literal(int32_t(5))).Bind(*batch->schema()));
+  EXPECT_EQ(expr.type()->id(), Type::RUN_END_ENCODED);
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       ExecuteScalarExpression(expr, *batch->schema(), batch));
+  ASSERT_OK_AND_ASSIGN(Datum expected,
+                       RunEndEncode(ArrayFromJSON(int32(), "[6, 6, 6, 7, 7, null]")));
+  AssertDatumsEqual(expected, actual, /*verbose=*/true);
+
+  // Plain array arguments would split it into a run per row, so it is decoded
+  ASSERT_OK_AND_ASSIGN(expr,
+                       add(field_ref("ree"), field_ref("plain")).Bind(*batch->schema()));
+  EXPECT_EQ(*expr.type(), *int32());
+  ASSERT_OK_AND_ASSIGN(actual, ExecuteScalarExpression(expr, *batch->schema(), batch));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, 2, 3, 5, 6, null]"), actual,
+                    /*verbose=*/true);
+}
+
+TEST(Expression, ExecuteWithSelectionVector) {
+  auto input_schema = schema({field("a", float64()), field("b", utf8())});
+  ExecBatch batch{{ArrayFromJSON(float64(), "[1, 2, 3, 4]"),
+                   ArrayFromJSON(utf8(), R"(["w", "x", "y", "z"])")},
+                  /*length=*/2};
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[1, 3]"));
+
+  ASSERT_OK_AND_ASSIGN(auto expr,
+                       add(field_ref("a"), literal(0.5)).Bind(*input_schema));
+  ASSERT_OK_AND_ASSIGN(Datum actual, ExecuteScalarExpression(expr, batch));
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[2.5, 4.5]"), actual);
+
+  ASSERT_OK_AND_ASSIGN(expr, field_ref("b").Bind(*input_schema));
+  ASSERT_OK_AND_ASSIGN(actual, ExecuteScalarExpression(expr, batch));
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["x", "z"])"), actual);
+}
+
+static std::atomic<int> counting_negate_calls{0};
+
+static Status RegisterCountingNegate() {
+  const std::string name = "counting_negate";
+  auto registry = GetFunctionRegistry();
+  if (registry->GetFunction(name).ok()) return Status::OK();
+
+  auto func =
+      std::make_shared<ScalarFunction>(name, Arity::Unary(), FunctionDoc::Empty());
+  auto func_exec = [](KernelContext*, const ExecSpan& batch, ExecResult* out) -> Status {
+    ++counting_negate_calls;
+    const double* in_values = batch[0].array.GetValues<double>(1);
+    double* out_values = out->array_span_mutable()->GetValues<double>(1);
+    for (int64_t i = 0; i < batch.length; ++i) {
+      out_values[i] = -in_values[i];
+    }
+    return Status::OK();
+  };
+  ARROW_RETURN_NOT_OK(func->AddKernel({float64()}, float64(), func_exec));
+  return registry->AddFunction(std::move(func));
+}
+
+TEST(Expression, ExecuteSharedSubexpressionsOnce) {
+  ASSERT_OK(RegisterCountingNegate());
+  auto input_schema = schema({field("a", float64()), field("b", float64())});
+  ExecBatch batch{{ArrayFromJSON(float64(), "[1, 2, null]"),
+                   ArrayFromJSON(float64(), "[10, 20, 30]")},
+                  /*length=*/3};
+
+  auto negate_a = call("counting_negate", {field_ref("a")});
+  std::vector<Expression> exprs;
+  for (auto expr : {add(negate_a, field_ref("b")), negate_a,
+                    call("multiply", {add(negate_a, field_ref("b")), negate_a}),
+                    call("counting_negate", {field_ref("b")})}) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*input_schema));
+    exprs.push_back(std::move(expr));
+  }
+
+  counting_negate_calls = 0;
+  ASSERT_OK_AND_ASSIGN(auto results, ExecuteScalarExpressions(exprs, batch));
+  // Once for field a and once for field b
+  ASSERT_EQ(counting_negate_calls.load(), 2);
+  ASSERT_EQ(results.size(), exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(exprs[i], batch));
+    AssertDatumsEqual(expected, results[i], /*verbose=*/true);
+  }
+
+  // Impure functions are called for each occurrence
+  ASSERT_OK_AND_ASSIGN(
+      auto random_expr,
+      call("random", {}, RandomOptions::FromSystemRandom()).Bind(*input_schema));
+  ASSERT_OK_AND_ASSIGN(auto random_results,
+                       ExecuteScalarExpressions({random_expr, random_expr}, batch));
+  ASSERT_FALSE(random_results[0].Equals(random_results[1]));
+
+  // ... including when they are nested in a call to a pure function
+  ASSERT_OK_AND_ASSIGN(
+      auto shifted_random_expr,
+      add(call("random", {}, RandomOptions::FromSystemRandom()), literal(1.0))
+          .Bind(*input_schema));
+  ASSERT_OK_AND_ASSIGN(
+      random_results,
+      ExecuteScalarExpressions({shifted_random_expr, shifted_random_expr}, batch));
+  ASSERT_FALSE(random_results[0].Equals(random_results[1]));
+
+  // Pure calls nested in a call to an impure function are still shared
+  counting_negate_calls = 0;
+  ASSERT_OK_AND_ASSIGN(auto mixed_expr,
+                       call("multiply", {negate_a, shifted_random_expr})
+                           .Bind(*input_schema));
+  ASSERT_OK_AND_ASSIGN(auto mixed_results,
+                       ExecuteScalarExpressions({mixed_expr, mixed_expr}, batch));
+  ASSERT_EQ(counting_negate_calls.load(), 1);
+  ASSERT_FALSE(mixed_results[0].Equals(mixed_results[1]));
+}
+
+TEST(Expression, ExecuteInChunks) {
+  ASSERT_OK(RegisterCountingNegate());
+  auto input_schema = schema(
+      {field("a", float64()), field("b", float64()), field("c", float64())});
+  ExecBatch batch{{ArrayFromJSON(float64(), "[1, 2, null, 4, 5]"),
+                   ArrayFromJSON(float64(), "[10, 20, 30, 40, 50]"),
+                   ArrayFromJSON(float64(), "[1, -1, 1, -1, 1]")},
+                  /*length=*/5};
+
+  std::vector<Expression> exprs;
+  for (auto expr :
+       {greater(add(call("multiply", {field_ref("a"), field_ref("b")}), field_ref("c")),
+                literal(50.0)),
+        call("counting_negate", {call("counting_negate", {field_ref("a")})}),
+        field_ref("b"), literal(1.0)}) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*input_schema));
+    exprs.push_back(std::move(expr));
+  }
+
+  ExecContext chunked_context;
+  ASSERT_EQ(chunked_context.expression_chunksize(), kDefaultExpressionChunksize);
+  chunked_context.set_expression_chunksize(2);
+  counting_negate_calls = 0;
+  ASSERT_OK_AND_ASSIGN(auto results,
+                       ExecuteScalarExpressions(exprs, batch, &chunked_context));
+  // Both calls are evaluated on each of the 3 chunks
+  ASSERT_EQ(counting_negate_calls.load(), 6);
+  // Field references are passed through rather than sliced and concatenated
+  ASSERT_EQ(results[2].array(), batch.values[1].array());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(exprs[i], batch));
+    AssertDatumsEqual(expected, results[i], /*verbose=*/true);
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         ExecuteScalarExpression(exprs[i], batch, &chunked_context));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
 TEST(Expression, ExecuteCallWithNoArguments) {
   const int kCount = 10;
   auto random_options = RandomOptions::FromSeed(/*seed=*/0);
@@ -181,11 +181,32 @@ const Kernel* DispatchExactImpl(const Function* func,
   return nullptr;
 }
 
+namespace {
+
+// The argument types expected by the executor: those of the kernel, except for
+// run-end encoded arguments that need no cast (see CanExecuteOnRunEndValues)
+std::vector<TypeHolder> GetExecutorTypes(const Function& func,
+                                         const std::vector<TypeHolder>& arg_types,
+                                         std::vector<TypeHolder> kernel_types) {
+  if (CanExecuteOnRunEndValues(func, arg_types, kernel_types)) {
+    for (size_t i = 0; i < arg_types.size(); ++i) {
+      if (arg_types[i].id() == Type::RUN_END_ENCODED) {
+        kernel_types[i] = arg_types[i];
+      }
+    }
+  }
+  return kernel_types;
+}
+
+}  // namespace
+
 struct FunctionExecutorImpl : public FunctionExecutor {
-  FunctionExecutorImpl(std::vector<TypeHolder> in_types, const Kernel* kernel,
+  FunctionExecutorImpl(const std::vector<TypeHolder>& arg_types,
+                       std::vector<TypeHolder> kernel_types, const Kernel* kernel,
                        std::unique_ptr<detail::KernelExecutor> executor,
                        const Function& func)
-      : in_types(std::move(in_types)),
+      : in_types(GetExecutorTypes(func, arg_types, kernel_types)),
+        kernel_types(std::move(kernel_types)),
         kernel(kernel),
         kernel_ctx(default_exec_context(), kernel),
         executor(std::move(executor)),
@@ -202,7 +223,7 @@ struct FunctionExecutorImpl : public FunctionExecutor {
     }
     if (kernel->init) {
       ARROW_ASSIGN_OR_RAISE(state,
-                            kernel->init(&kernel_ctx, {kernel, in_types, options}));
+                            kernel->init(&kernel_ctx, {kernel, kernel_types, options}));
       kernel_ctx.SetState(state.get());
     }
 
@@ -239,11 +260,14 @@ struct FunctionExecutorImpl : public FunctionExecutor {
     }
     ExecContext* ctx = kernel_ctx.exec_context();
     // Cast arguments if necessary
+    const bool on_dictionary_values =
+        args.size() == 1 &&
+        CanExecuteOnDictionaryValues(func, {args[0].type()}, in_types);
     std::vector<Datum> args_with_cast(args.size());
     for (size_t i = 0; i != args.size(); ++i) {
       const auto& in_type = in_types[i];
       auto arg = args[i];
-      if (in_type != args[i].type()) {
+      if (in_type != args[i].type() && !on_dictionary_values) {
         ARROW_ASSIGN_OR_RAISE(arg, Cast(args[i], CastOptions::Safe(in_type), ctx));
       }
       args_with_cast[i] = std::move(arg);
@@ -284,6 +308,7 @@ struct FunctionExecutorImpl : public FunctionExecutor {
   }
 
   std::vector<TypeHolder> in_types;
+  std::vector<TypeHolder> kernel_types;
   const Kernel* kernel;
   KernelContext kernel_ctx;
   std::unique_ptr<detail::KernelExecutor> executor;
@@ -310,6 +335,18 @@ Result<const Kernel*> Function::DispatchExact(
 
 Result<const Kernel*> Function::DispatchBest(std::vector<TypeHolder>* values) const {
   // TODO(ARROW-11508) permit generic conversions here
+  if (kind_ == Function::SCALAR && detail::DispatchExactImpl(this, *values) == nullptr) {
+    // Dispatch on the values of encoded arguments, see
+    // detail::CanExecuteOnDictionaryValues and detail::CanExecuteOnRunEndValues
+    if (values->size() == 1 && (*values)[0].id() == Type::DICTIONARY) {
+      (*values)[0] = checked_cast<const DictionaryType&>(*(*values)[0]).value_type();
+    }
+    for (auto& value : *values) {
+      if (value.id() == Type::RUN_END_ENCODED) {
+        value = checked_cast<const RunEndEncodedType&>(*value).value_type();
+      }
+    }
+  }
   return DispatchExact(*values);
 }
 
@@ -326,10 +363,11 @@ Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
     return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
   }
 
+  const std::vector<TypeHolder> arg_types = inputs;
   ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, DispatchBest(&inputs));
 
-  return std::make_shared<detail::FunctionExecutorImpl>(std::move(inputs), kernel,
-                                                        std::move(executor), *this);
+  return std::make_shared<detail::FunctionExecutorImpl>(
+      arg_types, std::move(inputs), kernel, std::move(executor), *this);
 }
 
 namespace {
@@ -338,6 +376,12 @@ Result<Datum> ExecuteInternal(const Function& func, std::vector<Datum> args,
                               int64_t passed_length, const FunctionOptions* options,
                               ExecContext* ctx) {
   ARROW_ASSIGN_OR_RAISE(auto inputs, internal::GetFunctionArgumentTypes(args));
+  if (func.kind() == Function::SCALAR && detail::HasRunEndEncodedAndPlainArrays(args) &&
+      !func.DispatchExact(inputs).ok()) {
+    // Output plain arrays rather than a run per row
+    RETURN_NOT_OK(detail::DecodeRunEndEncoded(&args, ctx));
+    ARROW_ASSIGN_OR_RAISE(inputs, internal::GetFunctionArgumentTypes(args));
+  }
   ARROW_ASSIGN_OR_RAISE(auto func_exec, func.GetBestExecutor(inputs));
   ARROW_RETURN_NOT_OK(func_exec->Init(options, ctx));
   return func_exec->Execute(args, passed_length);
@@ -352,6 +396,11 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
 
 Result<Datum> Function::Execute(const ExecBatch& batch, const FunctionOptions* options,
                                 ExecContext* ctx) const {
+  if (batch.selection_vector) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch selected, batch.ApplySelection(ctx));
+    return ExecuteInternal(*this, std::move(selected.values), selected.length, options,
+                           ctx);
+  }
   return ExecuteInternal(*this, batch.values, batch.length, options, ctx);
 }
 
@@ -487,6 +536,10 @@ Result<Datum> MetaFunction::Execute(const std::vector<Datum>& args,
 Result<Datum> MetaFunction::Execute(const ExecBatch& batch,
                                     const FunctionOptions* options,
                                     ExecContext* ctx) const {
+  if (batch.selection_vector) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch selected, batch.ApplySelection(ctx));
+    return Execute(selected.values, options, ctx);
+  }
   return Execute(batch.values, options, ctx);
 }
 
@@ -59,6 +59,8 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new TDigestOptions());
   options.emplace_back(
       new TDigestOptions(/*q=*/0.75, /*delta=*/50, /*buffer_size=*/1024));
+  options.emplace_back(new ApproxCountDistinctOptions());
+  options.emplace_back(new ApproxCountDistinctOptions(/*precision=*/16));
   options.emplace_back(new IndexOptions(ScalarFromJSON(int64(), "16")));
   options.emplace_back(new IndexOptions(ScalarFromJSON(boolean(), "true")));
   options.emplace_back(new IndexOptions(ScalarFromJSON(boolean(), "null")));
@@ -80,6 +82,9 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new JoinOptions(JoinOptions::REPLACE, "replacement"));
   options.emplace_back(new MatchSubstringOptions("pattern"));
   options.emplace_back(new MatchSubstringOptions("pattern", /*ignore_case=*/true));
+  options.emplace_back(new MatchAnySubstringOptions({"a", "b"}));
+  options.emplace_back(
+      new MatchAnySubstringOptions({"a", "b"}, /*ignore_case=*/true));
   options.emplace_back(new SplitOptions());
   options.emplace_back(new SplitOptions(/*max_splits=*/2, /*reverse=*/true));
   options.emplace_back(new SplitPatternOptions("pattern"));
@@ -60,6 +60,7 @@ Status RegisterComputeKernels() {
   internal::RegisterHashAggregateNumeric(registry);
   internal::RegisterHashAggregatePivot(registry);
   internal::RegisterScalarAggregateBasic(registry);
+  internal::RegisterScalarAggregateHyperLogLog(registry);
   internal::RegisterScalarAggregateMode(registry);
   internal::RegisterScalarAggregatePivot(registry);
   internal::RegisterScalarAggregateQuantile(registry);
@@ -24,6 +24,7 @@
 #include "arrow/compute/registry_internal.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/hashing.h"
+#include "arrow/util/ree_util.h"
 
 // Include templated definitions for aggregate kernels that must compiled here
 // with the SIMD level configured for this compilation unit in the build.
@@ -499,11 +500,20 @@ Result<std::unique_ptr<KernelState>> MinMaxInitDefault(KernelContext* ctx,
   return visitor.Create();
 }
 
+// The type of the first argument, or its value type if it is run-end encoded
+Result<TypeHolder> FirstRunEndDecodedType(KernelContext*,
+                                          const std::vector<TypeHolder>& types) {
+  if (types[0].id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedType&>(*types[0]).value_type();
+  }
+  return types[0];
+}
+
 // For "min" and "max" functions: override finalize and return the actual value
 template <MinOrMax min_or_max>
 void AddMinOrMaxAggKernel(ScalarAggregateFunction* func,
                           ScalarAggregateFunction* min_max_func) {
-  auto sig = KernelSignature::Make({InputType::Any()}, FirstType);
+  auto sig = KernelSignature::Make({InputType::Any()}, FirstRunEndDecodedType);
   auto init = [min_max_func](
                   KernelContext* ctx,
                   const KernelInitArgs& args) -> Result<std::unique_ptr<KernelState>> {
@@ -526,6 +536,120 @@ void AddMinOrMaxAggKernel(ScalarAggregateFunction* func,
   AddAggKernel(std::move(sig), std::move(init), std::move(finalize), func);
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded implementation
+
+// Aggregate run-end encoded input with the aggregator of its value type, consuming
+// each run at once rather than each of its values: runs of length 1 as slices of
+// the values, and longer runs as their value repeated over the run length (which
+// the aggregators weigh like any scalar input).
+struct RunEndEncodedAggregator : public ScalarAggregator {
+  RunEndEncodedAggregator(const ScalarAggregateKernel* values_kernel,
+                          std::unique_ptr<KernelState> values_state)
+      : values_kernel(values_kernel), values_state(std::move(values_state)) {}
+
+  Status Consume(KernelContext* ctx, const ExecSpan& batch) override {
+    KernelContext values_ctx = ValuesContext(ctx);
+    if (batch[0].is_scalar()) {
+      const auto& scalar = checked_cast<const RunEndEncodedScalar&>(*batch[0].scalar);
+      return values_kernel->consume(
+          &values_ctx, ExecSpan({ExecValue(scalar.value.get())}, batch.length));
+    }
+    const ArraySpan& array = batch[0].array;
+    switch (ree_util::RunEndsArray(array).type->id()) {
+      case Type::INT16:
+        return ConsumeRuns<int16_t>(&values_ctx, array);
+      case Type::INT32:
+        return ConsumeRuns<int32_t>(&values_ctx, array);
+      default:
+        DCHECK_EQ(ree_util::RunEndsArray(array).type->id(), Type::INT64);
+        return ConsumeRuns<int64_t>(&values_ctx, array);
+    }
+  }
+
+  template <typename RunEndCType>
+  Status ConsumeRuns(KernelContext* values_ctx, const ArraySpan& array) {
+    const ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(array);
+    const ArraySpan& values = ree_util::ValuesArray(array);
+    std::shared_ptr<Array> values_array;
+    // The physical range of pending runs of length 1
+    int64_t singles_begin = 0;
+    int64_t singles_length = 0;
+    auto consume_singles = [&]() -> Status {
+      if (singles_length == 0) return Status::OK();
+      ArraySpan slice = values;
+      slice.SetSlice(values.offset + singles_begin, singles_length);
+      singles_length = 0;
+      return values_kernel->consume(values_ctx, ExecSpan({slice}, slice.length));
+    };
+    for (auto it = ree_span.begin(); !it.is_end(ree_span); ++it) {
+      if (it.run_length() == 1) {
+        if (singles_length == 0) singles_begin = it.index_into_array();
+        ++singles_length;
+        continue;
+      }
+      RETURN_NOT_OK(consume_singles());
+      if (!values_array) values_array = values.ToArray();
+      ARROW_ASSIGN_OR_RAISE(auto value, values_array->GetScalar(it.index_into_array()));
+      RETURN_NOT_OK(values_kernel->consume(
+          values_ctx, ExecSpan({ExecValue(value.get())}, it.run_length())));
+    }
+    return consume_singles();
+  }
+
+  Status MergeFrom(KernelContext* ctx, KernelState&& src) override {
+    auto& other = checked_cast<RunEndEncodedAggregator&>(src);
+    KernelContext values_ctx = ValuesContext(ctx);
+    return values_kernel->merge(&values_ctx, std::move(*other.values_state),
+                                values_state.get());
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    KernelContext values_ctx = ValuesContext(ctx);
+    return values_kernel->finalize(&values_ctx, out);
+  }
+
+  KernelContext ValuesContext(KernelContext* ctx) const {
+    KernelContext values_ctx(ctx->exec_context(), values_kernel);
+    values_ctx.SetState(values_state.get());
+    return values_ctx;
+  }
+
+  const ScalarAggregateKernel* values_kernel;
+  std::unique_ptr<KernelState> values_state;
+};
+
+// Add a kernel for run-end encoded input, aggregated by the kernel of its value type
+void AddRunEndEncodedAggKernel(ScalarAggregateFunction* func) {
+  auto dispatch_values =
+      [func](const std::vector<TypeHolder>& types,
+             std::vector<TypeHolder>* value_types) -> Result<const Kernel*> {
+    ARROW_ASSIGN_OR_RAISE(TypeHolder value_type, FirstRunEndDecodedType(NULLPTR, types));
+    *value_types = {std::move(value_type)};
+    return func->DispatchExact(*value_types);
+  };
+  auto resolve = [dispatch_values](
+                     KernelContext* ctx,
+                     const std::vector<TypeHolder>& types) -> Result<TypeHolder> {
+    std::vector<TypeHolder> value_types;
+    ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, dispatch_values(types, &value_types));
+    return kernel->signature->out_type().Resolve(ctx, value_types);
+  };
+  auto init = [dispatch_values](
+                  KernelContext* ctx,
+                  const KernelInitArgs& args) -> Result<std::unique_ptr<KernelState>> {
+    std::vector<TypeHolder> value_types;
+    ARROW_ASSIGN_OR_RAISE(const Kernel* kernel,
+                          dispatch_values(args.inputs, &value_types));
+    ARROW_ASSIGN_OR_RAISE(auto values_state,
+                          kernel->init(ctx, {kernel, value_types, args.options}));
+    return std::make_unique<RunEndEncodedAggregator>(
+        static_cast<const ScalarAggregateKernel*>(kernel), std::move(values_state));
+  };
+  AddAggKernel(KernelSignature::Make({Type::RUN_END_ENCODED}, OutputType(resolve)),
+               std::move(init), func);
+}
+
 // ----------------------------------------------------------------------
 // Any implementation
 
@@ -1058,6 +1182,7 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddArrayScalarAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
   AddArrayScalarAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   AddArrayScalarAggKernels(SumInit, {null()}, int64(), func.get());
+  AddRunEndEncodedAggKernel(func.get());
   // Add the SIMD variants for sum
 #if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
   auto cpu_info = arrow::internal::CpuInfo::GetInstance();
@@ -1083,6 +1208,7 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddAggKernel(KernelSignature::Make({Type::DECIMAL256}, FirstType), MeanInit, func.get(),
                SimdLevel::NONE);
   AddArrayScalarAggKernels(MeanInit, {null()}, float64(), func.get());
+  AddRunEndEncodedAggKernel(func.get());
   // Add the SIMD variants for mean
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -1129,6 +1255,7 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddMinMaxKernel(MinMaxInitDefault, Type::INTERVAL_MONTHS, func.get());
   AddMinMaxKernel(MinMaxInitDefault, Type::DECIMAL128, func.get());
   AddMinMaxKernel(MinMaxInitDefault, Type::DECIMAL256, func.get());
+  AddRunEndEncodedAggKernel(func.get());
   // Add the SIMD variants for min max
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -0,0 +1,203 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/registry_internal.h"
+#include "arrow/util/hyperloglog_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+using arrow::internal::HyperLogLog;
+
+struct ApproxCountDistinctImpl : public ScalarAggregator {
+  ApproxCountDistinctImpl(const ApproxCountDistinctOptions& options, bool emit_sketch)
+      : sketch(options.precision), emit_sketch(emit_sketch) {}
+
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    if (batch[0].is_array()) {
+      return VisitValueHashes(batch[0].array,
+                              [&](int64_t, uint64_t hash) { sketch.Add(hash); });
+    }
+    // Adding the same value several times does not change the sketch
+    return VisitValueHashes(ArraySpan(*batch[0].scalar),
+                            [&](int64_t, uint64_t hash) { sketch.Add(hash); });
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const ApproxCountDistinctImpl&>(src);
+    return sketch.Merge(other.sketch);
+  }
+
+  Status Finalize(KernelContext*, Datum* out) override {
+    if (emit_sketch) {
+      *out = std::make_shared<BinaryScalar>(Buffer::FromString(sketch.Serialize()));
+    } else {
+      *out = Datum(static_cast<int64_t>(std::llround(sketch.Estimate())));
+    }
+    return Status::OK();
+  }
+
+  HyperLogLog sketch;
+  const bool emit_sketch;
+};
+
+template <bool EmitSketch>
+Result<std::unique_ptr<KernelState>> ApproxCountDistinctInit(KernelContext*,
+                                                             const KernelInitArgs& args) {
+  const auto& options = checked_cast<const ApproxCountDistinctOptions&>(*args.options);
+  RETURN_NOT_OK(HyperLogLog::ValidatePrecision(options.precision));
+  if (!CanHashValues(*args.inputs[0].type)) {
+    return Status::NotImplemented(
+        EmitSketch ? "hll_sketch" : "approx_count_distinct", " for type ",
+        args.inputs[0].type->ToString());
+  }
+  return std::make_unique<ApproxCountDistinctImpl>(options, EmitSketch);
+}
+
+// Merges serialized sketches of the precision given in the options, ignoring nulls
+template <typename Type>
+struct HyperLogLogMergeImpl : public ScalarAggregator {
+  explicit HyperLogLogMergeImpl(const ApproxCountDistinctOptions& options)
+      : sketch(options.precision) {}
+
+  Status MergeSketch(std::string_view data) {
+    ARROW_ASSIGN_OR_RAISE(auto other, HyperLogLog::Deserialize(data));
+    return sketch.Merge(other);
+  }
+
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    if (batch[0].is_array()) {
+      return VisitArraySpanInline<Type>(
+          batch[0].array, [&](std::string_view data) { return MergeSketch(data); },
+          [] { return Status::OK(); });
+    }
+    // Merging the same sketch several times does not change the result
+    const Scalar& scalar = *batch[0].scalar;
+    if (!scalar.is_valid) return Status::OK();
+    return MergeSketch(UnboxScalar<Type>::Unbox(scalar));
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    return sketch.Merge(checked_cast<const HyperLogLogMergeImpl&>(src).sketch);
+  }
+
+  Status Finalize(KernelContext*, Datum* out) override {
+    *out = std::make_shared<BinaryScalar>(Buffer::FromString(sketch.Serialize()));
+    return Status::OK();
+  }
+
+  HyperLogLog sketch;
+};
+
+template <typename Type>
+Result<std::unique_ptr<KernelState>> HyperLogLogMergeInit(KernelContext*,
+                                                          const KernelInitArgs& args) {
+  const auto& options = checked_cast<const ApproxCountDistinctOptions&>(*args.options);
+  RETURN_NOT_OK(HyperLogLog::ValidatePrecision(options.precision));
+  return std::make_unique<HyperLogLogMergeImpl<Type>>(options);
+}
+
+struct HyperLogLogEstimate {
+  template <typename OutValue, typename Arg0Value>
+  static OutValue Call(KernelContext*, Arg0Value data, Status* st) {
+    auto maybe_sketch = HyperLogLog::Deserialize(data);
+    if (!maybe_sketch.ok()) {
+      *st = maybe_sketch.status();
+      return 0;
+    }
+    return static_cast<OutValue>(std::llround(maybe_sketch->Estimate()));
+  }
+};
+
+const FunctionDoc approx_count_distinct_doc{
+    "Approximate number of distinct values with the HyperLogLog algorithm",
+    ("Null values are ignored.\n"
+     "NaNs and signed zeroes are not normalized.\n"
+     "The relative standard error is about 1.04 / sqrt(2^precision) and only\n"
+     "2^precision bytes of memory are used, whatever the number of values."),
+    {"array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hll_sketch_doc{
+    "Serialized HyperLogLog sketch of the distinct values of an array",
+    ("The binary result can be stored, merged with other sketches of the same\n"
+     "precision by \"hll_merge\" and turned into a distinct count by\n"
+     "\"hll_estimate\".\n"
+     "Null values are ignored."),
+    {"array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hll_merge_doc{
+    "Merge serialized HyperLogLog sketches into one",
+    ("Null sketches are ignored.\n"
+     "An error is returned if a sketch does not have the precision given in\n"
+     "ApproxCountDistinctOptions."),
+    {"sketches"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hll_estimate_doc{
+    "Approximate number of distinct values of serialized HyperLogLog sketches",
+    ("Null sketches emit null."),
+    {"sketches"}};
+
+}  // namespace
+
+void RegisterScalarAggregateHyperLogLog(FunctionRegistry* registry) {
+  static auto default_options = ApproxCountDistinctOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct", Arity::Unary(), approx_count_distinct_doc,
+      &default_options);
+  AddAggKernel(KernelSignature::Make({InputType::Any()}, int64()),
+               ApproxCountDistinctInit</*EmitSketch=*/false>, func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<ScalarAggregateFunction>("hll_sketch", Arity::Unary(),
+                                                   hll_sketch_doc, &default_options);
+  AddAggKernel(KernelSignature::Make({InputType::Any()}, binary()),
+               ApproxCountDistinctInit</*EmitSketch=*/true>, func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<ScalarAggregateFunction>("hll_merge", Arity::Unary(),
+                                                   hll_merge_doc, &default_options);
+  AddAggKernel(KernelSignature::Make({InputType(Type::BINARY)}, binary()),
+               HyperLogLogMergeInit<BinaryType>, func.get());
+  AddAggKernel(KernelSignature::Make({InputType(Type::LARGE_BINARY)}, binary()),
+               HyperLogLogMergeInit<LargeBinaryType>, func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  auto estimate = std::make_shared<ScalarFunction>("hll_estimate", Arity::Unary(),
+                                                   hll_estimate_doc);
+  DCHECK_OK(estimate->AddKernel(
+      {InputType(Type::BINARY)}, int64(),
+      applicator::ScalarUnaryNotNull<Int64Type, BinaryType, HyperLogLogEstimate>::Exec));
+  DCHECK_OK(estimate->AddKernel(
+      {InputType(Type::LARGE_BINARY)}, int64(),
+      applicator::ScalarUnaryNotNull<Int64Type, LargeBinaryType,
+                                     HyperLogLogEstimate>::Exec));
+  DCHECK_OK(registry->AddFunction(std::move(estimate)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
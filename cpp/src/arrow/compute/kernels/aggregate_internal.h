@@ -24,8 +24,11 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_run_reader.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/int128_internal.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/visit_data_inline.h"
 
 namespace arrow::compute::internal {
 
@@ -255,4 +258,76 @@ SumType SumArray(const ArraySpan& data) {
       data, [](ValueType v) { return static_cast<SumType>(v); });
 }
 
+// Helpers for aggregations on the hashes of the values
+
+// Whether VisitValueHashes supports arrays of the given type
+inline bool CanHashValues(const DataType& type) {
+  return type.id() == Type::NA || is_base_binary_like(type.id()) ||
+         is_binary_view_like(type.id()) ||
+         (is_fixed_width(type.id()) && !is_dictionary(type.id()));
+}
+
+template <typename Type, typename Visit>
+Status VisitBinaryValueHashes(const ArraySpan& data, Visit&& visit) {
+  int64_t i = 0;
+  return VisitArraySpanInline<Type>(
+      data,
+      [&](std::string_view value) {
+        visit(i++, ::arrow::internal::ComputeStringHash<0>(
+                       value.data(), static_cast<int64_t>(value.size())));
+        return Status::OK();
+      },
+      [&]() {
+        ++i;
+        return Status::OK();
+      });
+}
+
+// Calls visit(i, hash) for each non-null value i of the array, equal values having
+// equal hashes.  NaNs and signed zeroes are not normalized.
+template <typename Visit>
+Status VisitValueHashes(const ArraySpan& data, Visit&& visit) {
+  using ::arrow::internal::ComputeStringHash;
+  using ::arrow::internal::VisitSetBitRunsVoid;
+
+  const Type::type type_id = data.type->id();
+  if (type_id == Type::NA) {
+    return Status::OK();
+  }
+  if (type_id == Type::BOOL) {
+    VisitSetBitRunsVoid(data.buffers[0].data, data.offset, data.length,
+                        [&](int64_t pos, int64_t len) {
+                          for (int64_t i = pos; i < pos + len; ++i) {
+                            const uint8_t value = bit_util::GetBit(
+                                data.buffers[1].data, data.offset + i);
+                            visit(i, ComputeStringHash<0>(&value, 1));
+                          }
+                        });
+    return Status::OK();
+  }
+  if (is_binary_like(type_id)) {
+    return VisitBinaryValueHashes<BinaryType>(data, std::forward<Visit>(visit));
+  }
+  if (is_large_binary_like(type_id)) {
+    return VisitBinaryValueHashes<LargeBinaryType>(data, std::forward<Visit>(visit));
+  }
+  if (is_binary_view_like(type_id)) {
+    return VisitBinaryValueHashes<BinaryViewType>(data, std::forward<Visit>(visit));
+  }
+  if (!CanHashValues(*data.type)) {
+    return Status::NotImplemented("Hashing values of type ", data.type->ToString());
+  }
+  const int64_t byte_width =
+      ::arrow::internal::checked_cast<const FixedWidthType&>(*data.type).byte_width();
+  const uint8_t* values = data.buffers[1].data + data.offset * byte_width;
+  VisitSetBitRunsVoid(data.buffers[0].data, data.offset, data.length,
+                      [&](int64_t pos, int64_t len) {
+                        for (int64_t i = pos; i < pos + len; ++i) {
+                          visit(i, ComputeStringHash<0>(values + i * byte_width,
+                                                        byte_width));
+                        }
+                      });
+  return Status::OK();
+}
+
 }  // namespace arrow::compute::internal
@@ -15,8 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_nested.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
 #include "arrow/compute/registry_internal.h"
 #include "arrow/util/bit_run_reader.h"
@@ -37,12 +41,13 @@ struct TDigestImpl : public ScalarAggregator {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
   using CType = typename TypeTraits<ArrowType>::CType;
 
-  TDigestImpl(const TDigestOptions& options, const DataType& in_type)
+  TDigestImpl(const TDigestOptions& options, const DataType& in_type, bool emit_sketch)
       : options{options},
         tdigest{options.delta, options.buffer_size},
         count{0},
         decimal_scale{0},
-        all_valid{true} {
+        all_valid{true},
+        emit_sketch{emit_sketch} {
     if (is_decimal_type<ArrowType>::value) {
       decimal_scale = checked_cast<const DecimalType&>(in_type).scale();
     }
@@ -100,6 +105,15 @@ struct TDigestImpl : public ScalarAggregator {
   }
 
   Status Finalize(KernelContext* ctx, Datum* out) override {
+    if (emit_sketch) {
+      // The sketch is emitted whatever the count, so that it can still be merged
+      if (!this->all_valid) {
+        *out = MakeNullScalar(binary());
+      } else {
+        *out = std::make_shared<BinaryScalar>(Buffer::FromString(tdigest.Serialize()));
+      }
+      return Status::OK();
+    }
     const int64_t out_length = options.q.size();
     auto out_data = ArrayData::Make(float64(), out_length, 0);
     out_data->buffers.resize(2, nullptr);
@@ -127,17 +141,103 @@ struct TDigestImpl : public ScalarAggregator {
   int64_t count;
   int32_t decimal_scale;
   bool all_valid;
+  const bool emit_sketch;
+};
+
+// Merges serialized t-digests, ignoring nulls
+template <typename Type>
+struct TDigestMergeImpl : public ScalarAggregator {
+  explicit TDigestMergeImpl(const TDigestOptions& options)
+      : tdigest{options.delta, options.buffer_size} {}
+
+  Status MergeSketch(std::string_view sketch) {
+    ARROW_ASSIGN_OR_RAISE(auto other, TDigest::Deserialize(sketch));
+    tdigest.Merge(other);
+    return Status::OK();
+  }
+
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    if (batch[0].is_array()) {
+      return VisitArraySpanInline<Type>(
+          batch[0].array, [&](std::string_view sketch) { return MergeSketch(sketch); },
+          [] { return Status::OK(); });
+    }
+    const Scalar& scalar = *batch[0].scalar;
+    if (!scalar.is_valid) return Status::OK();
+    const std::string_view sketch = UnboxScalar<Type>::Unbox(scalar);
+    for (int64_t i = 0; i < batch.length; ++i) {
+      RETURN_NOT_OK(MergeSketch(sketch));
+    }
+    return Status::OK();
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    tdigest.Merge(checked_cast<const TDigestMergeImpl&>(src).tdigest);
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext*, Datum* out) override {
+    *out = std::make_shared<BinaryScalar>(Buffer::FromString(tdigest.Serialize()));
+    return Status::OK();
+  }
+
+  TDigest tdigest;
+};
+
+template <typename Type>
+Result<std::unique_ptr<KernelState>> TDigestMergeInit(KernelContext*,
+                                                      const KernelInitArgs& args) {
+  return std::make_unique<TDigestMergeImpl<Type>>(
+      checked_cast<const TDigestOptions&>(*args.options));
+}
+
+// Approximate quantiles of each serialized t-digest, as a fixed size list
+template <typename Type>
+struct TDigestQuantile {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& options = OptionsWrapper<TDigestOptions>::Get(ctx);
+    const auto num_quantiles = static_cast<int64_t>(options.q.size());
+    auto value_builder = std::make_shared<DoubleBuilder>(ctx->memory_pool());
+    FixedSizeListBuilder builder(ctx->memory_pool(), value_builder,
+                                 fixed_size_list(float64(), num_quantiles));
+    RETURN_NOT_OK(builder.Reserve(batch.length));
+    RETURN_NOT_OK(value_builder->Reserve(batch.length * num_quantiles));
+    RETURN_NOT_OK(VisitArraySpanInline<Type>(
+        batch[0].array,
+        [&](std::string_view sketch) {
+          ARROW_ASSIGN_OR_RAISE(auto tdigest, TDigest::Deserialize(sketch));
+          RETURN_NOT_OK(builder.Append());
+          if (tdigest.is_empty()) {
+            return value_builder->AppendNulls(num_quantiles);
+          }
+          for (double q : options.q) {
+            value_builder->UnsafeAppend(tdigest.Quantile(q));
+          }
+          return Status::OK();
+        },
+        [&]() { return builder.AppendNull(); }));
+    ARROW_ASSIGN_OR_RAISE(auto result, builder.Finish());
+    out->value = result->data();
+    return Status::OK();
+  }
 };
 
+Result<TypeHolder> ResolveTDigestQuantileOutput(KernelContext* ctx,
+                                                const std::vector<TypeHolder>&) {
+  const auto& options = OptionsWrapper<TDigestOptions>::Get(ctx);
+  return fixed_size_list(float64(), static_cast<int32_t>(options.q.size()));
+}
+
 struct TDigestInitState {
   std::unique_ptr<KernelState> state;
   KernelContext* ctx;
   const DataType& in_type;
   const TDigestOptions& options;
+  const bool emit_sketch;
 
   TDigestInitState(KernelContext* ctx, const DataType& in_type,
-                   const TDigestOptions& options)
-      : ctx(ctx), in_type(in_type), options(options) {}
+                   const TDigestOptions& options, bool emit_sketch)
+      : ctx(ctx), in_type(in_type), options(options), emit_sketch(emit_sketch) {}
 
   Status Visit(const DataType&) {
     return Status::NotImplemented("No tdigest implemented");
@@ -149,13 +249,13 @@ struct TDigestInitState {
 
   template <typename Type>
   enable_if_number<Type, Status> Visit(const Type&) {
-    state.reset(new TDigestImpl<Type>(options, in_type));
+    state.reset(new TDigestImpl<Type>(options, in_type, emit_sketch));
     return Status::OK();
   }
 
   template <typename Type>
   enable_if_decimal<Type, Status> Visit(const Type&) {
-    state.reset(new TDigestImpl<Type>(options, in_type));
+    state.reset(new TDigestImpl<Type>(options, in_type, emit_sketch));
     return Status::OK();
   }
 
@@ -168,15 +268,25 @@ struct TDigestInitState {
 Result<std::unique_ptr<KernelState>> TDigestInit(KernelContext* ctx,
                                                  const KernelInitArgs& args) {
   TDigestInitState visitor(ctx, *args.inputs[0].type,
-                           static_cast<const TDigestOptions&>(*args.options));
+                           static_cast<const TDigestOptions&>(*args.options),
+                           /*emit_sketch=*/false);
+  return visitor.Create();
+}
+
+Result<std::unique_ptr<KernelState>> TDigestSketchInit(KernelContext* ctx,
+                                                       const KernelInitArgs& args) {
+  TDigestInitState visitor(ctx, *args.inputs[0].type,
+                           static_cast<const TDigestOptions&>(*args.options),
+                           /*emit_sketch=*/true);
   return visitor.Create();
 }
 
 void AddTDigestKernels(KernelInit init,
                        const std::vector<std::shared_ptr<DataType>>& types,
-                       ScalarAggregateFunction* func) {
+                       ScalarAggregateFunction* func,
+                       const std::shared_ptr<DataType>& out_type = float64()) {
   for (const auto& ty : types) {
-    auto sig = KernelSignature::Make({InputType(ty->id())}, float64());
+    auto sig = KernelSignature::Make({InputType(ty->id())}, out_type);
     AddAggKernel(std::move(sig), init, func);
   }
 }
@@ -189,6 +299,32 @@ const FunctionDoc tdigest_doc{
     {"array"},
     "TDigestOptions"};
 
+const FunctionDoc tdigest_sketch_doc{
+    "Serialized T-Digest of a numeric array",
+    ("The binary result can be stored, merged with other sketches by\n"
+     "\"tdigest_merge\" and turned into quantiles by \"tdigest_quantile\".\n"
+     "Nulls and NaNs are ignored, unless skip_nulls is false in which case\n"
+     "a null is returned if there is any null.\n"
+     "The quantiles and min_count in TDigestOptions are not used."),
+    {"array"},
+    "TDigestOptions"};
+
+const FunctionDoc tdigest_merge_doc{
+    "Merge serialized T-Digests into one",
+    ("Null sketches are ignored.\n"
+     "The delta and buffer_size in TDigestOptions are used for the merged\n"
+     "sketch."),
+    {"sketches"},
+    "TDigestOptions"};
+
+const FunctionDoc tdigest_quantile_doc{
+    "Approximate quantiles of serialized T-Digests",
+    ("For each sketch, a list of the quantiles given in TDigestOptions is\n"
+     "emitted, or nulls if the sketch is empty.\n"
+     "Null sketches emit null."),
+    {"sketches"},
+    "TDigestOptions"};
+
 const FunctionDoc approximate_median_doc{
     "Approximate median of a numeric array with T-Digest algorithm",
     ("Nulls and NaNs are ignored.\n"
@@ -242,12 +378,54 @@ std::shared_ptr<ScalarAggregateFunction> AddApproximateMedianAggKernels(
   return median;
 }
 
+std::shared_ptr<ScalarAggregateFunction> AddTDigestSketchAggKernels() {
+  static auto default_tdigest_options = TDigestOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "tdigest_sketch", Arity::Unary(), tdigest_sketch_doc, &default_tdigest_options);
+  AddTDigestKernels(TDigestSketchInit, NumericTypes(), func.get(), binary());
+  AddTDigestKernels(TDigestSketchInit, {decimal128(1, 1), decimal256(1, 1)}, func.get(),
+                    binary());
+  return func;
+}
+
+std::shared_ptr<ScalarAggregateFunction> AddTDigestMergeAggKernels() {
+  static auto default_tdigest_options = TDigestOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "tdigest_merge", Arity::Unary(), tdigest_merge_doc, &default_tdigest_options);
+  AddAggKernel(KernelSignature::Make({InputType(Type::BINARY)}, binary()),
+               TDigestMergeInit<BinaryType>, func.get());
+  AddAggKernel(KernelSignature::Make({InputType(Type::LARGE_BINARY)}, binary()),
+               TDigestMergeInit<LargeBinaryType>, func.get());
+  return func;
+}
+
+std::shared_ptr<ScalarFunction> AddTDigestQuantileKernels() {
+  static auto default_tdigest_options = TDigestOptions::Defaults();
+  auto func = std::make_shared<ScalarFunction>("tdigest_quantile", Arity::Unary(),
+                                               tdigest_quantile_doc,
+                                               &default_tdigest_options);
+  auto add_kernel = [&](Type::type type_id, ArrayKernelExec exec) {
+    ScalarKernel kernel({InputType(type_id)}, OutputType(ResolveTDigestQuantileOutput),
+                        exec, OptionsWrapper<TDigestOptions>::Init);
+    kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  };
+  add_kernel(Type::BINARY, TDigestQuantile<BinaryType>::Exec);
+  add_kernel(Type::LARGE_BINARY, TDigestQuantile<LargeBinaryType>::Exec);
+  return func;
+}
+
 }  // namespace
 
 void RegisterScalarAggregateTDigest(FunctionRegistry* registry) {
   auto tdigest = AddTDigestAggKernels();
   DCHECK_OK(registry->AddFunction(tdigest));
 
+  DCHECK_OK(registry->AddFunction(AddTDigestSketchAggKernels()));
+  DCHECK_OK(registry->AddFunction(AddTDigestMergeAggKernels()));
+  DCHECK_OK(registry->AddFunction(AddTDigestQuantileKernels()));
+
   auto approx_median = AddApproximateMedianAggKernels(tdigest.get());
   DCHECK_OK(registry->AddFunction(approx_median));
 }
@@ -951,6 +951,64 @@ TEST(TestCountKernel, RunEndEncodedNulls) {
   ValidateCount(*array->Slice(3, 6), {3, 3});
 }
 
+TEST(TestRunEndEncodedAggregation, Basics) {
+  auto input = ArrayFromJSON(int32(), "[1, 1, 1, null, null, 5, 2, 2, 2, 2, 4]");
+  ASSERT_OK_AND_ASSIGN(auto encoded, RunEndEncode(input));
+  auto array = encoded.make_array();
+
+  // Runs are weighted by their length
+  for (std::string name : {"sum", "mean", "min_max", "min", "max"}) {
+    ARROW_SCOPED_TRACE(name);
+    for (const auto& [offset, length] : std::vector<std::pair<int64_t, int64_t>>{
+             {0, input->length()}, {2, 5}, {4, 1}, {3, 2}}) {
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           CallFunction(name, {input->Slice(offset, length)}));
+      ASSERT_OK_AND_ASSIGN(Datum actual,
+                           CallFunction(name, {array->Slice(offset, length)}));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    }
+    ASSERT_OK_AND_ASSIGN(
+        Datum expected,
+        CallFunction(name, {std::make_shared<ChunkedArray>(
+                               ArrayVector{input->Slice(0, 4), input->Slice(4)})}));
+    ASSERT_OK_AND_ASSIGN(
+        Datum actual,
+        CallFunction(name, {std::make_shared<ChunkedArray>(
+                               ArrayVector{array->Slice(0, 4), array->Slice(4)})}));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+
+  EXPECT_THAT(Sum(encoded), ResultWith(Datum(int64_t(20))));
+  ScalarAggregateOptions min_count(/*skip_nulls=*/true, /*min_count=*/12);
+  EXPECT_THAT(Sum(encoded, min_count), ResultWith(Datum(MakeNullScalar(int64()))));
+}
+
+TEST(TestRunEndEncodedAggregation, MinCount) {
+  // Each run counts its length towards min_count
+  std::vector<std::shared_ptr<Array>> inputs = {
+      ArrayFromJSON(int32(), "[1, 1, 1, null, null, 5, 2, 2, 2, 2, 4]"),
+      ArrayFromJSON(float64(), "[1.5, 1.5, 1.5, null, null, 5, 2, 2, 2, 2, 4]"),
+      ArrayFromJSON(boolean(),
+                    "[true, true, true, null, null, false, true, true, true, true, "
+                    "false]")};
+  for (const auto& input : inputs) {
+    ARROW_SCOPED_TRACE(input->type()->ToString());
+    ASSERT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(input));
+    for (uint32_t min_count : {9, 10}) {
+      ARROW_SCOPED_TRACE("min_count = ", min_count);
+      ScalarAggregateOptions options(/*skip_nulls=*/true, min_count);
+      for (std::string name : {"min_max", "min", "max"}) {
+        ARROW_SCOPED_TRACE(name);
+        ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(name, {input}, &options));
+        ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(name, {encoded}, &options));
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+      ASSERT_OK_AND_ASSIGN(Datum min_max, MinMax(encoded, options));
+      ASSERT_EQ(min_max.scalar_as<StructScalar>().value[0]->is_valid, min_count == 9);
+    }
+  }
+}
+
 TEST(TestCountKernel, SparseUnionSlicedNulls) {
   // GH-50113: Sliced unions can report incorrect null counts in count.
   auto type_ids = ArrayFromJSON(int8(), "[0, 1, 0, 0, 1, 1]");
@@ -1212,6 +1270,77 @@ TEST_F(TestCountDistinctKernel, Random) {
   Check(input, memo.size(), false);
 }
 
+//
+// Approximate Count Distinct
+//
+
+class TestApproxCountDistinctKernel : public ::testing::Test {
+ protected:
+  // The estimates of small distinct counts are exact
+  void Check(Datum input, int64_t expected) {
+    CheckScalar("approx_count_distinct", {input}, Datum(expected));
+  }
+
+  void Check(const std::shared_ptr<DataType>& type, std::string_view json,
+             int64_t expected) {
+    Check(ArrayFromJSON(type, json), expected);
+  }
+};
+
+TEST_F(TestApproxCountDistinctKernel, ArrayTypes) {
+  Check(null(), "[null, null]", 0);
+  Check(boolean(), "[true, null, false, false]", 2);
+  for (auto ty : NumericTypes()) {
+    Check(ty, "[]", 0);
+    Check(ty, "[1, 1, null, 2, 5, 8, 9, 9, null, 10, 6, 6]", 7);
+  }
+  for (auto u : TimeUnit::values()) {
+    Check(timestamp(u), R"(["2009-12-31T04:20:20", null, "2009-12-31T04:20:20"])", 1);
+  }
+  Check(month_day_nano_interval(), "[[0, 1, 2], [0, 1, 2], [0, 1, 3]]", 2);
+  auto samples = R"(["abc", "abc", "", null, "abcdefghijklmnopqrstuvwxyz", ""])";
+  for (auto ty : BaseBinaryTypes()) {
+    Check(ty, samples, 3);
+  }
+  Check(binary_view(), samples, 3);
+  Check(fixed_size_binary(3), R"(["abc", null, "abd", "abc"])", 2);
+  Check(decimal128(21, 3), R"(["12345.679", "98765.421", null, "12345.679"])", 2);
+}
+
+TEST_F(TestApproxCountDistinctKernel, ScalarsAndChunkedArrays) {
+  Check(ScalarFromJSON(utf8(), R"("abc")"), 1);
+  Check(ScalarFromJSON(int32(), "null"), 0);
+  Check(ChunkedArrayFromJSON(int64(), {"[1, 2, null]", "[]", "[2, 3, 1]"}), 3);
+}
+
+TEST_F(TestApproxCountDistinctKernel, Estimate) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  auto input = rand.Int64(100000, 0, 60000, /*null_probability=*/0.1);
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("count_distinct", {input}));
+  const auto expected_count = expected.scalar_as<Int64Scalar>().value;
+  for (int32_t precision : {10, 14}) {
+    ApproxCountDistinctOptions options(precision);
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         CallFunction("approx_count_distinct", {input}, &options));
+    // Allow for 4 standard errors
+    const double tolerance = 4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    ASSERT_NEAR(static_cast<double>(actual.scalar_as<Int64Scalar>().value),
+                static_cast<double>(expected_count), tolerance * expected_count);
+  }
+}
+
+TEST_F(TestApproxCountDistinctKernel, Errors) {
+  auto input = ArrayFromJSON(int32(), "[1, 2]");
+  ApproxCountDistinctOptions options(/*precision=*/3);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("precision must be between 4 and 18"),
+      CallFunction("approx_count_distinct", {input}, &options));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("approx_count_distinct for type list"),
+      CallFunction("approx_count_distinct",
+                   {ArrayFromJSON(list(int32()), "[[1], [2]]")}));
+}
+
 //
 // Mean
 //
@@ -4590,6 +4719,88 @@ TEST(TestTDigestKernel, ApproximateMedian) {
   }
 }
 
+TEST(TestTDigestKernel, Sketch) {
+  TDigestOptions options(std::vector<double>{0.0, 0.5, 1.0});
+  const std::vector<std::string> chunks = {"[1, 2, null]", "[]", "[3, 4, 5, 6]"};
+  BinaryBuilder builder;
+  for (const auto& json : chunks) {
+    ASSERT_OK_AND_ASSIGN(
+        Datum sketch,
+        CallFunction("tdigest_sketch", {ArrayFromJSON(float64(), json)}, &options));
+    ASSERT_OK(builder.AppendScalar(*sketch.scalar()));
+  }
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK_AND_ASSIGN(auto sketches, builder.Finish());
+
+  // Quantiles of each sketch, an empty sketch emits nulls
+  ASSERT_OK_AND_ASSIGN(auto first, TDigest(ArrayFromJSON(float64(), chunks[0]), options));
+  ASSERT_OK_AND_ASSIGN(auto last, TDigest(ArrayFromJSON(float64(), chunks[2]), options));
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       CallFunction("tdigest_quantile", {sketches}, &options));
+  ValidateOutput(actual);
+  ASSERT_EQ(actual.length(), 4);
+  AssertArraysApproxEqual(*first.make_array(),
+                          *actual.array_as<FixedSizeListArray>()->value_slice(0));
+  AssertArraysApproxEqual(*last.make_array(),
+                          *actual.array_as<FixedSizeListArray>()->value_slice(2));
+  ASSERT_TRUE(actual.make_array()->IsValid(1));
+  ASSERT_EQ(actual.array_as<FixedSizeListArray>()->value_slice(1)->null_count(), 3);
+  ASSERT_TRUE(actual.make_array()->IsNull(3));
+
+  // Merged sketches give the quantiles of all the values
+  ASSERT_OK_AND_ASSIGN(Datum merged, CallFunction("tdigest_merge", {sketches}, &options));
+  ASSERT_OK_AND_ASSIGN(auto all,
+                       TDigest(ChunkedArrayFromJSON(float64(), chunks), options));
+  ASSERT_OK_AND_ASSIGN(Datum merged_quantiles,
+                       CallFunction("tdigest_quantile", {merged}, &options));
+  AssertArraysApproxEqual(
+      *all.make_array(),
+      *checked_cast<const FixedSizeListScalar&>(*merged_quantiles.scalar()).value);
+
+  // Nulls are propagated unless skipped
+  TDigestOptions keep_nulls = options;
+  keep_nulls.skip_nulls = false;
+  EXPECT_THAT(CallFunction("tdigest_sketch", {ArrayFromJSON(int32(), "[1, null]")},
+                           &keep_nulls),
+              ResultWith(Datum(MakeNullScalar(binary()))));
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid serialized tdigest"),
+      CallFunction("tdigest_merge", {ArrayFromJSON(binary(), R"(["abc"])")}));
+}
+
+TEST_F(TestApproxCountDistinctKernel, Sketch) {
+  const std::vector<std::string> chunks = {"[1, 2, null, 2]", "[]", "[3, 1, 4, 5]"};
+  ApproxCountDistinctOptions options(/*precision=*/10);
+  BinaryBuilder builder;
+  for (const auto& json : chunks) {
+    ASSERT_OK_AND_ASSIGN(Datum sketch, CallFunction("hll_sketch",
+                                                    {ArrayFromJSON(int64(), json)},
+                                                    &options));
+    ASSERT_OK(builder.AppendScalar(*sketch.scalar()));
+  }
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK_AND_ASSIGN(auto sketches, builder.Finish());
+
+  CheckScalar("hll_estimate", {sketches}, ArrayFromJSON(int64(), "[2, 0, 4, null]"));
+  ASSERT_OK_AND_ASSIGN(Datum merged, CallFunction("hll_merge", {sketches}, &options));
+  CheckScalar("hll_estimate", {merged}, Datum(int64_t{5}));
+
+  // The merged sketch is the sketch of all the values
+  ASSERT_OK_AND_ASSIGN(
+      Datum all,
+      CallFunction("hll_sketch", {ChunkedArrayFromJSON(int64(), chunks)}, &options));
+  AssertDatumsEqual(all, merged);
+
+  ApproxCountDistinctOptions other_precision(/*precision=*/12);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("precision"),
+      CallFunction("hll_merge", {sketches}, &other_precision));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("HyperLogLog"),
+      CallFunction("hll_estimate", {ArrayFromJSON(binary(), R"(["abc"])")}));
+}
+
 //
 // Pivot
 //
@@ -95,6 +95,14 @@ void EnsureDictionaryDecoded(TypeHolder* begin, size_t count) {
   }
 }
 
+void EnsureRunEndDecoded(std::vector<TypeHolder>* types) {
+  for (auto& type : *types) {
+    if (type.id() == Type::RUN_END_ENCODED) {
+      type = checked_cast<const RunEndEncodedType&>(*type).value_type();
+    }
+  }
+}
+
 void ReplaceNullWithOtherType(std::vector<TypeHolder>* types) {
   ReplaceNullWithOtherType(types->data(), types->size());
 }
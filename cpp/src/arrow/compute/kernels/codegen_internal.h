@@ -1451,6 +1451,11 @@ void EnsureDictionaryDecoded(std::vector<TypeHolder>* types);
 ARROW_EXPORT
 void EnsureDictionaryDecoded(TypeHolder* begin, size_t count);
 
+// Replace run-end encoded types by their value types, which the scalar executor
+// evaluates per run (see compute::detail::CanExecuteOnRunEndValues)
+ARROW_EXPORT
+void EnsureRunEndDecoded(std::vector<TypeHolder>* types);
+
 ARROW_EXPORT
 void ReplaceNullWithOtherType(std::vector<TypeHolder>* types);
 
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
@@ -43,6 +44,7 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_writer.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/hyperloglog_internal.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/ree_util.h"
 #include "arrow/visit_type_inline.h"
@@ -51,6 +53,7 @@ namespace arrow::compute::internal {
 
 using ::arrow::internal::checked_cast;
 using ::arrow::internal::FirstTimeBitmapWriter;
+using ::arrow::internal::HyperLogLog;
 
 namespace {
 
@@ -1549,6 +1552,106 @@ Result<std::unique_ptr<KernelState>> GroupedDistinctInit(KernelContext* ctx,
   return impl;
 }
 
+// ----------------------------------------------------------------------
+// ApproxCountDistinct implementation
+
+struct GroupedApproxCountDistinctImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    pool_ = ctx->memory_pool();
+    options_ = checked_cast<const ApproxCountDistinctOptions&>(*args.options);
+    RETURN_NOT_OK(HyperLogLog::ValidatePrecision(options_.precision));
+    if (!CanHashValues(*args.inputs[0].type)) {
+      return Status::NotImplemented("hash_approx_count_distinct for type ",
+                                    args.inputs[0].type->ToString());
+    }
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    sketches_.resize(new_num_groups, HyperLogLog(options_.precision));
+    return Status::OK();
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    const auto* g = batch[1].array.GetValues<uint32_t>(1);
+    if (batch[0].is_array()) {
+      return VisitValueHashes(batch[0].array, [&](int64_t i, uint64_t hash) {
+        sketches_[g[i]].Add(hash);
+      });
+    }
+    return VisitValueHashes(ArraySpan(*batch[0].scalar), [&](int64_t, uint64_t hash) {
+      for (int64_t i = 0; i < batch.length; ++i) {
+        sketches_[g[i]].Add(hash);
+      }
+    });
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedApproxCountDistinctImpl*>(&raw_other);
+    const auto* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      RETURN_NOT_OK(sketches_[g[other_g]].Merge(other->sketches_[other_g]));
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const auto num_groups = static_cast<int64_t>(sketches_.size());
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(num_groups * sizeof(int64_t), pool_));
+    auto* counts = values->mutable_data_as<int64_t>();
+    for (int64_t i = 0; i < num_groups; ++i) {
+      counts[i] = static_cast<int64_t>(std::llround(sketches_[i].Estimate()));
+    }
+    sketches_.clear();
+    return ArrayData::Make(int64(), num_groups, {nullptr, std::move(values)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+  MemoryPool* pool_;
+  ApproxCountDistinctOptions options_;
+  std::vector<HyperLogLog> sketches_;
+};
+
+// Emits the serialized sketch of each group instead of its estimate
+struct GroupedHyperLogLogSketchImpl : public GroupedApproxCountDistinctImpl {
+  Result<Datum> Finalize() override {
+    BinaryBuilder builder(pool_);
+    RETURN_NOT_OK(builder.Reserve(sketches_.size()));
+    for (const auto& sketch : sketches_) {
+      RETURN_NOT_OK(builder.Append(sketch.Serialize()));
+    }
+    sketches_.clear();
+    ARROW_ASSIGN_OR_RAISE(auto sketches, builder.Finish());
+    return sketches->data();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return binary(); }
+};
+
+// Merges the serialized sketches of each group, ignoring nulls
+template <typename Type>
+struct GroupedHyperLogLogMergeImpl : public GroupedHyperLogLogSketchImpl {
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    pool_ = ctx->memory_pool();
+    options_ = checked_cast<const ApproxCountDistinctOptions&>(*args.options);
+    return HyperLogLog::ValidatePrecision(options_.precision);
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    return VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, std::string_view data) -> Status {
+          ARROW_ASSIGN_OR_RAISE(auto other, HyperLogLog::Deserialize(data));
+          return sketches_[g].Merge(other);
+        },
+        [](uint32_t) { return Status::OK(); });
+  }
+};
+
 // ----------------------------------------------------------------------
 // One implementation
 
@@ -2318,6 +2421,31 @@ const FunctionDoc hash_count_distinct_doc{
     {"array", "group_id_array"},
     "CountOptions"};
 
+const FunctionDoc hash_approx_count_distinct_doc{
+    "Approximate number of distinct values in each group with HyperLogLog",
+    ("Null values are ignored.\n"
+     "NaNs and signed zeroes are not normalized.\n"
+     "The relative standard error is about 1.04 / sqrt(2^precision) and\n"
+     "2^precision bytes of memory are used by each group."),
+    {"array", "group_id_array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hash_hll_sketch_doc{
+    "Serialized HyperLogLog sketch of the distinct values in each group",
+    ("The binary sketches can be stored, merged by \"hash_hll_merge\" or\n"
+     "\"hll_merge\" and turned into distinct counts by \"hll_estimate\".\n"
+     "Null values are ignored."),
+    {"array", "group_id_array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hash_hll_merge_doc{
+    "Merge the serialized HyperLogLog sketches in each group",
+    ("Null sketches are ignored.\n"
+     "An error is returned if a sketch does not have the precision given in\n"
+     "ApproxCountDistinctOptions."),
+    {"sketches", "group_id_array"},
+    "ApproxCountDistinctOptions"};
+
 const FunctionDoc hash_distinct_doc{
     "Keep the distinct values in each group",
     ("Whether nulls/values are kept is controlled by CountOptions.\n"
@@ -2340,6 +2468,8 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
   static const auto default_scalar_aggregate_options = ScalarAggregateOptions::Defaults();
   static const auto default_tdigest_options = TDigestOptions::Defaults();
   static const auto default_variance_options = VarianceOptions::Defaults();
+  static const auto default_approx_count_distinct_options =
+      ApproxCountDistinctOptions::Defaults();
   static const auto default_skew_options = SkewOptions::Defaults();
 
   {
@@ -2450,6 +2580,36 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_approx_count_distinct", Arity::Binary(), hash_approx_count_distinct_doc,
+        &default_approx_count_distinct_options);
+    DCHECK_OK(func->AddKernel(MakeKernel(
+        InputType::Any(), HashAggregateInit<GroupedApproxCountDistinctImpl>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_hll_sketch", Arity::Binary(), hash_hll_sketch_doc,
+        &default_approx_count_distinct_options);
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(InputType::Any(), HashAggregateInit<GroupedHyperLogLogSketchImpl>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_hll_merge", Arity::Binary(), hash_hll_merge_doc,
+        &default_approx_count_distinct_options);
+    DCHECK_OK(func->AddKernel(MakeKernel(
+        Type::BINARY, HashAggregateInit<GroupedHyperLogLogMergeImpl<BinaryType>>)));
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(Type::LARGE_BINARY,
+                   HashAggregateInit<GroupedHyperLogLogMergeImpl<LargeBinaryType>>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
   {
     auto func = std::make_shared<HashAggregateFunction>(
         "hash_distinct", Arity::Binary(), hash_distinct_doc, &default_count_options);
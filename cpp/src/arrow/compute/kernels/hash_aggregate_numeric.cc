@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/array/builder_binary.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernel.h"
@@ -1043,18 +1044,37 @@ struct GroupedTDigestImpl : public GroupedAggregator {
   MemoryPool* pool_;
 };
 
+// Emits the serialized t-digest of each group instead of its quantiles
+template <typename Type>
+struct GroupedTDigestSketchImpl : public GroupedTDigestImpl<Type> {
+  Result<Datum> Finalize() override {
+    BinaryBuilder builder(this->pool_);
+    RETURN_NOT_OK(builder.Reserve(this->tdigests_.size()));
+    for (int64_t i = 0; static_cast<size_t>(i) < this->tdigests_.size(); ++i) {
+      if (this->options_.skip_nulls || bit_util::GetBit(this->no_nulls_.data(), i)) {
+        RETURN_NOT_OK(builder.Append(this->tdigests_[i].Serialize()));
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto sketches, builder.Finish());
+    return sketches->data();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return binary(); }
+};
+
+template <template <typename> class GroupedImpl>
 struct GroupedTDigestFactory {
   template <typename T>
   enable_if_number<T, Status> Visit(const T&) {
-    kernel =
-        MakeKernel(std::move(argument_type), HashAggregateInit<GroupedTDigestImpl<T>>);
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<GroupedImpl<T>>);
     return Status::OK();
   }
 
   template <typename T>
   enable_if_decimal<T, Status> Visit(const T&) {
-    kernel =
-        MakeKernel(std::move(argument_type), HashAggregateInit<GroupedTDigestImpl<T>>);
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<GroupedImpl<T>>);
     return Status::OK();
   }
 
@@ -1067,7 +1087,7 @@ struct GroupedTDigestFactory {
   }
 
   static Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
-    GroupedTDigestFactory factory;
+    GroupedTDigestFactory<GroupedImpl> factory;
     factory.argument_type = type->id();
     RETURN_NOT_OK(VisitTypeInline(*type, &factory));
     return std::move(factory.kernel);
@@ -1077,6 +1097,62 @@ struct GroupedTDigestFactory {
   InputType argument_type;
 };
 
+// Merges the serialized t-digests of each group, ignoring nulls
+template <typename Type>
+struct GroupedTDigestMergeImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    options_ = *checked_cast<const TDigestOptions*>(args.options);
+    pool_ = ctx->memory_pool();
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    const int64_t added_groups = new_num_groups - tdigests_.size();
+    tdigests_.reserve(new_num_groups);
+    for (int64_t i = 0; i < added_groups; i++) {
+      tdigests_.emplace_back(options_.delta, options_.buffer_size);
+    }
+    return Status::OK();
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    return VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, std::string_view sketch) -> Status {
+          ARROW_ASSIGN_OR_RAISE(auto other, TDigest::Deserialize(sketch));
+          tdigests_[g].Merge(other);
+          return Status::OK();
+        },
+        [](uint32_t) { return Status::OK(); });
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedTDigestMergeImpl*>(&raw_other);
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      tdigests_[*g].Merge(other->tdigests_[other_g]);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    BinaryBuilder builder(pool_);
+    RETURN_NOT_OK(builder.Reserve(tdigests_.size()));
+    for (const auto& tdigest : tdigests_) {
+      RETURN_NOT_OK(builder.Append(tdigest.Serialize()));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto sketches, builder.Finish());
+    return sketches->data();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return binary(); }
+
+  TDigestOptions options_;
+  std::vector<TDigest> tdigests_;
+  MemoryPool* pool_;
+};
+
 HashAggregateKernel MakeApproximateMedianKernel(HashAggregateFunction* tdigest_func) {
   HashAggregateKernel kernel;
   kernel.init = [tdigest_func](
@@ -1170,6 +1246,21 @@ const FunctionDoc hash_tdigest_doc{
     {"array", "group_id_array"},
     "TDigestOptions"};
 
+const FunctionDoc hash_tdigest_sketch_doc{
+    "Compute the serialized T-Digest of values in each group",
+    ("The binary sketches can be stored, merged by \"hash_tdigest_merge\"\n"
+     "or \"tdigest_merge\" and turned into quantiles by \"tdigest_quantile\".\n"
+     "Nulls and NaNs are ignored, unless skip_nulls is false in which case\n"
+     "null is emitted for groups containing a null."),
+    {"array", "group_id_array"},
+    "TDigestOptions"};
+
+const FunctionDoc hash_tdigest_merge_doc{
+    "Merge the serialized T-Digests in each group",
+    ("Null sketches are ignored."),
+    {"sketches", "group_id_array"},
+    "TDigestOptions"};
+
 const FunctionDoc hash_approximate_median_doc{
     "Compute approximate medians of values in each group",
     ("The T-Digest algorithm is used for a fast approximation.\n"
@@ -1265,18 +1356,40 @@ void RegisterHashAggregateNumeric(FunctionRegistry* registry) {
   {
     auto func = std::make_shared<HashAggregateFunction>(
         "hash_tdigest", Arity::Binary(), hash_tdigest_doc, &default_tdigest_options);
-    DCHECK_OK(
-        AddHashAggKernels(SignedIntTypes(), GroupedTDigestFactory::Make, func.get()));
-    DCHECK_OK(
-        AddHashAggKernels(UnsignedIntTypes(), GroupedTDigestFactory::Make, func.get()));
-    DCHECK_OK(
-        AddHashAggKernels(FloatingPointTypes(), GroupedTDigestFactory::Make, func.get()));
+    auto make_kernel = GroupedTDigestFactory<GroupedTDigestImpl>::Make;
+    DCHECK_OK(AddHashAggKernels(SignedIntTypes(), make_kernel, func.get()));
+    DCHECK_OK(AddHashAggKernels(UnsignedIntTypes(), make_kernel, func.get()));
+    DCHECK_OK(AddHashAggKernels(FloatingPointTypes(), make_kernel, func.get()));
     // Type parameters are ignored
-    DCHECK_OK(AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)},
-                                GroupedTDigestFactory::Make, func.get()));
+    DCHECK_OK(
+        AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)}, make_kernel, func.get()));
     tdigest_func = func.get();
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_tdigest_sketch", Arity::Binary(), hash_tdigest_sketch_doc,
+        &default_tdigest_options);
+    auto make_kernel = GroupedTDigestFactory<GroupedTDigestSketchImpl>::Make;
+    DCHECK_OK(AddHashAggKernels(SignedIntTypes(), make_kernel, func.get()));
+    DCHECK_OK(AddHashAggKernels(UnsignedIntTypes(), make_kernel, func.get()));
+    DCHECK_OK(AddHashAggKernels(FloatingPointTypes(), make_kernel, func.get()));
+    // Type parameters are ignored
+    DCHECK_OK(
+        AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)}, make_kernel, func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_tdigest_merge", Arity::Binary(), hash_tdigest_merge_doc,
+        &default_tdigest_options);
+    DCHECK_OK(func->AddKernel(MakeKernel(
+        Type::BINARY, HashAggregateInit<GroupedTDigestMergeImpl<BinaryType>>)));
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(Type::LARGE_BINARY,
+                   HashAggregateInit<GroupedTDigestMergeImpl<LargeBinaryType>>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
   {
     auto func = std::make_shared<HashAggregateFunction>(
         "hash_approximate_median", Arity::Binary(), hash_approximate_median_doc,
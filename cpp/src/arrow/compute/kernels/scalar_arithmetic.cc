@@ -753,6 +753,7 @@ struct ArithmeticFunction : ScalarFunction {
     using arrow::compute::detail::DispatchExactImpl;
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
+    EnsureRunEndDecoded(types);
     EnsureDictionaryDecoded(types);
 
     // Only promote types for binary functions
@@ -808,6 +809,7 @@ struct ArithmeticDecimalToFloatingPointFunction : public ArithmeticFunction {
     using arrow::compute::detail::DispatchExactImpl;
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
+    EnsureRunEndDecoded(types);
     EnsureDictionaryDecoded(types);
 
     if (types->size() == 2) {
@@ -840,6 +842,7 @@ struct ArithmeticIntegerToFloatingPointFunction : public ArithmeticFunction {
     using arrow::compute::detail::DispatchExactImpl;
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
+    EnsureRunEndDecoded(types);
     EnsureDictionaryDecoded(types);
 
     if (types->size() == 2) {
@@ -871,6 +874,7 @@ struct ArithmeticFloatingPointFunction : public ArithmeticFunction {
     using arrow::compute::detail::DispatchExactImpl;
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
+    EnsureRunEndDecoded(types);
     EnsureDictionaryDecoded(types);
 
     if (types->size() == 2) {
@@ -1192,6 +1192,49 @@ TEST(TestBinaryArithmetic, AddWithImplicitCasts) {
                     ArrayFromJSON(int64(), "[3, 5, 7, null]"));
 }
 
+TEST(TestBinaryArithmetic, RunEndEncodedInputs) {
+  auto run_end_encoded = [](const std::string& json) {
+    EXPECT_OK_AND_ASSIGN(auto encoded, RunEndEncode(ArrayFromJSON(int32(), json)));
+    return encoded;
+  };
+  auto left = run_end_encoded("[1, 1, 1, 2, 2, null, null, 3]");
+  auto right = run_end_encoded("[10, 10, 20, 20, 20, 20, 30, 30]");
+
+  // The output keeps the runs common to all arguments
+  ASSERT_OK_AND_ASSIGN(auto sum, CallFunction("add", {left, right}));
+  ASSERT_OK(sum.make_array()->ValidateFull());
+  AssertDatumsEqual(run_end_encoded("[11, 11, 21, 22, 22, null, null, 33]"), sum,
+                    /*verbose=*/true);
+  ASSERT_EQ(sum.array()->child_data[1]->length, 6);
+
+  ASSERT_OK_AND_ASSIGN(sum, CallFunction("add", {left, Datum(int32_t(5))}));
+  AssertDatumsEqual(run_end_encoded("[6, 6, 6, 7, 7, null, null, 8]"), sum,
+                    /*verbose=*/true);
+
+  // The runs are decoded when combined with plain arrays, since the output would
+  // have a run per row
+  auto plain = ArrayFromJSON(int32(), "[0, 1, 2, 3, 4, 5, 6, 7]");
+  ASSERT_OK_AND_ASSIGN(sum, CallFunction("add", {left, plain}));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, 2, 3, 5, 6, null, null, 10]"), sum,
+                    /*verbose=*/true);
+  ASSERT_OK_AND_ASSIGN(sum, CallFunction("add", {left.make_array()->Slice(3),
+                                                 plain->Slice(3)}));
+  ASSERT_OK(sum.make_array()->ValidateFull());
+  AssertDatumsEqual(run_end_encoded("[5, 6, null, null, 10]"), sum, /*verbose=*/true);
+
+  // Sliced input
+  ASSERT_OK_AND_ASSIGN(sum, CallFunction("add", {left.make_array()->Slice(2, 4),
+                                                 right.make_array()->Slice(1, 4)}));
+  AssertDatumsEqual(run_end_encoded("[11, 22, 22, null]"), sum, /*verbose=*/true);
+
+  // Errors are raised for the values of the runs
+  ASSERT_OK_AND_ASSIGN(auto overflowing,
+                       RunEndEncode(ArrayFromJSON(int8(), "[100, 100, 1]")));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("overflow"),
+      CallFunction("add_checked", {overflowing, Datum(int8_t(100))}));
+}
+
 TEST(TestBinaryArithmetic, AddWithImplicitCastsUint64EdgeCase) {
   // int64 is as wide as we can promote
   CheckDispatchBest("add", {int8(), uint64()}, {int64(), int64()});
@@ -3096,6 +3139,26 @@ TYPED_TEST(TestUnaryArithmeticFloating, Sqrt) {
   this->AssertUnaryOpRaises(Sqrt, "[-Inf]", "square root of negative number");
 }
 
+TEST(TestUnaryArithmetic, SqrtDictionaryInput) {
+  auto dict = ArrayFromJSON(float64(), "[4, -1, 9, null]");
+  auto indices = ArrayFromJSON(int8(), "[0, 2, null, 3, 0]");
+  ASSERT_OK_AND_ASSIGN(auto dict_array, DictionaryArray::FromArrays(
+                                            dictionary(int8(), float64()), indices, dict));
+
+  // No index references the invalid dictionary value
+  ASSERT_OK_AND_ASSIGN(Datum sqrt, CallFunction("sqrt_checked", {dict_array}));
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[2, 3, null, null, 2]"), sqrt,
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(dict_array,
+                       DictionaryArray::FromArrays(dictionary(int8(), float64()),
+                                                   ArrayFromJSON(int8(), "[0, 1, 2, 3]"),
+                                                   dict));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid,
+                                  ::testing::HasSubstr("square root of negative number"),
+                                  CallFunction("sqrt_checked", {dict_array}));
+}
+
 TYPED_TEST(TestUnaryArithmeticSigned, Sign) {
   using CType = typename TestFixture::CType;
   constexpr auto min = std::numeric_limits<CType>::min();
@@ -349,6 +349,7 @@ struct CompareFunction : ScalarFunction {
     using arrow::compute::detail::DispatchExactImpl;
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
+    EnsureRunEndDecoded(types);
     EnsureDictionaryDecoded(types);
     ReplaceNullWithOtherType(types);
 
@@ -374,6 +375,7 @@ struct VarArgsCompareFunction : ScalarFunction {
     using arrow::compute::detail::DispatchExactImpl;
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
+    EnsureRunEndDecoded(types);
     EnsureDictionaryDecoded(types);
 
     if (auto type = CommonNumeric(*types)) {
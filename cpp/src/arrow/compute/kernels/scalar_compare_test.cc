@@ -1035,6 +1035,28 @@ TEST(TestCompareKernel, DispatchBest) {
   }
 }
 
+TEST(TestCompareKernel, RunEndEncodedInputs) {
+  auto run_end_encoded = [](const std::shared_ptr<DataType>& type,
+                            const std::string& json) {
+    EXPECT_OK_AND_ASSIGN(auto encoded, RunEndEncode(ArrayFromJSON(type, json)));
+    return encoded;
+  };
+  auto left = run_end_encoded(utf8(), R"(["a", "a", "b", "b", null, "c"])");
+  auto right = run_end_encoded(utf8(), R"(["a", "b", "b", "b", "b", "b"])");
+
+  ASSERT_OK_AND_ASSIGN(auto equal, CallFunction("equal", {left, right}));
+  ASSERT_OK(equal.make_array()->ValidateFull());
+  AssertDatumsEqual(
+      run_end_encoded(boolean(), "[true, false, true, true, null, false]"), equal,
+      /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(auto greater,
+                       CallFunction("greater", {left, Datum(std::string("a"))}));
+  AssertDatumsEqual(
+      run_end_encoded(boolean(), "[false, false, true, true, null, true]"), greater,
+      /*verbose=*/true);
+}
+
 TEST(TestCompareKernel, GreaterWithImplicitCasts) {
   CheckScalarBinary("greater", ArrayFromJSON(int32(), "[0, 1, 2, null]"),
                     ArrayFromJSON(float64(), "[0.5, 1.0, 1.5, 2.0]"),
@@ -17,15 +17,19 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/compute/registry_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/config.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/macros.h"
@@ -34,6 +38,7 @@
 
 #ifdef ARROW_WITH_RE2
 #  include <re2/re2.h>
+#  include <re2/set.h>
 #endif
 
 namespace arrow {
@@ -1220,6 +1225,50 @@ void StringBoolTransform(KernelContext* ctx, const ExecSpan& batch,
   }
 }
 
+// Call `visit(i)` for each value i (out of `length`) containing `literal`.
+//
+// The literal is searched in the whole values buffer at once rather than in each
+// value separately: std::string_view::find relies on the C library's vectorized
+// memchr and memcmp, so that runs of values without the literal are skipped at
+// memory bandwidth instead of paying a call per value.
+template <typename offset_type, typename Visitor>
+void VisitValuesContaining(std::string_view literal, const offset_type* offsets,
+                           const uint8_t* data, int64_t length, Visitor&& visit) {
+  if (literal.empty()) {
+    for (int64_t i = 0; i < length; ++i) {
+      visit(i);
+    }
+    return;
+  }
+  const int64_t base = offsets[0];
+  if (offsets[length] == base) {
+    return;
+  }
+  const std::string_view values(reinterpret_cast<const char*>(data) + base,
+                                static_cast<size_t>(offsets[length] - base));
+  const auto literal_length = static_cast<int64_t>(literal.length());
+  int64_t i = 0;
+  size_t pos = 0;
+  while (i < length) {
+    pos = values.find(literal, pos);
+    if (pos == std::string_view::npos) {
+      break;
+    }
+    const int64_t match_begin = base + static_cast<int64_t>(pos);
+    // The match starts in the last value starting at or before it
+    i = std::upper_bound(offsets + i + 1, offsets + length + 1, match_begin) - offsets -
+        1;
+    // Otherwise the match straddles two values, as would any later match starting in
+    // value i: resume the search at the next value.
+    if (match_begin + literal_length <= offsets[i + 1]) {
+      visit(i);
+    }
+    if (++i < length) {
+      pos = static_cast<size_t>(offsets[i] - base);
+    }
+  }
+}
+
 using MatchSubstringState = OptionsWrapper<MatchSubstringOptions>;
 
 // This is an implementation of the Knuth-Morris-Pratt algorithm
@@ -1311,14 +1360,130 @@ struct PlainEndsWithMatcher {
 };
 
 #ifdef ARROW_WITH_RE2
+/// Return a literal which any (case-sensitive) match of the regex must contain,
+/// or an empty string if none was found.
+///
+/// This is a conservative scan for the longest run of literal characters outside
+/// of groups, character classes and repetitions; patterns with a top-level
+/// alternation, flags or unusual escapes give an empty string.
+std::string RequiredRegexLiteral(std::string_view pattern) {
+  std::string longest, current;
+  auto end_run = [&]() {
+    if (current.length() > longest.length()) {
+      longest = current;
+    }
+    current.clear();
+  };
+  int depth = 0;
+  for (size_t i = 0; i < pattern.length(); ++i) {
+    const char c = pattern[i];
+    if (c == '\\') {
+      if (++i == pattern.length()) {
+        return "";
+      }
+      const char escaped = pattern[i];
+      if (std::isalnum(static_cast<unsigned char>(escaped)) ||
+          static_cast<unsigned char>(escaped) >= 0x80) {
+        // Character classes and assertions end the run, other escapes (\x, \p,
+        // \Q...) aren't worth parsing.
+        if (std::strchr("dDwWsSbBAz", escaped) == nullptr) {
+          return "";
+        }
+        end_run();
+      } else if (depth == 0) {
+        current.push_back(escaped);
+      }
+      continue;
+    }
+    switch (c) {
+      case '(':
+        if (i + 1 < pattern.length() && pattern[i + 1] == '?') {
+          // Flags may change the meaning of what follows
+          return "";
+        }
+        ++depth;
+        end_run();
+        break;
+      case ')':
+        --depth;
+        end_run();
+        break;
+      case '|':
+        if (depth == 0) {
+          return "";
+        }
+        break;
+      case '[':
+        // Skip the character class, whose first character may be a literal ']'
+        ++i;
+        if (i < pattern.length() && pattern[i] == '^') ++i;
+        if (i < pattern.length() && pattern[i] == ']') ++i;
+        while (i < pattern.length() && pattern[i] != ']') {
+          if (pattern[i] == '\\') {
+            ++i;
+          } else if (pattern[i] == '[' && i + 1 < pattern.length() &&
+                     std::strchr(":=.", pattern[i + 1]) != nullptr) {
+            // Skip a nested [:alpha:], [=a=] or [.a.], whose ']' doesn't end the class
+            const char delimiter[] = {pattern[i + 1], ']', '\0'};
+            const size_t close = pattern.find(delimiter, i + 2);
+            if (close == std::string_view::npos) {
+              return "";
+            }
+            i = close + 1;
+          }
+          ++i;
+        }
+        end_run();
+        break;
+      case '*':
+      case '?':
+      case '{':
+        // The previous character may be absent
+        if (!current.empty()) {
+          current.pop_back();
+        }
+        end_run();
+        if (c == '{') {
+          while (i < pattern.length() && pattern[i] != '}') ++i;
+        }
+        break;
+      case '+':
+        // The previous character is present at least once
+        end_run();
+        break;
+      case '.':
+      case '^':
+      case '$':
+        end_run();
+        break;
+      default:
+        if (static_cast<unsigned char>(c) >= 0x80) {
+          // Don't split multi-byte characters
+          end_run();
+        } else if (depth == 0) {
+          current.push_back(c);
+        }
+        break;
+    }
+  }
+  end_run();
+  return longest;
+}
+
 struct RegexSubstringMatcher {
   const MatchSubstringOptions& options_;
   const RE2 regex_match_;
+  // A literal contained in all matching values, to skip the others cheaply
+  std::string required_literal_;
 
   static Result<std::unique_ptr<RegexSubstringMatcher>> Make(
       const MatchSubstringOptions& options, bool is_utf8 = true, bool literal = false) {
     auto matcher = std::make_unique<RegexSubstringMatcher>(options, is_utf8, literal);
     RETURN_NOT_OK(RegexStatus(matcher->regex_match_));
+    if (!options.ignore_case) {
+      matcher->required_literal_ =
+          literal ? options.pattern : RequiredRegexLiteral(options.pattern);
+    }
     return matcher;
   }
 
@@ -1328,6 +1493,8 @@ struct RegexSubstringMatcher {
         regex_match_(options_.pattern,
                      MakeRE2Options(is_utf8, options.ignore_case, literal)) {}
 
+  std::string_view required_literal() const { return required_literal_; }
+
   bool Match(std::string_view current) const {
     auto piece = re2::StringPiece(current.data(), current.length());
     return RE2::PartialMatch(piece, regex_match_);
@@ -1339,8 +1506,12 @@ template <typename Type, typename Matcher>
 struct MatchSubstringImpl {
   using offset_type = typename Type::offset_type;
 
+  // If not empty, `required_literal` must be contained in all matching values
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out,
-                     const Matcher* matcher) {
+                     const Matcher* matcher, std::string_view required_literal = {}) {
+    if (!required_literal.empty()) {
+      return ExecPrefiltered(ctx, batch, out, matcher, required_literal);
+    }
     StringBoolTransform<Type>(
         ctx, batch,
         [&matcher](const void* raw_offsets, const uint8_t* data, int64_t length,
@@ -1360,6 +1531,33 @@ struct MatchSubstringImpl {
         out);
     return Status::OK();
   }
+
+  static Status ExecPrefiltered(KernelContext* ctx, const ExecSpan& batch,
+                                ExecResult* out, const Matcher* matcher,
+                                std::string_view required_literal) {
+    StringBoolTransform<Type>(
+        ctx, batch,
+        [&](const void* raw_offsets, const uint8_t* data, int64_t length,
+            int64_t output_offset, uint8_t* output) {
+          const offset_type* offsets = reinterpret_cast<const offset_type*>(raw_offsets);
+          bit_util::SetBitsTo(output, output_offset, length, false);
+          VisitValuesContaining(
+              required_literal, offsets, data, length, [&](int64_t i) {
+                // Containing the literal is enough for a plain substring match
+                if constexpr (!std::is_same_v<Matcher, PlainSubstringMatcher>) {
+                  const char* current_data =
+                      reinterpret_cast<const char*>(data + offsets[i]);
+                  int64_t current_length = offsets[i + 1] - offsets[i];
+                  if (!matcher->Match(std::string_view(current_data, current_length))) {
+                    return;
+                  }
+                }
+                bit_util::SetBit(output, output_offset + i);
+              });
+        },
+        out);
+    return Status::OK();
+  }
 };
 
 template <typename Type, typename Matcher>
@@ -1379,8 +1577,8 @@ struct MatchSubstring<Type, RegexSubstringMatcher> {
     ARROW_ASSIGN_OR_RAISE(auto matcher,
                           RegexSubstringMatcher::Make(MatchSubstringState::Get(ctx),
                                                       /*is_utf8=*/Type::is_utf8));
-    return MatchSubstringImpl<Type, RegexSubstringMatcher>::Exec(ctx, batch, out,
-                                                                 matcher.get());
+    return MatchSubstringImpl<Type, RegexSubstringMatcher>::Exec(
+        ctx, batch, out, matcher.get(), matcher->required_literal());
   }
 };
 #endif
@@ -1400,9 +1598,8 @@ struct MatchSubstring<Type, PlainSubstringMatcher> {
       return Status::NotImplemented("ignore_case requires RE2");
 #endif
     }
-    ARROW_ASSIGN_OR_RAISE(auto matcher, PlainSubstringMatcher::Make(options));
-    return MatchSubstringImpl<Type, PlainSubstringMatcher>::Exec(ctx, batch, out,
-                                                                 matcher.get());
+    return MatchSubstringImpl<Type, PlainSubstringMatcher>::ExecPrefiltered(
+        ctx, batch, out, /*matcher=*/nullptr, /*required_literal=*/options.pattern);
   }
 };
 
@@ -1500,6 +1697,27 @@ std::string MakeLikeRegex(const MatchSubstringOptions& options) {
   return like_pattern;
 }
 
+/// Return the longest run of literal characters in a SQL-style LIKE pattern,
+/// which any matching value must contain
+std::string RequiredLikeLiteral(const MatchSubstringOptions& options) {
+  std::string longest, current;
+  bool escaped = false;
+  for (const char c : options.pattern) {
+    if (!escaped && (c == '%' || c == '_')) {
+      if (current.length() > longest.length()) {
+        longest = current;
+      }
+      current.clear();
+    } else if (!escaped && c == '\\') {
+      escaped = true;
+    } else {
+      current.push_back(c);
+      escaped = false;
+    }
+  }
+  return current.length() > longest.length() ? current : longest;
+}
+
 // Evaluate a SQL-like LIKE pattern by translating it to a regexp or
 // substring search as appropriate. See what Apache Impala does:
 // https://github.com/apache/impala/blob/9c38568657d62b6f6d7b10aa1c721ba843374dd8/be/src/exprs/like-predicate.cc
@@ -1551,20 +1769,133 @@ struct MatchLike {
       }
     }
 
+    ctx->SetState(original_state);
     if (!matched) {
       MatchSubstringOptions converted_options{MakeLikeRegex(original_options),
                                               original_options.ignore_case};
-      MatchSubstringState converted_state(converted_options);
-      ctx->SetState(&converted_state);
-      status = MatchSubstring<StringType, RegexSubstringMatcher>::Exec(ctx, batch, out);
+      ARROW_ASSIGN_OR_RAISE(auto matcher,
+                            RegexSubstringMatcher::Make(converted_options,
+                                                        /*is_utf8=*/StringType::is_utf8));
+      const std::string required_literal =
+          original_options.ignore_case ? "" : RequiredLikeLiteral(original_options);
+      status = MatchSubstringImpl<StringType, RegexSubstringMatcher>::Exec(
+          ctx, batch, out, matcher.get(), required_literal);
     }
-    ctx->SetState(original_state);
     return status;
   }
 };
 
 #endif
 
+// Match against several patterns at once
+
+struct MatchAnySubstringState : public KernelState {
+  // Above this many patterns, literal patterns are also matched with a RE2::Set
+  // rather than by searching each of them in the values buffer
+  static constexpr size_t kMaxLiteralSearches = 4;
+
+  explicit MatchAnySubstringState(MatchAnySubstringOptions options)
+      : options(std::move(options)) {}
+
+  template <bool Literal>
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext* ctx,
+                                                   const KernelInitArgs& args) {
+    auto options = static_cast<const MatchAnySubstringOptions*>(args.options);
+    if (!options) {
+      return Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions");
+    }
+    auto state = std::make_unique<MatchAnySubstringState>(*options);
+    if (options->patterns.empty() ||
+        (Literal && !options->ignore_case &&
+         options->patterns.size() <= kMaxLiteralSearches)) {
+      return state;
+    }
+#ifdef ARROW_WITH_RE2
+    // Compile the patterns once into a single automaton, so that each value is
+    // scanned once whatever the number of patterns.
+    const bool is_utf8 = is_string(args.inputs[0].id());
+    state->regex_set = std::make_unique<RE2::Set>(
+        MakeRE2Options(is_utf8, options->ignore_case, Literal), RE2::UNANCHORED);
+    for (const auto& pattern : options->patterns) {
+      std::string error;
+      if (state->regex_set->Add(pattern, &error) < 0) {
+        return Status::Invalid("Invalid regular expression: ", error);
+      }
+    }
+    if (!state->regex_set->Compile()) {
+      return Status::OutOfMemory("Could not compile patterns: too large");
+    }
+    return state;
+#else
+    if (!Literal || options->ignore_case) {
+      return Status::NotImplemented("ignore_case requires RE2");
+    }
+    return state;
+#endif
+  }
+
+  MatchAnySubstringOptions options;
+#ifdef ARROW_WITH_RE2
+  // If null, the literal patterns are searched one by one
+  std::unique_ptr<RE2::Set> regex_set;
+#endif
+};
+
+template <typename Type>
+struct MatchAnySubstring {
+  using offset_type = typename Type::offset_type;
+
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& state = checked_cast<const MatchAnySubstringState&>(*ctx->state());
+    Status status;
+    StringBoolTransform<Type>(
+        ctx, batch,
+        [&](const void* raw_offsets, const uint8_t* data, int64_t length,
+            int64_t output_offset, uint8_t* output) {
+          const offset_type* offsets = reinterpret_cast<const offset_type*>(raw_offsets);
+#ifdef ARROW_WITH_RE2
+          if (state.regex_set) {
+            status = MatchRegexSet(*state.regex_set, offsets, data, length,
+                                   output_offset, output);
+            return;
+          }
+#endif
+          bit_util::SetBitsTo(output, output_offset, length, false);
+          for (const auto& pattern : state.options.patterns) {
+            VisitValuesContaining(pattern, offsets, data, length, [&](int64_t i) {
+              bit_util::SetBit(output, output_offset + i);
+            });
+          }
+        },
+        out);
+    return status;
+  }
+
+#ifdef ARROW_WITH_RE2
+  static Status MatchRegexSet(const RE2::Set& regex_set, const offset_type* offsets,
+                              const uint8_t* data, int64_t length,
+                              int64_t output_offset, uint8_t* output) {
+    FirstTimeBitmapWriter bitmap_writer(output, output_offset, length);
+    for (int64_t i = 0; i < length; ++i) {
+      const char* current_data = reinterpret_cast<const char*>(data + offsets[i]);
+      const int64_t current_length = offsets[i + 1] - offsets[i];
+      RE2::Set::ErrorInfo error_info;
+      // Without a vector of matching patterns, the search stops at the first match
+      if (regex_set.Match(re2::StringPiece(current_data, current_length),
+                          /*v=*/nullptr, &error_info)) {
+        bitmap_writer.Set();
+      } else if (error_info.kind != RE2::Set::kNoError) {
+        return Status::OutOfMemory("Could not match patterns: out of DFA memory");
+      }
+      bitmap_writer.Next();
+    }
+    bitmap_writer.Finish();
+    return Status::OK();
+  }
+#endif
+};
+
 const FunctionDoc match_substring_doc(
     "Match strings against literal pattern",
     ("For each string in `strings`, emit true iff it contains a given pattern.\n"
@@ -1611,6 +1942,27 @@ const FunctionDoc match_like_doc(
     {"strings"}, "MatchSubstringOptions", /*options_required=*/true);
 #endif
 
+const FunctionDoc match_any_substring_doc(
+    "Match strings against several literal patterns",
+    ("For each string in `strings`, emit true iff it contains any of the given\n"
+     "patterns. Null inputs emit null.\n"
+     "The patterns must be given in MatchAnySubstringOptions.\n"
+     "If ignore_case is set, only simple case folding is performed."),
+    {"strings"}, "MatchAnySubstringOptions", /*options_required=*/true);
+
+#ifdef ARROW_WITH_RE2
+const FunctionDoc match_any_substring_regex_doc(
+    "Match strings against several regex patterns",
+    ("For each string in `strings`, emit true iff it matches any of the given\n"
+     "patterns at any position. The patterns are compiled into a single automaton,\n"
+     "so that each string is scanned once whatever the number of patterns.\n"
+     "The patterns must be given in MatchAnySubstringOptions.\n"
+     "If ignore_case is set, only simple case folding is performed.\n"
+     "\n"
+     "Null inputs emit null."),
+    {"strings"}, "MatchAnySubstringOptions", /*options_required=*/true);
+#endif
+
 void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
   {
     auto func = std::make_shared<ScalarFunction>("match_substring", Arity::Unary(),
@@ -1664,6 +2016,28 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
     }
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+#endif
+  {
+    auto func = std::make_shared<ScalarFunction>("match_any_substring", Arity::Unary(),
+                                                 match_any_substring_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchAnySubstring>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec),
+                                MatchAnySubstringState::Init</*Literal=*/true>));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+#ifdef ARROW_WITH_RE2
+  {
+    auto func = std::make_shared<ScalarFunction>(
+        "match_any_substring_regex", Arity::Unary(), match_any_substring_regex_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchAnySubstring>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec),
+                                MatchAnySubstringState::Init</*Literal=*/false>));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
 #endif
 }
 
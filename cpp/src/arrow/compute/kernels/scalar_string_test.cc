@@ -1201,6 +1201,44 @@ TEST(TestStringKernels, LARGE_MEMORY_TEST(Utf8Upper32bitGrowth)) {
                                   CallFunction("utf8_upper", {scalar}, options));
 }
 
+TEST(TestStringKernels, DictionaryInput) {
+  // Unary functions are evaluated on the dictionary values
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "Bar", null, "baz"])");
+  auto indices = ArrayFromJSON(int8(), "[0, 1, 1, null, 2, 3, 0, 3]");
+  ASSERT_OK_AND_ASSIGN(auto dict_array, DictionaryArray::FromArrays(
+                                            dictionary(int8(), utf8()), indices, dict));
+
+  ASSERT_OK_AND_ASSIGN(Datum upper, CallFunction("utf8_upper", {dict_array}));
+  AssertDatumsEqual(
+      ArrayFromJSON(utf8(), R"(["FOO", "BAR", "BAR", null, null, "BAZ", "FOO", "BAZ"])"),
+      upper, /*verbose=*/true);
+
+  MatchSubstringOptions options("ba");
+  ASSERT_OK_AND_ASSIGN(Datum matches,
+                       CallFunction("match_substring", {dict_array}, &options));
+  AssertDatumsEqual(
+      ArrayFromJSON(boolean(), "[false, false, false, null, null, true, false, true]"),
+      matches, /*verbose=*/true);
+
+  // The dictionary is larger than the data
+  ASSERT_OK_AND_ASSIGN(upper, CallFunction("utf8_upper", {dict_array->Slice(5, 2)}));
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["BAZ", "FOO"])"), upper,
+                    /*verbose=*/true);
+
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{dict_array, dict_array->Slice(1, 3)}, dict_array->type());
+  ASSERT_OK_AND_ASSIGN(upper, CallFunction("utf8_upper", {chunked}));
+  AssertDatumsEqual(
+      ChunkedArrayFromJSON(
+          utf8(), {R"(["FOO", "BAR", "BAR", null, null, "BAZ", "FOO", "BAZ"])",
+                   R"(["BAR", "BAR", null])"}),
+      upper, /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(auto scalar, dict_array->GetScalar(1));
+  ASSERT_OK_AND_ASSIGN(upper, CallFunction("utf8_upper", {scalar}));
+  AssertDatumsEqual(ScalarFromJSON(utf8(), R"("BAR")"), upper, /*verbose=*/true);
+}
+
 TYPED_TEST(TestStringKernels, Utf8Length) {
   this->CheckUnary("utf8_length",
                    R"(["aaa", null, "áéíóú", "ɑɽⱤoW😀", "áéí 0😀", "", "b"])",
@@ -1553,7 +1591,67 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstring) {
   this->CheckUnary("match_substring", R"(["abc", "acb", "cab", null, "bac", "AB", ""])",
                    boolean(), "[true, true, true, null, true, true, true]",
                    &options_empty);
+
+  // Occurrences straddling consecutive values don't match
+  this->CheckUnary("match_substring", R"(["xa", "bx", "", "a", "b", "abab"])",
+                   boolean(), "[false, false, false, false, false, true]", &options);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchAnySubstring) {
+  MatchAnySubstringOptions options{{"ab", "ca"}};
+  this->CheckUnary("match_any_substring", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_substring",
+                   R"(["abc", "acb", "cab", null, "bac", "AB", "xc", "ab"])", boolean(),
+                   "[true, false, true, null, false, false, false, true]", &options);
+
+  MatchAnySubstringOptions options_none{{}};
+  this->CheckUnary("match_any_substring", R"(["abc", null, ""])", boolean(),
+                   "[false, null, false]", &options_none);
+
+  MatchAnySubstringOptions options_many{
+      {"error", "timeout", "refused", "denied", "reset", "a.b"}};
+  this->CheckUnary(
+      "match_any_substring",
+      R"(["ok", "connection reset", "errors", null, "axb", "a.b", "time out"])",
+      boolean(), "[false, true, true, null, false, true, false]", &options_many);
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestBaseBinaryKernels, MatchAnySubstringIgnoreCase) {
+  MatchAnySubstringOptions options{{"ab", "ca"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_substring", R"(["ABC", "aCb", "Cab", null, "bac", "xCA"])",
+                   boolean(), "[true, false, true, null, false, true]", &options);
+}
+
+TYPED_TEST(TestStringKernels, MatchAnySubstringRegex) {
+  MatchAnySubstringOptions options{{"^ERROR", "time(out|d out)", "\\d{3}ms$"}};
+  this->CheckUnary("match_any_substring_regex", "[]", boolean(), "[]", &options);
+  this->CheckUnary(
+      "match_any_substring_regex",
+      R"(["ERROR: x", "an ERROR", "timed out", "timeout", "took 250ms", "250ms!", null])",
+      boolean(), "[true, false, true, true, true, false, null]", &options);
+
+  MatchAnySubstringOptions options_insensitive{{"^error", "é"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_substring_regex", R"(["Error", "É", "e", "an error"])",
+                   boolean(), "[true, true, false, false]", &options_insensitive);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchAnySubstringRegexInvalid) {
+  Datum input = ArrayFromJSON(this->type(), "[null]");
+  MatchAnySubstringOptions options{{"a", "invalid["}};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid regular expression: missing ]"),
+      CallFunction("match_any_substring_regex", {input}, &options));
+}
+#else
+TYPED_TEST(TestBaseBinaryKernels, MatchAnySubstringIgnoreCase) {
+  Datum input = ArrayFromJSON(this->type(), R"(["a"])");
+  MatchAnySubstringOptions options{{"a"}, /*ignore_case=*/true};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
+                                  ::testing::HasSubstr("ignore_case requires RE2"),
+                                  CallFunction("match_any_substring", {input}, &options));
 }
+#endif
 
 #ifdef ARROW_WITH_RE2
 TYPED_TEST(TestStringKernels, MatchSubstringIgnoreCase) {
@@ -1655,6 +1753,22 @@ TYPED_TEST(TestStringKernels, MatchSubstringRegex) {
   MatchSubstringOptions options_unicode{"^\\pL+$"};
   this->CheckUnary("match_substring_regex", R"(["été", "ß", "€", ""])", boolean(),
                    "[true, true, false, false]", &options_unicode);
+
+  // Values without the literal "bar" are skipped before matching the regex
+  MatchSubstringOptions options_literal{"fo+\\.bar\\d"};
+  this->CheckUnary("match_substring_regex",
+                   R"(["foo.bar1", "fo.bar", "foo.", "bar1", "fooo.bar2x", "f.bar3"])",
+                   boolean(), "[true, false, false, false, true, false]",
+                   &options_literal);
+
+  // The ']' of a POSIX class doesn't end the enclosing character class
+  MatchSubstringOptions options_posix_class{"[[:digit:]x]yz"};
+  this->CheckUnary("match_substring_regex", R"(["1yz", "xyz", "ayz", "x]yz", "2]yz"])",
+                   boolean(), "[true, true, false, false, false]", &options_posix_class);
+  MatchSubstringOptions options_posix_classes{"a[^[:space:][:punct:]]b"};
+  this->CheckUnary("match_substring_regex", R"(["a1b", "a b", "a]b", "ab", "xa_bx"])",
+                   boolean(), "[true, false, false, false, false]",
+                   &options_posix_classes);
 }
 
 TYPED_TEST(TestBaseBinaryKernels, MatchSubstringRegexNoOptions) {
@@ -1695,6 +1809,8 @@ TYPED_TEST(TestStringKernels, MatchLike) {
   this->CheckUnary("match_like", inputs, boolean(),
                    "[false, false, true, false, false, false, false, null]",
                    &regex_match);
+  this->CheckUnary("match_like", R"(["foo", "bar", "fooxbar", "xfoo_bar"])", boolean(),
+                   "[false, false, true, false]", &regex_match);
 
   // ignore_case means this still gets mapped to a regex search
   MatchSubstringOptions insensitive_substring{"%é%", /*ignore_case=*/true};
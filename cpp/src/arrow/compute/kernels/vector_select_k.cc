@@ -21,6 +21,7 @@
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
+#include "arrow/compute/kernels/vector_sort_key_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/registry_internal.h"
 #include "arrow/type_fwd.h"
@@ -441,6 +442,16 @@ class ChunkedArraySelector : public TypeVisitor {
   Datum* output_;
 };
 
+// Select the first k of `indices` by their normalized sort keys into `output_indices`
+void SelectKByNormalizedKeys(const NormalizedSortKeys& keys, std::span<uint64_t> indices,
+                             std::span<uint64_t> output_indices) {
+  const auto kth = indices.begin() + output_indices.size();
+  std::partial_sort(
+      indices.begin(), kth, indices.end(),
+      [&](uint64_t left, uint64_t right) { return keys.Less(left, right); });
+  std::copy(indices.begin(), kth, output_indices.begin());
+}
+
 class RecordBatchSelector {
  private:
   using ResolvedSortKey = ResolvedRecordBatchSortKey;
@@ -585,6 +596,22 @@ class RecordBatchSelector {
     auto* output_indices = take_indices->template GetMutableValues<uint64_t>(1);
 
     std::span<uint64_t> input_indices_span(input_indices);
+    if (sort_keys_.size() > 1) {
+      std::vector<NormalizedSortKeyColumn> columns;
+      for (const auto& sort_key : sort_keys_) {
+        columns.push_back(
+            {{sort_key.owned_array}, sort_key.order, sort_key.null_placement});
+      }
+      ARROW_ASSIGN_OR_RAISE(auto normalized_keys,
+                            NormalizedSortKeys::MakeIfEncodable(
+                                columns, record_batch_.num_rows(), ctx_->memory_pool()));
+      if (normalized_keys.has_value()) {
+        SelectKByNormalizedKeys(*normalized_keys, input_indices_span,
+                                {output_indices, output_indices + k_});
+        *output_ = Datum(take_indices);
+        return Status::OK();
+      }
+    }
     ARROW_RETURN_NOT_OK(
         DoSelectKForKey(0, input_indices_span, {output_indices, output_indices + k_}));
     *output_ = Datum(take_indices);
@@ -672,6 +699,26 @@ class TableSelector : public TypeVisitor {
     if (k_ > table_.num_rows()) {
       k_ = table_.num_rows();
     }
+    if (sort_keys_.size() > 1) {
+      std::vector<NormalizedSortKeyColumn> columns;
+      for (const auto& sort_key : sort_keys_) {
+        columns.push_back({sort_key.chunks, sort_key.order, sort_key.null_placement});
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          auto normalized_keys,
+          NormalizedSortKeys::MakeIfEncodable(columns, num_rows, ctx_->memory_pool()));
+      if (normalized_keys.has_value()) {
+        std::vector<uint64_t> indices(num_rows);
+        std::iota(indices.begin(), indices.end(), 0);
+        ARROW_ASSIGN_OR_RAISE(auto take_indices,
+                              MakeMutableUInt64Array(k_, ctx_->memory_pool()));
+        auto* output_indices = take_indices->GetMutableValues<uint64_t>(1);
+        SelectKByNormalizedKeys(*normalized_keys, indices,
+                                {output_indices, output_indices + k_});
+        *output_ = Datum(take_indices);
+        return Status::OK();
+      }
+    }
     std::function<bool(const uint64_t&, const uint64_t&)> cmp =
         [&](const uint64_t& left, const uint64_t& right) -> bool {
       return comparator.Compare(left, right, 0);
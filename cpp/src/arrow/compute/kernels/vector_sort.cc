@@ -20,6 +20,7 @@
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
+#include "arrow/compute/kernels/vector_sort_key_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/registry_internal.h"
 #include "arrow/util/logging_internal.h"
@@ -42,7 +43,8 @@ Result<RecordBatchVector> BatchesFromTable(const Table& table) {
 // ChunkedArray sorting implementation
 
 // Sort a chunked array by sorting each array in the chunked array,
-// then merging the sorted chunks recursively.
+// then merging the sorted chunks recursively.  Large inputs are sorted
+// and merged in parallel.
 class ChunkedArraySorter : public TypeVisitor {
  public:
   ChunkedArraySorter(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
@@ -90,23 +92,28 @@ class ChunkedArraySorter : public TypeVisitor {
     const auto arrays = GetArrayPointers(physical_chunks_);
 
     // Sort each chunk independently and merge to sorted indices.
-    // This is a serial implementation.
     std::vector<NullPartitionResult> sorted(num_chunks);
+    const bool use_threads = UseParallelSort(ctx_, num_indices);
 
     // First sort all individual chunks
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
     int64_t null_count = 0;
     for (int i = 0; i < num_chunks; ++i) {
-      const auto array = checked_cast<const ArrayType*>(arrays[i]);
-      end_offset += array->length();
-      null_count += array->null_count();
-      ARROW_ASSIGN_OR_RAISE(sorted[i], array_sorter_(indices_begin_ + begin_offset,
-                                                     indices_begin_ + end_offset, *array,
-                                                     begin_offset, options, ctx_));
-      begin_offset = end_offset;
+      offsets[i + 1] = offsets[i] + arrays[i]->length();
+      null_count += arrays[i]->null_count();
     }
-    DCHECK_EQ(end_offset, num_indices);
+    DCHECK_EQ(offsets[num_chunks], num_indices);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        use_threads, num_chunks,
+        [&](int i) -> Status {
+          const auto array = checked_cast<const ArrayType*>(arrays[i]);
+          ARROW_ASSIGN_OR_RAISE(
+              sorted[i], array_sorter_(indices_begin_ + offsets[i],
+                                       indices_begin_ + offsets[i + 1], *array,
+                                       offsets[i], options, ctx_));
+          return Status::OK();
+        },
+        ctx_->executor()));
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -138,29 +145,14 @@ class ChunkedArraySorter : public TypeVisitor {
 
       ChunkedMergeImpl merge_impl{null_placement_, std::move(merge_nulls),
                                   std::move(merge_non_nulls)};
-      // std::merge is only called on non-null values, so size temp indices accordingly
-      RETURN_NOT_OK(merge_impl.Init(ctx_, num_indices - null_count));
-
-      while (chunk_sorted.size() > 1) {
-        // Merge all pairs of chunks
-        auto out_it = chunk_sorted.begin();
-        auto it = chunk_sorted.begin();
-        while (it < chunk_sorted.end() - 1) {
-          const auto& left = *it++;
-          const auto& right = *it++;
-          DCHECK_EQ(left.overall_end(), right.overall_begin());
-          const auto merged = merge_impl.Merge(left, right, null_count);
-          *out_it++ = merged;
-        }
-        if (it < chunk_sorted.end()) {
-          *out_it++ = *it++;
-        }
-        chunk_sorted.erase(out_it, chunk_sorted.end());
-      }
+      RETURN_NOT_OK(merge_impl.Init(ctx_, num_indices));
+      ARROW_ASSIGN_OR_RAISE(auto merged,
+                            merge_impl.MergeAll(std::move(chunk_sorted), null_count,
+                                                use_threads, ctx_->executor()));
 
       // Reverse everything
       sorted.resize(1);
-      sorted[0] = chunk_sorted[0].TranslateTo(chunked_indices_begin, indices_begin_);
+      sorted[0] = merged.TranslateTo(chunked_indices_begin, indices_begin_);
 
       RETURN_NOT_OK(chunked_mapper.PhysicalToLogical());
     }
@@ -617,7 +609,8 @@ class MultipleKeyRecordBatchSorter : public TypeVisitor {
 // Sort a table using an explicit merge sort.
 // Each batch is first sorted individually (taking advantage of the fact
 // that batch columns are contiguous and therefore have less indexing
-// overhead), then sorted batches are merged recursively.
+// overhead), then sorted batches are merged recursively.  Large tables
+// are sorted and merged in parallel.
 class TableSorter {
   // TODO make all methods const and defer initialization into a Init() method?
  private:
@@ -670,26 +663,49 @@ class TableSorter {
     if (num_batches == 0) {
       return Status::OK();
     }
+    if (sort_keys_.size() > 1) {
+      // Fixed-width sort keys are compared more cheaply as normalized keys,
+      // which also avoids merging the sorted batches.
+      std::vector<NormalizedSortKeyColumn> columns;
+      for (const auto& sort_key : sort_keys_) {
+        columns.push_back(
+            {sort_key.owned_chunks, sort_key.order, sort_key.null_placement});
+      }
+      ARROW_ASSIGN_OR_RAISE(auto normalized_keys,
+                            NormalizedSortKeys::MakeIfEncodable(
+                                columns, table_.num_rows(), ctx_->memory_pool()));
+      if (normalized_keys.has_value()) {
+        return normalized_keys->SortIndices(ctx_, indices_begin_, indices_end_);
+      }
+    }
     std::vector<NullPartitionResult> sorted(num_batches);
+    use_threads_ = UseParallelSort(ctx_, indices_end_ - indices_begin_);
 
     // First sort all individual batches
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
-    int64_t null_count = 0;
+    std::vector<int64_t> offsets(num_batches + 1, 0);
     for (int64_t i = 0; i < num_batches; ++i) {
-      const auto& batch = *batches_[i];
-      end_offset += batch.num_rows();
-      RadixRecordBatchSorter sorter(indices_begin_ + begin_offset,
-                                    indices_begin_ + end_offset, batch, options_);
-      ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offset));
-      DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offset);
-      DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + end_offset);
-      DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(), batch.num_rows());
-      begin_offset = end_offset;
+      offsets[i + 1] = offsets[i] + batches_[i]->num_rows();
+    }
+    DCHECK_EQ(offsets[num_batches], indices_end_ - indices_begin_);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        use_threads_, static_cast<int>(num_batches),
+        [&](int i) -> Status {
+          const auto& batch = *batches_[i];
+          RadixRecordBatchSorter sorter(indices_begin_ + offsets[i],
+                                        indices_begin_ + offsets[i + 1], batch, options_);
+          ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(offsets[i]));
+          DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + offsets[i]);
+          DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + offsets[i + 1]);
+          DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(),
+                    batch.num_rows());
+          return Status::OK();
+        },
+        ctx_->executor()));
+    int64_t null_count = 0;
+    for (const auto& p : sorted) {
       // XXX this is an upper bound on the true null count
-      null_count += sorted[i].null_count();
+      null_count += p.null_count();
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -754,21 +770,10 @@ class TableSorter {
     ChunkedMergeImpl merge_impl(sort_keys_[0].null_placement, std::move(merge_nulls),
                                 std::move(merge_non_nulls));
     RETURN_NOT_OK(merge_impl.Init(ctx_, table_.num_rows()));
-
-    while (sorted->size() > 1) {
-      auto out_it = sorted->begin();
-      auto it = sorted->begin();
-      while (it < sorted->end() - 1) {
-        const auto& left = *it++;
-        const auto& right = *it++;
-        DCHECK_EQ(left.overall_end(), right.overall_begin());
-        *out_it++ = merge_impl.Merge(left, right, null_count);
-      }
-      if (it < sorted->end()) {
-        *out_it++ = *it++;
-      }
-      sorted->erase(out_it, sorted->end());
-    }
+    ARROW_ASSIGN_OR_RAISE(auto merged,
+                          merge_impl.MergeAll(std::move(*sorted), null_count,
+                                              use_threads_, ctx_->executor()));
+    *sorted = {merged};
     return comparator_.status();
   }
 
@@ -880,6 +885,7 @@ class TableSorter {
   uint64_t* indices_begin_;
   uint64_t* indices_end_;
   Comparator comparator_;
+  bool use_threads_ = false;
 };
 
 // ----------------------------------------------------------------------
@@ -1033,7 +1039,17 @@ class SortIndicesMetaFunction : public MetaFunction {
     auto out_end = out_begin + length;
     std::iota(out_begin, out_end, 0);
 
-    if (n_sort_keys <= kMaxRadixSortKeys) {
+    std::vector<NormalizedSortKeyColumn> columns;
+    for (const auto& sort_key : sort_keys) {
+      columns.push_back(
+          {{sort_key.owned_array}, sort_key.order, sort_key.null_placement});
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto normalized_keys,
+        NormalizedSortKeys::MakeIfEncodable(columns, length, ctx->memory_pool()));
+    if (normalized_keys.has_value()) {
+      RETURN_NOT_OK(normalized_keys->SortIndices(ctx, out_begin, out_end));
+    } else if (n_sort_keys <= kMaxRadixSortKeys) {
       RadixRecordBatchSorter sorter(out_begin, out_end, std::move(sort_keys));
       ARROW_RETURN_NOT_OK(sorter.Sort());
     } else {
@@ -29,6 +29,8 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow::compute::internal {
 
@@ -368,16 +370,55 @@ struct GenericMergeImpl {
   NullPartitionResultType Merge(const NullPartitionResultType& left,
                                 const NullPartitionResultType& right,
                                 int64_t null_count) const {
+    return Merge(left, right, null_count, temp_indices_);
+  }
+
+  // Merge adjacent sorted ranges by pairs, recursively, into a single sorted range.
+  // The pairs of each level are disjoint and are merged in parallel if `use_threads`
+  // is true.  Init() must have been given the total length of the ranges, so that
+  // each pair has its own temporary area.
+  Result<NullPartitionResultType> MergeAll(std::vector<NullPartitionResultType> sorted,
+                                           int64_t null_count, bool use_threads,
+                                           ::arrow::internal::Executor* executor) const {
+    ARROW_DCHECK(!sorted.empty());
+    const IndexType* origin = sorted.front().overall_begin();
+    while (sorted.size() > 1) {
+      const auto num_pairs = static_cast<int>(sorted.size() / 2);
+      std::vector<NullPartitionResultType> merged((sorted.size() + 1) / 2);
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          use_threads && num_pairs > 1, num_pairs,
+          [&](int i) {
+            const auto& left = sorted[2 * i];
+            const auto& right = sorted[2 * i + 1];
+            ARROW_DCHECK_EQ(left.overall_end(), right.overall_begin());
+            merged[i] = Merge(left, right, null_count,
+                              temp_indices_ + (left.overall_begin() - origin));
+            return Status::OK();
+          },
+          executor));
+      if (sorted.size() % 2 == 1) {
+        merged.back() = sorted.back();
+      }
+      sorted = std::move(merged);
+    }
+    return sorted.front();
+  }
+
+ private:
+  NullPartitionResultType Merge(const NullPartitionResultType& left,
+                                const NullPartitionResultType& right, int64_t null_count,
+                                IndexType* temp_indices) const {
     if (null_placement_ == NullPlacement::AtStart) {
-      return MergeNullsAtStart(left, right, null_count);
+      return MergeNullsAtStart(left, right, null_count, temp_indices);
     } else {
-      return MergeNullsAtEnd(left, right, null_count);
+      return MergeNullsAtEnd(left, right, null_count, temp_indices);
     }
   }
 
   NullPartitionResultType MergeNullsAtStart(const NullPartitionResultType& left,
                                             const NullPartitionResultType& right,
-                                            int64_t null_count) const {
+                                            int64_t null_count,
+                                            IndexType* temp_indices) const {
     // Input layout:
     // [left nulls .... left non-nulls .... right nulls .... right non-nulls]
     ARROW_DCHECK_EQ(left.nulls_end, left.non_nulls_begin);
@@ -397,7 +438,7 @@ struct GenericMergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   temp_indices, null_count);
     }
 
     // Merge the non-null values into temp area
@@ -405,14 +446,15 @@ struct GenericMergeImpl {
     ARROW_DCHECK_EQ(p.non_nulls_end - right.non_nulls_begin, right.non_null_count());
     if (p.non_null_count()) {
       merge_non_nulls_(p.non_nulls_begin, right.non_nulls_begin, p.non_nulls_end,
-                       temp_indices_);
+                       temp_indices);
     }
     return p;
   }
 
   NullPartitionResultType MergeNullsAtEnd(const NullPartitionResultType& left,
                                           const NullPartitionResultType& right,
-                                          int64_t null_count) const {
+                                          int64_t null_count,
+                                          IndexType* temp_indices) const {
     // Input layout:
     // [left non-nulls .... left nulls .... right non-nulls .... right nulls]
     ARROW_DCHECK_EQ(left.non_nulls_end, left.nulls_begin);
@@ -432,7 +474,7 @@ struct GenericMergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   temp_indices, null_count);
     }
 
     // Merge the non-null values into temp area
@@ -440,12 +482,11 @@ struct GenericMergeImpl {
     ARROW_DCHECK_EQ(p.non_nulls_end - left.non_nulls_end, right.non_null_count());
     if (p.non_null_count()) {
       merge_non_nulls_(p.non_nulls_begin, left.non_nulls_end, p.non_nulls_end,
-                       temp_indices_);
+                       temp_indices);
     }
     return p;
   }
 
- private:
   NullPlacement null_placement_;
   MergeNullsFunc merge_nulls_;
   MergeNonNullsFunc merge_non_nulls_;
@@ -457,6 +498,15 @@ using MergeImpl = GenericMergeImpl<uint64_t, NullPartitionResult>;
 using ChunkedMergeImpl =
     GenericMergeImpl<CompressedChunkLocation, ChunkedNullPartitionResult>;
 
+// Whether the independent steps of sorting `length` values (sorting each chunk,
+// merging pairs of sorted chunks) should run in parallel on the executor of `ctx`.
+// Tasks of the executor don't spawn and wait for other tasks, as that could deadlock.
+inline bool UseParallelSort(ExecContext* ctx, int64_t length) {
+  constexpr int64_t kMinParallelSortLength = 1 << 16;
+  return ctx->use_threads() && length >= kMinParallelSortLength &&
+         ctx->executor()->GetCapacity() > 1 && !ctx->executor()->OwnsThisThread();
+}
+
 // TODO make this usable if indices are non trivial on input
 // (see ConcreteRecordBatchColumnSorter)
 // `offset` is used when this is called on a chunk of a chunked array
@@ -0,0 +1,353 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/vector_sort_key_internal.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <type_traits>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/kernels/vector_sort_internal.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow::compute::internal {
+
+using ::arrow::internal::checked_cast;
+
+namespace {
+
+// Tags of null, NaN and other values, ordered for NullPlacement::AtStart.
+// They are mirrored for NullPlacement::AtEnd, whatever the sort order.
+constexpr uint8_t kNullTag = 0;
+constexpr uint8_t kNaNTag = 1;
+constexpr uint8_t kValueTag = 2;
+
+std::optional<int64_t> ValueWidth(const DataType& type) {
+  switch (type.id()) {
+    case Type::NA:
+      return 0;
+    case Type::BOOL:
+      return 1;
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+    case Type::UINT8:
+    case Type::UINT16:
+    case Type::UINT32:
+    case Type::UINT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::FIXED_SIZE_BINARY:
+    case Type::DECIMAL128:
+    case Type::DECIMAL256:
+      return checked_cast<const FixedWidthType&>(type).byte_width();
+    default:
+      return std::nullopt;
+  }
+}
+
+// Whether values need a tag byte to be ordered with nulls and NaNs
+bool NeedsTag(const NormalizedSortKeyColumn& column, const DataType& type) {
+  if (type.id() == Type::NA) {
+    // All values are null and therefore equal
+    return false;
+  }
+  if (is_floating(type.id())) {
+    return true;
+  }
+  return std::any_of(column.chunks.begin(), column.chunks.end(),
+                     [](const std::shared_ptr<Array>& chunk) {
+                       return chunk->null_count() > 0;
+                     });
+}
+
+template <typename CType>
+void EncodeInteger(CType value, uint8_t* out) {
+  using Unsigned = std::make_unsigned_t<CType>;
+  auto bits = static_cast<Unsigned>(value);
+  if constexpr (std::is_signed_v<CType>) {
+    bits ^= Unsigned{1} << (sizeof(Unsigned) * 8 - 1);
+  }
+  bits = bit_util::ToBigEndian(bits);
+  std::memcpy(out, &bits, sizeof(bits));
+}
+
+// Return false for NaN
+template <typename CType>
+bool EncodeFloat(CType value, uint8_t* out) {
+  using Unsigned = std::conditional_t<sizeof(CType) == 4, uint32_t, uint64_t>;
+  constexpr auto kSignBit = Unsigned{1} << (sizeof(Unsigned) * 8 - 1);
+  if (std::isnan(value)) {
+    return false;
+  }
+  if (value == 0) {
+    // -0.0 and 0.0 compare equal
+    value = 0;
+  }
+  auto bits = std::bit_cast<Unsigned>(value);
+  bits = (bits & kSignBit) ? ~bits : (bits | kSignBit);
+  bits = bit_util::ToBigEndian(bits);
+  std::memcpy(out, &bits, sizeof(bits));
+  return true;
+}
+
+// Decimals are two's complement integers in native byte order
+void EncodeDecimal(const uint8_t* value, int32_t width, uint8_t* out) {
+#if ARROW_LITTLE_ENDIAN
+  bit_util::ByteSwap(out, value, width);
+#else
+  std::memcpy(out, value, width);
+#endif
+  out[0] ^= 0x80;
+}
+
+class ColumnEncoder {
+ public:
+  ColumnEncoder(const NormalizedSortKeyColumn& column, bool has_tag,
+                int64_t value_width, uint8_t* out, int64_t row_width)
+      : column_(column),
+        has_tag_(has_tag),
+        value_width_(value_width),
+        out_(out),
+        row_width_(row_width) {}
+
+  Status Encode(const DataType& type) {
+    switch (type.id()) {
+      case Type::NA:
+        return Status::OK();
+      case Type::BOOL:
+        return EncodeChunks<BooleanArray>([](const BooleanArray& array, int64_t i,
+                                             uint8_t* out) {
+          *out = array.Value(i) ? 1 : 0;
+          return true;
+        });
+      case Type::INT8:
+        return EncodeIntegers<Int8Type>();
+      case Type::INT16:
+        return EncodeIntegers<Int16Type>();
+      case Type::INT32:
+        return EncodeIntegers<Int32Type>();
+      case Type::INT64:
+        return EncodeIntegers<Int64Type>();
+      case Type::UINT8:
+        return EncodeIntegers<UInt8Type>();
+      case Type::UINT16:
+        return EncodeIntegers<UInt16Type>();
+      case Type::UINT32:
+        return EncodeIntegers<UInt32Type>();
+      case Type::UINT64:
+        return EncodeIntegers<UInt64Type>();
+      case Type::FLOAT:
+        return EncodeFloats<FloatType>();
+      case Type::DOUBLE:
+        return EncodeFloats<DoubleType>();
+      case Type::FIXED_SIZE_BINARY:
+        return EncodeChunks<FixedSizeBinaryArray>(
+            [](const FixedSizeBinaryArray& array, int64_t i, uint8_t* out) {
+              std::memcpy(out, array.GetValue(i), array.byte_width());
+              return true;
+            });
+      case Type::DECIMAL128:
+      case Type::DECIMAL256:
+        return EncodeChunks<FixedSizeBinaryArray>(
+            [](const FixedSizeBinaryArray& array, int64_t i, uint8_t* out) {
+              EncodeDecimal(array.GetValue(i), array.byte_width(), out);
+              return true;
+            });
+      default:
+        return Status::TypeError("Cannot normalize sort keys of type ", type);
+    }
+  }
+
+ private:
+  template <typename Type>
+  Status EncodeIntegers() {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+    return EncodeChunks<ArrayType>([](const ArrayType& array, int64_t i, uint8_t* out) {
+      EncodeInteger(array.Value(i), out);
+      return true;
+    });
+  }
+
+  template <typename Type>
+  Status EncodeFloats() {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+    return EncodeChunks<ArrayType>([](const ArrayType& array, int64_t i, uint8_t* out) {
+      return EncodeFloat(array.Value(i), out);
+    });
+  }
+
+  // `encode_value` encodes a valid value and returns false if it is null-like (NaN)
+  template <typename ArrayType, typename EncodeValue>
+  Status EncodeChunks(EncodeValue&& encode_value) {
+    const bool at_start = column_.null_placement == NullPlacement::AtStart;
+    const uint8_t null_tag = at_start ? kNullTag : kValueTag;
+    const uint8_t value_tag = at_start ? kValueTag : kNullTag;
+    const bool descending = column_.order == SortOrder::Descending;
+
+    uint8_t* row = out_;
+    for (const auto& chunk : column_.chunks) {
+      const auto& array = checked_cast<const ArrayType&>(*chunk);
+      for (int64_t i = 0; i < array.length(); ++i, row += row_width_) {
+        uint8_t* value = has_tag_ ? row + 1 : row;
+        uint8_t tag;
+        if (array.IsNull(i)) {
+          tag = null_tag;
+          std::memset(value, 0, value_width_);
+        } else if (!encode_value(array, i, value)) {
+          tag = kNaNTag;
+          std::memset(value, 0, value_width_);
+        } else {
+          tag = value_tag;
+          if (descending) {
+            for (int64_t j = 0; j < value_width_; ++j) {
+              value[j] = static_cast<uint8_t>(~value[j]);
+            }
+          }
+        }
+        if (has_tag_) {
+          *row = tag;
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  const NormalizedSortKeyColumn& column_;
+  const bool has_tag_;
+  const int64_t value_width_;
+  uint8_t* out_;
+  const int64_t row_width_;
+};
+
+}  // namespace
+
+std::optional<int64_t> NormalizedSortKeys::RowWidth(
+    const std::vector<NormalizedSortKeyColumn>& columns) {
+  int64_t width = 0;
+  for (const auto& column : columns) {
+    if (column.chunks.empty()) {
+      continue;
+    }
+    const auto& type = *column.chunks.front()->type();
+    const auto value_width = ValueWidth(type);
+    if (!value_width.has_value()) {
+      return std::nullopt;
+    }
+    width += *value_width + (NeedsTag(column, type) ? 1 : 0);
+  }
+  return width;
+}
+
+Result<NormalizedSortKeys> NormalizedSortKeys::Make(
+    const std::vector<NormalizedSortKeyColumn>& columns, int64_t num_rows,
+    MemoryPool* pool) {
+  const auto row_width = RowWidth(columns);
+  if (!row_width.has_value()) {
+    return Status::TypeError("Cannot normalize variable-width sort keys");
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                        AllocateBuffer(num_rows * *row_width, pool));
+  int64_t column_offset = 0;
+  for (const auto& column : columns) {
+    if (column.chunks.empty()) {
+      DCHECK_EQ(num_rows, 0);
+      continue;
+    }
+    const auto& type = *column.chunks.front()->type();
+    const bool has_tag = NeedsTag(column, type);
+    const int64_t value_width = *ValueWidth(type);
+    ColumnEncoder encoder(column, has_tag, value_width,
+                          buffer->mutable_data() + column_offset, *row_width);
+    RETURN_NOT_OK(encoder.Encode(type));
+    column_offset += value_width + (has_tag ? 1 : 0);
+  }
+  DCHECK_EQ(column_offset, *row_width);
+  return NormalizedSortKeys(std::move(buffer), *row_width, num_rows);
+}
+
+Result<std::optional<NormalizedSortKeys>> NormalizedSortKeys::MakeIfEncodable(
+    const std::vector<NormalizedSortKeyColumn>& columns, int64_t num_rows,
+    MemoryPool* pool) {
+  if (!CanEncode(columns)) {
+    return std::nullopt;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto keys, Make(columns, num_rows, pool));
+  return std::optional<NormalizedSortKeys>(std::move(keys));
+}
+
+Status NormalizedSortKeys::SortIndices(ExecContext* ctx, uint64_t* indices_begin,
+                                       uint64_t* indices_end) const {
+  auto less = [this](uint64_t left, uint64_t right) { return Less(left, right); };
+  const int64_t length = indices_end - indices_begin;
+  if (!UseParallelSort(ctx, length)) {
+    std::stable_sort(indices_begin, indices_end, less);
+    return Status::OK();
+  }
+
+  // Sort contiguous runs in parallel, then merge pairs of adjacent runs
+  // level by level, with the merges of each level also in parallel.
+  const auto num_runs = static_cast<int>(
+      std::min<int64_t>(ctx->executor()->GetCapacity(), length));
+  std::vector<uint64_t*> bounds(num_runs + 1);
+  for (int i = 0; i <= num_runs; ++i) {
+    bounds[i] = indices_begin + length * i / num_runs;
+  }
+  RETURN_NOT_OK(::arrow::internal::ParallelFor(
+      num_runs,
+      [&](int i) {
+        std::stable_sort(bounds[i], bounds[i + 1], less);
+        return Status::OK();
+      },
+      ctx->executor()));
+
+  ARROW_ASSIGN_OR_RAISE(auto temp_buffer,
+                        AllocateBuffer(length * sizeof(uint64_t), ctx->memory_pool()));
+  auto* temp = temp_buffer->mutable_data_as<uint64_t>();
+  while (bounds.size() > 2) {
+    const auto num_pairs = static_cast<int>((bounds.size() - 1) / 2);
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_pairs,
+        [&](int i) {
+          uint64_t* begin = bounds[2 * i];
+          uint64_t* middle = bounds[2 * i + 1];
+          uint64_t* end = bounds[2 * i + 2];
+          uint64_t* out = temp + (begin - indices_begin);
+          std::merge(begin, middle, middle, end, out, less);
+          std::copy(out, out + (end - begin), begin);
+          return Status::OK();
+        },
+        ctx->executor()));
+    std::vector<uint64_t*> merged_bounds;
+    for (size_t i = 0; i < bounds.size(); i += 2) {
+      merged_bounds.push_back(bounds[i]);
+    }
+    if (merged_bounds.back() != indices_end) {
+      merged_bounds.push_back(indices_end);
+    }
+    bounds = std::move(merged_bounds);
+  }
+  return Status::OK();
+}
+
+}  // namespace arrow::compute::internal
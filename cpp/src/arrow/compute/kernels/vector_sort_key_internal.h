@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/ordering.h"
+#include "arrow/result.h"
+
+namespace arrow::compute::internal {
+
+// The values of one sort key, as physical chunks (see GetPhysicalType)
+struct NormalizedSortKeyColumn {
+  ArrayVector chunks;
+  SortOrder order;
+  NullPlacement null_placement;
+};
+
+// Row-wise encoding of fixed-width sort keys, such that the order of two rows
+// is the lexicographic (memcmp) order of their encoded keys.
+//
+// Each sort key is encoded as a tag byte placing nulls and NaNs according to the
+// null placement (omitted if the column has neither), followed by the big-endian
+// value with its sign bit flipped, whose bytes are inverted for a descending order.
+// Comparing rows then needs neither type dispatch nor null checks, unlike
+// MultipleKeyComparator which calls one virtual comparator per sort key.
+class NormalizedSortKeys {
+ public:
+  // Encoding rows wider than this uses more memory than it saves in comparisons
+  static constexpr int64_t kMaxRowWidth = 64;
+
+  // The width of the encoded rows, or nullopt if a sort key has a variable width
+  static std::optional<int64_t> RowWidth(
+      const std::vector<NormalizedSortKeyColumn>& columns);
+
+  // Whether the given sort keys can and should be encoded
+  static bool CanEncode(const std::vector<NormalizedSortKeyColumn>& columns) {
+    const auto width = RowWidth(columns);
+    return width.has_value() && *width <= kMaxRowWidth;
+  }
+
+  static Result<NormalizedSortKeys> Make(
+      const std::vector<NormalizedSortKeyColumn>& columns, int64_t num_rows,
+      MemoryPool* pool);
+
+  // Make the normalized sort keys if CanEncode(columns), otherwise return nullopt
+  static Result<std::optional<NormalizedSortKeys>> MakeIfEncodable(
+      const std::vector<NormalizedSortKeyColumn>& columns, int64_t num_rows,
+      MemoryPool* pool);
+
+  int64_t row_width() const { return row_width_; }
+  int64_t num_rows() const { return num_rows_; }
+
+  const uint8_t* row(uint64_t index) const { return data_ + index * row_width_; }
+
+  bool Less(uint64_t left, uint64_t right) const {
+    return std::memcmp(row(left), row(right), row_width_) < 0;
+  }
+
+  // Stable sort of the given row indices, in parallel for large inputs
+  Status SortIndices(ExecContext* ctx, uint64_t* indices_begin,
+                     uint64_t* indices_end) const;
+
+ private:
+  NormalizedSortKeys(std::shared_ptr<Buffer> buffer, int64_t row_width,
+                     int64_t num_rows)
+      : buffer_(std::move(buffer)),
+        data_(buffer_ ? buffer_->data() : nullptr),
+        row_width_(row_width),
+        num_rows_(num_rows) {}
+
+  std::shared_ptr<Buffer> buffer_;
+  const uint8_t* data_;
+  int64_t row_width_;
+  int64_t num_rows_;
+};
+
+}  // namespace arrow::compute::internal
@@ -1405,6 +1405,28 @@ TEST_F(TestRecordBatchSortIndices, Decimal) {
   AssertSortIndices(batch, options, "[3, 4, 0, 2, 1]");
 }
 
+TEST_F(TestRecordBatchSortIndices, SignedZeroAndExtremes) {
+  auto schema = ::arrow::schema({
+      {field("a", float64())},
+      {field("b", int64())},
+  });
+  // -0.0 and 0.0 compare equal, so that ties are broken by "b" then stably
+  auto batch = RecordBatchFromJSON(schema,
+                                   R"([{"a": 0.0,     "b": -1},
+                                       {"a": -0.0,    "b": 5},
+                                       {"a": -1e300,  "b": 0},
+                                       {"a": -0.0,    "b": -1},
+                                       {"a": 1e300,   "b": -9223372036854775808}
+                                       ])");
+  std::vector<SortKey> sort_keys{SortKey("a", SortOrder::Ascending),
+                                 SortKey("b", SortOrder::Descending)};
+
+  SortOptions options(sort_keys);
+  AssertSortIndices(batch, options, "[2, 1, 0, 3, 4]");
+  options.sort_keys[0].order = SortOrder::Descending;
+  AssertSortIndices(batch, options, "[4, 1, 0, 3, 2]");
+}
+
 TEST_F(TestRecordBatchSortIndices, NullType) {
   auto schema = arrow::schema({
       field("a", null()),
@@ -2221,6 +2243,48 @@ INSTANTIATE_TEST_SUITE_P(AllNull, TestTableSortIndicesRandom,
                          testing::Combine(first_sort_keys, num_sort_keys,
                                           testing::Values(1.0)));
 
+// Large inputs are sorted and merged in parallel, which must give the same
+// stable order as a serial sort
+TEST(TestParallelSortIndices, ChunkedArrayAndTable) {
+  ::arrow::random::RandomArrayGenerator rng(0x5487655);
+  const int64_t chunk_length = 1 << 14;
+  ArrayVector int_chunks, string_chunks;
+  for (int i = 0; i < 9; ++i) {
+    int_chunks.push_back(rng.Int64(chunk_length, -1000, 1000, /*null_probability=*/0.1));
+    string_chunks.push_back(rng.StringWithRepeats(chunk_length, /*unique=*/100,
+                                                  /*min_length=*/0, /*max_length=*/5,
+                                                  /*null_probability=*/0.1));
+  }
+  auto ints = std::make_shared<ChunkedArray>(int_chunks);
+  auto strings = std::make_shared<ChunkedArray>(string_chunks);
+  auto table = Table::Make(schema({field("a", int64()), field("b", utf8())}),
+                           {ints, strings});
+
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  for (auto order : AllOrders()) {
+    for (auto null_placement : AllNullPlacements()) {
+      ARROW_SCOPED_TRACE("order = ",
+                         order == SortOrder::Ascending ? "Ascending" : "Descending",
+                         ", null_placement = ", null_placement);
+      ArraySortOptions array_options(order, null_placement);
+      for (const auto& chunked : {ints, strings}) {
+        ASSERT_OK_AND_ASSIGN(auto expected,
+                             SortIndices(*chunked, array_options, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(*chunked, array_options));
+        AssertArraysEqual(*expected, *actual);
+      }
+
+      SortOptions options(
+          {SortKey("b", order, null_placement), SortKey("a", order, null_placement)});
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           SortIndices(Datum(table), options, &serial_ctx));
+      ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(Datum(table), options));
+      AssertArraysEqual(*expected, *actual);
+    }
+  }
+}
+
 class TestNestedSortIndices : public ::testing::Test {
  protected:
   static std::shared_ptr<Array> GetArray() {
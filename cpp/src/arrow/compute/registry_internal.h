@@ -65,6 +65,7 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry);
 void RegisterHashAggregateNumeric(FunctionRegistry* registry);
 void RegisterHashAggregatePivot(FunctionRegistry* registry);
 void RegisterScalarAggregateBasic(FunctionRegistry* registry);
+void RegisterScalarAggregateHyperLogLog(FunctionRegistry* registry);
 void RegisterScalarAggregateMode(FunctionRegistry* registry);
 void RegisterScalarAggregatePivot(FunctionRegistry* registry);
 void RegisterScalarAggregateQuantile(FunctionRegistry* registry);
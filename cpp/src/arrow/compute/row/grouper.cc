@@ -17,11 +17,15 @@
 
 #include "arrow/compute/row/grouper.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 
 #include "arrow/array/builder_primitive.h"
 
@@ -206,6 +210,135 @@ struct SimpleKeySegmenter : public BaseRowSegmenter {
   bool extend_was_called_;
 };
 
+// Segments by comparing each row's keys with the previous row's, rather than by
+// grouping the keys as AnyKeysSegmenter does, so the keys are never hashed.  Only keys
+// whose values can be compared as bytes are supported.
+struct ComparingKeysSegmenter : public BaseRowSegmenter {
+  static bool CanSegment(const std::vector<TypeHolder>& key_types) {
+    return std::all_of(key_types.begin(), key_types.end(), [](const TypeHolder& type) {
+      const Type::type id = type.id();
+      return is_primitive(id) || is_fixed_size_binary(id) || is_base_binary_like(id);
+    });
+  }
+
+  static Result<std::unique_ptr<RowSegmenter>> Make(
+      const std::vector<TypeHolder>& key_types) {
+    return std::make_unique<ComparingKeysSegmenter>(key_types);
+  }
+
+  explicit ComparingKeysSegmenter(const std::vector<TypeHolder>& key_types)
+      : BaseRowSegmenter(key_types), save_keys_(key_types.size()) {}
+
+  Status Reset() override {
+    has_saved_keys_ = false;
+    return Status::OK();
+  }
+
+  Result<std::vector<Segment>> GetSegments(const ExecSpan& batch) override {
+    RETURN_NOT_OK(CheckForGetSegments(batch, key_types_));
+
+    if (batch.length == 0) {
+      return std::vector<Segment>{};
+    }
+
+    // A scalar is viewed as an array of length 1 whose only row stands for every row
+    std::vector<ArraySpan> keys(batch.values.size());
+    std::vector<int64_t> row_steps(batch.values.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      const ExecValue& value = batch.values[i];
+      if (value.is_scalar()) {
+        keys[i].FillFromScalar(*value.scalar);
+        row_steps[i] = 0;
+      } else {
+        keys[i] = value.array;
+        row_steps[i] = 1;
+      }
+    }
+
+    bool extends = kDefaultExtends;
+    if (has_saved_keys_) {
+      for (size_t i = 0; extends && i < keys.size(); ++i) {
+        extends = SameKey(save_keys_[i], GetKey(keys[i], 0));
+      }
+    }
+
+    std::vector<Segment> segments;
+    int64_t segment_offset = 0;
+    for (int64_t row = 1; row < batch.length; ++row) {
+      bool same = true;
+      for (size_t i = 0; same && i < keys.size(); ++i) {
+        same = row_steps[i] == 0 || GetKey(keys[i], row - 1) == GetKey(keys[i], row);
+      }
+      if (!same) {
+        segments.push_back(MakeSegment(batch.length, segment_offset, row - segment_offset,
+                                       segment_offset == 0 ? extends : false));
+        segment_offset = row;
+      }
+    }
+    segments.push_back(MakeSegment(batch.length, segment_offset,
+                                   batch.length - segment_offset,
+                                   segment_offset == 0 ? extends : false));
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      const auto key = GetKey(keys[i], (batch.length - 1) * row_steps[i]);
+      save_keys_[i] = {key.first, std::string(key.second)};
+    }
+    has_saved_keys_ = true;
+
+    return segments;
+  }
+
+ private:
+  // The validity of the key in a row, and its value as bytes which are equal if and
+  // only if the values are (or empty if the key is null)
+  using KeyView = std::pair<bool, std::string_view>;
+  using Key = std::pair<bool, std::string>;
+
+  static KeyView GetKey(const ArraySpan& array, int64_t row) {
+    if (!array.IsValid(row)) {
+      return {false, {}};
+    }
+    const int64_t index = array.offset + row;
+    switch (array.type->id()) {
+      case Type::BOOL: {
+        static constexpr char kBits[] = {0, 1};
+        return {true, std::string_view(
+                          kBits + bit_util::GetBit(array.buffers[1].data, index), 1)};
+      }
+      case Type::STRING:
+      case Type::BINARY: {
+        const auto* offsets = array.GetValues<int32_t>(1);
+        return {true, std::string_view(
+                          reinterpret_cast<const char*>(array.buffers[2].data) +
+                              offsets[row],
+                          offsets[row + 1] - offsets[row])};
+      }
+      case Type::LARGE_STRING:
+      case Type::LARGE_BINARY: {
+        const auto* offsets = array.GetValues<int64_t>(1);
+        return {true, std::string_view(
+                          reinterpret_cast<const char*>(array.buffers[2].data) +
+                              offsets[row],
+                          static_cast<size_t>(offsets[row + 1] - offsets[row]))};
+      }
+      default: {
+        const int byte_width = array.type->byte_width();
+        return {true, std::string_view(
+                          reinterpret_cast<const char*>(array.buffers[1].data) +
+                              index * byte_width,
+                          byte_width)};
+      }
+    }
+  }
+
+  static bool SameKey(const Key& saved, const KeyView& key) {
+    return saved.first == key.first && saved.second == key.second;
+  }
+
+  std::vector<Key> save_keys_;  // keys of the last row seen
+  bool has_saved_keys_ = false;
+};
+
 struct AnyKeysSegmenter : public BaseRowSegmenter {
   static Result<std::unique_ptr<RowSegmenter>> Make(
       const std::vector<TypeHolder>& key_types, ExecContext* ctx) {
@@ -314,6 +447,9 @@ Result<std::unique_ptr<RowSegmenter>> RowSegmenter::Make(
       return SimpleKeySegmenter::Make(key_types[0]);
     }
   }
+  if (ComparingKeysSegmenter::CanSegment(key_types)) {
+    return ComparingKeysSegmenter::Make(key_types);
+  }
   return AnyKeysSegmenter::Make(key_types, ctx);
 }
 
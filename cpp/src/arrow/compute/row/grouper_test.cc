@@ -364,6 +364,57 @@ TEST(RowSegmenter, MultipleSegmentsMultipleBatches) {
   }
 }
 
+TEST(RowSegmenter, NullableMultipleKeys) {
+  // Keys of these types are segmented by comparing rows instead of hashing them, which
+  // must find the same segments
+  random::RandomArrayGenerator rng(42);
+  constexpr int64_t kNumRows = 200;
+  std::vector<std::shared_ptr<Array>> keys = {
+      rng.Int32(kNumRows, 0, 1, /*null_probability=*/0.2),
+      rng.StringWithRepeats(kNumRows, /*unique=*/2, /*min_length=*/0, /*max_length=*/2,
+                            /*null_probability=*/0.2),
+      rng.Boolean(kNumRows, /*true_probability=*/0.9, /*null_probability=*/0.1),
+      rng.FixedSizeBinary(kNumRows, /*byte_width=*/1, /*null_probability=*/0.0,
+                          /*min_byte=*/'a', /*max_byte=*/'b')};
+  std::vector<TypeHolder> types;
+  for (const auto& key : keys) {
+    types.emplace_back(key->type());
+  }
+  ASSERT_OK_AND_ASSIGN(auto segmenter,
+                       RowSegmenter::Make(types, /*nullable_keys=*/true,
+                                          default_exec_context()));
+  ASSERT_OK_AND_ASSIGN(auto generic_segmenter, MakeGenericSegmenter(types));
+  for (int64_t offset = 0; offset < kNumRows; offset += 50) {
+    std::vector<Datum> values;
+    for (const auto& key : keys) {
+      values.emplace_back(key->Slice(offset, 50));
+    }
+    ExecBatch batch(std::move(values), 50);
+    ASSERT_OK_AND_ASSIGN(auto expected, generic_segmenter->GetSegments(ExecSpan(batch)));
+    TestSegments(segmenter, ExecSpan(batch), std::move(expected));
+  }
+}
+
+TEST(RowSegmenter, FloatKeysComparedByBytes) {
+  // Like hash grouping, negative and positive zeros are distinct keys, while NaNs with
+  // the same bytes are equal
+  for (const auto& type : {float32(), float64()}) {
+    SCOPED_TRACE(type->ToString());
+    ASSERT_OK_AND_ASSIGN(auto segmenter,
+                         RowSegmenter::Make({type}, /*nullable_keys=*/true,
+                                            default_exec_context()));
+    auto batch = ExecBatchFromJSON({type}, "[[0.0], [-0.0], [NaN], [NaN], [null]]");
+    TestSegments(segmenter, ExecSpan(batch),
+                 {{0, 1, false, true},
+                  {1, 1, false, false},
+                  {2, 2, false, false},
+                  {4, 1, true, false}});
+    auto next_batch = ExecBatchFromJSON({type}, "[[null], [-0.0]]");
+    TestSegments(segmenter, ExecSpan(next_batch),
+                 {{0, 1, false, true}, {1, 1, true, false}});
+  }
+}
+
 void TestRowSegmenterConstantBatch(
     const std::shared_ptr<DataType>& type,
     std::function<ArgShape(int64_t key)> shape_func,
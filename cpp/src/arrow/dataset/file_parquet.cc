@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -24,6 +25,8 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
@@ -31,6 +34,8 @@
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
@@ -41,11 +46,16 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
 #include "parquet/encryption/crypto_factory.h"
 #include "parquet/encryption/encryption.h"
 #include "parquet/encryption/kms_client.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
+#include "parquet/row_ranges.h"
+#include "parquet/schema.h"
 #include "parquet/statistics.h"
 
 namespace arrow {
@@ -189,6 +199,238 @@ std::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
                                                              *statistics);
 }
 
+// The guarantees the column index gives about each data page of a column chunk.
+std::vector<compute::Expression> PageStatisticsAsExpressions(
+    const FieldRef& field_ref, const SchemaField& schema_field,
+    const parquet::ColumnDescriptor* descr, const parquet::ColumnIndex& column_index,
+    const std::vector<parquet::RowRange>& page_ranges) {
+  const auto& null_pages = column_index.null_pages();
+  const auto& encoded_min_values = column_index.encoded_min_values();
+  const auto& encoded_max_values = column_index.encoded_max_values();
+  const bool has_null_counts = column_index.has_null_counts();
+
+  std::vector<compute::Expression> expressions(page_ranges.size(),
+                                               compute::literal(true));
+  if (null_pages.size() != page_ranges.size()) {
+    // The column index doesn't match the offset index: ignore it
+    return expressions;
+  }
+  for (size_t i = 0; i < page_ranges.size(); ++i) {
+    if (null_pages[i]) {
+      expressions[i] = compute::is_null(compute::field_ref(field_ref));
+      continue;
+    }
+    // Only non-repeated columns are considered, so that each row has a single value
+    const int64_t null_count = has_null_counts ? column_index.null_counts()[i] : 0;
+    auto statistics = parquet::Statistics::Make(
+        descr, encoded_min_values[i], encoded_max_values[i],
+        page_ranges[i].length() - null_count, null_count, /*distinct_count=*/0,
+        /*has_min_max=*/true, has_null_counts, /*has_distinct_count=*/false);
+    if (auto minmax = ParquetFileFragment::EvaluateStatisticsAsExpression(
+            *schema_field.field, field_ref, *statistics)) {
+      expressions[i] = std::move(*minmax);
+    }
+  }
+  return expressions;
+}
+
+// Find the field of the file referenced by a predicate, or nullptr if it isn't in the
+// file.
+Result<const SchemaField*> FindSchemaField(const FieldRef& ref,
+                                           const Schema& physical_schema,
+                                           const SchemaManifest& manifest) {
+  ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+
+  if (match.empty()) return nullptr;
+  const SchemaField* schema_field = &manifest.schema_fields[match[0]];
+
+  for (size_t i = 1; i < match.indices().size(); ++i) {
+    if (schema_field->field->type()->id() != Type::STRUCT) {
+      return Status::Invalid("nested paths only supported for structs");
+    }
+    schema_field = &schema_field->children[match[i]];
+  }
+  return schema_field;
+}
+
+template <typename ScalarType>
+int64_t IntegerScalarValue(const Scalar& value) {
+  return static_cast<int64_t>(checked_cast<const ScalarType&>(value).value);
+}
+
+// The hash of a value as the writer inserts it into the Bloom filter of a column, or
+// nullopt if it can't be derived reliably from the Arrow value.
+std::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                                        const parquet::ColumnDescriptor& descr,
+                                        const Scalar& value) {
+  if (!value.is_valid) return std::nullopt;
+
+  int64_t integer;
+  switch (value.type->id()) {
+    case Type::INT8:
+      integer = IntegerScalarValue<Int8Scalar>(value);
+      break;
+    case Type::INT16:
+      integer = IntegerScalarValue<Int16Scalar>(value);
+      break;
+    case Type::INT32:
+      integer = IntegerScalarValue<Int32Scalar>(value);
+      break;
+    case Type::INT64:
+      integer = IntegerScalarValue<Int64Scalar>(value);
+      break;
+    case Type::UINT8:
+      integer = IntegerScalarValue<UInt8Scalar>(value);
+      break;
+    case Type::UINT16:
+      integer = IntegerScalarValue<UInt16Scalar>(value);
+      break;
+    case Type::UINT32:
+      integer = IntegerScalarValue<UInt32Scalar>(value);
+      break;
+    case Type::UINT64:
+      integer = IntegerScalarValue<UInt64Scalar>(value);
+      break;
+    case Type::DATE32:
+      integer = IntegerScalarValue<Date32Scalar>(value);
+      break;
+    case Type::FLOAT: {
+      const float f = checked_cast<const FloatScalar&>(value).value;
+      // Values which compare equal to zero or NaN have several representations
+      if (descr.physical_type() != parquet::Type::FLOAT || f == 0 || std::isnan(f)) {
+        return std::nullopt;
+      }
+      return bloom_filter.Hash(f);
+    }
+    case Type::DOUBLE: {
+      const double d = checked_cast<const DoubleScalar&>(value).value;
+      if (descr.physical_type() != parquet::Type::DOUBLE || d == 0 || std::isnan(d)) {
+        return std::nullopt;
+      }
+      return bloom_filter.Hash(d);
+    }
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+    case Type::STRING_VIEW:
+    case Type::BINARY_VIEW:
+      if (descr.physical_type() != parquet::Type::BYTE_ARRAY) return std::nullopt;
+      return bloom_filter.Hash(checked_cast<const BaseBinaryScalar&>(value).view());
+    case Type::FIXED_SIZE_BINARY: {
+      const auto view = checked_cast<const FixedSizeBinaryScalar&>(value).view();
+      if (descr.physical_type() != parquet::Type::FIXED_LEN_BYTE_ARRAY ||
+          descr.type_length() != static_cast<int>(view.size())) {
+        return std::nullopt;
+      }
+      return bloom_filter.Hash(
+          parquet::FLBA(reinterpret_cast<const uint8_t*>(view.data())),
+          static_cast<uint32_t>(view.size()));
+    }
+    default:
+      // Other types are converted (e.g. timestamps may be coerced to another unit)
+      return std::nullopt;
+  }
+
+  // Unsigned integers are stored with the bit pattern of the signed physical type
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+      return bloom_filter.Hash(static_cast<int32_t>(integer));
+    case parquet::Type::INT64:
+      return bloom_filter.Hash(integer);
+    default:
+      return std::nullopt;
+  }
+}
+
+// Tests the equality and membership tests of a predicate against the Bloom filters of
+// a row group. The Bloom filters are only read once a test needs them.
+class RowGroupBloomFilters {
+ public:
+  RowGroupBloomFilters(parquet::RowGroupBloomFilterReader* reader,
+                       const parquet::SchemaDescriptor* descr,
+                       const Schema& physical_schema, const SchemaManifest& manifest)
+      : reader_(reader),
+        descr_(descr),
+        physical_schema_(physical_schema),
+        manifest_(manifest) {}
+
+  // Whether a row of the row group may satisfy the predicate
+  Result<bool> MayMatch(const compute::Expression& predicate) {
+    if (!predicate.IsSatisfiable()) return false;
+
+    auto call = predicate.call();
+    if (!call) return true;
+
+    if (call->function_name == "and_kleene" || call->function_name == "and") {
+      for (const auto& argument : call->arguments) {
+        ARROW_ASSIGN_OR_RAISE(bool may_match, MayMatch(argument));
+        if (!may_match) return false;
+      }
+      return true;
+    }
+    if (call->function_name == "or_kleene" || call->function_name == "or") {
+      for (const auto& argument : call->arguments) {
+        ARROW_ASSIGN_OR_RAISE(bool may_match, MayMatch(argument));
+        if (may_match) return true;
+      }
+      return false;
+    }
+
+    // Comparisons are canonicalized with the field reference on the left
+    const FieldRef* ref = call->arguments.empty() ? nullptr
+                                                  : call->arguments[0].field_ref();
+    if (ref == nullptr) return true;
+
+    if (call->function_name == "equal") {
+      const Datum* value = call->arguments[1].literal();
+      if (value == nullptr || !value->is_scalar()) return true;
+      return MayContain(*ref, *value->scalar());
+    }
+    if (call->function_name == "is_in") {
+      const auto& options =
+          checked_cast<const compute::SetLookupOptions&>(*call->options);
+      if (!options.value_set.is_array()) return true;
+      auto values = options.value_set.make_array();
+      // Nulls aren't inserted into Bloom filters
+      if (values->null_count() > 0) return true;
+      for (int64_t i = 0; i < values->length(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto value, values->GetScalar(i));
+        ARROW_ASSIGN_OR_RAISE(bool may_contain, MayContain(*ref, *value));
+        if (may_contain) return true;
+      }
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  Result<bool> MayContain(const FieldRef& ref, const Scalar& value) {
+    ARROW_ASSIGN_OR_RAISE(const SchemaField* schema_field,
+                          FindSchemaField(ref, physical_schema_, manifest_));
+    if (schema_field == nullptr || !schema_field->is_leaf() ||
+        !value.type->Equals(*schema_field->field->type())) {
+      return true;
+    }
+
+    const int column = schema_field->column_index;
+    auto it = bloom_filters_.find(column);
+    if (it == bloom_filters_.end()) {
+      it = bloom_filters_.emplace(column, reader_->GetColumnBloomFilter(column)).first;
+    }
+    if (it->second == nullptr) return true;
+
+    auto hash = BloomFilterHash(*it->second, *descr_->Column(column), value);
+    return !hash.has_value() || it->second->FindHash(*hash);
+  }
+
+  parquet::RowGroupBloomFilterReader* reader_;
+  const parquet::SchemaDescriptor* descr_;
+  const Schema& physical_schema_;
+  const SchemaManifest& manifest_;
+  std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters_;
+};
+
 void AddColumnIndices(const SchemaField& schema_field,
                       std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -301,12 +543,11 @@ Result<FieldRef> MaybeConvertFieldRef(FieldRef ref, const Schema& dataset_schema
                                 : FieldRef(std::move(named_refs));
 }
 
-// Compute the column projection based on the scan options
+// Compute the columns of the given fields
 Result<std::vector<int>> InferColumnProjection(const parquet::arrow::FileReader& reader,
-                                               const ScanOptions& options) {
+                                               const ScanOptions& options,
+                                               std::vector<FieldRef> field_refs) {
   auto manifest = reader.manifest();
-  // Checks if the field is needed in either the projection or the filter.
-  auto field_refs = options.MaterializedFields();
 
   // Build a lookup table from top level field name to field metadata.
   // This is to avoid quadratic-time mapping of projected fields to
@@ -338,6 +579,13 @@ Result<std::vector<int>> InferColumnProjection(const parquet::arrow::FileReader&
   return columns_selection;
 }
 
+// Compute the column projection based on the scan options
+Result<std::vector<int>> InferColumnProjection(const parquet::arrow::FileReader& reader,
+                                               const ScanOptions& options) {
+  // Checks if the field is needed in either the projection or the filter.
+  return InferColumnProjection(reader, options, options.MaterializedFields());
+}
+
 Status WrapSourceError(const Status& status, const std::string& path) {
   return status.WithMessage("Could not open Parquet input source '", path,
                             "': ", status.message());
@@ -606,6 +854,150 @@ struct SlicingGenerator {
   std::shared_ptr<State> state;
 };
 
+namespace {
+
+// Select the rows for which the filter mask is true, mapping the positions of the
+// mask to the rows of read_ranges, which were read to evaluate it
+Result<parquet::RowRanges> SelectRowRanges(const Datum& mask,
+                                           const parquet::RowRanges& read_ranges,
+                                           MemoryPool* pool) {
+  if (mask.is_scalar()) {
+    const auto& selected = mask.scalar_as<BooleanScalar>();
+    return selected.is_valid && selected.value ? read_ranges : parquet::RowRanges();
+  }
+  const ArrayData& data = *mask.array();
+  if (data.length != read_ranges.num_rows()) {
+    return Status::Invalid("Filter mask of length ", data.length, " for ",
+                           read_ranges.num_rows(), " rows");
+  }
+  // A null is not a match
+  ARROW_ASSIGN_OR_RAISE(auto selection,
+                        ::arrow::internal::OptionalBitmapAnd(
+                            pool, data.buffers[0], data.offset, data.buffers[1],
+                            data.offset, data.length));
+  std::vector<parquet::RowRange> selected;
+  auto range = read_ranges.ranges().begin();
+  // The position in the mask of the first row of *range
+  int64_t range_position = 0;
+  ::arrow::internal::VisitSetBitRunsVoid(
+      selection, 0, data.length, [&](int64_t position, int64_t length) {
+        while (length > 0) {
+          while (position >= range_position + range->length()) {
+            range_position += range->length();
+            ++range;
+          }
+          const int64_t begin = range->begin + position - range_position;
+          const int64_t run_length =
+              std::min(length, range_position + range->length() - position);
+          selected.push_back({begin, begin + run_length});
+          position += run_length;
+          length -= run_length;
+        }
+      });
+  return parquet::RowRanges(std::move(selected));
+}
+
+// Reads the row groups in two phases: the columns referenced by the filter are read
+// first and the filter is evaluated against them, then only the rows which satisfy
+// the filter are read from the other columns. The pages of the other columns without
+// any of these rows are skipped using the offset index.
+struct LateMaterializingReader {
+  std::shared_ptr<parquet::arrow::FileReader> reader;
+  std::shared_ptr<ScanOptions> options;
+  compute::Expression guarantee;
+  std::vector<int> column_projection;
+  std::vector<int> filter_columns;
+  std::vector<int> other_columns;
+  std::vector<int> row_groups;
+  // The rows to read of each row group
+  std::vector<parquet::RowRanges> row_ranges;
+  ::arrow::internal::Executor* cpu_executor;
+
+  Future<std::shared_ptr<RecordBatch>> ReadColumns(int row_group,
+                                                   const std::vector<int>& columns,
+                                                   const parquet::RowRanges& rows) {
+    ARROW_ASSIGN_OR_RAISE(auto generator,
+                          reader->GetRecordBatchGenerator(reader, {row_group}, columns,
+                                                          {rows}, cpu_executor));
+    return CollectAsyncGenerator(std::move(generator))
+        .Then([pool = options->pool](const RecordBatchVector& batches)
+                  -> Result<std::shared_ptr<RecordBatch>> {
+          if (batches.size() == 1) return batches[0];
+          return ConcatenateRecordBatches(batches, pool);
+        });
+  }
+
+  static Future<RecordBatchGenerator> ReadRowGroup(
+      std::shared_ptr<LateMaterializingReader> self, size_t index) {
+    const int row_group = self->row_groups[index];
+    const parquet::RowRanges& rows = self->row_ranges[index];
+    if (rows.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    return self->ReadColumns(row_group, self->filter_columns, rows)
+        .Then([self, row_group, &rows](const std::shared_ptr<RecordBatch>& filter_batch)
+                  -> Future<RecordBatchGenerator> {
+          compute::ExecContext exec_context(self->options->pool);
+          ARROW_ASSIGN_OR_RAISE(
+              auto input, compute::MakeExecBatch(*self->options->dataset_schema,
+                                                 filter_batch, self->guarantee));
+          ARROW_ASSIGN_OR_RAISE(
+              Datum mask, compute::ExecuteScalarExpression(self->options->filter, input,
+                                                           &exec_context));
+          ARROW_ASSIGN_OR_RAISE(auto selected,
+                                SelectRowRanges(mask, rows, self->options->pool));
+          if (selected.empty()) {
+            return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+          }
+          std::shared_ptr<RecordBatch> filtered_batch = filter_batch;
+          if (selected != rows) {
+            ARROW_ASSIGN_OR_RAISE(
+                Datum filtered,
+                compute::Filter(filter_batch, mask, compute::FilterOptions::Defaults(),
+                                &exec_context));
+            filtered_batch = filtered.record_batch();
+          }
+          return self->ReadColumns(row_group, self->other_columns, selected)
+              .Then([self, filtered_batch](
+                        const std::shared_ptr<RecordBatch>& other_batch)
+                        -> Result<RecordBatchGenerator> {
+                ARROW_ASSIGN_OR_RAISE(auto assembled,
+                                      self->Assemble(*filtered_batch, other_batch));
+                return MakeVectorGenerator<std::shared_ptr<RecordBatch>>(
+                    {std::move(assembled)});
+              });
+        });
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Assemble(
+      const RecordBatch& filter_batch, const std::shared_ptr<RecordBatch>& other_batch) {
+    // Assemble the fields in the order the reader would have returned them
+    std::unordered_map<int, std::pair<const RecordBatch*, int>> field_columns;
+    auto add_fields = [&](const RecordBatch* batch,
+                          const std::vector<int>& batch_columns) -> Status {
+      ARROW_ASSIGN_OR_RAISE(auto batch_fields,
+                            reader->manifest().GetFieldIndices(batch_columns));
+      for (size_t i = 0; i < batch_fields.size(); ++i) {
+        field_columns[batch_fields[i]] = {batch, static_cast<int>(i)};
+      }
+      return Status::OK();
+    };
+    RETURN_NOT_OK(add_fields(&filter_batch, filter_columns));
+    RETURN_NOT_OK(add_fields(other_batch.get(), other_columns));
+    ARROW_ASSIGN_OR_RAISE(auto all_fields,
+                          reader->manifest().GetFieldIndices(column_projection));
+    FieldVector fields;
+    ArrayVector columns;
+    for (int field : all_fields) {
+      const auto& [batch, i] = field_columns.at(field);
+      fields.push_back(batch->schema()->field(i));
+      columns.push_back(batch->column(i));
+    }
+    return RecordBatch::Make(::arrow::schema(std::move(fields)), other_batch->num_rows(),
+                             std::move(columns));
+  }
+};
+
+}  // namespace
+
 Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
@@ -634,20 +1026,84 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
                             parquet_fragment->FilterRowGroups(options->filter));
       if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
     }
-    ARROW_ASSIGN_OR_RAISE(auto column_projection,
-                          InferColumnProjection(*reader, *options));
     ARROW_ASSIGN_OR_RAISE(
         auto parquet_scan_options,
         GetFragmentScanOptions<ParquetFragmentScanOptions>(
             kParquetTypeName, options.get(), default_fragment_scan_options));
+    if (parquet_scan_options->use_bloom_filter &&
+        ExpressionHasFieldRefs(options->filter)) {
+      ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroupsByBloomFilter(
+                                            reader->parquet_reader(), options->filter,
+                                            std::move(row_groups)));
+      if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto column_projection,
+                          InferColumnProjection(*reader, *options));
     int batch_readahead = options->batch_readahead;
     int64_t rows_to_readahead = batch_readahead * options->batch_size;
     // Use the executor from scan options if provided.
     auto cpu_executor = options->cpu_executor ? options->cpu_executor
                                               : ::arrow::internal::GetCpuThreadPool();
-    ARROW_ASSIGN_OR_RAISE(auto generator, reader->GetRecordBatchGenerator(
-                                              reader, row_groups, column_projection,
-                                              cpu_executor, rows_to_readahead));
+    std::vector<parquet::RowRanges> row_ranges;
+    if (parquet_scan_options->use_page_index &&
+        ExpressionHasFieldRefs(options->filter)) {
+      ARROW_ASSIGN_OR_RAISE(row_ranges,
+                            parquet_fragment->FilterPages(reader->parquet_reader(),
+                                                          options->filter, row_groups));
+    }
+    std::vector<int> filter_columns;
+    std::vector<int> other_columns;
+    if (parquet_scan_options->late_materialization && options->dataset_schema &&
+        options->filter.IsBound() && ExpressionHasFieldRefs(options->filter)) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::vector<int> filtered_leaves,
+          InferColumnProjection(*reader, *options,
+                                compute::FieldsInExpression(options->filter)));
+      // The phases are split by top-level field, since each phase reads whole fields:
+      // a struct with a filtered child is read with all its projected children first
+      ARROW_ASSIGN_OR_RAISE(std::vector<int> filtered_fields,
+                            reader->manifest().GetFieldIndices(filtered_leaves));
+      std::unordered_set<int> filtered_field_set(filtered_fields.begin(),
+                                                 filtered_fields.end());
+      for (int column : column_projection) {
+        ARROW_ASSIGN_OR_RAISE(std::vector<int> field,
+                              reader->manifest().GetFieldIndices({column}));
+        if (filtered_field_set.count(field[0]) == 0) {
+          other_columns.push_back(column);
+        } else {
+          filter_columns.push_back(column);
+        }
+      }
+    }
+    RecordBatchGenerator generator;
+    if (!filter_columns.empty() && !other_columns.empty()) {
+      if (row_ranges.empty()) {
+        for (int row_group : row_groups) {
+          row_ranges.push_back(parquet::RowRanges::All(
+              reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows()));
+        }
+      }
+      auto late_reader = std::make_shared<LateMaterializingReader>(
+          LateMaterializingReader{reader, options,
+                                  parquet_fragment->partition_expression(),
+                                  std::move(column_projection), std::move(filter_columns),
+                                  std::move(other_columns), row_groups,
+                                  std::move(row_ranges), cpu_executor});
+      AsyncGenerator<RecordBatchGenerator> row_group_generators =
+          [late_reader, index = size_t{0}]() mutable -> Future<RecordBatchGenerator> {
+        if (index == late_reader->row_groups.size()) {
+          return AsyncGeneratorEnd<RecordBatchGenerator>();
+        }
+        return LateMaterializingReader::ReadRowGroup(late_reader, index++);
+      };
+      generator = MakeConcatenatedGenerator(std::move(row_group_generators));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          generator,
+          reader->GetRecordBatchGenerator(reader, row_groups, column_projection,
+                                          std::move(row_ranges), cpu_executor,
+                                          rows_to_readahead));
+    }
     RecordBatchGenerator sliced =
         SlicingGenerator(std::move(generator), options->batch_size);
     if (batch_readahead == 0) {
@@ -942,17 +1398,9 @@ Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
   }
 
   for (const FieldRef& ref : FieldsInExpression(predicate)) {
-    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
-
-    if (match.empty()) continue;
-    const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
-
-    for (size_t i = 1; i < match.indices().size(); ++i) {
-      if (schema_field->field->type()->id() != Type::STRUCT) {
-        return Status::Invalid("nested paths only supported for structs");
-      }
-      schema_field = &schema_field->children[match[i]];
-    }
+    ARROW_ASSIGN_OR_RAISE(const SchemaField* schema_field,
+                          FindSchemaField(ref, *physical_schema_, *manifest_));
+    if (schema_field == nullptr) continue;
 
     if (!schema_field->is_leaf()) continue;
     if (statistics_expressions_complete_[schema_field->column_index]) continue;
@@ -982,6 +1430,137 @@ Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
   return row_groups;
 }
 
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroupsByBloomFilter(
+    parquet::ParquetFileReader* reader, compute::Expression predicate,
+    std::vector<int> row_groups) {
+  ARROW_ASSIGN_OR_RAISE(auto expressions, TestRowGroups(std::move(predicate)));
+  if (expressions.empty()) return std::vector<int>{};
+
+  auto lock = physical_schema_mutex_.Lock();
+  // The predicate of each row group, simplified against its statistics
+  std::unordered_map<int, const compute::Expression*> row_group_predicates;
+  for (size_t i = 0; i < expressions.size(); ++i) {
+    row_group_predicates.emplace(row_groups_->at(i), &expressions[i]);
+  }
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto& bloom_filter_reader = reader->GetBloomFilterReader();
+  std::vector<int> selected;
+  for (int row_group : row_groups) {
+    auto it = row_group_predicates.find(row_group);
+    auto row_group_reader = bloom_filter_reader.RowGroup(row_group);
+    if (it != row_group_predicates.end() && row_group_reader != nullptr) {
+      RowGroupBloomFilters bloom_filters(row_group_reader.get(), metadata_->schema(),
+                                         *physical_schema_, *manifest_);
+      ARROW_ASSIGN_OR_RAISE(bool may_match, bloom_filters.MayMatch(*it->second));
+      if (!may_match) continue;
+    }
+    selected.push_back(row_group);
+  }
+  return selected;
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+Result<std::vector<parquet::RowRanges>> ParquetFileFragment::FilterPages(
+    parquet::ParquetFileReader* reader, compute::Expression predicate,
+    const std::vector<int>& row_groups) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  DCHECK_NE(metadata_, nullptr);
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+
+  // The non-repeated leaf columns referenced by the predicate
+  std::vector<std::pair<FieldRef, const SchemaField*>> columns;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(const SchemaField* schema_field,
+                          FindSchemaField(ref, *physical_schema_, *manifest_));
+    if (schema_field == nullptr) continue;
+
+    if (!schema_field->is_leaf() || schema_field->level_info.rep_level > 0) continue;
+    columns.emplace_back(ref, schema_field);
+  }
+  if (columns.empty()) {
+    return std::vector<parquet::RowRanges>{};
+  }
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto page_index_reader = reader->GetPageIndexReader();
+  if (page_index_reader == nullptr) {
+    return std::vector<parquet::RowRanges>{};
+  }
+
+  bool any_page_skipped = false;
+  std::vector<parquet::RowRanges> row_ranges;
+  row_ranges.reserve(row_groups.size());
+  for (int row_group : row_groups) {
+    const int64_t num_rows = metadata_->RowGroup(row_group)->num_rows();
+    auto row_group_page_index = page_index_reader->RowGroup(row_group);
+
+    // The row range and the guarantee of each page of each column which has a
+    // page index
+    std::vector<std::vector<parquet::RowRange>> page_ranges;
+    std::vector<std::vector<compute::Expression>> page_guarantees;
+    for (const auto& [ref, schema_field] : columns) {
+      if (row_group_page_index == nullptr) break;
+      const int column = schema_field->column_index;
+      auto column_index = row_group_page_index->GetColumnIndex(column);
+      auto offset_index = row_group_page_index->GetOffsetIndex(column);
+      if (column_index == nullptr || offset_index == nullptr) continue;
+
+      auto ranges = parquet::PageRowRanges(*offset_index, num_rows);
+      if (ranges.empty()) continue;
+      page_guarantees.push_back(PageStatisticsAsExpressions(
+          ref, *schema_field, metadata_->schema()->Column(column), *column_index,
+          ranges));
+      page_ranges.push_back(std::move(ranges));
+    }
+
+    // Pages of different columns don't need to be aligned: split the row group at
+    // every page boundary and test each of the resulting segments against the
+    // guarantees of the pages which cover it.
+    std::vector<int64_t> boundaries = {num_rows};
+    for (const auto& ranges : page_ranges) {
+      for (const auto& range : ranges) {
+        boundaries.push_back(range.begin);
+      }
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()),
+                     boundaries.end());
+
+    parquet::RowRanges selected;
+    std::vector<size_t> pages(page_ranges.size(), 0);
+    int64_t begin = 0;
+    for (int64_t end : boundaries) {
+      if (end <= begin) continue;
+      compute::Expression guarantee = compute::literal(true);
+      for (size_t c = 0; c < page_ranges.size(); ++c) {
+        while (pages[c] + 1 < page_ranges[c].size() &&
+               page_ranges[c][pages[c]].end <= begin) {
+          ++pages[c];
+        }
+        FoldingAnd(&guarantee, page_guarantees[c][pages[c]]);
+      }
+      ARROW_ASSIGN_OR_RAISE(guarantee, guarantee.Bind(*physical_schema_));
+      ARROW_ASSIGN_OR_RAISE(auto segment_predicate,
+                            SimplifyWithGuarantee(predicate, guarantee));
+      if (segment_predicate.IsSatisfiable()) {
+        selected.Add({begin, end});
+      } else {
+        any_page_skipped = true;
+      }
+      begin = end;
+    }
+    row_ranges.push_back(std::move(selected));
+  }
+  if (!any_page_skipped) {
+    return std::vector<parquet::RowRanges>{};
+  }
+  return row_ranges;
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
 Result<std::optional<int64_t>> ParquetFileFragment::TryCountRows(
     compute::Expression predicate) {
   DCHECK_NE(metadata_, nullptr);
@@ -34,6 +34,7 @@
 
 namespace parquet {
 class ParquetFileReader;
+class RowRanges;
 class Statistics;
 class ColumnChunkMetaData;
 class RowGroupMetaData;
@@ -208,6 +209,17 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::vector<int>> FilterRowGroups(compute::Expression predicate);
   /// Simplify the predicate against the statistics of each row group.
   Result<std::vector<compute::Expression>> TestRowGroups(compute::Expression predicate);
+  /// Return the subset of the given row groups which may satisfy the predicate
+  /// according to the Bloom filters of the columns it tests for equality.
+  Result<std::vector<int>> FilterRowGroupsByBloomFilter(
+      parquet::ParquetFileReader* reader, compute::Expression predicate,
+      std::vector<int> row_groups);
+  /// Select the rows of each of the given row groups which may satisfy the predicate,
+  /// according to the page index of the non-repeated columns it references. An empty
+  /// result means that all the rows of the row groups are selected.
+  Result<std::vector<parquet::RowRanges>> FilterPages(
+      parquet::ParquetFileReader* reader, compute::Expression predicate,
+      const std::vector<int>& row_groups);
   /// Try to count rows matching the predicate using metadata. Expects
   /// metadata to be present, and expects the predicate to have been
   /// simplified against the partition expression already.
@@ -248,6 +260,19 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   std::shared_ptr<parquet::ArrowReaderProperties> arrow_reader_properties;
   /// A configuration structure that provides decryption properties for a dataset
   std::shared_ptr<ParquetDecryptionConfig> parquet_decryption_config = NULLPTR;
+  /// Whether to evaluate the filter against the page index of the scanned row groups,
+  /// if the file has one, and skip the pages which cannot contain a matching row.
+  bool use_page_index = true;
+  /// Whether to test the equality and membership tests of the filter against the Bloom
+  /// filters of the columns, if the file has some, and skip the row groups which
+  /// cannot contain a matching row.
+  bool use_bloom_filter = true;
+  /// Whether to read the columns referenced by the filter first, and then only the
+  /// rows which satisfy the filter of the other columns. This saves decoding (and,
+  /// with the page index, reading and decompressing) most of the other columns when
+  /// the filter is selective, at the cost of evaluating the filter once more. A
+  /// struct column with a child referenced by the filter is read whole first.
+  bool late_materialization = false;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
@@ -23,9 +23,15 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/runtime_filter.h"
+#include "arrow/acero/test_util_internal.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/parquet_encryption_config.h"
+#include "arrow/dataset/plan.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/dataset/test_util_internal.h"
 #include "arrow/io/interfaces.h"
@@ -34,6 +40,7 @@
 #include "arrow/io/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/testing/builder.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
@@ -872,6 +879,308 @@ TEST_P(TestParquetFileFormatScan,
   }
 }
 
+TEST_P(TestParquetFileFormatScan, PredicatePushdownPages) {
+  constexpr int64_t kNumRows = 1000;
+  std::vector<int64_t> values(kNumRows);
+  std::vector<std::string> strings(kNumRows);
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    values[i] = i;
+    strings[i] = std::to_string(i);
+  }
+  std::shared_ptr<Array> i64, str;
+  ArrayFromVector<Int64Type, int64_t>(values, &i64);
+  ArrayFromVector<StringType, std::string>(strings, &str);
+  auto table = Table::Make(schema({field("i64", int64()), field("str", utf8())}),
+                           {i64, str});
+
+  // A single row group of 10 pages of 100 rows
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->max_rows_per_page(100)
+                        ->write_batch_size(10)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kNumRows, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto source = std::make_shared<FileSource>(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  auto check_scan = [&](compute::Expression filter, int64_t expected_rows) {
+    SetFilter(std::move(filter));
+    int64_t actual_rows = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      // The pages of both columns must be skipped in step
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           compute::Cast(batch->GetColumnByName("i64"), utf8()));
+      AssertArraysEqual(*expected.make_array(), *batch->GetColumnByName("str"));
+      actual_rows += batch->num_rows();
+    }
+    EXPECT_EQ(actual_rows, expected_rows);
+  };
+
+  check_scan(literal(true), kNumRows);
+  check_scan(equal(field_ref("i64"), literal<int64_t>(250)), 100);
+  check_scan(and_(greater_equal(field_ref("i64"), literal<int64_t>(150)),
+                  less(field_ref("i64"), literal<int64_t>(420))),
+             300);
+  check_scan(or_(less(field_ref("i64"), literal<int64_t>(50)),
+                 greater_equal(field_ref("i64"), literal<int64_t>(950))),
+             200);
+  check_scan(equal(field_ref("str"), literal("999")), 100);
+
+  // Without the page index the whole row group is read
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->use_page_index = false;
+  opts_->fragment_scan_options = fragment_scan_options;
+  check_scan(equal(field_ref("i64"), literal<int64_t>(250)), kNumRows);
+}
+
+TEST_P(TestParquetFileFormatScan, RuntimeFilterPushdownPages) {
+  dataset::internal::Initialize();
+  constexpr int64_t kNumRows = 1000;
+  std::vector<int64_t> values(kNumRows);
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    values[i] = i;
+  }
+  std::shared_ptr<Array> i64;
+  ArrayFromVector<Int64Type, int64_t>(values, &i64);
+  auto table = Table::Make(schema({field("i64", int64())}), {i64});
+
+  // A single row group of 10 pages of 100 rows
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->max_rows_per_page(100)
+                        ->write_batch_size(10)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kNumRows, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto source = std::make_shared<FileSource>(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+  auto dataset = std::make_shared<FragmentDataset>(table->schema(),
+                                                   FragmentVector{fragment});
+
+  // The filter is delivered before the plan starts, as a hash join would deliver it
+  // before its probe side is scanned
+  auto check_scan = [&](std::shared_ptr<acero::RuntimeFilter> filter,
+                        int64_t expected_rows) {
+    ASSERT_OK_AND_ASSIGN(auto plan, acero::ExecPlan::Make());
+    ASSERT_OK_AND_ASSIGN(
+        auto scan, acero::MakeExecNode("scan", plan.get(), {},
+                                       ScanNodeOptions{dataset, opts_}));
+    AsyncGenerator<std::optional<compute::ExecBatch>> sink_gen;
+    ASSERT_OK(acero::MakeExecNode("sink", plan.get(), {scan},
+                                  acero::SinkNodeOptions{&sink_gen}));
+    if (filter) {
+      auto* receiver = dynamic_cast<acero::RuntimeFilterReceiver*>(scan);
+      ASSERT_NE(nullptr, receiver);
+      ASSERT_TRUE(receiver->accepts_runtime_filters());
+      ASSERT_OK(receiver->ReceiveRuntimeFilter(std::move(filter)));
+    }
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches,
+                                  acero::StartAndCollect(plan.get(), sink_gen));
+    int64_t actual_rows = 0;
+    for (const auto& batch : batches) {
+      actual_rows += batch.length;
+    }
+    EXPECT_EQ(actual_rows, expected_rows);
+  };
+  auto key_range = [](int64_t min, int64_t max) {
+    return std::make_shared<acero::RuntimeFilter>(
+        std::vector<int>{0}, std::vector<std::shared_ptr<Scalar>>{MakeScalar(min)},
+        std::vector<std::shared_ptr<Scalar>>{MakeScalar(max)},
+        /*bloom_filter=*/nullptr);
+  };
+
+  check_scan(nullptr, kNumRows);
+  // Only the page holding the key is read
+  check_scan(key_range(250, 250), 100);
+  check_scan(key_range(150, 419), 300);
+  // The row group is skipped entirely
+  check_scan(key_range(2000, 3000), 0);
+  // A key which isn't in the files, such as an augmented field, doesn't keep the
+  // other keys from pruning
+  check_scan(std::make_shared<acero::RuntimeFilter>(
+                 std::vector<int>{0, 1},
+                 std::vector<std::shared_ptr<Scalar>>{MakeScalar(int64_t{250}),
+                                                      MakeScalar(int32_t{0})},
+                 std::vector<std::shared_ptr<Scalar>>{MakeScalar(int64_t{250}),
+                                                      MakeScalar(int32_t{0})},
+                 /*bloom_filter=*/nullptr),
+             100);
+}
+
+TEST_P(TestParquetFileFormatScan, LateMaterialization) {
+  constexpr int64_t kNumRows = 1000;
+  std::vector<int64_t> values(kNumRows);
+  std::vector<std::string> strings(kNumRows);
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    values[i] = i;
+    strings[i] = std::to_string(i);
+  }
+  std::shared_ptr<Array> i64, str;
+  ArrayFromVector<Int64Type, int64_t>(values, &i64);
+  ArrayFromVector<StringType, std::string>(strings, &str);
+  auto table = Table::Make(schema({field("i64", int64()), field("str", utf8())}),
+                           {i64, str});
+
+  // Two row groups of 5 pages of 100 rows
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->max_rows_per_page(100)
+                        ->write_batch_size(10)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kNumRows / 2, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto source = std::make_shared<FileSource>(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  auto check_scan = [&](compute::Expression filter, int64_t expected_rows) {
+    SetFilter(std::move(filter));
+    int64_t actual_rows = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      ASSERT_EQ(batch->schema()->field(0)->name(), "i64");
+      ASSERT_EQ(batch->schema()->field(1)->name(), "str");
+      // The rows of both columns must be selected in step
+      ASSERT_OK_AND_ASSIGN(auto expected, compute::Cast(batch->column(0), utf8()));
+      AssertArraysEqual(*expected.make_array(), *batch->column(1));
+      actual_rows += batch->num_rows();
+    }
+    EXPECT_EQ(actual_rows, expected_rows);
+  };
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->late_materialization = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  // Only the rows which satisfy the filter are returned, even within the pages which
+  // can't be skipped using the page index
+  check_scan(literal(true), kNumRows);
+  check_scan(equal(field_ref("i64"), literal<int64_t>(250)), 1);
+  check_scan(or_(less(field_ref("i64"), literal<int64_t>(50)),
+                 and_(greater_equal(field_ref("i64"), literal<int64_t>(480)),
+                      less(field_ref("i64"), literal<int64_t>(530)))),
+             100);
+  check_scan(equal(field_ref("str"), literal("999")), 1);
+  check_scan(equal(field_ref("i64"), literal<int64_t>(2000)), 0);
+
+  fragment_scan_options->use_page_index = false;
+  check_scan(greater_equal(field_ref("i64"), literal<int64_t>(990)), 10);
+
+  // When the filter references every projected column, the whole row group is read
+  check_scan(and_(equal(field_ref("i64"), literal<int64_t>(250)),
+                  equal(field_ref("str"), literal("250"))),
+             kNumRows / 2);
+
+  // Both phases are read asynchronously, so a single CPU thread doesn't block on
+  // the decoding of the columns
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, arrow::internal::ThreadPool::Make(1));
+  opts_->cpu_executor = thread_pool.get();
+  opts_->use_threads = true;
+  fragment_scan_options->use_page_index = true;
+  check_scan(greater_equal(field_ref("i64"), literal<int64_t>(990)), 10);
+  opts_->cpu_executor = nullptr;
+
+  // A struct with a filtered child is read with all its children before the other
+  // columns
+  ASSERT_OK_AND_ASSIGN(auto struct_array,
+                       StructArray::Make({i64, str}, std::vector<std::string>{"a", "b"}));
+  auto nested_table = Table::Make(
+      schema({field("s", struct_array->type()), field("str", utf8())}),
+      {struct_array, str});
+  sink = CreateOutputStream();
+  ASSERT_OK(
+      WriteTable(*nested_table, default_memory_pool(), sink, kNumRows / 2, properties));
+  ASSERT_OK_AND_ASSIGN(buffer, sink->Finish());
+  SetSchema(nested_table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(fragment,
+                       format_->MakeFragment(*std::make_shared<FileSource>(buffer)));
+  SetFilter(equal(field_ref(FieldRef("s", "a")), literal<int64_t>(250)));
+  int64_t actual_rows = 0;
+  for (auto maybe_batch : PhysicalBatches(fragment)) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    AssertTypeEqual(*struct_array->type(), *batch->column(0)->type());
+    const auto& s = checked_cast<const StructArray&>(*batch->column(0));
+    ASSERT_OK_AND_ASSIGN(auto expected, compute::Cast(s.field(0), utf8()));
+    AssertArraysEqual(*expected.make_array(), *s.field(1));
+    AssertArraysEqual(*s.field(1), *batch->column(1));
+    actual_rows += batch->num_rows();
+  }
+  EXPECT_EQ(actual_rows, 1);
+}
+
+TEST_P(TestParquetFileFormatScan, PredicatePushdownBloomFilter) {
+  // Row group `i` holds the values congruent to `i` modulo kNumRowGroups, so that the
+  // statistics of every row group cover about the same range of values.
+  constexpr int64_t kNumRowGroups = 8;
+  constexpr int64_t kRowGroupSize = 100;
+  std::vector<int64_t> values;
+  std::vector<std::string> strings;
+  for (int64_t i = 0; i < kNumRowGroups; ++i) {
+    for (int64_t j = 0; j < kRowGroupSize; ++j) {
+      values.push_back(j * kNumRowGroups + i);
+      strings.push_back("id-" + std::to_string(values.back()));
+    }
+  }
+  std::shared_ptr<Array> i64, str;
+  ArrayFromVector<Int64Type, int64_t>(values, &i64);
+  ArrayFromVector<StringType, std::string>(strings, &str);
+  auto table = Table::Make(schema({field("i64", int64()), field("str", utf8())}),
+                           {i64, str});
+
+  parquet::BloomFilterOptions bloom_filter_options;
+  bloom_filter_options.fpp = 0.01;
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("i64", bloom_filter_options)
+                        ->enable_bloom_filter("str", bloom_filter_options)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kRowGroupSize, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto source = std::make_shared<FileSource>(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, kNumRowGroups * kRowGroupSize, kNumRowGroups);
+
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(3 * kNumRowGroups + 5)));
+  CountRowsAndBatchesInScan(fragment, kRowGroupSize, 1);
+  SetFilter(equal(field_ref("str"), literal("id-42")));
+  CountRowsAndBatchesInScan(fragment, kRowGroupSize, 1);
+
+  auto set = ArrayFromJSON(int64(), "[17, 33, 20]");
+  SetFilter(call("is_in", {field_ref("i64")}, compute::SetLookupOptions{set}));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowGroupSize, 2);
+
+  SetFilter(or_(equal(field_ref("i64"), literal<int64_t>(2)),
+                equal(field_ref("str"), literal("id-3"))));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowGroupSize, 2);
+  SetFilter(and_(equal(field_ref("i64"), literal<int64_t>(2)),
+                 equal(field_ref("str"), literal("id-3"))));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  // Other predicates can't be tested against Bloom filters
+  SetFilter(greater(field_ref("i64"), literal<int64_t>(2)));
+  CountRowsAndBatchesInScan(fragment, kNumRowGroups * kRowGroupSize, kNumRowGroups);
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->use_bloom_filter = false;
+  opts_->fragment_scan_options = fragment_scan_options;
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(3 * kNumRowGroups + 5)));
+  CountRowsAndBatchesInScan(fragment, kNumRowGroups * kRowGroupSize, kNumRowGroups);
+}
+
 // Tests projection with nested/indexed FieldRefs.
 // https://github.com/apache/arrow/issues/35579
 TEST_P(TestParquetFileFormatScan, ProjectWithNonNamedFieldRefs) {
@@ -19,12 +19,14 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/expression_internal.h"
@@ -116,17 +118,25 @@ Future<AsyncGenerator<std::shared_ptr<Fragment>>> GetFragments(
 /// readahead is handled by the fragment (and not the scanner) because the exact details
 /// of how it is performed depend on the underlying format.
 ///
+/// A hash join downstream of the scan may publish a runtime filter once its build side
+/// is known.  Its key ranges are added to the filter of any fragment which has not
+/// started yet, which lets us skip fragments whose partition expression cannot satisfy
+/// it, and batches read from then on are filtered before they are sent downstream.
+///
 /// When a scan node is aborted (StopProducing) we send a cancel signal to any active
 /// fragments.  On destruction we continue consuming the fragments until they complete
 /// (which should be fairly quick since we cancelled the fragment).  This ensures the
 /// I/O work is completely finished before the node is destroyed.
-class ScanNode : public acero::ExecNode, public acero::TracedNode {
+class ScanNode : public acero::ExecNode,
+                 public acero::TracedNode,
+                 public acero::RuntimeFilterReceiver {
  public:
   ScanNode(acero::ExecPlan* plan, ScanV2Options options,
            std::shared_ptr<Schema> output_schema)
       : acero::ExecNode(plan, {}, {}, std::move(output_schema)),
         acero::TracedNode(this),
-        options_(std::move(options)) {}
+        options_(std::move(options)),
+        runtime_filters_(plan->query_context()) {}
 
   static Result<ScanV2Options> NormalizeAndValidate(const ScanV2Options& options,
                                                     compute::ExecContext* ctx) {
@@ -195,6 +205,26 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
   Status Init() override { return Status::OK(); }
 
+  Status ReceiveRuntimeFilter(std::shared_ptr<acero::RuntimeFilter> filter) override {
+    std::vector<std::optional<FieldRef>> key_refs;
+    for (int key_id : filter->key_ids()) {
+      key_refs.emplace_back(options_.columns[key_id]);
+    }
+    compute::Expression expression = filter->ToExpression(key_refs);
+    runtime_filters_.Add(std::move(filter), std::move(expression));
+    return Status::OK();
+  }
+
+  // The key ranges of the runtime filters received so far, or nullopt if none
+  Result<std::optional<compute::Expression>> RuntimeFilterExpression() {
+    std::optional<compute::Expression> expression = runtime_filters_.expression();
+    if (!expression) {
+      return std::nullopt;
+    }
+    return expression->Bind(*options_.dataset->schema(),
+                            plan_->query_context()->exec_context());
+  }
+
   struct KnownValue {
     std::size_t index;
     Datum value;
@@ -262,6 +292,10 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
           scan_->fragment_evolution->EvolveBatch(
               batch, node_->options_.columns, *scan_->scan_request.fragment_selection));
       compute::ExecBatch with_known_values = AddKnownValues(std::move(evolved_batch));
+      // Every scanned batch is delivered, even if the runtime filters leave it empty,
+      // since the batch count is fixed once the fragment has been inspected
+      ARROW_ASSIGN_OR_RAISE(with_known_values,
+                            node_->runtime_filters_.Apply(std::move(with_known_values)));
       node_->plan_->query_context()->ScheduleTask(
           [node = node_, output_batch = std::move(with_known_values)] {
             return node->output_->InputReceived(node, output_batch);
@@ -338,8 +372,22 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
     }
 
     Future<> BeginScan(const std::shared_ptr<InspectedFragment>& inspected_fragment) {
-      // Based on the fragment's guarantee we may not need to retrieve all the columns
       compute::Expression fragment_filter = node->options_.filter;
+      ARROW_ASSIGN_OR_RAISE(std::optional<compute::Expression> runtime_filter,
+                            node->RuntimeFilterExpression());
+      if (runtime_filter) {
+        ARROW_ASSIGN_OR_RAISE(
+            compute::Expression runtime_filter_minus_part,
+            compute::SimplifyWithGuarantee(*runtime_filter,
+                                           fragment->partition_expression()));
+        if (!runtime_filter_minus_part.IsSatisfiable()) {
+          // The runtime filters rule out every row of this fragment
+          return Future<>::MakeFinished();
+        }
+        fragment_filter = compute::and_(std::move(fragment_filter),
+                                        std::move(runtime_filter_minus_part));
+      }
+      // Based on the fragment's guarantee we may not need to retrieve all the columns
       ARROW_ASSIGN_OR_RAISE(
           compute::Expression filter_minus_part,
           compute::SimplifyWithGuarantee(std::move(fragment_filter),
@@ -463,6 +511,7 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
  private:
   ScanV2Options options_;
+  acero::RuntimeFilterSet runtime_filters_;
   std::atomic<int> num_batches_{0};
   std::shared_ptr<util::ThrottledAsyncTaskScheduler> batches_throttle_;
 };
@@ -28,6 +28,7 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/array/array_primitive.h"
 #include "arrow/array/util.h"
 #include "arrow/compute/api_aggregate.h"
@@ -292,9 +293,63 @@ class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncSc
   std::shared_ptr<Dataset> dataset_;
 };
 
+// The runtime filters received by a scan node.  Their key ranges are added to the
+// filter of each fragment when its scan starts, so a format can use them to skip data,
+// e.g. the row groups and pages of a Parquet file.  Rows are not filtered here, as the
+// join applies its Bloom filter to its probe side anyway.
+class ScanRuntimeFilters : public acero::RuntimeFilterReceiver {
+ public:
+  ScanRuntimeFilters(acero::QueryContext* ctx, std::shared_ptr<Schema> dataset_schema)
+      : filters_(ctx), dataset_schema_(std::move(dataset_schema)) {}
+
+  Status ReceiveRuntimeFilter(std::shared_ptr<acero::RuntimeFilter> filter) override {
+    std::vector<std::optional<FieldRef>> key_refs;
+    for (int key_id : filter->key_ids()) {
+      // The augmented fields follow those of the dataset and aren't in the files, so
+      // only the ranges of the other keys prune them
+      if (key_id >= dataset_schema_->num_fields()) {
+        key_refs.emplace_back(std::nullopt);
+      } else {
+        key_refs.emplace_back(dataset_schema_->field(key_id)->name());
+      }
+    }
+    compute::Expression expression = filter->ToExpression(key_refs);
+    filters_.Add(std::move(filter), std::move(expression));
+    return Status::OK();
+  }
+
+  // The options to scan a fragment with, or null if the runtime filters rule out all
+  // of its rows
+  Result<std::shared_ptr<ScanOptions>> FragmentOptions(
+      const std::shared_ptr<ScanOptions>& options, const Fragment& fragment) const {
+    std::optional<compute::Expression> expression = filters_.expression();
+    if (!expression) {
+      return options;
+    }
+    ARROW_ASSIGN_OR_RAISE(compute::Expression bound,
+                          expression->Bind(*options->dataset_schema));
+    ARROW_ASSIGN_OR_RAISE(
+        compute::Expression simplified,
+        compute::SimplifyWithGuarantee(bound, fragment.partition_expression()));
+    if (!simplified.IsSatisfiable()) {
+      return nullptr;
+    }
+    auto fragment_options = std::make_shared<ScanOptions>(*options);
+    fragment_options->filter = compute::and_(options->filter, std::move(bound));
+    ARROW_ASSIGN_OR_RAISE(fragment_options->filter,
+                          fragment_options->filter.Bind(*options->dataset_schema));
+    return fragment_options;
+  }
+
+ private:
+  acero::RuntimeFilterSet filters_;
+  const std::shared_ptr<Schema> dataset_schema_;
+};
+
 Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
     const Enumerated<std::shared_ptr<Fragment>>& fragment,
-    const std::shared_ptr<ScanOptions>& options) {
+    std::shared_ptr<ScanOptions> options,
+    const std::shared_ptr<ScanRuntimeFilters>& runtime_filters = NULLPTR) {
 #ifdef ARROW_WITH_OPENTELEMETRY
   util::tracing::Span span;
   START_SPAN(span, "Scanner::FragmentToBatches",
@@ -305,7 +360,19 @@ Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
                  {"arrow.dataset.fragment.type_name", fragment.value->type_name()},
              });
 #endif
-  ARROW_ASSIGN_OR_RAISE(auto batch_gen, fragment.value->ScanBatchesAsync(options));
+  RecordBatchGenerator batch_gen;
+  if (runtime_filters) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment_options,
+                          runtime_filters->FragmentOptions(options, *fragment.value));
+    if (fragment_options) {
+      options = std::move(fragment_options);
+    } else {
+      batch_gen = MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
+  }
+  if (!batch_gen) {
+    ARROW_ASSIGN_OR_RAISE(batch_gen, fragment.value->ScanBatchesAsync(options));
+  }
   ArrayVector columns;
   for (const auto& field : options->dataset_schema->fields()) {
     // TODO(ARROW-7051): use helper to make empty batch
@@ -332,12 +399,13 @@ Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
 }
 
 Result<AsyncGenerator<EnumeratedRecordBatchGenerator>> FragmentsToBatches(
-    FragmentGenerator fragment_gen, const std::shared_ptr<ScanOptions>& options) {
+    FragmentGenerator fragment_gen, const std::shared_ptr<ScanOptions>& options,
+    std::shared_ptr<ScanRuntimeFilters> runtime_filters = NULLPTR) {
   auto enumerated_fragment_gen = MakeEnumeratedGenerator(std::move(fragment_gen));
   auto batch_gen_gen =
       MakeMappedGenerator(std::move(enumerated_fragment_gen),
                           [=](const Enumerated<std::shared_ptr<Fragment>>& fragment) {
-                            return FragmentToBatches(fragment, options);
+                            return FragmentToBatches(fragment, options, runtime_filters);
                           });
   PROPAGATE_SPAN_TO_GENERATOR(std::move(batch_gen_gen));
   return batch_gen_gen;
@@ -1026,8 +1094,12 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
   ARROW_ASSIGN_OR_RAISE(auto fragments_vec, fragments_it.ToVector());
   auto fragment_gen = MakeVectorGenerator(std::move(fragments_vec));
 
-  ARROW_ASSIGN_OR_RAISE(auto batch_gen_gen,
-                        FragmentsToBatches(std::move(fragment_gen), scan_options));
+  auto runtime_filters =
+      std::make_shared<ScanRuntimeFilters>(plan->query_context(),
+                                           scan_options->dataset_schema);
+  ARROW_ASSIGN_OR_RAISE(
+      auto batch_gen_gen,
+      FragmentsToBatches(std::move(fragment_gen), scan_options, runtime_filters));
 
   AsyncGenerator<EnumeratedRecordBatch> merged_batch_gen;
   if (require_sequenced_output) {
@@ -1087,9 +1159,10 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
     }
   }
 
-  return acero::MakeExecNode(
-      "source", plan, {},
-      acero::SourceNodeOptions{schema(std::move(fields)), std::move(gen), ordering});
+  acero::SourceNodeOptions source_options{schema(std::move(fields)), std::move(gen),
+                                          ordering};
+  source_options.runtime_filter_receiver = std::move(runtime_filters);
+  return acero::MakeExecNode("source", plan, {}, source_options);
 }
 
 Result<acero::ExecNode*> MakeAugmentedProjectNode(acero::ExecPlan* plan,
@@ -25,6 +25,9 @@
 #include <gmock/gmock.h>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/runtime_filter.h"
+#include "arrow/acero/test_util_internal.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
@@ -781,6 +784,71 @@ TEST(TestNewScanner, PartitionSkip) {
   }
 }
 
+TEST(TestNewScanner, RuntimeFilter) {
+  internal::Initialize();
+  // Only the second fragment has keys that join with the build side, whose runtime
+  // filter may or may not arrive before each fragment is scanned
+  std::shared_ptr<Table> build_side = TableFromJSON(
+      schema({field("key", int16()), field("payload", utf8())}), {R"([[50, "a"]])"});
+  for (bool disable_bloom_filter : {false, true}) {
+    ARROW_SCOPED_TRACE("disable_bloom_filter=", disable_bloom_filter);
+    std::shared_ptr<MockDataset> test_dataset = MakePartitionSkipDataset();
+    test_dataset->DeliverBatchesInOrder(false);
+    ScanV2Options options(test_dataset);
+    options.columns = ScanV2Options::AllColumns(*test_dataset->schema());
+
+    acero::HashJoinNodeOptions join_options(acero::JoinType::INNER, {"filterable"},
+                                            {"key"}, literal(true), "", "",
+                                            disable_bloom_filter);
+    acero::Declaration plan(
+        "hashjoin",
+        {acero::Declaration("scan2", options),
+         acero::Declaration("table_source", acero::TableSourceNodeOptions(build_side))},
+        std::move(join_options));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> joined,
+                         acero::DeclarationToTable(std::move(plan)));
+    ASSERT_EQ(kRowsPerTestBatch, joined->num_rows());
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<RecordBatch> combined,
+                         joined->CombineChunksToBatch());
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> sort_indices,
+                         compute::SortIndices(*combined->column(0)));
+    ASSERT_OK_AND_ASSIGN(Datum sorted_row_nums,
+                         compute::Take(combined->column(0), sort_indices));
+    AssertArraysEqual(*MakeTestBatch(1)->column(0), *sorted_row_nums.make_array());
+  }
+}
+
+TEST(TestNewScanner, RuntimeFilterSkipsFragment) {
+  internal::Initialize();
+  std::shared_ptr<MockDataset> test_dataset = MakePartitionSkipDataset();
+  test_dataset->DeliverBatchesInOrder(false);
+  ScanV2Options options(test_dataset);
+  options.columns = ScanV2Options::AllColumns(*test_dataset->schema());
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<acero::ExecPlan> plan, acero::ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(acero::ExecNode * scan,
+                       acero::MakeExecNode("scan2", plan.get(), {}, options));
+  AsyncGenerator<std::optional<compute::ExecBatch>> sink_gen;
+  ASSERT_OK(acero::MakeExecNode("sink", plan.get(), {scan},
+                                acero::SinkNodeOptions{&sink_gen}));
+
+  // Deliver the filter before starting so that it is known when the fragments are
+  // scanned.  Only the second fragment's partition overlaps the key range.
+  auto* receiver = dynamic_cast<acero::RuntimeFilterReceiver*>(scan);
+  ASSERT_NE(nullptr, receiver);
+  ASSERT_OK(receiver->ReceiveRuntimeFilter(std::make_shared<acero::RuntimeFilter>(
+      std::vector<int>{1}, std::vector<std::shared_ptr<Scalar>>{MakeScalar(int16_t(50))},
+      std::vector<std::shared_ptr<Scalar>>{MakeScalar(int16_t(50))},
+      /*bloom_filter=*/nullptr)));
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(std::vector<compute::ExecBatch> batches,
+                                acero::StartAndCollect(plan.get(), sink_gen));
+  ASSERT_EQ(1, batches.size());
+  ASSERT_EQ(kRowsPerTestBatch, batches[0].length);
+  ASSERT_FALSE(test_dataset->HasStartedFragment(0));
+  ASSERT_TRUE(test_dataset->HasStartedFragment(1));
+}
+
 TEST(TestNewScanner, NoFragments) {
   internal::Initialize();
   std::shared_ptr<Schema> test_schema = ScannerTestSchema();
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/hyperloglog_internal.h"
+
+#include <cmath>
+#include <limits>
+
+#include "arrow/status.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+constexpr uint8_t kSerializationVersion = 1;
+
+// sigma and tau functions of Ertl's improved raw estimator, correcting for the
+// registers which are still zero and for those which are saturated
+double Sigma(double x) {
+  if (x == 1) return std::numeric_limits<double>::infinity();
+  double y = 1;
+  double z = x;
+  while (true) {
+    x *= x;
+    const double z_prev = z;
+    z += x * y;
+    y += y;
+    if (z == z_prev) return z;
+  }
+}
+
+double Tau(double x) {
+  if (x == 0 || x == 1) return 0;
+  double y = 1;
+  double z = 1 - x;
+  while (true) {
+    x = std::sqrt(x);
+    const double z_prev = z;
+    y *= 0.5;
+    z -= (1 - x) * (1 - x) * y;
+    if (z == z_prev) return z / 3;
+  }
+}
+
+}  // namespace
+
+HyperLogLog::HyperLogLog(int precision)
+    : precision_(precision), registers_(static_cast<size_t>(1) << precision, 0) {
+  DCHECK_GE(precision, kMinPrecision);
+  DCHECK_LE(precision, kMaxPrecision);
+}
+
+Status HyperLogLog::ValidatePrecision(int precision) {
+  if (precision < kMinPrecision || precision > kMaxPrecision) {
+    return Status::Invalid("HyperLogLog precision must be between ", kMinPrecision,
+                           " and ", kMaxPrecision, ", got ", precision);
+  }
+  return Status::OK();
+}
+
+void HyperLogLog::Reset() { std::fill(registers_.begin(), registers_.end(), 0); }
+
+Status HyperLogLog::Merge(const HyperLogLog& other) {
+  if (other.precision_ != precision_) {
+    return Status::Invalid("Cannot merge HyperLogLog sketches of precision ",
+                           other.precision_, " and ", precision_);
+  }
+  for (size_t i = 0; i < registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+  return Status::OK();
+}
+
+double HyperLogLog::Estimate() const {
+  const int q = 64 - precision_;
+  const auto m = static_cast<double>(registers_.size());
+
+  // histogram of the register values
+  std::vector<int64_t> counts(q + 2, 0);
+  for (uint8_t value : registers_) {
+    ++counts[value];
+  }
+  if (counts[0] == static_cast<int64_t>(registers_.size())) return 0;
+
+  double z = m * Tau(1 - static_cast<double>(counts[q + 1]) / m);
+  for (int k = q; k >= 1; --k) {
+    z = 0.5 * (z + static_cast<double>(counts[k]));
+  }
+  z += m * Sigma(static_cast<double>(counts[0]) / m);
+  // alpha for an infinite number of registers, i.e. 1 / (2 * ln(2))
+  constexpr double kAlpha = 0.7213475204444817;
+  return kAlpha * m * m / z;
+}
+
+bool HyperLogLog::is_empty() const {
+  return std::all_of(registers_.begin(), registers_.end(),
+                     [](uint8_t value) { return value == 0; });
+}
+
+std::string HyperLogLog::Serialize() const {
+  std::string out;
+  out.reserve(2 + registers_.size());
+  out.push_back(static_cast<char>(kSerializationVersion));
+  out.push_back(static_cast<char>(precision_));
+  out.append(registers_.begin(), registers_.end());
+  return out;
+}
+
+Result<HyperLogLog> HyperLogLog::Deserialize(std::string_view data) {
+  if (data.size() < 2 || static_cast<uint8_t>(data[0]) != kSerializationVersion) {
+    return Status::Invalid("Invalid serialized HyperLogLog sketch");
+  }
+  const int precision = static_cast<uint8_t>(data[1]);
+  if (!ValidatePrecision(precision).ok() ||
+      data.size() != 2 + (static_cast<size_t>(1) << precision)) {
+    return Status::Invalid("Invalid serialized HyperLogLog sketch of precision ",
+                           precision, " and size ", data.size());
+  }
+  HyperLogLog sketch(precision);
+  const int max_rank = 64 - precision + 1;
+  for (size_t i = 0; i < sketch.registers_.size(); ++i) {
+    const auto value = static_cast<uint8_t>(data[2 + i]);
+    if (value > max_rank) {
+      return Status::Invalid("Invalid serialized HyperLogLog sketch: register value ",
+                             static_cast<int>(value), " is out of range");
+    }
+    sketch.registers_[i] = value;
+  }
+  return sketch;
+}
+
+}  // namespace internal
+}  // namespace arrow
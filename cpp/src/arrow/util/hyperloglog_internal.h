@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// approximate distinct counts from arbitrary length dataset with O(1) space
+// based on 'HyperLogLog: the analysis of a near-optimal cardinality estimation
+// algorithm' from Flajolet et al., with the estimator of 'New cardinality estimation
+// algorithms for HyperLogLog sketches' from Ertl
+// - https://arxiv.org/abs/1702.01284
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+  static constexpr int kDefaultPrecision = 12;
+
+  // a sketch of 2^precision registers, the relative standard error of the estimate
+  // is about 1.04 / sqrt(2^precision)
+  explicit HyperLogLog(int precision = kDefaultPrecision);
+
+  // check that a precision is supported
+  static Status ValidatePrecision(int precision);
+
+  int precision() const { return precision_; }
+
+  // reset and re-use this sketch
+  void Reset();
+
+  // add the hash of a value, the hash is remixed so that hashes which are only
+  // well distributed in their low bits can be used
+  // this function is intensively called and performance critical
+  void Add(uint64_t hash) {
+    hash = Mix(hash);
+    const uint64_t index = hash >> (64 - precision_);
+    // the position of the first set bit among the remaining 64 - precision bits,
+    // or 64 - precision + 1 if there is none
+    const uint64_t remaining = hash << precision_;
+    const auto rank = static_cast<uint8_t>(
+        std::min(std::countl_zero(remaining), 64 - precision_) + 1);
+    registers_[index] = std::max(registers_[index], rank);
+  }
+
+  // merge with another sketch of the same precision, called infrequently
+  Status Merge(const HyperLogLog& other);
+
+  // estimate the number of distinct hashes added
+  double Estimate() const;
+
+  // check if no hash has been added
+  bool is_empty() const;
+
+  // binary representation of the sketch, which can be stored and merged later
+  std::string Serialize() const;
+  static Result<HyperLogLog> Deserialize(std::string_view data);
+
+ private:
+  // the finalizer of MurmurHash3
+  static uint64_t Mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  int precision_;
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog_internal.h"
+
+namespace arrow {
+namespace internal {
+
+// The integer hash of hashing.h is only well distributed in some of its bits,
+// the sketch must cope with that
+void AddRange(HyperLogLog* sketch, uint64_t begin, uint64_t end) {
+  for (uint64_t i = begin; i < end; ++i) {
+    sketch->Add(ScalarHelper<uint64_t>::ComputeHash(i));
+  }
+}
+
+void AssertEstimateNear(const HyperLogLog& sketch, double expected) {
+  // Allow for 4 standard errors
+  const double tolerance =
+      4 * 1.04 / std::sqrt(static_cast<double>(uint64_t{1} << sketch.precision()));
+  ASSERT_NEAR(sketch.Estimate(), expected, expected * tolerance);
+}
+
+TEST(HyperLogLogTest, ValidatePrecision) {
+  ASSERT_OK(HyperLogLog::ValidatePrecision(HyperLogLog::kMinPrecision));
+  ASSERT_OK(HyperLogLog::ValidatePrecision(HyperLogLog::kMaxPrecision));
+  ASSERT_RAISES(Invalid, HyperLogLog::ValidatePrecision(HyperLogLog::kMinPrecision - 1));
+  ASSERT_RAISES(Invalid, HyperLogLog::ValidatePrecision(HyperLogLog::kMaxPrecision + 1));
+}
+
+TEST(HyperLogLogTest, Empty) {
+  HyperLogLog sketch;
+  ASSERT_TRUE(sketch.is_empty());
+  ASSERT_EQ(sketch.Estimate(), 0);
+}
+
+TEST(HyperLogLogTest, Estimate) {
+  for (int precision : {HyperLogLog::kMinPrecision, HyperLogLog::kDefaultPrecision,
+                        HyperLogLog::kMaxPrecision}) {
+    ARROW_SCOPED_TRACE("precision = ", precision);
+    for (uint64_t num_distinct : {1, 10, 1000, 100000, 1000000}) {
+      ARROW_SCOPED_TRACE("num_distinct = ", num_distinct);
+      HyperLogLog sketch(precision);
+      // Duplicates do not change the estimate
+      AddRange(&sketch, 0, num_distinct);
+      AddRange(&sketch, 0, num_distinct);
+      ASSERT_FALSE(sketch.is_empty());
+      AssertEstimateNear(sketch, static_cast<double>(num_distinct));
+    }
+  }
+}
+
+TEST(HyperLogLogTest, Merge) {
+  HyperLogLog left, right, all;
+  AddRange(&left, 0, 60000);
+  AddRange(&right, 40000, 100000);
+  AddRange(&all, 0, 100000);
+  ASSERT_OK(left.Merge(right));
+  ASSERT_EQ(left.Estimate(), all.Estimate());
+  AssertEstimateNear(left, 100000);
+
+  HyperLogLog other_precision(HyperLogLog::kDefaultPrecision + 1);
+  ASSERT_RAISES(Invalid, left.Merge(other_precision));
+
+  left.Reset();
+  ASSERT_TRUE(left.is_empty());
+}
+
+TEST(HyperLogLogTest, Serialize) {
+  HyperLogLog sketch(10);
+  AddRange(&sketch, 0, 5000);
+  const std::string serialized = sketch.Serialize();
+  ASSERT_OK_AND_ASSIGN(auto deserialized, HyperLogLog::Deserialize(serialized));
+  ASSERT_EQ(deserialized.precision(), 10);
+  ASSERT_EQ(deserialized.Estimate(), sketch.Estimate());
+  ASSERT_EQ(deserialized.Serialize(), serialized);
+
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(""));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(serialized.substr(1)));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(serialized.substr(0, 100)));
+  std::string out_of_range = serialized;
+  out_of_range.back() = static_cast<char>(64);
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(out_of_range));
+}
+
+}  // namespace internal
+}  // namespace arrow
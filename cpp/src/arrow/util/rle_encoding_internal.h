@@ -462,6 +462,12 @@ class RleBitPackedDecoder {
   /// left or if an error occurred.
   [[nodiscard]] rle_size_t GetBatch(value_type* out, rle_size_t batch_size);
 
+  /// Skip a batch of values without decoding them and return the number of skipped
+  /// elements.
+  /// May skip fewer elements than requested if there are not enough values left or if
+  /// an error occurred.
+  [[nodiscard]] rle_size_t Advance(rle_size_t batch_size);
+
   /// Like GetBatch but add spacing for null entries.
   ///
   /// Null entries will be set to an arbistrary value to avoid leaking private data.
@@ -833,6 +839,49 @@ auto RleBitPackedDecoder<T>::GetBatch(value_type* out,
   return values_read;
 }
 
+template <typename T>
+auto RleBitPackedDecoder<T>::Advance(rle_size_t batch_size) -> rle_size_t {
+  using ControlFlow = RleBitPackedParser::ControlFlow;
+
+  if (ARROW_PREDICT_FALSE(batch_size == 0 || exhausted())) {
+    return 0;
+  }
+
+  rle_size_t values_skipped = 0;
+
+  // Remaining from a previous call that would have left some unread data from a run.
+  if (ARROW_PREDICT_FALSE(run_remaining() > 0)) {
+    values_skipped +=
+        std::visit([&](auto& dec) { return dec.Advance(batch_size); }, decoder_);
+
+    // Either we skipped all the batch or we finished remaining run.
+    if (ARROW_PREDICT_FALSE(values_skipped == batch_size)) {
+      return values_skipped;
+    }
+    ARROW_DCHECK(run_remaining() == 0);
+  }
+
+  parser_.ParseWithCallable([&](auto run) {
+    using RunDecoder =
+        typename RleBitPackedDecoderGetRunDecoder<value_type, decltype(run)>::type;
+
+    ARROW_DCHECK_LT(values_skipped, batch_size);
+    RunDecoder decoder(run, value_bit_width_);
+    const auto skipped = decoder.Advance(batch_size - values_skipped);
+    values_skipped += skipped;
+
+    // Stop skipping and store remaining decoder
+    if (ARROW_PREDICT_FALSE(values_skipped == batch_size || skipped == 0)) {
+      decoder_ = std::move(decoder);
+      return ControlFlow::Break;
+    }
+
+    return ControlFlow::Continue;
+  });
+
+  return values_skipped;
+}
+
 namespace internal {
 
 /// Utility class to safely handle values and null count without too error-prone
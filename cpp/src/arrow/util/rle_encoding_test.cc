@@ -873,6 +873,44 @@ TEST(RleBitPacked, BitWidthZeroLiteral) {
   EXPECT_FALSE(decoder.Get(&val));
 }
 
+TEST(RleBitPacked, Advance) {
+  // Alternate repeated and literal runs
+  constexpr int kBitWidth = 5;
+  std::vector<int> values;
+  for (int run = 0; run < 20; ++run) {
+    for (int i = 0; i < 37; ++i) {
+      values.push_back(run % 2 == 0 ? run : (i * 7) % 32);
+    }
+  }
+  std::vector<uint8_t> buffer(
+      static_cast<size_t>(RleBitPackedEncoder::MaxBufferSize(kBitWidth, 1000)));
+  RleBitPackedEncoder encoder(buffer.data(), static_cast<int>(buffer.size()), kBitWidth);
+  for (int value : values) {
+    ASSERT_TRUE(encoder.Put(value));
+  }
+  const int encoded_len = encoder.Flush();
+
+  for (int skip : {1, 5, 37, 100}) {
+    ARROW_SCOPED_TRACE("skip = ", skip);
+    RleBitPackedDecoder<int> decoder(buffer.data(), encoded_len, kBitWidth);
+    const int read = 3;
+    size_t position = 0;
+    std::vector<int> values_read(read);
+    while (position + skip + read <= values.size()) {
+      ASSERT_EQ(decoder.Advance(skip), skip);
+      position += skip;
+      ASSERT_EQ(decoder.GetBatch(values_read.data(), read), read);
+      ASSERT_EQ(values_read, std::vector<int>(values.begin() + position,
+                                              values.begin() + position + read));
+      position += read;
+    }
+    const auto remaining = static_cast<int>(values.size() - position);
+    // Values padding the last literal run may also be skipped
+    ASSERT_GE(decoder.Advance(remaining + 100), remaining);
+    ASSERT_EQ(decoder.Advance(1), 0);
+  }
+}
+
 // Test that writes out a repeated group and then a literal
 // group but flush before finishing.
 TEST(BitRle, Flush) {
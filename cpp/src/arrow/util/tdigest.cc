@@ -19,13 +19,16 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <queue>
 #include <tuple>
 #include <vector>
 
+#include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/math_constants.h"
 
@@ -34,6 +37,24 @@ namespace internal {
 
 namespace {
 
+constexpr uint8_t kSerializationVersion = 1;
+
+template <typename T>
+void AppendLittleEndian(T value, std::string* out) {
+  const auto bits = bit_util::ToLittleEndian(value);
+  out->append(reinterpret_cast<const char*>(&bits), sizeof(bits));
+}
+
+template <typename T>
+bool ReadLittleEndian(std::string_view* data, T* out) {
+  if (data->size() < sizeof(T)) return false;
+  T bits;
+  std::memcpy(&bits, data->data(), sizeof(T));
+  *out = bit_util::FromLittleEndian(bits);
+  data->remove_prefix(sizeof(T));
+  return true;
+}
+
 // a numerically stable lerp is unbelievably complex
 // but we are *approximating* the quantile, so let's keep it simple
 double Lerp(double a, double b, double t) { return a + t * (b - a); }
@@ -132,10 +153,13 @@ class TDigestMerger : private T {
 
 class TDigest::TDigestImpl {
  public:
-  explicit TDigestImpl(uint32_t delta)
+  explicit TDigestImpl(uint32_t delta) : TDigestImpl(delta, delta) {}
+
+  // reserve room for `num_centroids` centroids only
+  TDigestImpl(uint32_t delta, uint32_t num_centroids)
       : delta_(delta > 10 ? delta : 10), merger_(delta_) {
-    tdigests_[0].reserve(delta_);
-    tdigests_[1].reserve(delta_);
+    tdigests_[0].reserve(std::min(num_centroids, delta_));
+    tdigests_[1].reserve(std::min(num_centroids, delta_));
     Reset();
   }
 
@@ -341,6 +365,49 @@ class TDigest::TDigestImpl {
 
   double total_weight() const { return total_weight_; }
 
+  // layout: version, delta, min, max, number of centroids, (mean, weight) of each
+  // centroid, all little-endian
+  void Serialize(std::string* out) const {
+    const auto& td = tdigests_[current_];
+    out->push_back(static_cast<char>(kSerializationVersion));
+    AppendLittleEndian(delta_, out);
+    AppendLittleEndian(min_, out);
+    AppendLittleEndian(max_, out);
+    AppendLittleEndian(static_cast<uint32_t>(td.size()), out);
+    for (const auto& centroid : td) {
+      AppendLittleEndian(centroid.mean, out);
+      AppendLittleEndian(centroid.weight, out);
+    }
+  }
+
+  // load `num_centroids` centroids of a serialized tdigest of the same delta, whose
+  // header was read and checked against the length of `data`, see
+  // TDigest::Deserialize
+  Status Deserialize(double min, double max, uint32_t num_centroids,
+                     std::string_view data) {
+    Reset();
+    auto& td = tdigests_[current_];
+    min_ = min;
+    max_ = max;
+    for (uint32_t i = 0; i < num_centroids; ++i) {
+      Centroid centroid;
+      ReadLittleEndian(&data, &centroid.mean);
+      ReadLittleEndian(&data, &centroid.weight);
+      td.push_back(centroid);
+      total_weight_ += centroid.weight;
+    }
+    if (td.empty()) {
+      min_ = std::numeric_limits<double>::max();
+      max_ = std::numeric_limits<double>::lowest();
+      return Status::OK();
+    }
+    if (std::isnan(min_) || std::isnan(max_) || min_ > td.front().mean ||
+        max_ < td.back().mean) {
+      return Status::Invalid("Invalid serialized tdigest: inconsistent min and max");
+    }
+    return Validate();
+  }
+
  private:
   // must be declared before merger_, see constructor initialization list
   const uint32_t delta_;
@@ -360,6 +427,12 @@ TDigest::TDigest(uint32_t delta, uint32_t buffer_size) : impl_(new TDigestImpl(d
   Reset();
 }
 
+TDigest::TDigest(std::unique_ptr<TDigestImpl> impl, uint32_t buffer_size)
+    : impl_(std::move(impl)) {
+  input_.reserve(buffer_size);
+  Reset();
+}
+
 TDigest::~TDigest() = default;
 TDigest::TDigest(TDigest&&) = default;
 TDigest& TDigest::operator=(TDigest&&) = default;
@@ -411,6 +484,40 @@ bool TDigest::is_empty() const {
   return input_.size() == 0 && impl_->total_weight() == 0;
 }
 
+std::string TDigest::Serialize() const {
+  MergeInput();
+  std::string out;
+  impl_->Serialize(&out);
+  return out;
+}
+
+Result<TDigest> TDigest::Deserialize(std::string_view data, uint32_t buffer_size) {
+  // Check the header against the length of the data before allocating anything
+  uint8_t version;
+  uint32_t delta, num_centroids;
+  double min, max;
+  if (!ReadLittleEndian(&data, &version) || version != kSerializationVersion ||
+      !ReadLittleEndian(&data, &delta) || !ReadLittleEndian(&data, &min) ||
+      !ReadLittleEndian(&data, &max) || !ReadLittleEndian(&data, &num_centroids)) {
+    return Status::Invalid("Invalid serialized tdigest: truncated header");
+  }
+  if (data.size() != static_cast<uint64_t>(num_centroids) * 2 * sizeof(double)) {
+    return Status::Invalid("Invalid serialized tdigest: expected ", num_centroids,
+                           " centroids, got ", data.size(), " bytes");
+  }
+  if (num_centroids > std::max<uint32_t>(delta, 10)) {
+    return Status::Invalid("Invalid serialized tdigest: ", num_centroids,
+                           " centroids for a delta of ", delta);
+  }
+  if (buffer_size == 0) {
+    return Status::Invalid("tdigest buffer_size must be positive");
+  }
+  // A large delta doesn't allocate more than the centroids found in the data
+  TDigest tdigest(std::make_unique<TDigestImpl>(delta, num_centroids), buffer_size);
+  RETURN_NOT_OK(tdigest.impl_->Deserialize(min, max, num_centroids, data));
+  return tdigest;
+}
+
 void TDigest::MergeInput() const {
   if (input_.size() > 0) {
     impl_->MergeInput(input_);  // will mutate input_
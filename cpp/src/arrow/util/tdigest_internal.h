@@ -24,6 +24,8 @@
 
 #include <cmath>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "arrow/util/logging.h"
@@ -33,6 +35,8 @@
 namespace arrow {
 
 class Status;
+template <typename T>
+class Result;
 
 namespace internal {
 
@@ -88,7 +92,18 @@ class ARROW_EXPORT TDigest {
   // check if this tdigest contains no valid data points
   bool is_empty() const;
 
+  // binary representation of the tdigest, which can be stored and merged later
+  std::string Serialize() const;
+  // the header of `data` is checked against its length before anything is allocated,
+  // returning Status::Invalid for truncated or corrupt data
+  static Result<TDigest> Deserialize(std::string_view data,
+                                     uint32_t buffer_size = 500);
+
  private:
+  class TDigestImpl;
+
+  TDigest(std::unique_ptr<TDigestImpl> impl, uint32_t buffer_size);
+
   // merge input data with current tdigest
   void MergeInput() const;
 
@@ -96,7 +111,6 @@ class ARROW_EXPORT TDigest {
   mutable std::vector<double> input_;
 
   // hide other members with pimpl
-  class TDigestImpl;
   std::unique_ptr<TDigestImpl> impl_;
 };
 
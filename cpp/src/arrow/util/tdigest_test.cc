@@ -25,14 +25,17 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <numeric>
 #include <vector>
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/tdigest_internal.h"
 
 namespace arrow {
@@ -232,6 +235,89 @@ TEST(TDigestTest, MergeNonUniform) {
 #endif
 }
 
+TEST(TDigestTest, Serialize) {
+  const std::vector<double> quantiles = {0, 0.01, 0.1, 0.5, 0.9, 0.99, 1};
+  std::vector<double> values;
+  random_real(10000, 0x11223344, -1000, 1000, &values);
+
+  TDigest td(100), td_other(100);
+  for (size_t i = 0; i < values.size(); ++i) {
+    (i % 2 ? td : td_other).Add(values[i]);
+  }
+  ASSERT_OK_AND_ASSIGN(auto deserialized, TDigest::Deserialize(td.Serialize()));
+  ASSERT_OK(deserialized.Validate());
+  for (double q : quantiles) {
+    ASSERT_EQ(deserialized.Quantile(q), td.Quantile(q)) << q;
+  }
+  ASSERT_EQ(deserialized.Serialize(), td.Serialize());
+
+  // deserialized tdigests can be merged with others
+  ASSERT_OK_AND_ASSIGN(auto deserialized_other,
+                       TDigest::Deserialize(td_other.Serialize()));
+  td.Merge(td_other);
+  deserialized.Merge(deserialized_other);
+  ASSERT_OK(deserialized.Validate());
+  for (double q : quantiles) {
+    ASSERT_EQ(deserialized.Quantile(q), td.Quantile(q)) << q;
+  }
+
+  // empty tdigest
+  ASSERT_OK_AND_ASSIGN(auto empty, TDigest::Deserialize(TDigest().Serialize()));
+  ASSERT_TRUE(empty.is_empty());
+
+  const std::string serialized = td.Serialize();
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(""));
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized.substr(1)));
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized.substr(0, 40)));
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized + "x"));
+}
+
+TEST(TDigestTest, DeserializeCorrupt) {
+  TDigest td(100);
+  for (int i = 0; i < 1000; ++i) {
+    td.Add(i);
+  }
+  const std::string serialized = td.Serialize();
+  // layout: version (1 byte), delta (4), min (8), max (8), number of centroids (4)
+  auto with_uint32 = [](std::string data, size_t offset, uint32_t value) {
+    const uint32_t bits = bit_util::ToLittleEndian(value);
+    std::memcpy(data.data() + offset, &bits, sizeof(bits));
+    return data;
+  };
+  constexpr size_t kDeltaOffset = 1, kNumCentroidsOffset = 21;
+
+  // truncated input
+  for (size_t length : {size_t{1}, size_t{5}, size_t{24}, size_t{25}, size_t{33}}) {
+    ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized.substr(0, length)));
+  }
+  // a number of centroids which doesn't match the length, including one that would
+  // overflow 32-bit arithmetic
+  for (uint32_t num_centroids : {0u, 1u, 1u << 28, 0xffffffffu}) {
+    const auto corrupt = with_uint32(serialized, kNumCentroidsOffset, num_centroids);
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("centroids, got"),
+                                    TDigest::Deserialize(corrupt));
+  }
+  // more centroids than delta allows
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("for a delta of 10"),
+      TDigest::Deserialize(with_uint32(serialized, kDeltaOffset, 10)));
+  // centroids too large for their delta
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("oversized centroid"),
+      TDigest::Deserialize(with_uint32(serialized, kDeltaOffset, 0xffffffffu)));
+  // a huge delta doesn't allocate more than the centroids present
+  ASSERT_OK_AND_ASSIGN(auto huge_delta,
+                       TDigest::Deserialize(with_uint32(TDigest().Serialize(),
+                                                        kDeltaOffset, 0xffffffffu)));
+  ASSERT_TRUE(huge_delta.is_empty());
+  // no buffer
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized, /*buffer_size=*/0));
+  // centroids out of order
+  std::string unordered = serialized;
+  std::swap_ranges(unordered.end() - 16, unordered.end(), unordered.end() - 32);
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(unordered));
+}
+
 TEST(TDigestTest, Misc) {
   const size_t size = 100000;
   const double min = -1000, max = 1000;
@@ -18,10 +18,12 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <vector>
@@ -395,11 +397,96 @@ void SerialExecutor::RunLoop() {
 
 #ifdef ARROW_ENABLE_THREADING
 
+namespace {
+
+// A worker runs this many tasks from its own queue at most before it looks at the
+// shared queue, so that tasks spawned from outside the pool are not starved
+constexpr int kLocalTasksPerSharedCheck = 32;
+
+// A worker runs at most this many tasks in a row from the `next` slot of its queue
+// while older tasks wait, so that a chain of tasks spawning each other doesn't starve
+// them
+constexpr int kMaxConsecutiveNextTasks = 4;
+
+// The tasks spawned by one worker thread.  The task spawned last is kept aside to
+// run next, so that a continuation runs while its data is most likely still in the
+// worker's cache.  Older tasks run in the order they were spawned.  Idle workers
+// steal the oldest task.
+struct WorkerQueue {
+  std::mutex mutex;
+  std::optional<Task> next;
+  std::deque<Task> tasks;
+  int consecutive_next = 0;
+
+  void Push(Task task) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (next) {
+      tasks.push_back(std::move(*next));
+    }
+    next = std::move(task);
+  }
+
+  // Take the task for the worker owning the queue to run
+  std::optional<Task> Pop() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (next && (tasks.empty() || consecutive_next < kMaxConsecutiveNextTasks)) {
+      ++consecutive_next;
+      return TakeNextUnlocked();
+    }
+    consecutive_next = 0;
+    return PopFrontUnlocked();
+  }
+
+  // Take the oldest task, for another worker
+  std::optional<Task> Steal() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tasks.empty()) {
+      return TakeNextUnlocked();
+    }
+    return PopFrontUnlocked();
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    next.reset();
+    tasks.clear();
+  }
+
+  bool empty() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !next && tasks.empty();
+  }
+
+ private:
+  std::optional<Task> TakeNextUnlocked() {
+    std::optional<Task> task = std::move(next);
+    next.reset();
+    return task;
+  }
+
+  std::optional<Task> PopFrontUnlocked() {
+    if (tasks.empty()) return std::nullopt;
+    Task task = std::move(tasks.front());
+    tasks.pop_front();
+    return task;
+  }
+};
+
+// Identifies the thread pool, and the local queue, of a worker thread
+struct CurrentWorker {
+  ThreadPool* pool;
+  WorkerQueue* queue;
+};
+
+}  // namespace
+
 struct ThreadPool::State {
   State() = default;
 
-  // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
-  // such as https://github.com/cameron314/concurrentqueue
+  // Tasks spawned from outside the pool, or with a non-default priority, go to a
+  // shared queue.  Tasks spawned by a worker go to the worker's own queue, which
+  // other workers only take from when they run out of work.  This keeps a pipeline
+  // of tasks on one core, and spares the shared lock when all workers are busy.
 
   std::mutex mutex_;
   std::condition_variable cv_;
@@ -411,19 +498,71 @@ struct ThreadPool::State {
   std::vector<std::thread> finished_workers_;
   std::priority_queue<QueuedTask> pending_tasks_;
   uint64_t spawned_tasks_count_ = 0;
+  // The local queues of the running workers
+  std::vector<WorkerQueue*> worker_queues_;
+  // Where the next steal starts looking, to spread steals over the workers
+  size_t steal_start_ = 0;
 
   // Desired number of threads
   int desired_capacity_ = 0;
 
   // Total number of tasks that are either queued or running
-  int tasks_queued_or_running_ = 0;
+  std::atomic<int> tasks_queued_or_running_{0};
+  // Number of workers waiting for tasks
+  std::atomic<int> num_sleeping_{0};
+  // Whether there are fewer workers than the desired capacity
+  std::atomic<bool> can_grow_{false};
 
   // Are we shutting down?
-  bool please_shutdown_ = false;
-  bool quick_shutdown_ = false;
+  std::atomic<bool> please_shutdown_{false};
+  std::atomic<bool> quick_shutdown_{false};
 
   std::vector<std::shared_ptr<Resource>> kept_alive_resources_;
 
+  void UpdateCanGrowUnlocked() {
+    can_grow_ = static_cast<int>(workers_.size()) < desired_capacity_;
+  }
+
+  bool AnyLocalTasksUnlocked() {
+    return std::any_of(worker_queues_.begin(), worker_queues_.end(),
+                       [](WorkerQueue* queue) { return !queue->empty(); });
+  }
+
+  std::optional<Task> PopPendingUnlocked() {
+    if (pending_tasks_.empty()) return std::nullopt;
+    Task task = std::move(const_cast<Task&>(pending_tasks_.top().task));
+    pending_tasks_.pop();
+    return task;
+  }
+
+  std::optional<Task> StealUnlocked(WorkerQueue* thief) {
+    const size_t num_queues = worker_queues_.size();
+    for (size_t i = 0; i < num_queues; ++i) {
+      WorkerQueue* victim = worker_queues_[(steal_start_ + i) % num_queues];
+      if (victim == thief) continue;
+      if (auto task = victim->Steal()) {
+        steal_start_ = (steal_start_ + i + 1) % num_queues;
+        return task;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void FinishTask() {
+    DCHECK_GT(tasks_queued_or_running_.load(), 0);
+    if (ARROW_PREDICT_FALSE(--tasks_queued_or_running_ == 0)) {
+      {
+        // Synchronize with threads checking the count before they wait
+        std::lock_guard<std::mutex> lock(mutex_);
+      }
+      cv_idle_.notify_all();
+      if (please_shutdown_) {
+        // Workers wait for all tasks to finish before exiting
+        cv_.notify_all();
+      }
+    }
+  }
+
   // At-fork machinery
 
   void BeforeFork() { mutex_.lock(); }
@@ -438,25 +577,54 @@ struct ThreadPool::State {
     desired_capacity_ = desired_capacity;
     please_shutdown_ = please_shutdown;
     quick_shutdown_ = quick_shutdown;
+    UpdateCanGrowUnlocked();
   }
 
   std::shared_ptr<AtForkHandler> atfork_handler_;
 };
 
+static void RunTask(ThreadPool::State* state, Task task) {
+  StopToken* stop_token = &task.stop_token;
+  if (!stop_token->IsStopRequested()) {
+    std::move(task.callable)();
+  } else {
+    if (task.stop_callback) {
+      std::move(task.stop_callback)(stop_token->Poll());
+    }
+  }
+  {
+    auto tmp_task = std::move(task);  // release resources before updating the count
+    ARROW_UNUSED(tmp_task);
+  }
+  state->FinishTask();
+}
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
-                       std::list<std::thread>::iterator it) {
+                       std::list<std::thread>::iterator it, WorkerQueue* local_queue) {
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
   // (LaunchWorkersUnlocked has exited)
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  state->worker_queues_.push_back(local_queue);
 
   // If too many threads, we should secede from the pool
   const auto should_secede = [&]() -> bool {
     return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
   };
+  // Whether the worker may exit once it finds no task.  When shutting down, tasks
+  // still running may spawn more tasks on their local queue, which they may then wait
+  // for, so wait for all of them.
+  const auto should_exit = [&]() -> bool {
+    return state->quick_shutdown_ ||
+           (state->please_shutdown_ && state->tasks_queued_or_running_ == 0) ||
+           should_secede();
+  };
+
+  // The number of tasks run since the worker last looked at the shared queue
+  int local_tasks_run = 0;
 
   while (true) {
     // By the time this thread is started, some tasks may have been pushed
@@ -464,44 +632,66 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
     // condition variable at the end of the loop.
 
     // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
+    while (!state->quick_shutdown_) {
       // We check this opportunistically at each loop iteration since
       // it releases the lock below.
       if (should_secede()) {
         break;
       }
 
-      DCHECK_GE(state->tasks_queued_or_running_, 0);
-      {
-        Task task = std::move(const_cast<Task&>(state->pending_tasks_.top().task));
-        state->pending_tasks_.pop();
-        StopToken* stop_token = &task.stop_token;
-        lock.unlock();
-        if (!stop_token->IsStopRequested()) {
-          std::move(task.callable)();
-        } else {
-          if (task.stop_callback) {
-            std::move(task.stop_callback)(stop_token->Poll());
-          }
-        }
-        {
-          auto tmp_task = std::move(task);  // release resources before waiting for lock
-          ARROW_UNUSED(tmp_task);
-        }
-        lock.lock();
+      std::optional<Task> task;
+      if (local_tasks_run >= kLocalTasksPerSharedCheck) {
+        task = state->PopPendingUnlocked();
+        local_tasks_run = 0;
       }
-      if (ARROW_PREDICT_FALSE(--state->tasks_queued_or_running_ == 0)) {
-        state->cv_idle_.notify_all();
+      if (!task) task = local_queue->Pop();
+      if (!task) {
+        task = state->PopPendingUnlocked();
+        local_tasks_run = 0;
       }
+      if (!task) task = state->StealUnlocked(local_queue);
+      if (!task) break;
+
+      lock.unlock();
+      RunTask(state.get(), std::move(*task));
+      ++local_tasks_run;
+      // Tasks spawned by the task we just ran are on our queue and don't need the lock
+      while (!state->quick_shutdown_ && local_tasks_run < kLocalTasksPerSharedCheck &&
+             (task = local_queue->Pop())) {
+        RunTask(state.get(), std::move(*task));
+        ++local_tasks_run;
+      }
+      lock.lock();
     }
-    // Now either the queue is empty *or* a quick shutdown was requested
-    if (state->please_shutdown_ || should_secede()) {
+    // Now the queues are empty *or* a quick shutdown was requested *or* we should
+    // secede
+    if (should_exit()) {
       break;
     }
-    // Wait for next wakeup
-    state->cv_.wait(lock);
+    // Wait for next wakeup.  Workers push to their local queue without the lock, so
+    // look again once they can see we are waiting.
+    ++state->num_sleeping_;
+    if (local_queue->empty() && !state->AnyLocalTasksUnlocked()) {
+      state->cv_.wait(lock);
+    }
+    --state->num_sleeping_;
+  }
+  DCHECK_GE(state->tasks_queued_or_running_.load(), 0);
+
+  // Hand over the tasks left on our queue, or drop them if shutting down quickly
+  if (state->quick_shutdown_) {
+    local_queue->Clear();
+  } else {
+    while (auto task = local_queue->Steal()) {
+      state->pending_tasks_.push(
+          QueuedTask{std::move(*task), /*priority=*/0, state->spawned_tasks_count_++});
+    }
+    if (!state->pending_tasks_.empty()) {
+      state->cv_.notify_one();
+    }
   }
-  DCHECK_GE(state->tasks_queued_or_running_, 0);
+  state->worker_queues_.erase(std::find(state->worker_queues_.begin(),
+                                        state->worker_queues_.end(), local_queue));
 
   // We're done.  Move our thread object to the trashcan of finished
   // workers.  This has two motivations:
@@ -513,6 +703,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
   state->finished_workers_.push_back(std::move(*it));
   state->workers_.erase(it);
+  state->UpdateCanGrowUnlocked();
   if (state->please_shutdown_) {
     // Notify the function waiting in Shutdown().
     state->cv_shutdown_.notify_one();
@@ -575,6 +766,7 @@ Status ThreadPool::SetCapacity(int threads) {
   CollectFinishedWorkersUnlocked();
 
   state_->desired_capacity_ = threads;
+  state_->UpdateCanGrowUnlocked();
   // See if we need to increase or decrease the number of running threads
   const int required = std::min(static_cast<int>(state_->pending_tasks_.size()),
                                 threads - static_cast<int>(state_->workers_.size()));
@@ -593,10 +785,7 @@ int ThreadPool::GetCapacity() {
   return state_->desired_capacity_;
 }
 
-int ThreadPool::GetNumTasks() {
-  std::unique_lock<std::mutex> lock(state_->mutex_);
-  return state_->tasks_queued_or_running_;
-}
+int ThreadPool::GetNumTasks() { return state_->tasks_queued_or_running_; }
 
 int ThreadPool::GetActualCapacity() {
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -609,8 +798,8 @@ Status ThreadPool::Shutdown(bool wait) {
   if (state_->please_shutdown_) {
     return Status::Invalid("Shutdown() already called");
   }
-  state_->please_shutdown_ = true;
   state_->quick_shutdown_ = !wait;
+  state_->please_shutdown_ = true;
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
@@ -659,12 +848,12 @@ DWORD GetPoolTlsIndex() {
 }
 }  // namespace
 
-static ThreadPool* GetCurrentThreadPool() {
+static CurrentWorker* GetCurrentWorker() {
   // Preserve the caller's last-error value while also detecting TLS failures.
   DWORD original_error = GetLastError();
   // Ensure a successful TlsGetValue() leaves GetLastError() == 0.
   SetLastError(0);
-  auto* pool = static_cast<ThreadPool*>(TlsGetValue(GetPoolTlsIndex()));
+  auto* worker = static_cast<CurrentWorker*>(TlsGetValue(GetPoolTlsIndex()));
   DWORD tls_error = GetLastError();
   if (tls_error != 0) {
     // No need to restore original_error here: ARROW_LOG(FATAL) aborts the process.
@@ -673,24 +862,27 @@ static ThreadPool* GetCurrentThreadPool() {
   }
   // Restore the caller's last-error value.
   SetLastError(original_error);
-  return pool;
+  return worker;
 }
 
-static void SetCurrentThreadPool(ThreadPool* pool) {
-  BOOL ok = TlsSetValue(GetPoolTlsIndex(), pool);
+static void SetCurrentWorker(CurrentWorker* worker) {
+  BOOL ok = TlsSetValue(GetPoolTlsIndex(), worker);
   if (!ok) {
     ARROW_LOG(FATAL) << "TlsSetValue failed for thread pool TLS: "
                      << WinErrorMessage(GetLastError());
   }
 }
 #  else
-thread_local ThreadPool* current_thread_pool_ = nullptr;
+thread_local CurrentWorker* current_worker_ = nullptr;
 
-static ThreadPool* GetCurrentThreadPool() { return current_thread_pool_; }
-static void SetCurrentThreadPool(ThreadPool* pool) { current_thread_pool_ = pool; }
+static CurrentWorker* GetCurrentWorker() { return current_worker_; }
+static void SetCurrentWorker(CurrentWorker* worker) { current_worker_ = worker; }
 #  endif
 
-bool ThreadPool::OwnsThisThread() { return GetCurrentThreadPool() == this; }
+bool ThreadPool::OwnsThisThread() {
+  CurrentWorker* worker = GetCurrentWorker();
+  return worker != nullptr && worker->pool == this;
+}
 
 void ThreadPool::LaunchWorkersUnlocked(int threads) {
   std::shared_ptr<State> state = sp_state_;
@@ -699,10 +891,14 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
     *it = std::thread([this, state, it] {
-      SetCurrentThreadPool(this);
-      WorkerLoop(state, it);
+      WorkerQueue queue;
+      CurrentWorker worker{this, &queue};
+      SetCurrentWorker(&worker);
+      WorkerLoop(state, it, &queue);
+      SetCurrentWorker(nullptr);
     });
   }
+  state_->UpdateCanGrowUnlocked();
 }
 
 Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken stop_token,
@@ -724,6 +920,32 @@ Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken sto
               ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
     task = std::move(wrapper);
 #  endif
+    CurrentWorker* worker = GetCurrentWorker();
+    if (worker != nullptr && worker->pool == this && hints.priority == 0) {
+      // Spawned by one of our workers: queue it locally.  The shared lock is only
+      // needed to wake up or launch another worker, which may then steal it.
+      if (state_->please_shutdown_) {
+        return Status::Invalid("operation forbidden during or after shutdown");
+      }
+      ++state_->tasks_queued_or_running_;
+      worker->queue->Push(
+          Task{std::move(task), std::move(stop_token), std::move(stop_callback)});
+      if (state_->num_sleeping_ > 0) {
+        {
+          std::lock_guard<std::mutex> lock(state_->mutex_);
+        }
+        state_->cv_.notify_one();
+      } else if (state_->can_grow_) {
+        std::lock_guard<std::mutex> lock(state_->mutex_);
+        if (static_cast<int>(state_->workers_.size()) <
+                state_->tasks_queued_or_running_ &&
+            state_->desired_capacity_ > static_cast<int>(state_->workers_.size())) {
+          LaunchWorkersUnlocked(/*threads=*/1);
+        }
+      }
+      return Status::OK();
+    }
+
     std::lock_guard<std::mutex> lock(state_->mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
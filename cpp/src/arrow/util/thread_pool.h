@@ -61,9 +61,10 @@ ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 namespace internal {
 
 // Hints about a task that may be used by an Executor.
-// They are ignored by the provided ThreadPool implementation.
+// The provided ThreadPool implementation only uses the priority.
 struct TaskHints {
-  // The lower, the more urgent
+  // The lower, the more urgent.  A non-zero priority sends a task spawned by a
+  // worker thread to the shared queue instead of the worker's own queue.
   int32_t priority = 0;
   // The IO transfer size in bytes
   int64_t io_size = -1;
@@ -437,8 +438,14 @@ class ARROW_EXPORT SerialExecutor : public Executor {
 
 #ifdef ARROW_ENABLE_THREADING
 
-/// An Executor implementation spawning tasks in FIFO manner on a fixed-size
-/// pool of worker threads.
+/// An Executor implementation spawning tasks on a fixed-size pool of worker threads.
+///
+/// Tasks spawned from outside the pool run in FIFO order (within a priority).  Tasks
+/// spawned by a worker thread are queued on that worker: the task spawned last runs
+/// next, so that a chain of tasks over the same data stays on one core, and the others
+/// run in FIFO order.  Workers regularly look at the shared queue so that it isn't
+/// starved by their own tasks.  A worker without work takes the oldest task of another
+/// worker.
 ///
 /// Note: Any sort of nested parallelism will deadlock this executor.  Blocking waits are
 /// fine but if one task needs to wait for another task it must be expressed as an
@@ -636,6 +636,90 @@ TEST_F(TestThreadPool, TasksOfEqualPriorityRunInSpawnOrder) {
   }
 }
 
+TEST_F(TestThreadPool, WorkerSpawnedTasksOrder) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  auto pool = this->MakeThreadPool(1);
+  constexpr int kNumTasks = 10;
+  std::vector<int> order;
+
+  ASSERT_OK(pool->Spawn([&] {
+    for (int i = 0; i < kNumTasks; ++i) {
+      ASSERT_OK(pool->Spawn([&order, i] { order.push_back(i); }));
+    }
+  }));
+  pool->WaitForIdle();
+  ASSERT_OK(pool->Shutdown());
+
+  // The task spawned last runs first, then the others in FIFO order
+  ASSERT_EQ(order.size(), kNumTasks);
+  ASSERT_EQ(order[0], kNumTasks - 1);
+  for (int i = 1; i < kNumTasks; ++i) {
+    ASSERT_EQ(order[i], i - 1);
+  }
+}
+
+TEST_F(TestThreadPool, WorkerSpawnedTasksDoNotStarveSharedQueue) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  auto pool = this->MakeThreadPool(1);
+  std::atomic<bool> done{false};
+  // A chain of tasks that keeps the only worker busy with its own queue until the
+  // task submitted from outside the pool runs
+  std::function<void()> respawn = [&] {
+    if (!done) {
+      ASSERT_OK(pool->Spawn(respawn));
+    }
+  };
+  ASSERT_OK(pool->Spawn(respawn));
+  ASSERT_OK_AND_ASSIGN(auto external, pool->Submit([&] { done = true; }));
+  ASSERT_FINISHES_OK(external);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, WorkerSpawnedTasksAreStolen) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  auto pool = this->MakeThreadPool(4);
+  Future<> child_started = Future<>::Make();
+  std::atomic<bool> stolen{false};
+
+  // The parent blocks its worker, so the child can only run if another worker
+  // takes it from the parent's queue
+  ASSERT_OK_AND_ASSIGN(auto parent, pool->Submit([&] {
+    auto parent_thread = std::this_thread::get_id();
+    ASSERT_OK(pool->Spawn([&, parent_thread] {
+      stolen = std::this_thread::get_id() != parent_thread;
+      child_started.MarkFinished();
+    }));
+    ASSERT_TRUE(child_started.Wait(kDefaultAssertFinishesWaitSeconds));
+  }));
+  ASSERT_FINISHES_OK(parent);
+  ASSERT_TRUE(stolen);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, StressRecursiveSpawn) {
+  auto pool = this->MakeThreadPool(8);
+  std::atomic<int> count{0};
+  // Each task spawns two children until a depth of 10, for 2047 tasks in total
+  std::function<void(int)> spawn_tree = [&](int depth) {
+    ++count;
+    if (depth == 0) return;
+    ASSERT_OK(pool->Spawn([&, depth] { spawn_tree(depth - 1); }));
+    ASSERT_OK(pool->Spawn([&, depth] { spawn_tree(depth - 1); }));
+  };
+  ASSERT_OK(pool->Spawn([&] { spawn_tree(10); }));
+  // Spawning fails once shutdown has started, so wait for the whole tree first
+  pool->WaitForIdle();
+  ASSERT_EQ(count.load(), 2047);
+  ASSERT_EQ(pool->GetNumTasks(), 0);
+  ASSERT_OK(pool->Shutdown());
+}
+
 TEST_F(TestThreadPool, StressSpawn) {
   auto pool = this->MakeThreadPool(30);
   SpawnAdds(pool.get(), 1000, task_add<int>);
@@ -24,8 +24,10 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <type_traits>
@@ -52,6 +54,7 @@
 #include "arrow/testing/util.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"  // for ARROW_CSV and PARQUET_REQUIRE_ENCRYPTION
 #include "arrow/util/decimal.h"
@@ -59,6 +62,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 
 #ifdef ARROW_CSV
 #  include "arrow/csv/api.h"
@@ -75,6 +79,7 @@
 #include "parquet/arrow/writer.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
@@ -2767,6 +2772,192 @@ TEST(TestArrowReadWrite, GetRecordBatchGenerator) {
   }
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchReaderRowRanges) {
+  constexpr int64_t kNumRows = 1000;
+  constexpr int64_t kRowGroupSize = 500;
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64()),
+                                 ::arrow::field("b", ::arrow::utf8()),
+                                 ::arrow::field("c", ::arrow::list(::arrow::int32()))});
+  ::arrow::random::RandomArrayGenerator rag(/*seed=*/42);
+  std::shared_ptr<Array> a;
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(Iota<int64_t>(kNumRows), &a);
+  auto table = Table::Make(
+      schema, {a,
+               rag.String(kNumRows, /*min_length=*/0, /*max_length=*/10,
+                          /*null_probability=*/0.2),
+               rag.List(*rag.Int32(kNumRows * 2, 0, 100), kNumRows,
+                        /*null_probability=*/0.2)});
+
+  // Both rows selected within a page and whole pages are skipped
+  const std::vector<RowRanges> row_ranges = {RowRanges({{5, 10}, {240, 320}}),
+                                             RowRanges({{0, 1}, {450, 600}})};
+  std::vector<std::shared_ptr<Table>> slices;
+  for (size_t i = 0; i < row_ranges.size(); ++i) {
+    for (const auto& range : row_ranges[i].ranges()) {
+      slices.push_back(table->Slice(i * kRowGroupSize + range.begin,
+                                    std::min(range.end, kRowGroupSize) - range.begin));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(slices));
+
+  for (bool write_page_index : {false, true}) {
+    ARROW_SCOPED_TRACE("write_page_index = ", write_page_index);
+    WriterProperties::Builder builder;
+    builder.max_rows_per_page(50)->write_batch_size(10);
+    if (write_page_index) builder.enable_write_page_index();
+    ASSERT_OK_AND_ASSIGN(auto buffer,
+                         WriteTableToBuffer(table, kRowGroupSize, builder.build()));
+
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_batch_size(64);
+    std::shared_ptr<FileReader> reader;
+    {
+      std::unique_ptr<FileReader> unique_reader;
+      FileReaderBuilder reader_builder;
+      ASSERT_OK(reader_builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(reader_builder.properties(properties)->Build(&unique_reader));
+      reader = std::move(unique_reader);
+    }
+
+    ASSERT_OK_AND_ASSIGN(auto batch_reader,
+                         reader->GetRecordBatchReader({0, 1}, {0, 1, 2}, row_ranges));
+    ASSERT_OK_AND_ASSIGN(auto actual, batch_reader->ToTable());
+    ASSERT_OK(actual->ValidateFull());
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    ASSERT_OK_AND_ASSIGN(auto generator, reader->GetRecordBatchGenerator(
+                                             reader, {0, 1}, {0, 1, 2}, row_ranges));
+    ASSERT_OK_AND_ASSIGN(auto batches,
+                         ::arrow::CollectAsyncGenerator(generator).result());
+    ASSERT_OK_AND_ASSIGN(actual, Table::FromRecordBatches(expected->schema(), batches));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    // No columns
+    ASSERT_OK_AND_ASSIGN(batch_reader,
+                         reader->GetRecordBatchReader({0, 1}, {}, row_ranges));
+    ASSERT_OK_AND_ASSIGN(actual, batch_reader->ToTable());
+    ASSERT_EQ(actual->num_rows(), expected->num_rows());
+
+    ASSERT_RAISES(Invalid, reader->GetRecordBatchReader({0, 1}, {0}, {row_ranges[0]}));
+  }
+}
+
+// A file which records the byte ranges read from it
+class ReadRecordingFile : public ::arrow::io::RandomAccessFile {
+ public:
+  explicit ReadRecordingFile(std::shared_ptr<Buffer> buffer)
+      : reader_(std::make_shared<BufferReader>(std::move(buffer))) {}
+
+  Status Close() override { return reader_->Close(); }
+  bool closed() const override { return reader_->closed(); }
+  Result<int64_t> Tell() const override { return reader_->Tell(); }
+  Status Seek(int64_t position) override { return reader_->Seek(position); }
+  Result<int64_t> GetSize() override { return reader_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t position, reader_->Tell());
+    Record(position, nbytes);
+    return reader_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t position, reader_->Tell());
+    Record(position, nbytes);
+    return reader_->Read(nbytes);
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, bool allow_short_read,
+                         void* out) override {
+    Record(position, nbytes);
+    return reader_->ReadAt(position, nbytes, allow_short_read, out);
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    return ReadAt(position, nbytes, /*allow_short_read=*/true, out);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes,
+                                         bool allow_short_read) override {
+    Record(position, nbytes);
+    return reader_->ReadAt(position, nbytes, allow_short_read);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return ReadAt(position, nbytes, /*allow_short_read=*/true);
+  }
+
+  std::vector<::arrow::io::ReadRange> reads() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return reads_;
+  }
+
+ private:
+  void Record(int64_t position, int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reads_.push_back({position, nbytes});
+  }
+
+  std::shared_ptr<BufferReader> reader_;
+  mutable std::mutex mutex_;
+  std::vector<::arrow::io::ReadRange> reads_;
+};
+
+TEST(TestArrowReadWrite, GetRecordBatchReaderRowRangesReadsSelectedPages) {
+  constexpr int64_t kNumRows = 1000;
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64())});
+  std::shared_ptr<Array> a;
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(Iota<int64_t>(kNumRows), &a);
+  auto table = Table::Make(schema, {a});
+  WriterProperties::Builder builder;
+  builder.max_rows_per_page(50)->write_batch_size(10)->enable_write_page_index();
+  ASSERT_OK_AND_ASSIGN(auto buffer, WriteTableToBuffer(table, kNumRows, builder.build()));
+
+  const std::vector<RowRanges> row_ranges = {RowRanges({{5, 10}, {240, 320}})};
+  ASSERT_OK_AND_ASSIGN(
+      auto expected,
+      ::arrow::ConcatenateTables({table->Slice(5, 5), table->Slice(240, 80)}));
+
+  // The byte ranges of the pages without any selected row
+  auto offset_index = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer))
+                          ->GetPageIndexReader()
+                          ->RowGroup(0)
+                          ->GetOffsetIndex(0);
+  ASSERT_NE(offset_index, nullptr);
+  const std::vector<RowRange> pages = PageRowRanges(*offset_index, kNumRows);
+  std::vector<::arrow::io::ReadRange> skipped_pages;
+  for (size_t i = 0; i < pages.size(); ++i) {
+    if (!row_ranges[0].Overlaps(pages[i])) {
+      const PageLocation& location = offset_index->page_locations()[i];
+      skipped_pages.push_back({location.offset, location.compressed_page_size});
+    }
+  }
+  ASSERT_EQ(skipped_pages.size(), 16);
+
+  for (bool pre_buffer : {false, true}) {
+    ARROW_SCOPED_TRACE("pre_buffer = ", pre_buffer);
+    auto file = std::make_shared<ReadRecordingFile>(buffer);
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_pre_buffer(pre_buffer);
+    // Don't coalesce the selected pages with the skipped ones in between
+    ::arrow::io::CacheOptions cache_options = ::arrow::io::CacheOptions::Defaults();
+    cache_options.hole_size_limit = 0;
+    properties.set_cache_options(cache_options);
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder reader_builder;
+    ASSERT_OK(reader_builder.Open(file));
+    ASSERT_OK(reader_builder.properties(properties)->Build(&reader));
+
+    ASSERT_OK_AND_ASSIGN(auto batch_reader,
+                         reader->GetRecordBatchReader({0}, {0}, row_ranges));
+    ASSERT_OK_AND_ASSIGN(auto actual, batch_reader->ToTable());
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    for (const auto& read : file->reads()) {
+      for (const auto& page : skipped_pages) {
+        ASSERT_FALSE(read.offset < page.offset + page.length &&
+                     page.offset < read.offset + read.length)
+            << "read of " << read.length << " bytes at " << read.offset
+            << " overlaps skipped page at " << page.offset;
+      }
+    }
+  }
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -5146,10 +5337,128 @@ TEST_P(TestArrowReadDictionary, ReadWholeFileDense) {
   CheckReadWholeFile(*expected_dense_);
 }
 
+TEST_P(TestArrowReadDictionary, ReadUnifiedDict) {
+  properties_.set_read_dictionary(0, true);
+  properties_.set_unify_dictionaries(true);
+  WriteSimple();
+
+  // All the row groups are read as a single batch sharing one dictionary
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  ASSERT_OK_AND_ASSIGN(auto table, reader->ReadTable());
+  ASSERT_OK(table->ValidateFull());
+  auto column = table->column(0);
+  ASSERT_EQ(column->num_chunks(), options.num_row_groups);
+  const auto& dictionary =
+      checked_cast<const ::arrow::DictionaryArray&>(*column->chunk(0)).dictionary();
+  for (const auto& chunk : column->chunks()) {
+    const auto& dict_chunk = checked_cast<const ::arrow::DictionaryArray&>(*chunk);
+    AssertArraysEqual(*dictionary, *dict_chunk.dictionary());
+  }
+  ASSERT_OK_AND_ASSIGN(auto dense, ::arrow::compute::Cast(column, ::arrow::utf8()));
+  ::arrow::AssertChunkedEquivalent(*expected_dense_->column(0), *dense.chunked_array());
+
+  // Each batch extends the dictionary of the previous ones, and reuses it as is when
+  // it has no new values (e.g. the second batch of a row group)
+  properties_.set_batch_size(
+      std::max<int64_t>(options.num_rows / options.num_row_groups / 2, 1));
+  ASSERT_OK_AND_ASSIGN(reader, GetReader());
+  ASSERT_OK_AND_ASSIGN(auto batch_reader, reader->GetRecordBatchReader());
+  std::shared_ptr<Array> previous_dictionary;
+  int64_t offset = 0;
+  for (std::shared_ptr<::arrow::RecordBatch> batch;;) {
+    ASSERT_OK(batch_reader->ReadNext(&batch));
+    if (!batch) break;
+    const auto& array = checked_cast<const ::arrow::DictionaryArray&>(*batch->column(0));
+    if (previous_dictionary) {
+      ASSERT_LE(previous_dictionary->length(), array.dictionary()->length());
+      AssertArraysEqual(*previous_dictionary,
+                        *array.dictionary()->Slice(0, previous_dictionary->length()));
+      if (previous_dictionary->length() == array.dictionary()->length()) {
+        ASSERT_EQ(previous_dictionary.get(), array.dictionary().get());
+      }
+    }
+    previous_dictionary = array.dictionary();
+    ASSERT_OK_AND_ASSIGN(auto dense, ::arrow::compute::Cast(array, ::arrow::utf8()));
+    AssertArraysEqual(*dense_values_->Slice(offset, array.length()), *dense);
+    offset += array.length();
+  }
+  ASSERT_EQ(offset, options.num_rows);
+
+  // The generator decodes each row group with new column readers, possibly
+  // concurrently, but they share the dictionaries unified so far
+  ASSERT_OK_AND_ASSIGN(reader, GetReader());
+  std::shared_ptr<FileReader> shared_reader = std::move(reader);
+  ASSERT_OK_AND_ASSIGN(auto generator,
+                       shared_reader->GetRecordBatchGenerator(
+                           shared_reader, ::arrow::internal::Iota(options.num_row_groups),
+                           {0}, ::arrow::internal::GetCpuThreadPool(),
+                           /*rows_to_readahead=*/options.num_rows));
+  ASSERT_OK_AND_ASSIGN(auto batches, ::arrow::CollectAsyncGenerator(generator).result());
+  std::shared_ptr<Array> largest_dictionary;
+  for (const auto& batch : batches) {
+    const auto& array = checked_cast<const ::arrow::DictionaryArray&>(*batch->column(0));
+    if (!largest_dictionary ||
+        array.dictionary()->length() > largest_dictionary->length()) {
+      largest_dictionary = array.dictionary();
+    }
+  }
+  offset = 0;
+  for (const auto& batch : batches) {
+    const auto& array = checked_cast<const ::arrow::DictionaryArray&>(*batch->column(0));
+    AssertArraysEqual(*largest_dictionary->Slice(0, array.dictionary()->length()),
+                      *array.dictionary());
+    ASSERT_OK_AND_ASSIGN(auto dense, ::arrow::compute::Cast(array, ::arrow::utf8()));
+    AssertArraysEqual(*dense_values_->Slice(offset, array.length()), *dense);
+    offset += array.length();
+  }
+  ASSERT_EQ(offset, options.num_rows);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+TEST(TestArrowReadDictionaries, PrimitiveTypes) {
+  for (const auto& type :
+       {::arrow::int8(), ::arrow::uint32(), ::arrow::int64(), ::arrow::float64(),
+        ::arrow::date32(), ::arrow::timestamp(::arrow::TimeUnit::MICRO),
+        ::arrow::fixed_size_binary(3)}) {
+    ARROW_SCOPED_TRACE("type = ", type->ToString());
+    auto values = ::arrow::ArrayFromJSON(::arrow::int8(),
+                                         "[1, 2, 1, null, 3, 1, 2, 2, 4, 1, null, 3]");
+    std::shared_ptr<Array> typed_values;
+    if (type->id() == ::arrow::Type::FIXED_SIZE_BINARY) {
+      typed_values = ::arrow::ArrayFromJSON(
+          type, R"(["abc", "def", "abc", null, "ghi", "abc", "def", "def", "jkl",
+                    "abc", null, "ghi"])");
+    } else {
+      ASSERT_OK_AND_ASSIGN(typed_values, ::arrow::compute::Cast(*values, type));
+    }
+    auto table = MakeSimpleTable(typed_values, /*nullable=*/true);
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, /*row_group_size=*/4,
+                                               default_arrow_writer_properties(),
+                                               &buffer));
+
+    for (bool unify : {false, true}) {
+      ArrowReaderProperties properties = default_arrow_reader_properties();
+      properties.set_read_dictionary(0, true);
+      properties.set_unify_dictionaries(unify);
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(builder.properties(properties)->Build(&reader));
+      ASSERT_OK_AND_ASSIGN(auto actual, reader->ReadTable());
+      ASSERT_OK(actual->ValidateFull());
+
+      auto column = actual->column(0);
+      AssertTypeEqual(*::arrow::dictionary(::arrow::int32(), type), *column->type());
+      ASSERT_OK_AND_ASSIGN(auto dense, ::arrow::compute::Cast(column, type));
+      ::arrow::AssertChunkedEquivalent(*table->column(0), *dense.chunked_array());
+    }
+  }
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
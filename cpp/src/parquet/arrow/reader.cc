@@ -20,12 +20,16 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <random>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/builder_dict.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
 #include "arrow/io/memory.h"
@@ -37,6 +41,7 @@
 #include "arrow/util/async_generator.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/future.h"
+#include "arrow/util/int_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/parallel.h"
@@ -59,6 +64,7 @@ using arrow::Array;
 using arrow::ArrayData;
 using arrow::BooleanArray;
 using arrow::ChunkedArray;
+using arrow::DictionaryArray;
 using arrow::DataType;
 using arrow::ExtensionType;
 using arrow::Field;
@@ -129,6 +135,31 @@ class ColumnReaderImpl : public ColumnReader {
   virtual bool IsOrHasRepeatedChild() const = 0;
 };
 
+// The dictionary unified so far for a leaf and the memo of its values
+struct UnifiedDictionary {
+  std::mutex mutex;
+  std::unique_ptr<::arrow::internal::DictionaryMemoTable> memo;
+  std::shared_ptr<Array> values;
+};
+
+// The unified dictionaries of the leaves read by the row groups of a generator, whose
+// row groups may be decoded concurrently
+class UnifiedDictionaries {
+ public:
+  std::shared_ptr<UnifiedDictionary> Get(int leaf_index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& dictionary = dictionaries_[leaf_index];
+    if (dictionary == nullptr) {
+      dictionary = std::make_shared<UnifiedDictionary>();
+    }
+    return dictionary;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<int, std::shared_ptr<UnifiedDictionary>> dictionaries_;
+};
+
 namespace {
 
 std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
@@ -159,9 +190,10 @@ class FileReaderImpl : public FileReader {
                                 reader_properties_, &manifest_);
   }
 
-  FileColumnIteratorFactory SomeRowGroupsFactory(std::vector<int> row_groups) {
-    return [row_groups](int i, ParquetFileReader* reader) {
-      return new FileColumnIterator(i, reader, row_groups);
+  FileColumnIteratorFactory SomeRowGroupsFactory(std::vector<int> row_groups,
+                                                 std::vector<RowRanges> row_ranges = {}) {
+    return [row_groups, row_ranges](int i, ParquetFileReader* reader) {
+      return new FileColumnIterator(i, reader, row_groups, row_ranges);
     };
   }
 
@@ -200,6 +232,37 @@ class FileReaderImpl : public FileReader {
     return Status::OK();
   }
 
+  Status CheckRowRanges(const std::vector<int>& row_groups,
+                        const std::vector<RowRanges>& row_ranges) {
+    if (row_ranges.empty()) return Status::OK();
+    if (row_ranges.size() != row_groups.size()) {
+      return Status::Invalid("Got row ranges for ", row_ranges.size(),
+                             " row groups, but reading ", row_groups.size(),
+                             " row groups");
+    }
+    // The column readers get the page index reader concurrently, but creating it is
+    // not thread-safe
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    reader_->GetPageIndexReader();
+    END_PARQUET_CATCH_EXCEPTIONS
+    return Status::OK();
+  }
+
+  // The number of rows to read from the given row groups, see GetRecordBatchReader
+  int64_t NumRowsToRead(const std::vector<int>& row_groups,
+                        const std::vector<RowRanges>& row_ranges) {
+    int64_t num_rows = 0;
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      const int64_t row_group_rows =
+          reader_->metadata()->RowGroup(row_groups[i])->num_rows();
+      num_rows += row_ranges.empty() ? row_group_rows
+                                     : RowRanges::Intersection(
+                                           row_ranges[i], RowRanges::All(row_group_rows))
+                                           .num_rows();
+    }
+    return num_rows;
+  }
+
   std::shared_ptr<RowGroupReader> RowGroup(int row_group_index) override;
 
   Result<std::shared_ptr<Table>> ReadTable(
@@ -210,6 +273,8 @@ class FileReaderImpl : public FileReader {
   Status GetFieldReader(int i,
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
                         const std::vector<int>& row_groups,
+                        const std::vector<RowRanges>& row_ranges,
+                        std::shared_ptr<UnifiedDictionaries> unified_dictionaries,
                         std::unique_ptr<ColumnReaderImpl>* out) {
     // Should be covered by GetRecordBatchReader checks but
     // manifest_.schema_fields is a separate variable so be extra careful.
@@ -223,15 +288,18 @@ class FileReaderImpl : public FileReader {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
-    ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx->iterator_factory = SomeRowGroupsFactory(row_groups, row_ranges);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
     ctx->reader_properties = &reader_properties_;
+    ctx->unified_dictionaries = std::move(unified_dictionaries);
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
   Status GetFieldReaders(const std::vector<int>& column_indices,
                          const std::vector<int>& row_groups,
+                         const std::vector<RowRanges>& row_ranges,
+                         const std::shared_ptr<UnifiedDictionaries>& unified_dictionaries,
                          std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
                          std::shared_ptr<::arrow::Schema>* out_schema) {
     // We only need to read schema fields which have columns indicated
@@ -245,8 +313,8 @@ class FileReaderImpl : public FileReader {
     ::arrow::FieldVector out_fields(field_indices.size());
     for (size_t i = 0; i < out->size(); ++i) {
       std::unique_ptr<ColumnReaderImpl> reader;
-      RETURN_NOT_OK(
-          GetFieldReader(field_indices[i], included_leaves, row_groups, &reader));
+      RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, row_groups,
+                                   row_ranges, unified_dictionaries, &reader));
 
       out_fields[i] = reader->field();
       out->at(i) = std::move(reader);
@@ -314,10 +382,13 @@ class FileReaderImpl : public FileReader {
 
   // Helper method used by ReadRowGroups - read the given row groups/columns, skipping
   // bounds checks and pre-buffering. Takes a shared_ptr to self to keep the reader
-  // alive in async contexts.
+  // alive in async contexts. The dictionaries are unified with those of the other
+  // row groups of the read given unified_dictionaries, if any.
   Future<std::shared_ptr<Table>> DecodeRowGroups(
       std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor);
+      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor,
+      const std::vector<RowRanges>& row_ranges = {},
+      std::shared_ptr<UnifiedDictionaries> unified_dictionaries = nullptr);
 
   Result<std::shared_ptr<Table>> ReadRowGroups(
       const std::vector<int>& row_groups) override {
@@ -333,9 +404,15 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroup(i, Iota(reader_->metadata()->num_columns()));
   }
 
+  Result<std::unique_ptr<RecordBatchReader>> GetRecordBatchReader(
+      const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges) override;
+
   Result<std::unique_ptr<RecordBatchReader>> GetRecordBatchReader(
       const std::vector<int>& row_group_indices,
-      const std::vector<int>& column_indices) override;
+      const std::vector<int>& column_indices) override {
+    return GetRecordBatchReader(row_group_indices, column_indices, {});
+  }
 
   Result<std::unique_ptr<RecordBatchReader>> GetRecordBatchReader(
       const std::vector<int>& row_group_indices) override {
@@ -352,9 +429,20 @@ class FileReaderImpl : public FileReader {
   GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
                           const std::vector<int> row_group_indices,
                           const std::vector<int> column_indices,
+                          std::vector<RowRanges> row_ranges,
                           ::arrow::internal::Executor* cpu_executor,
                           int64_t rows_to_readahead) override;
 
+  ::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          ::arrow::internal::Executor* cpu_executor,
+                          int64_t rows_to_readahead) override {
+    return GetRecordBatchGenerator(std::move(reader), row_group_indices, column_indices,
+                                   /*row_ranges=*/{}, cpu_executor, rows_to_readahead);
+  }
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -500,7 +588,7 @@ class LeafReader : public ColumnReaderImpl {
       if (!record_reader_->HasMoreData()) {
         break;
       }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      int64_t records_read = ReadRecords(records_to_read);
       records_to_read -= records_read;
       if (records_read == 0) {
         NextRowGroup();
@@ -519,6 +607,10 @@ class LeafReader : public ColumnReaderImpl {
         record_reader_.get(),
         num_target_row_groups == 1 ? input_->column_chunk_metadata() : nullptr, field_,
         descr_, ctx_.get(), &out_));
+    if (ctx_->reader_properties->unify_dictionaries() &&
+        out_->type()->id() == ::arrow::Type::DICTIONARY) {
+      RETURN_NOT_OK(UnifyDictionaries());
+    }
     return Status::OK();
     END_PARQUET_CATCH_EXCEPTIONS
   }
@@ -536,13 +628,155 @@ class LeafReader : public ColumnReaderImpl {
   void NextRowGroup() {
     std::unique_ptr<PageReader> page_reader = input_->NextChunk();
     record_reader_->SetPageReader(std::move(page_reader));
+    position_ = 0;
   }
 
+  // Read up to records_to_read records from the current column chunk, skipping the
+  // records outside of its read ranges if any. Return 0 once it is exhausted.
+  int64_t ReadRecords(int64_t records_to_read) {
+    auto& read_ranges = input_->read_ranges();
+    if (!read_ranges.has_value()) {
+      return record_reader_->ReadRecords(records_to_read);
+    }
+    int64_t records_read = 0;
+    while (records_read < records_to_read && !read_ranges->empty()) {
+      const RowRange& range = read_ranges->front();
+      if (position_ < range.begin) {
+        position_ += record_reader_->SkipRecords(range.begin - position_);
+        if (position_ < range.begin) {
+          throw ParquetException("Column chunk ended before row ", range.begin);
+        }
+      }
+      const int64_t read = record_reader_->ReadRecords(
+          std::min(records_to_read - records_read, range.end - position_));
+      if (read == 0) {
+        throw ParquetException("Column chunk ended before row ", range.end);
+      }
+      position_ += read;
+      records_read += read;
+      if (position_ == range.end) {
+        read_ranges->pop_front();
+      }
+    }
+    return records_read;
+  }
+
+  // Remap the chunks of out_ onto a single dictionary which extends the one of the
+  // previous batches, so that the indices of a value are stable across the read.
+  // The values seen so far are kept in a memo, so each batch only looks up the values
+  // of its own dictionaries and the unified dictionary only grows by the new values.
+  // The memo is shared with the readers of the other row groups of the read, if any.
+  Status UnifyDictionaries() {
+    const auto& dict_type = checked_cast<const ::arrow::DictionaryType&>(*out_->type());
+    if (unified_dictionary_ == nullptr) {
+      unified_dictionary_ =
+          ctx_->unified_dictionaries != nullptr
+              ? ctx_->unified_dictionaries->Get(input_->column_index())
+              : std::make_shared<UnifiedDictionary>();
+    }
+    std::vector<std::shared_ptr<Buffer>> transpose_maps(out_->num_chunks());
+    std::shared_ptr<Array> dictionary;
+    {
+      std::lock_guard<std::mutex> lock(unified_dictionary_->mutex);
+      auto& memo = unified_dictionary_->memo;
+      auto& values = unified_dictionary_->values;
+      if (memo == nullptr) {
+        memo = std::make_unique<::arrow::internal::DictionaryMemoTable>(
+            ctx_->pool, dict_type.value_type());
+      }
+      const int32_t unified_size =
+          values == nullptr ? 0 : static_cast<int32_t>(values->length());
+      for (int i = 0; i < out_->num_chunks(); ++i) {
+        const auto& chunk = checked_cast<const DictionaryArray&>(*out_->chunk(i));
+        // The batches of a row group usually share its dictionary
+        if (chunk.dictionary() != last_dictionary_) {
+          ARROW_ASSIGN_OR_RAISE(
+              last_transpose_map_,
+              ::arrow::AllocateBuffer(chunk.dictionary()->length() * sizeof(int32_t),
+                                      ctx_->pool));
+          DictionaryIndexer indexer{memo.get(), *chunk.dictionary(),
+                                    last_transpose_map_->mutable_data_as<int32_t>()};
+          RETURN_NOT_OK(::arrow::VisitTypeInline(*dict_type.value_type(), &indexer));
+          last_dictionary_ = chunk.dictionary();
+        }
+        transpose_maps[i] = last_transpose_map_;
+      }
+      if (!::arrow::internal::IntegersCanFit(::arrow::Int64Scalar(memo->size()),
+                                             *dict_type.index_type())
+               .ok()) {
+        return Status::Invalid(
+            "These dictionaries cannot be combined.  The unified dictionary requires a "
+            "larger index type.");
+      }
+      if (values == nullptr || memo->size() > unified_size) {
+        std::shared_ptr<ArrayData> new_values;
+        RETURN_NOT_OK(memo->GetArrayData(unified_size, &new_values));
+        if (values == nullptr) {
+          values = ::arrow::MakeArray(std::move(new_values));
+        } else {
+          ARROW_ASSIGN_OR_RAISE(
+              values, ::arrow::Concatenate({values, ::arrow::MakeArray(new_values)},
+                                           ctx_->pool));
+        }
+      }
+      dictionary = values;
+    }
+    ::arrow::ArrayVector chunks(out_->num_chunks());
+    for (int i = 0; i < out_->num_chunks(); ++i) {
+      const auto& chunk = checked_cast<const DictionaryArray&>(*out_->chunk(i));
+      ARROW_ASSIGN_OR_RAISE(
+          chunks[i], chunk.Transpose(out_->type(), dictionary,
+                                     transpose_maps[i]->data_as<int32_t>(), ctx_->pool));
+    }
+    out_ = std::make_shared<ChunkedArray>(std::move(chunks), out_->type());
+    return Status::OK();
+  }
+
+  // Looks up (or inserts) each value of a dictionary in the memo, writing its index
+  // in the unified dictionary to `out`
+  struct DictionaryIndexer {
+    ::arrow::internal::DictionaryMemoTable* memo;
+    const Array& dictionary;
+    int32_t* out;
+
+    template <typename T>
+    Status Visit(const T& type) {
+      if constexpr (!std::is_same_v<T, ::arrow::HalfFloatType> &&
+                    (::arrow::is_boolean_type<T>::value ||
+                     ::arrow::is_number_type<T>::value ||
+                     ::arrow::is_temporal_type<T>::value ||
+                     ::arrow::is_base_binary_type<T>::value ||
+                     ::arrow::is_binary_view_like_type<T>::value ||
+                     ::arrow::is_fixed_size_binary_type<T>::value)) {
+        if (dictionary.null_count() > 0) {
+          return Status::Invalid("Cannot yet unify dictionaries with nulls");
+        }
+        const auto& values =
+            checked_cast<const typename ::arrow::TypeTraits<T>::ArrayType&>(dictionary);
+        for (int64_t i = 0; i < values.length(); ++i) {
+          RETURN_NOT_OK(memo->GetOrInsert<T>(values.GetView(i), &out[i]));
+        }
+        return Status::OK();
+      } else {
+        return Status::NotImplemented("Unification of ", type,
+                                      " dictionaries is not implemented");
+      }
+    }
+  };
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
   std::shared_ptr<RecordReader> record_reader_;
+  // The number of records read or skipped from the current column chunk
+  int64_t position_ = 0;
+  // The values of the batches read so far and their dictionary, if dictionaries are
+  // unified
+  std::shared_ptr<UnifiedDictionary> unified_dictionary_;
+  // The last dictionary of a chunk and the indices of its values in the unified one
+  std::shared_ptr<::arrow::Array> last_dictionary_;
+  std::shared_ptr<Buffer> last_transpose_map_;
 };
 
 // Column reader for extension arrays
@@ -1052,20 +1286,27 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
 }  // namespace
 
 Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
-    const std::vector<int>& row_groups, const std::vector<int>& column_indices) {
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+    const std::vector<RowRanges>& row_ranges) {
   RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
+  RETURN_NOT_OK(CheckRowRanges(row_groups, row_ranges));
 
   if (reader_properties_.pre_buffer()) {
     // PARQUET-1698/PARQUET-1820: pre-buffer row groups/column chunks if enabled
     BEGIN_PARQUET_CATCH_EXCEPTIONS
-    reader_->PreBuffer(row_groups, column_indices, reader_properties_.io_context(),
+    reader_->PreBuffer(row_groups, column_indices, row_ranges,
+                       reader_properties_.io_context(),
                        reader_properties_.cache_options());
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> batch_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &batch_schema));
+  // A single reader per column reads all the row groups, so it unifies their
+  // dictionaries on its own
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, row_ranges,
+                                /*unified_dictionaries=*/nullptr, &readers,
+                                &batch_schema));
 
   if (readers.empty()) {
     // Just generate all batches right now; they're cheap since they have no columns.
@@ -1075,8 +1316,11 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
 
     ::arrow::RecordBatchVector batches;
 
-    for (int row_group : row_groups) {
-      int64_t num_rows = parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      int64_t num_rows =
+          NumRowsToRead({row_groups[i]}, row_ranges.empty()
+                                             ? std::vector<RowRanges>{}
+                                             : std::vector<RowRanges>{row_ranges[i]});
 
       batches.insert(batches.end(), static_cast<size_t>(num_rows / batch_size),
                      max_sized_batch);
@@ -1090,10 +1334,7 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
         ::arrow::MakeVectorIterator(std::move(batches)), std::move(batch_schema));
   }
 
-  int64_t num_rows = 0;
-  for (int row_group : row_groups) {
-    num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
-  }
+  int64_t num_rows = NumRowsToRead(row_groups, row_ranges);
 
   using ::arrow::RecordBatchIterator;
 
@@ -1157,15 +1398,23 @@ class RowGroupGenerator {
   explicit RowGroupGenerator(std::shared_ptr<FileReaderImpl> arrow_reader,
                              ::arrow::internal::Executor* cpu_executor,
                              std::vector<int> row_groups, std::vector<int> column_indices,
+                             std::vector<RowRanges> row_ranges,
                              int64_t min_rows_in_flight)
       : arrow_reader_(std::move(arrow_reader)),
         cpu_executor_(cpu_executor),
         row_groups_(std::move(row_groups)),
         column_indices_(std::move(column_indices)),
+        row_ranges_(std::move(row_ranges)),
         min_rows_in_flight_(min_rows_in_flight),
         rows_in_flight_(0),
         index_(0),
-        readahead_index_(0) {}
+        readahead_index_(0) {
+    // Each row group is decoded with new column readers, which share the dictionaries
+    // unified so far
+    if (arrow_reader_->properties().unify_dictionaries()) {
+      unified_dictionaries_ = std::make_shared<UnifiedDictionaries>();
+    }
+  }
 
   ::arrow::Future<RecordBatchGenerator> operator()() {
     if (index_ >= row_groups_.size()) {
@@ -1197,21 +1446,28 @@ class RowGroupGenerator {
     size_t row_group_index = readahead_index_++;
     int row_group = row_groups_[row_group_index];
     std::vector<int> column_indices = column_indices_;
+    std::vector<RowRanges> row_ranges;
+    if (!row_ranges_.empty()) row_ranges.push_back(row_ranges_[row_group_index]);
     auto reader = arrow_reader_;
-    int64_t num_rows =
-        reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    auto unified_dictionaries = unified_dictionaries_;
+    int64_t num_rows = reader->NumRowsToRead({row_group}, row_ranges);
     rows_in_flight_ += num_rows;
     ::arrow::Future<RecordBatchGenerator> row_group_read;
     if (!reader->properties().pre_buffer()) {
-      row_group_read = SubmitRead(cpu_executor_, reader, row_group, column_indices);
+      row_group_read = SubmitRead(cpu_executor_, reader, row_group, column_indices,
+                                  row_ranges, unified_dictionaries);
     } else {
-      auto ready = reader->parquet_reader()->WhenBuffered({row_group}, column_indices);
+      auto ready = reader->parquet_reader()->WhenBuffered({row_group}, column_indices,
+                                                          row_ranges);
       if (cpu_executor_) ready = cpu_executor_->TransferAlways(ready);
       row_group_read =
           ready.Then([cpu_executor = cpu_executor_, reader, row_group,
-                      column_indices = std::move(
-                          column_indices)]() -> ::arrow::Future<RecordBatchGenerator> {
-            return ReadOneRowGroup(cpu_executor, reader, row_group, column_indices);
+                      column_indices = std::move(column_indices),
+                      row_ranges = std::move(row_ranges),
+                      unified_dictionaries = std::move(unified_dictionaries)]()
+                         -> ::arrow::Future<RecordBatchGenerator> {
+            return ReadOneRowGroup(cpu_executor, reader, row_group, column_indices,
+                                   row_ranges, unified_dictionaries);
           });
     }
     in_flight_reads_.push({std::move(row_group_read), num_rows});
@@ -1224,21 +1480,29 @@ class RowGroupGenerator {
   // async I/O without forcing readahead.
   static ::arrow::Future<RecordBatchGenerator> SubmitRead(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges,
+      const std::shared_ptr<UnifiedDictionaries>& unified_dictionaries) {
     if (!cpu_executor) {
-      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices);
+      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices, row_ranges,
+                             unified_dictionaries);
     }
     // If we have an executor, then force transfer (even if I/O was complete)
     return ::arrow::DeferNotOk(cpu_executor->Submit(ReadOneRowGroup, cpu_executor, self,
-                                                    row_group, column_indices));
+                                                    row_group, column_indices,
+                                                    row_ranges, unified_dictionaries));
   }
 
   static ::arrow::Future<RecordBatchGenerator> ReadOneRowGroup(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges,
+      const std::shared_ptr<UnifiedDictionaries>& unified_dictionaries) {
     // Skips bound checks/pre-buffering, since we've done that already
     const int64_t batch_size = self->properties().batch_size();
-    return self->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor)
+    return self
+        ->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor, row_ranges,
+                          unified_dictionaries)
         .Then([batch_size](const std::shared_ptr<Table>& table)
                   -> ::arrow::Result<RecordBatchGenerator> {
           ::arrow::TableBatchReader table_reader(*table);
@@ -1252,6 +1516,10 @@ class RowGroupGenerator {
   ::arrow::internal::Executor* cpu_executor_;
   std::vector<int> row_groups_;
   std::vector<int> column_indices_;
+  // The rows to read of each row group, or empty to read all of them
+  std::vector<RowRanges> row_ranges_;
+  // The dictionaries unified so far, if dictionaries are unified
+  std::shared_ptr<UnifiedDictionaries> unified_dictionaries_;
   int64_t min_rows_in_flight_;
   std::queue<ReadRequest> in_flight_reads_;
   int64_t rows_in_flight_;
@@ -1263,22 +1531,25 @@ class RowGroupGenerator {
 FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
                                         const std::vector<int> row_group_indices,
                                         const std::vector<int> column_indices,
+                                        std::vector<RowRanges> row_ranges,
                                         ::arrow::internal::Executor* cpu_executor,
                                         int64_t rows_to_readahead) {
   RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
+  RETURN_NOT_OK(CheckRowRanges(row_group_indices, row_ranges));
   if (rows_to_readahead < 0) {
     return Status::Invalid("rows_to_readahead must be >= 0");
   }
   if (reader_properties_.pre_buffer()) {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
-    reader_->PreBuffer(row_group_indices, column_indices, reader_properties_.io_context(),
+    reader_->PreBuffer(row_group_indices, column_indices, row_ranges,
+                       reader_properties_.io_context(),
                        reader_properties_.cache_options());
     END_PARQUET_CATCH_EXCEPTIONS
   }
   ::arrow::AsyncGenerator<RowGroupGenerator::RecordBatchGenerator> row_group_generator =
       RowGroupGenerator(::arrow::internal::checked_pointer_cast<FileReaderImpl>(reader),
                         cpu_executor, row_group_indices, column_indices,
-                        rows_to_readahead);
+                        std::move(row_ranges), rows_to_readahead);
   ::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>> concatenated =
       ::arrow::MakeConcatenatedGenerator(std::move(row_group_generator));
   WRAP_ASYNC_GENERATOR(std::move(concatenated));
@@ -1320,12 +1591,15 @@ Result<std::shared_ptr<Table>> FileReaderImpl::ReadRowGroups(
 
 Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor) {
+    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor,
+    const std::vector<RowRanges>& row_ranges,
+    std::shared_ptr<UnifiedDictionaries> unified_dictionaries) {
   // `self` is used solely to keep `this` alive in an async context - but we use this
   // in a sync context too so use `this` over `self`
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> result_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, row_ranges,
+                                unified_dictionaries, &readers, &result_schema));
   // OptionalParallelForAsync requires an executor
   if (!cpu_executor) cpu_executor = ::arrow::internal::GetCpuThreadPool();
 
@@ -1336,16 +1610,14 @@ Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     RETURN_NOT_OK(ReadColumn(static_cast<int>(i), row_groups, reader.get(), &column));
     return column;
   };
-  auto make_table = [result_schema, row_groups, self,
+  auto make_table = [result_schema, row_groups, row_ranges, self,
                      this](const ::arrow::ChunkedArrayVector& columns)
       -> ::arrow::Result<std::shared_ptr<Table>> {
     int64_t num_rows = 0;
     if (!columns.empty()) {
       num_rows = columns[0]->length();
     } else {
-      for (int i : row_groups) {
-        num_rows += parquet_reader()->metadata()->RowGroup(i)->num_rows();
-      }
+      num_rows = NumRowsToRead(row_groups, row_ranges);
     }
     auto table = Table::Make(std::move(result_schema), columns, num_rows);
     RETURN_NOT_OK(table->Validate());
@@ -1386,6 +1658,29 @@ Status FileReader::GetRecordBatchReader(const std::vector<int>& row_group_indice
   return Status::OK();
 }
 
+Result<std::unique_ptr<RecordBatchReader>> FileReader::GetRecordBatchReader(
+    const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+    const std::vector<RowRanges>& row_ranges) {
+  if (!row_ranges.empty()) {
+    return Status::NotImplemented("Reading row ranges is not supported by this reader");
+  }
+  return GetRecordBatchReader(row_group_indices, column_indices);
+}
+
+::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+FileReader::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                                    const std::vector<int> row_group_indices,
+                                    const std::vector<int> column_indices,
+                                    std::vector<RowRanges> row_ranges,
+                                    ::arrow::internal::Executor* cpu_executor,
+                                    int64_t rows_to_readahead) {
+  if (!row_ranges.empty()) {
+    return Status::NotImplemented("Reading row ranges is not supported by this reader");
+  }
+  return GetRecordBatchGenerator(std::move(reader), row_group_indices, column_indices,
+                                 cpu_executor, rows_to_readahead);
+}
+
 Status FileReader::ReadTable(std::shared_ptr<Table>* out) {
   ARROW_ASSIGN_OR_RAISE(*out, ReadTable());
   return Status::OK();
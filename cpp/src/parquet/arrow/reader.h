@@ -26,6 +26,7 @@
 #include "parquet/file_reader.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
+#include "parquet/row_ranges.h"
 
 namespace arrow {
 
@@ -192,6 +193,27 @@ class PARQUET_EXPORT FileReader {
   GetRecordBatchReader(const std::vector<int>& row_group_indices,
                        const std::vector<int>& column_indices) = 0;
 
+  /// \brief Return a RecordBatchReader of the rows selected by row_ranges in the
+  /// row groups selected from row_group_indices, whose columns are selected by
+  /// column_indices.
+  ///
+  /// row_ranges holds the rows to read of each row group in row_group_indices,
+  /// relative to the first row of the row group, or is empty to read all rows.
+  /// Using the offset index of the file if any, the data pages without any of these
+  /// rows are neither decompressed nor decoded (except for repeated columns); the
+  /// other rows are skipped while decoding. FileReaders must outlive their
+  /// RecordBatchReaders.
+  ///
+  /// The default implementation only supports an empty row_ranges.
+  ///
+  /// \returns error Result if either row_group_indices or column_indices
+  ///     contains an invalid index, or if row_ranges is neither empty nor of the
+  ///     size of row_group_indices
+  virtual ::arrow::Result<std::unique_ptr<::arrow::RecordBatchReader>>
+  GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                       const std::vector<int>& column_indices,
+                       const std::vector<RowRanges>& row_ranges);
+
   /// \brief Return a RecordBatchReader of row groups selected from
   /// row_group_indices, whose columns are selected by column_indices.
   ///
@@ -234,6 +256,24 @@ class PARQUET_EXPORT FileReader {
                           ::arrow::internal::Executor* cpu_executor = NULLPTR,
                           int64_t rows_to_readahead = 0) = 0;
 
+  /// \brief Return a generator of record batches of the rows selected by row_ranges.
+  ///
+  /// See GetRecordBatchReader for the meaning of row_ranges. The FileReader must
+  /// outlive the generator, so this requires that you pass in a shared_ptr. The
+  /// default implementation only supports an empty row_ranges.
+  ///
+  /// \returns error Result if either row_group_indices or column_indices contains an
+  ///     invalid index, or if row_ranges is neither empty nor of the size of
+  ///     row_group_indices
+  virtual ::arrow::Result<
+      std::function<::arrow::Future<std::shared_ptr<::arrow::RecordBatch>>()>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          std::vector<RowRanges> row_ranges,
+                          ::arrow::internal::Executor* cpu_executor = NULLPTR,
+                          int64_t rows_to_readahead = 0);
+
   /// Read all columns into a Table
   virtual ::arrow::Result<std::shared_ptr<::arrow::Table>> ReadTable() = 0;
 
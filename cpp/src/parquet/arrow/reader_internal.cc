@@ -51,6 +51,7 @@
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/schema_internal.h"
 #include "parquet/column_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -857,6 +858,82 @@ Status TransferHalfFloat(RecordReader* reader, MemoryPool* pool,
 
 }  // namespace
 
+std::unique_ptr<::parquet::PageReader> FileColumnIterator::NextChunk() {
+  if (row_groups_.empty()) {
+    return nullptr;
+  }
+
+  row_group_index_ = row_groups_.front();
+  auto row_group_reader = reader_->RowGroup(row_group_index_);
+  row_groups_.pop_front();
+  read_ranges_.reset();
+  if (row_ranges_.empty()) {
+    return row_group_reader->GetColumnPageReader(column_index_);
+  }
+
+  const int64_t num_rows = row_group_reader->metadata()->num_rows();
+  const RowRanges row_ranges =
+      RowRanges::Intersection(row_ranges_.front(), RowRanges::All(num_rows));
+  row_ranges_.pop_front();
+  read_ranges_.emplace(row_ranges.ranges().begin(), row_ranges.ranges().end());
+
+  // Pages of repeated columns may not start at a record boundary, so that they
+  // can't be skipped based on their first row
+  std::shared_ptr<OffsetIndex> offset_index;
+  if (descr()->max_repetition_level() == 0) {
+    // NOTE: the page index reader was created by the FileReader beforehand, since
+    // creating it is not thread-safe
+    if (auto page_index_reader = reader_->GetPageIndexReader()) {
+      if (auto row_group_index = page_index_reader->RowGroup(row_group_index_)) {
+        offset_index = row_group_index->GetOffsetIndex(column_index_);
+      }
+    }
+  }
+  if (!offset_index) {
+    return row_group_reader->GetColumnPageReader(column_index_);
+  }
+
+  // Skip the pages without any selected row, and move the ranges after them back by
+  // the number of rows skipped, since the page reader won't return them
+  const std::vector<RowRange> pages = PageRowRanges(*offset_index, num_rows);
+  std::vector<bool> skip_pages(pages.size(), false);
+  int64_t skipped_rows = 0;
+  auto range = read_ranges_->begin();
+  for (size_t i = 0; i < pages.size(); ++i) {
+    if (row_ranges.Overlaps(pages[i])) continue;
+    skip_pages[i] = true;
+    // No range overlaps the skipped page, so that the ranges starting before it also
+    // end before it
+    for (; range != read_ranges_->end() && range->begin < pages[i].begin; ++range) {
+      range->begin -= skipped_rows;
+      range->end -= skipped_rows;
+    }
+    skipped_rows += pages[i].length();
+  }
+  for (; range != read_ranges_->end(); ++range) {
+    range->begin -= skipped_rows;
+    range->end -= skipped_rows;
+  }
+  // Only read the selected pages if possible (which is also what
+  // ParquetFileReader::PreBuffer buffers), otherwise read the whole column chunk and
+  // skip the other pages without decompressing them
+  if (auto page_reader = row_group_reader->GetColumnPageReader(
+          column_index_, *offset_index, row_ranges)) {
+    return page_reader;
+  }
+  auto page_reader = row_group_reader->GetColumnPageReader(column_index_);
+  if (skipped_rows == 0) {
+    return page_reader;
+  }
+  page_reader->set_data_page_filter([skip_pages = std::move(skip_pages),
+                                     page = size_t{0}](const DataPageStats&) mutable {
+    const bool skip = page < skip_pages.size() && skip_pages[page];
+    ++page;
+    return skip;
+  });
+  return page_reader;
+}
+
 #define TRANSFER_INT32(ENUM, ArrowType)                                            \
   case ::arrow::Type::ENUM: {                                                      \
     Status s = TransferInt<ArrowType, Int32Type>(reader, std::move(metadata), ctx, \
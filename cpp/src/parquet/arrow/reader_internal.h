@@ -22,6 +22,7 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
 #include "parquet/platform.h"
+#include "parquet/row_ranges.h"
 #include "parquet/schema.h"
 
 namespace arrow {
@@ -53,6 +55,7 @@ class ArrowReaderProperties;
 namespace arrow {
 
 class ColumnReaderImpl;
+class UnifiedDictionaries;
 
 // ----------------------------------------------------------------------
 // Iteration utilities
@@ -62,25 +65,22 @@ class ColumnReaderImpl;
 class FileColumnIterator {
  public:
   explicit FileColumnIterator(int column_index, ParquetFileReader* reader,
-                              std::vector<int> row_groups)
+                              std::vector<int> row_groups,
+                              std::vector<RowRanges> row_ranges = {})
       : column_index_(column_index),
         reader_(reader),
         schema_(reader->metadata()->schema()),
         row_groups_(row_groups.begin(), row_groups.end()),
+        row_ranges_(row_ranges.begin(), row_ranges.end()),
         row_group_index_(-1) {}
 
   virtual ~FileColumnIterator() {}
 
-  std::unique_ptr<::parquet::PageReader> NextChunk() {
-    if (row_groups_.empty()) {
-      return nullptr;
-    }
-
-    row_group_index_ = row_groups_.front();
-    auto row_group_reader = reader_->RowGroup(row_group_index_);
-    row_groups_.pop_front();
-    return row_group_reader->GetColumnPageReader(column_index_);
-  }
+  // Return the page reader of the column chunk in the next row group. If the rows
+  // to read are restricted to row ranges, the pages which have none of these rows
+  // are skipped using the offset index and read_ranges() is set accordingly. Only
+  // the other pages are read from the file, unless the column is encrypted.
+  std::unique_ptr<::parquet::PageReader> NextChunk();
 
   const SchemaDescriptor* schema() const { return schema_; }
 
@@ -100,12 +100,19 @@ class FileColumnIterator {
 
   int row_group_index() const { return row_group_index_; }
 
+  // The ranges of records to read from the current column chunk, relative to the
+  // records returned by its page reader (i.e. once skipped pages are left out), or
+  // nullopt if all of them are read
+  std::optional<std::deque<RowRange>>& read_ranges() { return read_ranges_; }
+
  protected:
   int column_index_;
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  std::deque<RowRanges> row_ranges_;
   int row_group_index_;
+  std::optional<std::deque<RowRange>> read_ranges_;
 };
 
 using FileColumnIteratorFactory =
@@ -118,6 +125,10 @@ struct ReaderContext {
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
   ArrowReaderProperties* reader_properties;
+  // The dictionaries unified so far for each leaf, shared by the column readers of a
+  // read which decodes each row group with new readers. If null, each leaf reader
+  // unifies the dictionaries of the batches it reads on its own.
+  std::shared_ptr<UnifiedDictionaries> unified_dictionaries;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
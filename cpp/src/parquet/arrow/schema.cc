@@ -539,8 +539,31 @@ struct SchemaTreeContext {
 };
 
 bool IsDictionaryReadSupported(const ArrowType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+  // Supported for the types whose values are the Parquet physical values, so that the
+  // decoded dictionary can be viewed or cast as the logical type
+  switch (type.id()) {
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::INT8:
+    case ::arrow::Type::INT16:
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::UINT8:
+    case ::arrow::Type::UINT16:
+    case ::arrow::Type::UINT32:
+    case ::arrow::Type::UINT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+    case ::arrow::Type::DATE32:
+    case ::arrow::Type::TIME32:
+    case ::arrow::Type::TIME64:
+    case ::arrow::Type::TIMESTAMP:
+    case ::arrow::Type::DURATION:
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+      return true;
+    default:
+      return false;
+  }
 }
 
 // ----------------------------------------------------------------------
@@ -552,6 +575,7 @@ bool IsDictionaryReadSupported(const ArrowType& type) {
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ArrowType> storage_type,
                         GetArrowType(primitive_node, ctx->properties, ctx->metadata));
   if (ctx->properties.read_dictionary(column_index) &&
+      primitive_node.physical_type() != ParquetType::INT96 &&
       IsDictionaryReadSupported(*storage_type)) {
     return ::arrow::dictionary(::arrow::int32(), storage_type);
   }
@@ -1105,9 +1129,12 @@ Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
 
   if (origin_type->id() == ::arrow::Type::DICTIONARY &&
       inferred_type->id() != ::arrow::Type::DICTIONARY &&
+      ::arrow::is_base_binary_like(inferred_type->id()) &&
       IsDictionaryReadSupported(*inferred_type)) {
-    // Direct dictionary reads are only supported for a couple primitive types,
-    // so no need to recurse on value types.
+    // Direct dictionary reads are only supported for primitive types, so no need to
+    // recurse on value types. Other dictionary types are restored only for binary
+    // values, as the physical type of the other columns is unknown here; the other
+    // columns can be read as dictionary with ArrowReaderProperties::read_dictionary.
     const auto& dict_origin_type =
         checked_cast<const ::arrow::DictionaryType&>(*origin_type);
     inferred->field = inferred->field->WithType(::arrow::dictionary(
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <exception>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -659,6 +660,14 @@ class ColumnReaderImplBase {
     return num_decoded;
   }
 
+  // Skip up to batch_size values of the current data page without materializing them
+  //
+  // @returns: the number of values skipped
+  int64_t SkipValues(int64_t batch_size) {
+    return current_decoder_->Skip(static_cast<int>(
+        std::min<int64_t>(batch_size, std::numeric_limits<int32_t>::max())));
+  }
+
   // Read up to batch_size values from the current data page into the
   // pre-allocated memory T*, leaving spaces for null entries according
   // to the def_levels.
@@ -1157,6 +1166,14 @@ int64_t TypedColumnReaderImpl<DType>::Skip(int64_t num_values_to_skip) {
     if (values_to_skip >= available_values) {
       values_to_skip -= available_values;
       this->ConsumeBufferedValues(available_values);
+    } else if (this->max_def_level_ == 0 && this->max_rep_level_ == 0) {
+      // Without levels, values can be skipped in the decoder directly
+      const int64_t values_skipped = this->SkipValues(values_to_skip);
+      if (values_skipped == 0) {
+        ParquetException::EofException();
+      }
+      this->ConsumeBufferedValues(values_skipped);
+      values_to_skip -= values_skipped;
     } else {
       // We need to read this Page
       // Jump to the right offset in the Page
@@ -1513,22 +1530,15 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
     return skipped_records;
   }
 
-  // Read 'num_values' values and throw them away.
-  // Throws an error if it could not read 'num_values'.
+  // Skip 'num_values' values without materializing them.
+  // Throws an error if it could not skip 'num_values'.
   void ReadAndThrowAwayValues(int64_t num_values) {
     int64_t values_left = num_values;
-    int64_t values_read = 0;
-
-    // Allocate enough scratch space to accommodate 16-bit levels or any
-    // value type
-    this->InitScratchForSkip();
-    ARROW_DCHECK_NE(this->scratch_for_skip_, nullptr);
+    int64_t values_skipped = 0;
     do {
-      int64_t batch_size = std::min<int64_t>(kSkipScratchBatchSize, values_left);
-      values_read = this->ReadValues(
-          batch_size, this->scratch_for_skip_->template mutable_data_as<T>());
-      values_left -= values_read;
-    } while (values_read > 0 && values_left > 0);
+      values_skipped = this->SkipValues(values_left);
+      values_left -= values_skipped;
+    } while (values_skipped > 0 && values_left > 0);
     if (values_left > 0) {
       std::stringstream ss;
       ss << "Could not read and throw away " << num_values << " values";
@@ -2089,18 +2099,21 @@ class ByteArrayChunkedRecordReader final : public TypedRecordReader<ByteArrayTyp
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-/// ByteArrayDictionaryRecordReader reads into ::arrow::dictionary(index: int32,
-/// values: binary).
+/// DictionaryRecordReaderImpl reads into ::arrow::dictionary(index: int32,
+/// values: value_type), where value_type is the Arrow type of the physical values
+/// (binary, int32, int64, float, double or fixed size binary).
 ///
 /// If underlying column is dictionary encoded, it will call `DecodeIndices` to read,
 /// otherwise it will call `DecodeArrowNonNull` to read.
-class ByteArrayDictionaryRecordReader final : public TypedRecordReader<ByteArrayType>,
-                                              virtual public DictionaryRecordReader {
+template <typename DType>
+class DictionaryRecordReaderImpl final : public TypedRecordReader<DType>,
+                                         virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
-                                  ::arrow::MemoryPool* pool, bool read_dense_for_nullable)
-      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool, read_dense_for_nullable),
-        builder_(pool) {
+  DictionaryRecordReaderImpl(const ColumnDescriptor* descr, LevelInfo leaf_info,
+                             ::arrow::MemoryPool* pool, bool read_dense_for_nullable,
+                             const std::shared_ptr<::arrow::DataType>& value_type)
+      : TypedRecordReader<DType>(descr, leaf_info, pool, read_dense_for_nullable),
+        builder_(value_type, pool) {
     this->read_dictionary_ = true;
   }
 
@@ -2128,7 +2141,7 @@ class ByteArrayDictionaryRecordReader final : public TypedRecordReader<ByteArray
       /// insert the new dictionary values
       FlushBuilder();
       builder_.ResetFull();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       decoder->InsertDictionary(&builder_);
       this->new_dictionary_ = false;
     }
@@ -2136,41 +2149,39 @@ class ByteArrayDictionaryRecordReader final : public TypedRecordReader<ByteArray
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
     }
     // Flush values since they have been copied into the builder
-    ResetValues();
+    this->ResetValues();
     CheckNumberDecoded(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     }
     ARROW_DCHECK_EQ(num_decoded, values_to_read - null_count);
     // Flush values since they have been copied into the builder
-    ResetValues();
+    this->ResetValues();
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
-
-  ::arrow::BinaryDictionary32Builder builder_;
+  typename EncodingTraits<DType>::DictAccumulator builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
@@ -2189,20 +2200,52 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(
     bool read_dictionary, bool read_dense_for_nullable,
     const std::shared_ptr<::arrow::DataType>& arrow_type) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, leaf_info, pool,
-                                                             read_dense_for_nullable);
+    return std::make_shared<DictionaryRecordReaderImpl<ByteArrayType>>(
+        descr, leaf_info, pool, read_dense_for_nullable, ::arrow::binary());
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(
         descr, leaf_info, pool, read_dense_for_nullable, arrow_type);
   }
 }
 
+std::shared_ptr<RecordReader> MakeDictionaryRecordReader(const ColumnDescriptor* descr,
+                                                         LevelInfo leaf_info,
+                                                         ::arrow::MemoryPool* pool,
+                                                         bool read_dense_for_nullable) {
+  switch (descr->physical_type()) {
+    case Type::INT32:
+      return std::make_shared<DictionaryRecordReaderImpl<Int32Type>>(
+          descr, leaf_info, pool, read_dense_for_nullable, ::arrow::int32());
+    case Type::INT64:
+      return std::make_shared<DictionaryRecordReaderImpl<Int64Type>>(
+          descr, leaf_info, pool, read_dense_for_nullable, ::arrow::int64());
+    case Type::FLOAT:
+      return std::make_shared<DictionaryRecordReaderImpl<FloatType>>(
+          descr, leaf_info, pool, read_dense_for_nullable, ::arrow::float32());
+    case Type::DOUBLE:
+      return std::make_shared<DictionaryRecordReaderImpl<DoubleType>>(
+          descr, leaf_info, pool, read_dense_for_nullable, ::arrow::float64());
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return std::make_shared<DictionaryRecordReaderImpl<FLBAType>>(
+          descr, leaf_info, pool, read_dense_for_nullable,
+          ::arrow::fixed_size_binary(descr->type_length()));
+    default:
+      return nullptr;
+  }
+}
+
 }  // namespace
 
 std::shared_ptr<RecordReader> RecordReader::Make(
     const ColumnDescriptor* descr, LevelInfo leaf_info, MemoryPool* pool,
     bool read_dictionary, bool read_dense_for_nullable,
     const std::shared_ptr<::arrow::DataType>& arrow_type) {
+  if (read_dictionary && descr->physical_type() != Type::BYTE_ARRAY) {
+    // BOOLEAN and INT96 columns are read as dense values
+    auto dict_reader =
+        MakeDictionaryRecordReader(descr, leaf_info, pool, read_dense_for_nullable);
+    if (dict_reader) return dict_reader;
+  }
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, leaf_info, pool,
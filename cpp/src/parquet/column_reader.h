@@ -275,6 +275,7 @@ class PARQUET_EXPORT RecordReader {
   /// @param leaf_info Level info, used to determine if a column is nullable or not
   /// @param pool Memory pool to use for buffering values and rep/def levels
   /// @param read_dictionary True if reading directly as Arrow dictionary-encoded
+  /// (not supported for BOOLEAN and INT96 columns, which are read as dense values)
   /// @param read_dense_for_nullable True if reading dense and not leaving space for null
   /// values
   /// @param arrow_type Which type to read this column as (optional). Currently
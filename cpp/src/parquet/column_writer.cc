@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <utility>
 #include <vector>
@@ -41,10 +43,12 @@
 #include "arrow/util/crc32.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/float16.h"
+#include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/rle_encoding_internal.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/type_traits.h"
 #include "arrow/util/unreachable.h"
 #include "arrow/visit_array_inline.h"
@@ -162,6 +166,22 @@ inline const T* AddIfNotNull(const T* base, int64_t offset) {
   return nullptr;
 }
 
+// Compress a buffer into a new buffer
+Result<std::shared_ptr<Buffer>> CompressBuffer(::arrow::util::Codec* codec,
+                                               const Buffer& src_buffer,
+                                               MemoryPool* pool) {
+  const int64_t max_compressed_size =
+      codec->MaxCompressedLen(src_buffer.size(), src_buffer.data());
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<::arrow::ResizableBuffer> dest_buffer,
+                        ::arrow::AllocateResizableBuffer(max_compressed_size, pool));
+  ARROW_ASSIGN_OR_RAISE(
+      int64_t compressed_size,
+      codec->Compress(src_buffer.size(), src_buffer.data(), max_compressed_size,
+                      dest_buffer->mutable_data()));
+  RETURN_NOT_OK(dest_buffer->Resize(compressed_size, /*shrink_to_fit=*/false));
+  return std::shared_ptr<Buffer>(std::move(dest_buffer));
+}
+
 }  // namespace
 
 LevelEncoder::LevelEncoder() {}
@@ -774,6 +794,11 @@ class ColumnWriterImpl {
     if (pager_->has_compressor()) {
       compressor_temp_buffer_ =
           std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(allocator_, 0));
+      page_compression_executor_ = properties_->page_compression_executor();
+      if (page_compression_executor_ != nullptr) {
+        page_codecs_.resize(
+            std::max<int64_t>(1, properties_->max_pending_compressed_pages()));
+      }
     }
     if (properties_->content_defined_chunking_enabled()) {
       auto cdc_options = properties_->content_defined_chunking_options();
@@ -783,7 +808,14 @@ class ColumnWriterImpl {
     }
   }
 
-  virtual ~ColumnWriterImpl() = default;
+  virtual ~ColumnWriterImpl() {
+    // The pages being compressed use the codecs of this writer, and the pages being
+    // written use its page writer
+    for (auto& pending_page : pending_data_pages_) {
+      pending_page.page.Wait();
+    }
+    last_page_written_.Wait();
+  }
 
   int64_t Close();
 
@@ -821,9 +853,20 @@ class ColumnWriterImpl {
   void BuildDataPageV2(int64_t definition_levels_rle_size,
                        int64_t repetition_levels_rle_size, int64_t uncompressed_size,
                        const std::shared_ptr<Buffer>& values);
+  // BuildDataPageV1 and BuildDataPageV2 when the pages are compressed on the page
+  // compression executor
+  void AddPendingDataPageV1(int64_t definition_levels_rle_size,
+                            int64_t repetition_levels_rle_size,
+                            int64_t uncompressed_size,
+                            const std::shared_ptr<Buffer>& values);
+  void AddPendingDataPageV2(int64_t definition_levels_rle_size,
+                            int64_t repetition_levels_rle_size,
+                            int64_t uncompressed_size,
+                            const std::shared_ptr<Buffer>& values);
 
   // Serializes Data Pages
   void WriteDataPage(const DataPage& page) {
+    std::lock_guard<std::mutex> lock(page_write_mutex_);
     total_bytes_written_ += pager_->WriteDataPage(page);
   }
 
@@ -848,6 +891,82 @@ class ColumnWriterImpl {
   // Serialize the buffered Data Pages
   void FlushBufferedDataPages();
 
+  // Compress a data page on the page compression executor. make_page is called with
+  // a codec to return the compressed page.  Pages which are buffered until the end of
+  // dictionary encoding are collected by FinishPendingDataPage, the others are written
+  // in order as soon as they and the previous pages are done, while the next pages
+  // are encoded.
+  template <typename MakePage>
+  void AddPendingDataPage(int64_t uncompressed_size, MakePage&& make_page) {
+    while (static_cast<int64_t>(pending_data_pages_.size()) >=
+           static_cast<int64_t>(page_codecs_.size())) {
+      FinishPendingDataPage();
+    }
+    // A codec can't compress several pages at a time, but the page which used this
+    // one before is done since at most page_codecs_.size() pages are pending
+    auto& codec = page_codecs_[num_pending_data_pages_added_++ % page_codecs_.size()];
+    if (codec == nullptr) {
+      auto codec_options = properties_->codec_options(descr_->path());
+      codec = GetCodec(properties_->compression(descr_->path()),
+                       codec_options ? *codec_options : CodecOptions());
+    }
+    {
+      std::lock_guard<std::mutex> lock(page_write_mutex_);
+      pending_bytes_ += uncompressed_size;
+    }
+    ::arrow::Future<std::unique_ptr<DataPage>> page;
+    if (page_compression_executor_->OwnsThisThread()) {
+      // The column is written on the executor itself, so waiting for a page compressed
+      // on it could deadlock once all of its threads wait.  Compress it here instead.
+      page = ::arrow::Future<std::unique_ptr<DataPage>>::MakeFinished(
+          make_page(codec.get()));
+    } else {
+      PARQUET_ASSIGN_OR_THROW(
+          page, page_compression_executor_->Submit(
+                    [codec = codec.get(),
+                     make_page = std::forward<MakePage>(make_page)]() mutable {
+                      return make_page(codec);
+                    }));
+    }
+    const bool buffered = has_dictionary_ && !fallback_;
+    ::arrow::Future<> written;
+    if (!buffered) {
+      last_page_written_ = last_page_written_.Then([this, page, uncompressed_size]() {
+        return page.Then(
+            [this, uncompressed_size](const std::unique_ptr<DataPage>& data_page) {
+              BEGIN_PARQUET_CATCH_EXCEPTIONS
+              std::lock_guard<std::mutex> lock(page_write_mutex_);
+              total_bytes_written_ += pager_->WriteDataPage(*data_page);
+              pending_bytes_ -= uncompressed_size;
+              END_PARQUET_CATCH_EXCEPTIONS
+              return Status::OK();
+            });
+      });
+      written = last_page_written_;
+    }
+    pending_data_pages_.push_back(
+        {std::move(page), std::move(written), buffered, uncompressed_size});
+  }
+
+  // Wait for the oldest pending data page, then buffer it until the end of dictionary
+  // encoding or wait for it to be written
+  void FinishPendingDataPage() {
+    PendingDataPage pending_page = std::move(pending_data_pages_.front());
+    pending_data_pages_.pop_front();
+    if (pending_page.buffered) {
+      PARQUET_ASSIGN_OR_THROW(std::unique_ptr<DataPage> page,
+                              pending_page.page.MoveResult());
+      {
+        std::lock_guard<std::mutex> lock(page_write_mutex_);
+        pending_bytes_ -= pending_page.uncompressed_size;
+      }
+      total_compressed_bytes_ += page->size() + sizeof(format::PageHeader);
+      data_pages_.push_back(std::move(page));
+    } else {
+      PARQUET_THROW_NOT_OK(pending_page.written.status());
+    }
+  }
+
   ColumnChunkMetaDataBuilder* metadata_;
   // key_value_metadata_ for the column chunk
   // It would be nullptr if there is no KeyValueMetadata set.
@@ -912,6 +1031,31 @@ class ColumnWriterImpl {
 
   std::vector<std::unique_ptr<DataPage>> data_pages_;
 
+  struct PendingDataPage {
+    ::arrow::Future<std::unique_ptr<DataPage>> page;
+    // Finished once the page is written, unless it is buffered
+    ::arrow::Future<> written;
+    // Whether the page is buffered until the end of dictionary encoding
+    bool buffered;
+    int64_t uncompressed_size;
+  };
+
+  // The executor the data pages are compressed on, if any
+  ::arrow::internal::Executor* page_compression_executor_ = nullptr;
+  // The data pages being compressed, in page order
+  std::deque<PendingDataPage> pending_data_pages_;
+  // One codec per data page which may be pending
+  std::vector<std::unique_ptr<::arrow::util::Codec>> page_codecs_;
+  int64_t num_pending_data_pages_added_ = 0;
+  // The uncompressed size of the data pages being compressed or written
+  int64_t pending_bytes_ = 0;
+  // Guards the writes to pager_, total_bytes_written_ and pending_bytes_, as the
+  // pages compressed on the page compression executor are written from its threads
+  mutable std::mutex page_write_mutex_;
+  // Finished once the last of the data pages which aren't buffered is written, the
+  // writes are chained so that the pages are written in order
+  ::arrow::Future<> last_page_written_ = ::arrow::Future<>::MakeFinished();
+
   std::optional<internal::ContentDefinedChunker> content_defined_chunker_;
 
  private:
@@ -1002,10 +1146,47 @@ void ColumnWriterImpl::AddDataPage() {
   num_buffered_nulls_ = 0;
 }
 
+void ColumnWriterImpl::AddPendingDataPageV1(int64_t definition_levels_rle_size,
+                                            int64_t repetition_levels_rle_size,
+                                            int64_t uncompressed_size,
+                                            const std::shared_ptr<Buffer>& values) {
+  // The page needs its own buffer, as uncompressed_data_ is reused
+  std::shared_ptr<ResizableBuffer> uncompressed_data =
+      AllocateBuffer(allocator_, uncompressed_size);
+  ConcatenateBuffers(definition_levels_rle_size, repetition_levels_rle_size, values,
+                     uncompressed_data->mutable_data());
+
+  auto [page_stats, page_size_stats] = GetPageStatistics();
+  page_stats.ApplyStatSizeLimits(properties_->max_statistics_size(descr_->path()));
+  page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
+  ResetPageStatistics();
+
+  AddPendingDataPage(
+      uncompressed_size,
+      [uncompressed_data, num_values = static_cast<int32_t>(num_buffered_values_),
+       encoding = encoding_, uncompressed_size, page_stats = std::move(page_stats),
+       first_row_index = rows_written_ - num_buffered_rows_,
+       page_size_stats = std::move(page_size_stats), pool = allocator_](
+          ::arrow::util::Codec* codec) mutable -> Result<std::unique_ptr<DataPage>> {
+        ARROW_ASSIGN_OR_RAISE(auto compressed_data,
+                              CompressBuffer(codec, *uncompressed_data, pool));
+        return std::make_unique<DataPageV1>(
+            compressed_data, num_values, encoding, Encoding::RLE, Encoding::RLE,
+            uncompressed_size, std::move(page_stats), first_row_index,
+            std::move(page_size_stats));
+      });
+}
+
 void ColumnWriterImpl::BuildDataPageV1(int64_t definition_levels_rle_size,
                                        int64_t repetition_levels_rle_size,
                                        int64_t uncompressed_size,
                                        const std::shared_ptr<Buffer>& values) {
+  if (page_compression_executor_ != nullptr) {
+    AddPendingDataPageV1(definition_levels_rle_size, repetition_levels_rle_size,
+                         uncompressed_size, values);
+    return;
+  }
+
   // Use Arrow::Buffer::shrink_to_fit = false
   // underlying buffer only keeps growing. Resize to a smaller size does not reallocate.
   PARQUET_THROW_NOT_OK(uncompressed_data_->Resize(uncompressed_size, false));
@@ -1048,10 +1229,71 @@ void ColumnWriterImpl::BuildDataPageV1(int64_t definition_levels_rle_size,
   }
 }
 
+void ColumnWriterImpl::AddPendingDataPageV2(int64_t definition_levels_rle_size,
+                                            int64_t repetition_levels_rle_size,
+                                            int64_t uncompressed_size,
+                                            const std::shared_ptr<Buffer>& values) {
+  // The levels are copied along with the values, as their buffers are reused
+  const int64_t levels_size = definition_levels_rle_size + repetition_levels_rle_size;
+  std::shared_ptr<ResizableBuffer> uncompressed_data =
+      AllocateBuffer(allocator_, uncompressed_size);
+  ConcatenateBuffers(definition_levels_rle_size, repetition_levels_rle_size, values,
+                     uncompressed_data->mutable_data());
+
+  auto [page_stats, page_size_stats] = GetPageStatistics();
+  page_stats.ApplyStatSizeLimits(properties_->max_statistics_size(descr_->path()));
+  page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
+  ResetPageStatistics();
+  DCHECK(!page_stats.has_null_count || page_stats.null_count == num_buffered_nulls_);
+
+  AddPendingDataPage(
+      uncompressed_size,
+      [uncompressed_data, levels_size,
+       num_values = static_cast<int32_t>(num_buffered_values_),
+       null_count = static_cast<int32_t>(num_buffered_nulls_),
+       num_rows = static_cast<int32_t>(num_buffered_rows_), encoding = encoding_,
+       def_levels_byte_length = static_cast<int32_t>(definition_levels_rle_size),
+       rep_levels_byte_length = static_cast<int32_t>(repetition_levels_rle_size),
+       uncompressed_size, page_stats = std::move(page_stats),
+       first_row_index = rows_written_ - num_buffered_rows_,
+       page_size_stats = std::move(page_size_stats), pool = allocator_](
+          ::arrow::util::Codec* codec) mutable -> Result<std::unique_ptr<DataPage>> {
+        // Only keep the compressed values if they are smaller
+        std::shared_ptr<Buffer> page_data = uncompressed_data;
+        bool page_is_compressed = false;
+        if (uncompressed_size > levels_size) {
+          auto values = SliceBuffer(uncompressed_data, levels_size);
+          ARROW_ASSIGN_OR_RAISE(auto compressed_values,
+                                CompressBuffer(codec, *values, pool));
+          if (compressed_values->size() < values->size()) {
+            ARROW_ASSIGN_OR_RAISE(
+                page_data,
+                ::arrow::AllocateBuffer(levels_size + compressed_values->size(), pool));
+            uint8_t* out = page_data->mutable_data();
+            memcpy(out, uncompressed_data->data(), static_cast<size_t>(levels_size));
+            memcpy(out + levels_size, compressed_values->data(),
+                   static_cast<size_t>(compressed_values->size()));
+            page_is_compressed = true;
+          }
+        }
+        return std::make_unique<DataPageV2>(
+            page_data, num_values, null_count, num_rows, encoding,
+            def_levels_byte_length, rep_levels_byte_length, uncompressed_size,
+            page_is_compressed, std::move(page_stats), first_row_index,
+            std::move(page_size_stats));
+      });
+}
+
 void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
                                        int64_t repetition_levels_rle_size,
                                        int64_t uncompressed_size,
                                        const std::shared_ptr<Buffer>& values) {
+  if (page_compression_executor_ != nullptr) {
+    AddPendingDataPageV2(definition_levels_rle_size, repetition_levels_rle_size,
+                         uncompressed_size, values);
+    return;
+  }
+
   // Compress the values if needed. Repetition and definition levels are uncompressed in
   // V2.
   bool page_is_compressed = false;
@@ -1150,6 +1392,9 @@ void ColumnWriterImpl::FlushBufferedDataPages() {
   if (num_buffered_values_ > 0) {
     AddDataPage();
   }
+  while (!pending_data_pages_.empty()) {
+    FinishPendingDataPage();
+  }
   for (const auto& page_ptr : data_pages_) {
     WriteDataPage(*page_ptr);
   }
@@ -1610,11 +1855,19 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
 
   int64_t rows_written() const override { return rows_written_; }
 
-  int64_t total_compressed_bytes() const override { return total_compressed_bytes_; }
+  int64_t total_compressed_bytes() const override {
+    // The pending data pages are counted with their uncompressed size
+    std::lock_guard<std::mutex> lock(page_write_mutex_);
+    return total_compressed_bytes_ + pending_bytes_;
+  }
 
-  int64_t total_bytes_written() const override { return total_bytes_written_; }
+  int64_t total_bytes_written() const override {
+    std::lock_guard<std::mutex> lock(page_write_mutex_);
+    return total_bytes_written_;
+  }
 
   int64_t total_compressed_bytes_written() const override {
+    std::lock_guard<std::mutex> lock(page_write_mutex_);
     return pager_->total_compressed_bytes_written();
   }
 
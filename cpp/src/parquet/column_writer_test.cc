@@ -24,11 +24,13 @@
 
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_builders.h"
 #include "arrow/util/config.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 #include "parquet/bloom_filter.h"
 #include "parquet/bloom_filter_writer.h"
@@ -112,14 +114,16 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
       const ParquetVersion::type version = ParquetVersion::PARQUET_1_0,
       const ParquetDataPageVersion data_page_version = ParquetDataPageVersion::V1,
       bool enable_checksum = false, int64_t page_size = kDefaultDataPageSize,
-      int64_t max_rows_per_page = kDefaultMaxRowsPerPage) {
+      int64_t max_rows_per_page = kDefaultMaxRowsPerPage,
+      ::arrow::internal::Executor* page_compression_executor = NULLPTR,
+      int64_t dictionary_pagesize_limit = DICTIONARY_PAGE_SIZE) {
     sink_ = CreateOutputStream();
     WriterProperties::Builder wp_builder;
     wp_builder.version(version)->data_page_version(data_page_version);
     if (column_properties.encoding() == Encoding::PLAIN_DICTIONARY ||
         column_properties.encoding() == Encoding::RLE_DICTIONARY) {
       wp_builder.enable_dictionary();
-      wp_builder.dictionary_pagesize_limit(DICTIONARY_PAGE_SIZE);
+      wp_builder.dictionary_pagesize_limit(dictionary_pagesize_limit);
     } else {
       wp_builder.disable_dictionary();
       wp_builder.encoding(column_properties.encoding());
@@ -130,6 +134,9 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
     wp_builder.max_statistics_size(column_properties.max_statistics_size());
     wp_builder.data_pagesize(page_size);
     wp_builder.max_rows_per_page(max_rows_per_page);
+    if (page_compression_executor != NULLPTR) {
+      wp_builder.enable_parallel_page_compression(page_compression_executor);
+    }
     writer_properties_ = wp_builder.build();
 
     metadata_ = ColumnChunkMetaDataBuilder::Make(writer_properties_, this->descr_);
@@ -710,6 +717,61 @@ TYPED_TEST(TestPrimitiveWriter, RequiredPlainWithZstdCodecOptions) {
   this->TestRequiredWithCodecOptions(Encoding::PLAIN, Compression::ZSTD, false, false,
                                      LARGE_SIZE, codec_options);
 }
+
+TYPED_TEST(TestPrimitiveWriter, ParallelPageCompression) {
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  // Only one thread, so that writing the column on it would deadlock if it waited for
+  // pages compressed on it
+  ASSERT_OK_AND_ASSIGN(auto single_thread_pool, ::arrow::internal::ThreadPool::Make(1));
+  this->GenerateData(VERY_LARGE_SIZE);
+  for (auto data_page_version :
+       {ParquetDataPageVersion::V1, ParquetDataPageVersion::V2}) {
+    for (auto encoding : {Encoding::PLAIN, Encoding::RLE_DICTIONARY}) {
+      for (bool write_on_executor : {false, true}) {
+        ARROW_SCOPED_TRACE("encoding = ", EncodingToString(encoding),
+                           ", write_on_executor = ", write_on_executor);
+        ::arrow::internal::ThreadPool* executor =
+            write_on_executor ? single_thread_pool.get() : thread_pool.get();
+        ColumnProperties column_properties;
+        column_properties.set_encoding(encoding);
+        column_properties.set_compression(Compression::ZSTD);
+        // Small pages and a dictionary limit of several pages, so that dictionary
+        // encoding falls back to plain encoding while pages are pending
+        auto writer = this->BuildWriter(
+            VERY_LARGE_SIZE, column_properties, ParquetVersion::PARQUET_2_6,
+            data_page_version, /*enable_checksum=*/false, /*page_size=*/4096,
+            /*max_rows_per_page=*/100, executor,
+            /*dictionary_pagesize_limit=*/16 * 1024);
+        auto write = [&]() {
+          writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+          writer->Close();
+        };
+        if (write_on_executor) {
+          ASSERT_OK_AND_ASSIGN(auto written, executor->Submit(write));
+          ASSERT_FINISHES_OK(written);
+        } else {
+          write();
+        }
+
+        this->SetupValuesOut(VERY_LARGE_SIZE);
+        this->ReadColumnFully(Compression::ZSTD);
+        ASSERT_EQ(VERY_LARGE_SIZE, this->values_read_);
+        this->values_.resize(VERY_LARGE_SIZE);
+        ASSERT_EQ(this->values_, this->values_out_);
+
+        if (encoding == Encoding::RLE_DICTIONARY &&
+            this->type_num() != Type::BOOLEAN) {
+          std::vector<Encoding::type> encodings_vector = this->metadata_encodings();
+          std::set<Encoding::type> encodings(encodings_vector.begin(),
+                                             encodings_vector.end());
+          std::set<Encoding::type> expected(
+              {Encoding::RLE_DICTIONARY, Encoding::PLAIN, Encoding::RLE});
+          ASSERT_EQ(encodings, expected);
+        }
+      }
+    }
+  }
+}
 #endif
 
 TYPED_TEST(TestPrimitiveWriter, Optional) {
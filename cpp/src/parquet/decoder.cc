@@ -339,6 +339,20 @@ class TypedDecoderImpl : public DecoderImpl, virtual public TypedDecoder<DType>
     }
   }
 
+  // Encodings which cannot skip values cheaply decode them into a scratch buffer
+  int Skip(int num_values) override {
+    constexpr int kBatchSize = 256;
+    T scratch[kBatchSize];
+    int values_skipped = 0;
+    while (values_skipped < num_values) {
+      const int batch_size = std::min(kBatchSize, num_values - values_skipped);
+      const int values_decoded = this->Decode(scratch, batch_size);
+      values_skipped += values_decoded;
+      if (values_decoded < batch_size) break;
+    }
+    return values_skipped;
+  }
+
   int type_length_;
 };
 
@@ -355,6 +369,8 @@ class PlainDecoder : public TypedDecoderImpl<DType> {
 
   int Decode(T* buffer, int max_values) override;
 
+  int Skip(int num_values) override;
+
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* builder) override;
@@ -529,6 +545,56 @@ int PlainDecoder<DType>::Decode(T* buffer, int max_values) {
   return max_values;
 }
 
+// Skip routine templated on C++ type rather than type enum, returning the number of
+// bytes skipped
+template <typename T>
+inline int SkipPlain(const uint8_t* data, int64_t data_size, int num_values,
+                     int type_length) {
+  int64_t bytes_to_skip = num_values * static_cast<int64_t>(sizeof(T));
+  if (bytes_to_skip > data_size || bytes_to_skip > INT_MAX) {
+    ParquetException::EofException();
+  }
+  return static_cast<int>(bytes_to_skip);
+}
+
+template <>
+inline int SkipPlain<ByteArray>(const uint8_t* data, int64_t data_size, int num_values,
+                                int type_length) {
+  int bytes_skipped = 0;
+  ByteArray value;
+  for (int i = 0; i < num_values; ++i) {
+    const auto increment = ReadByteArray(data, data_size, &value);
+    if (ARROW_PREDICT_FALSE(increment > INT_MAX - bytes_skipped)) {
+      throw ParquetException("BYTE_ARRAY chunk too large");
+    }
+    data += increment;
+    data_size -= increment;
+    bytes_skipped += static_cast<int>(increment);
+  }
+  return bytes_skipped;
+}
+
+template <>
+inline int SkipPlain<FixedLenByteArray>(const uint8_t* data, int64_t data_size,
+                                        int num_values, int type_length) {
+  int64_t bytes_to_skip = static_cast<int64_t>(type_length) * num_values;
+  if (bytes_to_skip > data_size || bytes_to_skip > INT_MAX) {
+    ParquetException::EofException();
+  }
+  return static_cast<int>(bytes_to_skip);
+}
+
+template <typename DType>
+int PlainDecoder<DType>::Skip(int num_values) {
+  num_values = std::min(num_values, this->num_values_);
+  int bytes_skipped =
+      SkipPlain<T>(this->data_, this->len_, num_values, this->type_length_);
+  this->data_ += bytes_skipped;
+  this->len_ -= bytes_skipped;
+  this->num_values_ -= num_values;
+  return num_values;
+}
+
 // PLAIN decoder implementation for BOOLEAN
 
 class PlainBooleanDecoder : public TypedDecoderImpl<BooleanType>, public BooleanDecoder {
@@ -539,6 +605,7 @@ class PlainBooleanDecoder : public TypedDecoderImpl<BooleanType>, public Boolean
   // Two flavors of bool decoding
   int Decode(uint8_t* buffer, int max_values) override;
   int Decode(bool* buffer, int max_values) override;
+  int Skip(int num_values) override;
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<BooleanType>::Accumulator* out) override;
@@ -639,6 +706,15 @@ int PlainBooleanDecoder::Decode(uint8_t* buffer, int max_values) {
   return max_values;
 }
 
+int PlainBooleanDecoder::Skip(int num_values) {
+  num_values = std::min(num_values, num_values_);
+  if (ARROW_PREDICT_FALSE(!bit_reader_->Advance(num_values))) {
+    ParquetException::EofException();
+  }
+  num_values_ -= num_values;
+  return num_values;
+}
+
 int PlainBooleanDecoder::Decode(bool* buffer, int max_values) {
   max_values = std::min(max_values, num_values_);
   if (bit_reader_->GetBatch(1, buffer, max_values) != max_values) {
@@ -708,7 +784,7 @@ inline int PlainDecoder<FLBAType>::DecodeArrow(
                    [&](int64_t position, int64_t run_length, bool is_valid) {
                      if (is_valid) {
                        for (int64_t i = 0; i < run_length; ++i) {
-                         RETURN_NOT_OK(builder->Append(data_));
+                         RETURN_NOT_OK(builder->Append(data_ + i * byte_width));
                        }
                        data_ += run_length * byte_width;
                      } else {
@@ -907,6 +983,15 @@ class DictDecoderImpl : public TypedDecoderImpl<Type>, public DictDecoder<Type>
     return num_values;
   }
 
+  int Skip(int num_values) override {
+    num_values = std::min(num_values, this->num_values_);
+    if (idx_decoder_.Advance(num_values) != num_values) {
+      ParquetException::EofException();
+    }
+    this->num_values_ -= num_values;
+    return num_values;
+  }
+
   int DecodeSpaced(T* buffer, int num_values, int null_count, const uint8_t* valid_bits,
                    int64_t valid_bits_offset) override {
     num_values = std::min(num_values, this->num_values_);
@@ -953,9 +1038,7 @@ class DictDecoderImpl : public TypedDecoderImpl<Type>, public DictDecoder<Type>
         valid_bits, valid_bits_offset, num_values, null_count,
         [&]() { valid_bytes[i++] = 1; }, [&]() { ++i; });
 
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendIndices(builder, indices_buffer, num_values, valid_bytes.data());
     this->num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -973,8 +1056,7 @@ class DictDecoderImpl : public TypedDecoderImpl<Type>, public DictDecoder<Type>
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendIndices(builder, indices_buffer, num_values);
     this->num_values_ -= num_values;
     return num_values;
   }
@@ -993,6 +1075,35 @@ class DictDecoderImpl : public TypedDecoderImpl<Type>, public DictDecoder<Type>
   }
 
  protected:
+  using DictAccumulator = typename EncodingTraits<Type>::DictAccumulator;
+
+  static void AppendIndices(::arrow::ArrayBuilder* builder, const int32_t* indices,
+                            int64_t length, const uint8_t* valid_bytes = NULLPTR) {
+    if constexpr (std::is_base_of_v<::arrow::ArrayBuilder, DictAccumulator>) {
+      auto dict_builder = checked_cast<DictAccumulator*>(builder);
+      PARQUET_THROW_NOT_OK(dict_builder->AppendIndices(indices, length, valid_bytes));
+    } else {
+      ParquetException::NYI("Dictionary indices for " + TypeToString(Type::type_num));
+    }
+  }
+
+  // Insert the decoded dictionary, whose values are held by the given buffer, into
+  // the memo of the dictionary builder
+  void InsertDictionaryValues(::arrow::ArrayBuilder* builder,
+                              const std::shared_ptr<Buffer>& values) {
+    if constexpr (std::is_base_of_v<::arrow::ArrayBuilder, DictAccumulator>) {
+      auto dict_builder = checked_cast<DictAccumulator*>(builder);
+      const auto& value_type =
+          checked_cast<const ::arrow::DictionaryType&>(*dict_builder->type())
+              .value_type();
+      auto arr = ::arrow::MakeArray(::arrow::ArrayData::Make(
+          value_type, dictionary_length_, {nullptr, values}, /*null_count=*/0));
+      PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(*arr));
+    } else {
+      ParquetException::NYI("InsertDictionary for " + TypeToString(Type::type_num));
+    }
+  }
+
   Status IndexInBounds(int32_t index) const {
     if (ARROW_PREDICT_TRUE(0 <= index && index < dictionary_length_)) {
       return Status::OK();
@@ -1244,7 +1355,14 @@ int DictDecoderImpl<Type>::DecodeArrow(
 
 template <typename Type>
 void DictDecoderImpl<Type>::InsertDictionary(::arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+  // The dictionary values are laid out as the values of the Arrow array
+  InsertDictionaryValues(builder, dictionary_);
+}
+
+template <>
+void DictDecoderImpl<FLBAType>::InsertDictionary(::arrow::ArrayBuilder* builder) {
+  // SetDict copies the fixed size values contiguously
+  InsertDictionaryValues(builder, byte_array_data_);
 }
 
 template <>
@@ -1897,6 +2015,15 @@ class RleBooleanDecoder : public TypedDecoderImpl<BooleanType>, public BooleanDe
     ParquetException::NYI("Decode(uint8_t*, int) for RleBooleanDecoder");
   }
 
+  int Skip(int num_values) override {
+    num_values = std::min(num_values, num_values_);
+    if (decoder_->Advance(num_values) != num_values) {
+      ParquetException::EofException();
+    }
+    num_values_ -= num_values;
+    return num_values;
+  }
+
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<BooleanType>::Accumulator* out) override {
@@ -2271,7 +2398,41 @@ class ByteStreamSplitDecoderBase : public TypedDecoderImpl<DType> {
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* builder) override {
-    ParquetException::NYI("DecodeArrow to DictAccumulator for BYTE_STREAM_SPLIT");
+    const int values_to_decode = num_values - null_count;
+    if (ARROW_PREDICT_FALSE(this->num_values_ < values_to_decode)) {
+      ParquetException::EofException();
+    }
+
+    PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+
+    // Decode into an intermediate buffer, then look the values up in the memo
+    uint8_t* decode_out = this->EnsureDecodeBuffer(values_to_decode);
+    const int num_decoded = this->DecodeRaw(decode_out, values_to_decode);
+    DCHECK_EQ(num_decoded, values_to_decode);
+
+    const uint8_t* decoded = decode_out;
+
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() {
+          if constexpr (std::is_same_v<DType, FLBAType>) {
+            PARQUET_THROW_NOT_OK(builder->Append(decoded));
+          } else {
+            PARQUET_THROW_NOT_OK(builder->Append(SafeLoadAs<T>(decoded)));
+          }
+          decoded += this->type_length_;
+        },
+        [&]() { PARQUET_THROW_NOT_OK(builder->AppendNull()); });
+    return values_to_decode;
+  }
+
+  int Skip(int num_values) override {
+    // Every stream advances by one byte per value
+    const int values_to_skip = std::min(this->num_values_, num_values);
+    this->data_ += values_to_skip;
+    this->num_values_ -= values_to_skip;
+    this->len_ -= this->type_length_ * values_to_skip;
+    return values_to_skip;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
@@ -278,6 +278,13 @@ class TypedDecoder : virtual public Decoder {
   /// at the end of the current data page.
   virtual int Decode(T* buffer, int max_values) = 0;
 
+  /// \brief Skip values without materializing them
+  ///
+  /// \param[in] num_values number of values to skip
+  /// \return The number of values skipped. Should be identical to num_values except
+  /// at the end of the current data page.
+  virtual int Skip(int num_values) = 0;
+
   /// \brief Decode the values in this data page but leave spaces for null entries.
   ///
   /// \param[in] buffer destination for decoded values
@@ -356,12 +356,40 @@ class TestPlainEncoding : public TestEncodingBase<Type> {
                                                         valid_bits, valid_bits_offset));
   }
 
+  void CheckSkip() {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::PLAIN, /*use_dictionary=*/false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::PLAIN, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+
+    // Alternate skipping and decoding a few values
+    int position = 0;
+    for (int skip : {1, 7, 100, 1000}) {
+      ASSERT_EQ(skip, decoder->Skip(skip));
+      position += skip;
+      ASSERT_EQ(3, decoder->Decode(decode_buf_, 3));
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<c_type>(decode_buf_, draws_ + position, 3));
+      position += 3;
+    }
+    // Skipping past the end stops at the end of the data
+    ASSERT_EQ(num_values_ - position, decoder->Skip(num_values_));
+    ASSERT_EQ(0, decoder->values_left());
+  }
+
  protected:
   USING_BASE_MEMBERS();
 };
 
 TYPED_TEST_SUITE(TestPlainEncoding, ParquetTypes);
 
+TYPED_TEST(TestPlainEncoding, Skip) {
+  this->InitData(2000, 1);
+  ASSERT_NO_FATAL_FAILURE(this->CheckSkip());
+}
+
 TYPED_TEST(TestPlainEncoding, BasicRoundTrip) {
   ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
 
@@ -449,6 +477,15 @@ class TestDictionaryEncoding : public TestEncodingBase<Type> {
     values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, 0, nullptr, 0);
     ASSERT_EQ(num_values_, values_decoded);
     ASSERT_NO_FATAL_FAILURE(VerifyResults<c_type>(decode_buf_, draws_, num_values_));
+
+    // Skipping indices, then decoding the rest
+    decoder->SetData(num_values_, indices->data(), static_cast<int>(indices->size()));
+    const int num_skipped = num_values_ / 3;
+    ASSERT_EQ(num_skipped, decoder->Skip(num_skipped));
+    values_decoded = decoder->Decode(decode_buf_, num_values_);
+    ASSERT_EQ(num_values_ - num_skipped, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(
+        VerifyResults<c_type>(decode_buf_, draws_ + num_skipped, values_decoded));
   }
 
  protected:
@@ -156,6 +156,11 @@ std::shared_ptr<internal::RecordReader> RowGroupReader::RecordReaderWithExposeEn
           IsColumnChunkFullyDictionaryEncoded(*metadata()->ColumnChunk(i)));
 }
 
+std::unique_ptr<PageReader> RowGroupReader::Contents::GetColumnPageReader(
+    int i, const OffsetIndex& offset_index, const RowRanges& row_ranges) {
+  return nullptr;
+}
+
 std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   if (i >= metadata()->num_columns()) {
     std::stringstream ss;
@@ -166,6 +171,17 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const OffsetIndex& offset_index, const RowRanges& row_ranges) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnPageReader(i, offset_index, row_ranges);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -212,6 +228,67 @@ namespace {
   return {col_start, col_length};
 }
 
+/// Whether the data pages of a column chunk can be read separately, skipping the
+/// others. Pages of repeated columns may not start at a record boundary, and the
+/// pages of encrypted columns are authenticated with their ordinal.
+bool CanReadColumnChunkPages(const RowGroupMetaData& row_group_metadata,
+                             int column_index) {
+  return row_group_metadata.schema()->Column(column_index)->max_repetition_level() ==
+             0 &&
+         row_group_metadata.ColumnChunk(column_index)->crypto_metadata() == nullptr;
+}
+
+/// The sections of the file to read for the data pages of the given column chunk
+/// which hold some row of row_ranges, along with its dictionary page if any.
+/// Adjacent pages are read together.
+struct ColumnChunkPages {
+  std::vector<::arrow::io::ReadRange> ranges;
+  // The number of values in the selected data pages
+  int64_t num_values = 0;
+};
+
+ColumnChunkPages ComputeColumnChunkPages(FileMetaData* file_metadata,
+                                         int64_t source_size, int row_group_index,
+                                         int column_index,
+                                         const OffsetIndex& offset_index,
+                                         const RowRanges& row_ranges) {
+  const ::arrow::io::ReadRange col_range = ComputeColumnChunkRange(
+      file_metadata, source_size, row_group_index, column_index);
+  const int64_t num_rows = file_metadata->RowGroup(row_group_index)->num_rows();
+  const RowRanges selected =
+      RowRanges::Intersection(row_ranges, RowRanges::All(num_rows));
+  const std::vector<PageLocation>& page_locations = offset_index.page_locations();
+  const std::vector<RowRange> pages = PageRowRanges(offset_index, num_rows);
+
+  ColumnChunkPages result;
+  auto add_range = [&](int64_t offset, int64_t length) {
+    if (offset < col_range.offset || length < 0 ||
+        offset + length > col_range.offset + col_range.length) {
+      throw ParquetException("Invalid offset index (corrupt file?)");
+    }
+    if (!result.ranges.empty() &&
+        result.ranges.back().offset + result.ranges.back().length == offset) {
+      result.ranges.back().length += length;
+    } else {
+      result.ranges.push_back({offset, length});
+    }
+  };
+  const int64_t first_page_offset = page_locations.empty()
+                                        ? col_range.offset + col_range.length
+                                        : page_locations[0].offset;
+  if (first_page_offset > col_range.offset) {
+    // The dictionary page
+    add_range(col_range.offset, first_page_offset - col_range.offset);
+  }
+  for (size_t i = 0; i < pages.size(); ++i) {
+    if (!selected.Overlaps(pages[i])) continue;
+    add_range(page_locations[i].offset, page_locations[i].compressed_page_size);
+    // Each value of a non-repeated column is a row
+    result.num_values += pages[i].length();
+  }
+  return result;
+}
+
 }  // namespace
 
 // RowGroupReader::Contents implementation for the Parquet file specification
@@ -290,6 +367,44 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             *descr, always_compressed, &ctx);
   }
 
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const OffsetIndex& offset_index, const RowRanges& row_ranges) override {
+    if (!CanReadColumnChunkPages(*row_group_metadata_, i)) {
+      return nullptr;
+    }
+    auto col = row_group_metadata_->ColumnChunk(i);
+    const ColumnDescriptor* descr = row_group_metadata_->schema()->Column(i);
+
+    ColumnChunkPages pages = ComputeColumnChunkPages(
+        file_metadata_, source_size_, row_group_ordinal_, i, offset_index, row_ranges);
+    const bool prebuffered =
+        cached_source_ && prebuffered_column_chunks_bitmap_ != nullptr &&
+        ::arrow::bit_util::GetBit(prebuffered_column_chunks_bitmap_->data(), i);
+    ::arrow::BufferVector buffers;
+    for (const ::arrow::io::ReadRange& range : pages.ranges) {
+      std::shared_ptr<Buffer> buffer;
+      if (prebuffered) {
+        PARQUET_ASSIGN_OR_THROW(buffer, cached_source_->Read(range));
+      } else {
+        PARQUET_ASSIGN_OR_THROW(buffer, source_->ReadAt(range.offset, range.length));
+      }
+      buffers.push_back(std::move(buffer));
+    }
+    std::shared_ptr<Buffer> data;
+    if (buffers.size() == 1) {
+      data = std::move(buffers[0]);
+    } else {
+      PARQUET_ASSIGN_OR_THROW(
+          data, ::arrow::ConcatenateBuffers(buffers, properties_.memory_pool()));
+    }
+
+    bool always_compressed = file_metadata_->writer_version().VersionLt(
+        ApplicationVersion::PARQUET_CPP_10353_FIXED_VERSION());
+    return PageReader::Open(std::make_shared<::arrow::io::BufferReader>(std::move(data)),
+                            pages.num_values, col->compression(), properties_, *descr,
+                            always_compressed);
+  }
+
  private:
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
@@ -377,6 +492,7 @@ class SerializedFile : public ParquetFileReader::Contents {
 
   void PreBuffer(const std::vector<int>& row_groups,
                  const std::vector<int>& column_indices,
+                 const std::vector<RowRanges>& row_ranges,
                  const ::arrow::io::IOContext& ctx,
                  const ::arrow::io::CacheOptions& options) {
     cached_source_ =
@@ -395,12 +511,9 @@ class SerializedFile : public ParquetFileReader::Contents {
     }
     for (int row : row_groups) {
       prebuffered_column_chunks_[row] = buffer_columns;
-      for (int col : column_indices) {
-        ranges.push_back(
-            ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
-      }
     }
-    PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
+    PARQUET_THROW_NOT_OK(
+        cached_source_->Cache(BufferedRanges(row_groups, column_indices, row_ranges)));
   }
 
   Result<std::vector<::arrow::io::ReadRange>> GetReadRanges(
@@ -419,18 +532,52 @@ class SerializedFile : public ParquetFileReader::Contents {
   }
 
   Future<> WhenBuffered(const std::vector<int>& row_groups,
-                        const std::vector<int>& column_indices) const {
+                        const std::vector<int>& column_indices,
+                        const std::vector<RowRanges>& row_ranges) {
     if (!cached_source_) {
       return Status::Invalid("Must call PreBuffer before WhenBuffered");
     }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    return cached_source_->WaitFor(
+        BufferedRanges(row_groups, column_indices, row_ranges));
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  // The sections of the file which PreBuffer reads: the data pages holding some of the
+  // selected rows (see SerializedRowGroup::GetColumnPageReader) if they can be read
+  // separately, or else the whole column chunks
+  std::vector<::arrow::io::ReadRange> BufferedRanges(
+      const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges) {
     std::vector<::arrow::io::ReadRange> ranges;
-    for (int row : row_groups) {
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      const int row = row_groups[i];
+      std::shared_ptr<RowGroupPageIndexReader> row_group_page_index;
+      std::unique_ptr<RowGroupMetaData> row_group_metadata;
+      if (!row_ranges.empty()) {
+        if (auto page_index_reader = GetPageIndexReader()) {
+          row_group_page_index = page_index_reader->RowGroup(row);
+        }
+        row_group_metadata = file_metadata_->RowGroup(row);
+      }
       for (int col : column_indices) {
-        ranges.push_back(
-            ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
+        std::shared_ptr<OffsetIndex> offset_index;
+        if (row_group_page_index &&
+            CanReadColumnChunkPages(*row_group_metadata, col)) {
+          offset_index = row_group_page_index->GetOffsetIndex(col);
+        }
+        if (offset_index) {
+          ColumnChunkPages pages =
+              ComputeColumnChunkPages(file_metadata_.get(), source_size_, row, col,
+                                      *offset_index, row_ranges[i]);
+          ranges.insert(ranges.end(), pages.ranges.begin(), pages.ranges.end());
+        } else {
+          ranges.push_back(
+              ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
+        }
       }
     }
-    return cached_source_->WaitFor(ranges);
+    return ranges;
   }
 
   // Metadata/footer parsing. Divided up to separate sync/async paths, and to use
@@ -906,7 +1053,23 @@ void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
   // Access private methods here
   SerializedFile* file =
       ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
-  file->PreBuffer(row_groups, column_indices, ctx, options);
+  file->PreBuffer(row_groups, column_indices, /*row_ranges=*/{}, ctx, options);
+}
+
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices,
+                                  const std::vector<RowRanges>& row_ranges,
+                                  const ::arrow::io::IOContext& ctx,
+                                  const ::arrow::io::CacheOptions& options) {
+  if (!row_ranges.empty() && row_ranges.size() != row_groups.size()) {
+    throw ParquetException("Got row ranges for ", row_ranges.size(),
+                           " row groups, but pre-buffering ", row_groups.size(),
+                           " row groups");
+  }
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  file->PreBuffer(row_groups, column_indices, row_ranges, ctx, options);
 }
 
 Result<std::vector<::arrow::io::ReadRange>> ParquetFileReader::GetReadRanges(
@@ -924,7 +1087,21 @@ Future<> ParquetFileReader::WhenBuffered(const std::vector<int>& row_groups,
   // Access private methods here
   SerializedFile* file =
       ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
-  return file->WhenBuffered(row_groups, column_indices);
+  return file->WhenBuffered(row_groups, column_indices, /*row_ranges=*/{});
+}
+
+Future<> ParquetFileReader::WhenBuffered(const std::vector<int>& row_groups,
+                                         const std::vector<int>& column_indices,
+                                         const std::vector<RowRanges>& row_ranges) const {
+  if (!row_ranges.empty() && row_ranges.size() != row_groups.size()) {
+    return Status::Invalid("Got row ranges for ", row_ranges.size(),
+                           " row groups, but waiting for ", row_groups.size(),
+                           " row groups");
+  }
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  return file->WhenBuffered(row_groups, column_indices, row_ranges);
 }
 
 // ----------------------------------------------------------------------
@@ -27,6 +27,7 @@
 #include "parquet/metadata.h"  // IWYU pragma: keep
 #include "parquet/platform.h"
 #include "parquet/properties.h"
+#include "parquet/row_ranges.h"
 
 namespace parquet {
 
@@ -49,6 +50,9 @@ class PARQUET_EXPORT RowGroupReader {
   struct Contents {
     virtual ~Contents() {}
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
+    // Return nullptr if the data pages of the column chunk can't be read separately
+    virtual std::unique_ptr<PageReader> GetColumnPageReader(
+        int i, const OffsetIndex& offset_index, const RowRanges& row_ranges);
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
   };
@@ -95,6 +99,16 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // EXPERIMENTAL: Construct a PageReader for the indicated column which only returns
+  // the data pages holding some row of row_ranges, after the dictionary page if any.
+  // Only the bytes of these pages are read, at the locations given by the offset
+  // index of the column chunk.
+  //
+  // Returns nullptr if the data pages can't be read separately, i.e. if the column
+  // is repeated or encrypted.
+  std::unique_ptr<PageReader> GetColumnPageReader(int i, const OffsetIndex& offset_index,
+                                                  const RowRanges& row_ranges);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -201,6 +215,22 @@ class PARQUET_EXPORT ParquetFileReader {
                  const ::arrow::io::IOContext& ctx,
                  const ::arrow::io::CacheOptions& options);
 
+  /// Pre-buffer the data pages of the specified columns which hold some of the rows
+  /// selected by row_ranges, along with their dictionary pages.
+  ///
+  /// row_ranges holds the rows to read of each row group in row_groups, or is empty
+  /// to pre-buffer the whole column chunks. The pages are selected using the offset
+  /// index as RowGroupReader::GetColumnPageReader does, so that these page readers
+  /// only read buffered data. The column chunks of repeated or encrypted columns, and
+  /// those without an offset index, are pre-buffered whole.
+  ///
+  /// This method may throw.
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const std::vector<RowRanges>& row_ranges,
+                 const ::arrow::io::IOContext& ctx,
+                 const ::arrow::io::CacheOptions& options);
+
   /// Retrieve the list of byte ranges that would need to be read to retrieve
   /// the data for the specified row groups and column indices.
   ///
@@ -236,6 +266,15 @@ class PARQUET_EXPORT ParquetFileReader {
   ::arrow::Future<> WhenBuffered(const std::vector<int>& row_groups,
                                  const std::vector<int>& column_indices) const;
 
+  /// Wait for the pages selected by row_ranges to be pre-buffered, see
+  /// PreBuffer(row_groups, column_indices, row_ranges, ...).
+  ///
+  /// PreBuffer must be called first with the same row ranges. This method does not
+  /// throw.
+  ::arrow::Future<> WhenBuffered(const std::vector<int>& row_groups,
+                                 const std::vector<int>& column_indices,
+                                 const std::vector<RowRanges>& row_ranges) const;
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
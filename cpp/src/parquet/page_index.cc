@@ -16,6 +16,7 @@
 // under the License.
 
 #include <limits>
+#include <mutex>
 #include <numeric>
 
 #include "arrow/io/interfaces.h"
@@ -244,10 +245,15 @@ class RowGroupPageIndexReaderImpl : public RowGroupPageIndexReader {
     CheckReadRangeOrThrow(*column_index_location, index_read_range_.column_index,
                           row_group_ordinal_);
 
-    if (column_index_buffer_ == nullptr) {
-      column_index_buffer_ =
-          ReadIndexBuffer(index_read_range_.column_index->offset,
-                          index_read_range_.column_index->length, "ColumnIndex");
+    std::shared_ptr<::arrow::Buffer> column_index_buffer;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (column_index_buffer_ == nullptr) {
+        column_index_buffer_ =
+            ReadIndexBuffer(index_read_range_.column_index->offset,
+                            index_read_range_.column_index->length, "ColumnIndex");
+      }
+      column_index_buffer = column_index_buffer_;
     }
 
     int64_t buffer_offset =
@@ -266,7 +272,7 @@ class RowGroupPageIndexReaderImpl : public RowGroupPageIndexReader {
                       encryption::kColumnIndex);
     }
 
-    return ColumnIndex::Make(*descr, column_index_buffer_->data() + buffer_offset, length,
+    return ColumnIndex::Make(*descr, column_index_buffer->data() + buffer_offset, length,
                              properties_, decryptor.get());
   }
 
@@ -285,10 +291,15 @@ class RowGroupPageIndexReaderImpl : public RowGroupPageIndexReader {
     CheckReadRangeOrThrow(*offset_index_location, index_read_range_.offset_index,
                           row_group_ordinal_);
 
-    if (offset_index_buffer_ == nullptr) {
-      offset_index_buffer_ =
-          ReadIndexBuffer(index_read_range_.offset_index->offset,
-                          index_read_range_.offset_index->length, "OffsetIndex");
+    std::shared_ptr<::arrow::Buffer> offset_index_buffer;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (offset_index_buffer_ == nullptr) {
+        offset_index_buffer_ =
+            ReadIndexBuffer(index_read_range_.offset_index->offset,
+                            index_read_range_.offset_index->length, "OffsetIndex");
+      }
+      offset_index_buffer = offset_index_buffer_;
     }
 
     int64_t buffer_offset =
@@ -306,7 +317,7 @@ class RowGroupPageIndexReaderImpl : public RowGroupPageIndexReader {
                       encryption::kOffsetIndex);
     }
 
-    return OffsetIndex::Make(offset_index_buffer_->data() + buffer_offset, length,
+    return OffsetIndex::Make(offset_index_buffer->data() + buffer_offset, length,
                              properties_, decryptor.get());
   }
 
@@ -379,6 +390,9 @@ class RowGroupPageIndexReaderImpl : public RowGroupPageIndexReader {
 
   /// Buffer to hold the raw bytes of the page index.
   /// Will be set lazily when the corresponding page index is accessed for the 1st time.
+  /// The reader is shared by the columns of the row group, which may be read
+  /// concurrently, so the buffers are guarded by mutex_.
+  std::mutex mutex_;
   std::shared_ptr<::arrow::Buffer> column_index_buffer_;
   std::shared_ptr<::arrow::Buffer> offset_index_buffer_;
 };
@@ -399,6 +413,13 @@ class PageIndexReaderImpl : public PageIndexReader {
       throw ParquetException("Invalid row group ordinal: ", i);
     }
 
+    std::lock_guard<std::mutex> lock(mutex_);
+    // The reader of a row group is kept, so that its page index is only read once
+    auto cached = row_group_readers_.find(i);
+    if (cached != row_group_readers_.cend()) {
+      return cached->second;
+    }
+
     auto row_group_metadata = file_metadata_->RowGroup(i);
 
     // Find the read range of the page index of the row group if provided by WillNeed()
@@ -417,9 +438,11 @@ class PageIndexReaderImpl : public PageIndexReader {
 
     if (index_read_range.column_index.has_value() ||
         index_read_range.offset_index.has_value()) {
-      return std::make_shared<RowGroupPageIndexReaderImpl>(
+      auto row_group_reader = std::make_shared<RowGroupPageIndexReaderImpl>(
           input_, std::move(row_group_metadata), properties_, i, index_read_range,
           file_decryptor_);
+      row_group_readers_.emplace(i, row_group_reader);
+      return row_group_reader;
     }
 
     /// The row group does not has page index or has not been requested by WillNeed().
@@ -431,7 +454,10 @@ class PageIndexReaderImpl : public PageIndexReader {
                 const std::vector<int32_t>& column_indices,
                 const PageIndexSelection& selection) override {
     std::vector<::arrow::io::ReadRange> read_ranges;
+    std::lock_guard<std::mutex> lock(mutex_);
     for (int32_t row_group_ordinal : row_group_indices) {
+      // The page index to read may differ from that of the current reader
+      row_group_readers_.erase(row_group_ordinal);
       auto read_range = PageIndexReader::DeterminePageIndexRangesInRowGroup(
           *file_metadata_->RowGroup(row_group_ordinal), column_indices);
       if (selection.column_index && read_range.column_index.has_value()) {
@@ -452,8 +478,10 @@ class PageIndexReaderImpl : public PageIndexReader {
   }
 
   void WillNotNeed(const std::vector<int32_t>& row_group_indices) override {
+    std::lock_guard<std::mutex> lock(mutex_);
     for (int32_t row_group_ordinal : row_group_indices) {
       index_read_ranges_.erase(row_group_ordinal);
+      row_group_readers_.erase(row_group_ordinal);
     }
   }
 
@@ -473,6 +501,15 @@ class PageIndexReaderImpl : public PageIndexReader {
   /// Coalesced read ranges of page index of row groups that have been suggested by
   /// WillNeed(). Key is the row group ordinal.
   std::unordered_map<int32_t, RowGroupIndexReadRange> index_read_ranges_;
+
+  /// Readers of the row groups whose page index has been accessed, which hold the
+  /// page index read from the file. Key is the row group ordinal.
+  std::unordered_map<int32_t, std::shared_ptr<RowGroupPageIndexReaderImpl>>
+      row_group_readers_;
+
+  /// Guards index_read_ranges_ and row_group_readers_, since the columns of a file
+  /// may be read concurrently.
+  std::mutex mutex_;
 };
 
 /// \brief Internal state of page index builder.
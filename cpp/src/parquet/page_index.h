@@ -206,7 +206,9 @@ class PARQUET_EXPORT PageIndexReader {
   /// \returns RowGroupPageIndexReader of the specified row group. A nullptr may or may
   ///          not be returned if the page index for the row group is unavailable. It is
   ///          the caller's responsibility to check the return value of follow-up calls
-  ///          to the RowGroupPageIndexReader.
+  ///          to the RowGroupPageIndexReader. The same RowGroupPageIndexReader,
+  ///          which reads the page index of the row group once, is returned until
+  ///          WillNeed() or WillNotNeed() is called for the row group.
   /// \throws ParquetException if the index is out of bound.
   virtual std::shared_ptr<RowGroupPageIndexReader> RowGroup(int i) = 0;
 
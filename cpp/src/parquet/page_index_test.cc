@@ -24,6 +24,7 @@
 #include "arrow/util/float16.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/row_ranges.h"
 #include "parquet/schema.h"
 #include "parquet/test_util.h"
 #include "parquet/thrift_internal.h"
@@ -147,6 +148,28 @@ void TestReadTypedColumnIndex(const std::string& file_name, int column_id,
   }
 }
 
+TEST(PageIndex, ReuseRowGroupPageIndexReader) {
+  std::string dir_string(parquet::test::get_data_dir());
+  std::string path = dir_string + "/alltypes_tiny_pages.parquet";
+  auto reader = ParquetFileReader::OpenFile(path, false);
+  auto page_index_reader = reader->GetPageIndexReader();
+  ASSERT_NE(page_index_reader, nullptr);
+
+  // The page index of a row group is only read once for all its columns
+  auto row_group_index = page_index_reader->RowGroup(0);
+  ASSERT_NE(row_group_index, nullptr);
+  ASSERT_EQ(row_group_index, page_index_reader->RowGroup(0));
+  ASSERT_NE(row_group_index->GetOffsetIndex(0), nullptr);
+
+  // Requesting other parts of the page index replaces the reader
+  page_index_reader->WillNeed({0}, {0}, {/*column_index=*/false,
+                                         /*offset_index=*/true});
+  auto requested_index = page_index_reader->RowGroup(0);
+  ASSERT_NE(requested_index, row_group_index);
+  ASSERT_NE(requested_index->GetOffsetIndex(0), nullptr);
+  ASSERT_THROW(requested_index->GetColumnIndex(0), ParquetException);
+}
+
 TEST(PageIndex, ReadInt64ColumnIndex) {
   const int column_id = 5;
   const size_t num_pages = 528;
@@ -469,6 +492,47 @@ void TestWriteOffsetIndex(bool write_size_stats) {
   }
 }
 
+TEST(RowRanges, Basics) {
+  RowRanges ranges({{20, 30}, {0, 5}, {5, 8}, {25, 40}, {50, 50}});
+  ASSERT_EQ(ranges, RowRanges({{0, 8}, {20, 40}}));
+  ASSERT_EQ(ranges.num_rows(), 28);
+  ASSERT_EQ(ranges.ToString(), "[[0, 8), [20, 40)]");
+
+  ranges.Add({10, 20});
+  ASSERT_EQ(ranges, RowRanges({{0, 8}, {10, 40}}));
+  ranges.Add({7, 11});
+  ASSERT_EQ(ranges, RowRanges::All(40));
+
+  ASSERT_TRUE(RowRanges().empty());
+  ASSERT_EQ(RowRanges::All(0), RowRanges());
+}
+
+TEST(RowRanges, SetOperations) {
+  RowRanges left({{0, 10}, {20, 30}, {40, 50}});
+  RowRanges right({{5, 25}, {45, 60}});
+  ASSERT_EQ(RowRanges::Intersection(left, right),
+            RowRanges({{5, 10}, {20, 25}, {45, 50}}));
+  ASSERT_EQ(RowRanges::Union(left, right), RowRanges({{0, 30}, {40, 60}}));
+  ASSERT_EQ(RowRanges::Intersection(left, RowRanges()), RowRanges());
+
+  ASSERT_TRUE(left.Overlaps({9, 12}));
+  ASSERT_TRUE(left.Overlaps({35, 41}));
+  ASSERT_FALSE(left.Overlaps({10, 20}));
+  ASSERT_FALSE(left.Overlaps({50, 100}));
+  ASSERT_FALSE(left.Overlaps({5, 5}));
+}
+
+TEST(RowRanges, PageRowRanges) {
+  auto builder = OffsetIndexBuilder::Make();
+  builder->AddPage(/*offset=*/100, /*compressed_page_size=*/10, /*first_row_index=*/0);
+  builder->AddPage(/*offset=*/110, /*compressed_page_size=*/10, /*first_row_index=*/30);
+  builder->AddPage(/*offset=*/120, /*compressed_page_size=*/10, /*first_row_index=*/70);
+  builder->Finish(/*final_position=*/0);
+  auto offset_index = builder->Build();
+  ASSERT_EQ(PageRowRanges(*offset_index, /*num_rows=*/100),
+            (std::vector<RowRange>{{0, 30}, {30, 70}, {70, 100}}));
+}
+
 TEST(PageIndex, WriteOffsetIndexWithoutSizeStats) {
   TestWriteOffsetIndex(/*write_size_stats=*/false);
 }
@@ -158,6 +158,7 @@ ReaderProperties PARQUET_EXPORT default_reader_properties();
 
 static constexpr int64_t kDefaultDataPageSize = 1024 * 1024;
 static constexpr int64_t kDefaultMaxRowsPerPage = 20'000;
+static constexpr int64_t kDefaultMaxPendingCompressedPages = 8;
 static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
@@ -376,7 +377,9 @@ class PARQUET_EXPORT WriterProperties {
           page_checksum_enabled_(false),
           size_statistics_level_(DEFAULT_SIZE_STATISTICS_LEVEL),
           content_defined_chunking_enabled_(false),
-          content_defined_chunking_options_({}) {}
+          content_defined_chunking_options_({}),
+          page_compression_executor_(NULLPTR),
+          max_pending_compressed_pages_(kDefaultMaxPendingCompressedPages) {}
 
     explicit Builder(const WriterProperties& properties)
         : pool_(properties.memory_pool()),
@@ -396,7 +399,9 @@ class PARQUET_EXPORT WriterProperties {
           content_defined_chunking_enabled_(
               properties.content_defined_chunking_enabled()),
           content_defined_chunking_options_(
-              properties.content_defined_chunking_options()) {
+              properties.content_defined_chunking_options()),
+          page_compression_executor_(properties.page_compression_executor()),
+          max_pending_compressed_pages_(properties.max_pending_compressed_pages()) {
       CopyColumnSpecificProperties(properties);
     }
 
@@ -426,6 +431,38 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief EXPERIMENTAL: Compress the data pages on the given executor.
+    ///
+    /// While its data pages are being compressed, a column writer keeps encoding the
+    /// next pages. Each compressed page is written in order once the previous pages
+    /// are written, usually from the thread which compressed it. This overlaps the
+    /// encoding, the compression and the output of a column, and compresses several
+    /// pages of a column in parallel.
+    ///
+    /// A column written on a thread of this executor (for example with
+    /// ArrowWriterProperties::set_use_threads and the same executor) compresses its
+    /// pages itself, since waiting for them could deadlock the executor.
+    ///
+    /// Default is nullptr: the data pages are compressed by the column writers.
+    Builder* enable_parallel_page_compression(::arrow::internal::Executor* executor) {
+      page_compression_executor_ = executor;
+      return this;
+    }
+
+    /// \brief Compress the data pages by the column writers.
+    Builder* disable_parallel_page_compression() {
+      page_compression_executor_ = NULLPTR;
+      return this;
+    }
+
+    /// \brief Specify the maximum number of data pages of a column being compressed
+    /// at a time with parallel page compression, which bounds the memory buffered by
+    /// each column writer. Default 8.
+    Builder* max_pending_compressed_pages(int64_t max_pending_pages) {
+      max_pending_compressed_pages_ = max_pending_pages;
+      return this;
+    }
+
     /// Specify the memory pool for the writer. Default default_memory_pool.
     Builder* memory_pool(MemoryPool* pool) {
       pool_ = pool;
@@ -903,7 +940,8 @@ class PARQUET_EXPORT WriterProperties {
           size_statistics_level_, std::move(file_encryption_properties_),
           default_column_properties_, column_properties, data_page_version_,
           store_decimal_as_integer_, std::move(sorting_columns_),
-          content_defined_chunking_enabled_, content_defined_chunking_options_));
+          content_defined_chunking_enabled_, content_defined_chunking_options_,
+          page_compression_executor_, max_pending_compressed_pages_));
     }
 
    private:
@@ -939,6 +977,9 @@ class PARQUET_EXPORT WriterProperties {
 
     bool content_defined_chunking_enabled_;
     CdcOptions content_defined_chunking_options_;
+
+    ::arrow::internal::Executor* page_compression_executor_;
+    int64_t max_pending_compressed_pages_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -972,6 +1013,16 @@ class PARQUET_EXPORT WriterProperties {
     return content_defined_chunking_options_;
   }
 
+  /// \brief Returns the executor the data pages are compressed on, or nullptr if
+  /// they are compressed by the column writers.
+  inline ::arrow::internal::Executor* page_compression_executor() const {
+    return page_compression_executor_;
+  }
+
+  inline int64_t max_pending_compressed_pages() const {
+    return max_pending_compressed_pages_;
+  }
+
   inline SizeStatisticsLevel size_statistics_level() const {
     return size_statistics_level_;
   }
@@ -1086,7 +1137,9 @@ class PARQUET_EXPORT WriterProperties {
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
       ParquetDataPageVersion data_page_version, bool store_short_decimal_as_integer,
       std::vector<SortingColumn> sorting_columns, bool content_defined_chunking_enabled,
-      CdcOptions content_defined_chunking_options)
+      CdcOptions content_defined_chunking_options,
+      ::arrow::internal::Executor* page_compression_executor,
+      int64_t max_pending_compressed_pages)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
@@ -1104,7 +1157,9 @@ class PARQUET_EXPORT WriterProperties {
         default_column_properties_(default_column_properties),
         column_properties_(column_properties),
         content_defined_chunking_enabled_(content_defined_chunking_enabled),
-        content_defined_chunking_options_(content_defined_chunking_options) {}
+        content_defined_chunking_options_(content_defined_chunking_options),
+        page_compression_executor_(page_compression_executor),
+        max_pending_compressed_pages_(max_pending_compressed_pages) {}
 
   MemoryPool* pool_;
   int64_t dictionary_pagesize_limit_;
@@ -1128,6 +1183,9 @@ class PARQUET_EXPORT WriterProperties {
 
   bool content_defined_chunking_enabled_;
   CdcOptions content_defined_chunking_options_;
+
+  ::arrow::internal::Executor* page_compression_executor_;
+  int64_t max_pending_compressed_pages_;
 };
 
 PARQUET_EXPORT const std::shared_ptr<WriterProperties>& default_writer_properties();
@@ -1149,6 +1207,7 @@ class PARQUET_EXPORT ArrowReaderProperties {
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
+        unify_dictionaries_(false),
         batch_size_(kArrowDefaultBatchSize),
         pre_buffer_(true),
         cache_options_(::arrow::io::CacheOptions::LazyDefaults()),
@@ -1170,8 +1229,10 @@ class PARQUET_EXPORT ArrowReaderProperties {
   ///
   /// If the file metadata contains a serialized Arrow schema, then ...
   ////
-  /// This is only supported for columns with a Parquet physical type of
-  /// BYTE_ARRAY, such as string or binary types.
+  /// This is supported for string and binary columns, and for integer, floating
+  /// point, temporal and fixed size binary columns which are stored as their
+  /// Parquet physical type (for example, not for decimals or INT96 timestamps).
+  /// The other columns are read as their dense type.
   void set_read_dictionary(int column_index, bool read_dict) {
     if (read_dict) {
       read_dict_indices_.insert(column_index);
@@ -1188,6 +1249,21 @@ class PARQUET_EXPORT ArrowReaderProperties {
     }
   }
 
+  /// \brief Set whether to unify the dictionaries of the columns read as dictionary
+  /// encoded across row groups.
+  ///
+  /// Each row group of a Parquet file has its own dictionary. When enabled, the
+  /// dictionary of each batch read from a column extends the dictionary of the
+  /// previous batches with the values of the new row groups, so that a value keeps
+  /// the same index across all the batches of a read.
+  ///
+  /// Default is false.
+  void set_unify_dictionaries(bool unify_dictionaries) {
+    unify_dictionaries_ = unify_dictionaries;
+  }
+  /// Return whether the dictionaries are unified across row groups.
+  bool unify_dictionaries() const { return unify_dictionaries_; }
+
   /// \brief Set the Arrow binary type to read BYTE_ARRAY columns as.
   ///
   /// Allowed values are Type::BINARY, Type::LARGE_BINARY and Type::BINARY_VIEW.
@@ -1298,6 +1374,7 @@ class PARQUET_EXPORT ArrowReaderProperties {
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
+  bool unify_dictionaries_;
   int64_t batch_size_;
   bool pre_buffer_;
   ::arrow::io::IOContext io_context_;
@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/row_ranges.h"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+#include "parquet/exception.h"
+#include "parquet/page_index.h"
+
+namespace parquet {
+
+RowRanges::RowRanges(std::vector<RowRange> ranges) {
+  std::sort(ranges.begin(), ranges.end(),
+            [](const RowRange& left, const RowRange& right) {
+              return left.begin < right.begin;
+            });
+  for (const auto& range : ranges) {
+    Add(range);
+  }
+}
+
+RowRanges RowRanges::All(int64_t num_rows) {
+  RowRanges all;
+  all.Add({0, num_rows});
+  return all;
+}
+
+void RowRanges::Add(RowRange range) {
+  if (range.length() <= 0) return;
+  // Find the first range which ends at or after the start of the new one, so that
+  // it overlaps or is adjacent to it, or follows it
+  auto it = std::lower_bound(
+      ranges_.begin(), ranges_.end(), range.begin,
+      [](const RowRange& existing, int64_t begin) { return existing.end < begin; });
+  auto last = it;
+  while (last != ranges_.end() && last->begin <= range.end) {
+    range.begin = std::min(range.begin, last->begin);
+    range.end = std::max(range.end, last->end);
+    ++last;
+  }
+  it = ranges_.erase(it, last);
+  ranges_.insert(it, range);
+}
+
+RowRanges RowRanges::Intersection(const RowRanges& left, const RowRanges& right) {
+  RowRanges result;
+  auto left_it = left.ranges_.begin();
+  auto right_it = right.ranges_.begin();
+  while (left_it != left.ranges_.end() && right_it != right.ranges_.end()) {
+    const int64_t begin = std::max(left_it->begin, right_it->begin);
+    const int64_t end = std::min(left_it->end, right_it->end);
+    if (begin < end) {
+      result.ranges_.push_back({begin, end});
+    }
+    if (left_it->end < right_it->end) {
+      ++left_it;
+    } else {
+      ++right_it;
+    }
+  }
+  return result;
+}
+
+RowRanges RowRanges::Union(const RowRanges& left, const RowRanges& right) {
+  RowRanges result = left;
+  for (const auto& range : right.ranges_) {
+    result.Add(range);
+  }
+  return result;
+}
+
+bool RowRanges::Overlaps(const RowRange& range) const {
+  auto it = std::upper_bound(
+      ranges_.begin(), ranges_.end(), range.begin,
+      [](int64_t begin, const RowRange& existing) { return begin < existing.end; });
+  return it != ranges_.end() && it->begin < range.end && range.length() > 0;
+}
+
+int64_t RowRanges::num_rows() const {
+  int64_t num_rows = 0;
+  for (const auto& range : ranges_) {
+    num_rows += range.length();
+  }
+  return num_rows;
+}
+
+std::string RowRanges::ToString() const {
+  std::stringstream ss;
+  ss << "[";
+  for (size_t i = 0; i < ranges_.size(); ++i) {
+    if (i > 0) ss << ", ";
+    ss << "[" << ranges_[i].begin << ", " << ranges_[i].end << ")";
+  }
+  ss << "]";
+  return ss.str();
+}
+
+std::vector<RowRange> PageRowRanges(const OffsetIndex& offset_index, int64_t num_rows) {
+  const auto& page_locations = offset_index.page_locations();
+  std::vector<RowRange> ranges(page_locations.size());
+  for (size_t i = 0; i < page_locations.size(); ++i) {
+    const int64_t end = i + 1 < page_locations.size()
+                            ? page_locations[i + 1].first_row_index
+                            : num_rows;
+    if (page_locations[i].first_row_index > end) {
+      throw ParquetException("Invalid offset index: page ", i, " starts at row ",
+                             page_locations[i].first_row_index, " after row ", end);
+    }
+    ranges[i] = {page_locations[i].first_row_index, end};
+  }
+  return ranges;
+}
+
+}  // namespace parquet
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/type_fwd.h"
+
+namespace parquet {
+
+/// \brief A half-open range [begin, end) of row indices within a row group.
+struct PARQUET_EXPORT RowRange {
+  int64_t begin;
+  int64_t end;
+
+  int64_t length() const { return end - begin; }
+
+  bool operator==(const RowRange& other) const {
+    return begin == other.begin && end == other.end;
+  }
+  bool operator!=(const RowRange& other) const { return !(*this == other); }
+};
+
+/// \brief A selection of rows within a row group.
+///
+/// The selection is kept as sorted, disjoint and non-adjacent row ranges.
+class PARQUET_EXPORT RowRanges {
+ public:
+  /// \brief Create an empty selection.
+  RowRanges() = default;
+
+  /// \brief Create a selection of the given ranges, which may be unsorted and overlap.
+  explicit RowRanges(std::vector<RowRange> ranges);
+
+  /// \brief Create a selection of all the rows of a row group.
+  static RowRanges All(int64_t num_rows);
+
+  /// \brief Add a range to the selection, merging it with the overlapping or
+  /// adjacent ranges.
+  void Add(RowRange range);
+
+  /// \brief The rows selected by both selections.
+  static RowRanges Intersection(const RowRanges& left, const RowRanges& right);
+
+  /// \brief The rows selected by either selection.
+  static RowRanges Union(const RowRanges& left, const RowRanges& right);
+
+  /// \brief Whether some row of the given range is selected.
+  bool Overlaps(const RowRange& range) const;
+
+  /// \brief The number of selected rows.
+  int64_t num_rows() const;
+
+  bool empty() const { return ranges_.empty(); }
+
+  const std::vector<RowRange>& ranges() const { return ranges_; }
+
+  std::string ToString() const;
+
+  bool operator==(const RowRanges& other) const { return ranges_ == other.ranges_; }
+  bool operator!=(const RowRanges& other) const { return !(*this == other); }
+
+ private:
+  std::vector<RowRange> ranges_;
+};
+
+/// \brief The row range of each data page of a column chunk.
+///
+/// \param[in] offset_index the offset index of the column chunk
+/// \param[in] num_rows the number of rows of the row group
+PARQUET_EXPORT std::vector<RowRange> PageRowRanges(const OffsetIndex& offset_index,
+                                                   int64_t num_rows);
+
+}  // namespace parquet
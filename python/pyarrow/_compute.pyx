@@ -1127,6 +1127,32 @@ class MatchSubstringOptions(_MatchSubstringOptions):
         self._set_options(pattern, ignore_case)
 
 
+cdef class _MatchAnySubstringOptions(FunctionOptions):
+    def _set_options(self, patterns, ignore_case):
+        cdef vector[c_string] c_patterns
+        for pattern in patterns:
+            c_patterns.push_back(tobytes(pattern))
+        self.wrapped.reset(
+            new CMatchAnySubstringOptions(move(c_patterns), ignore_case)
+        )
+
+
+class MatchAnySubstringOptions(_MatchAnySubstringOptions):
+    """
+    Options for looking for any of several substrings.
+
+    Parameters
+    ----------
+    patterns : sequence of str
+        Substring patterns to look for inside input values.
+    ignore_case : bool, default False
+        Whether to perform a case-insensitive match.
+    """
+
+    def __init__(self, patterns, *, ignore_case=False):
+        self._set_options(patterns, ignore_case)
+
+
 cdef class _PadOptions(FunctionOptions):
     def _set_options(self, width, padding, lean_left_on_odd_padding):
         self.wrapped.reset(new CPadOptions(width, tobytes(padding), lean_left_on_odd_padding))
@@ -1667,6 +1693,26 @@ class CountOptions(_CountOptions):
         self._set_options(mode)
 
 
+cdef class _ApproxCountDistinctOptions(FunctionOptions):
+    def _set_options(self, precision):
+        self.wrapped.reset(new CApproxCountDistinctOptions(precision))
+
+
+class ApproxCountDistinctOptions(_ApproxCountDistinctOptions):
+    """
+    Options for the `approx_count_distinct` function.
+
+    Parameters
+    ----------
+    precision : int, default 12
+        Base-2 logarithm of the number of HyperLogLog registers, between 4
+        and 18. The relative standard error is about 1.04 / sqrt(2**precision).
+    """
+
+    def __init__(self, precision=12):
+        self._set_options(precision)
+
+
 cdef class _IndexOptions(FunctionOptions):
     def _set_options(self, scalar):
         self.wrapped.reset(new CIndexOptions(pyarrow_unwrap_scalar(scalar)))
@@ -29,6 +29,7 @@ from pyarrow._compute import (  # noqa
     VectorFunction,
     VectorKernel,
     # Option classes
+    ApproxCountDistinctOptions,
     ArraySortOptions,
     AssumeTimezoneOptions,
     CastOptions,
@@ -49,6 +50,7 @@ from pyarrow._compute import (  # noqa
     ListFlattenOptions,
     MakeStructOptions,
     MapLookupOptions,
+    MatchAnySubstringOptions,
     MatchSubstringOptions,
     ModeOptions,
     NullOptions,
@@ -2472,6 +2472,12 @@ cdef extern from "arrow/compute/api.h" namespace "arrow::compute" nogil:
         c_string pattern
         c_bool ignore_case
 
+    cdef cppclass CMatchAnySubstringOptions \
+            "arrow::compute::MatchAnySubstringOptions"(CFunctionOptions):
+        CMatchAnySubstringOptions(vector[c_string] patterns, c_bool ignore_case)
+        vector[c_string] patterns
+        c_bool ignore_case
+
     cdef cppclass CTrimOptions \
             "arrow::compute::TrimOptions"(CFunctionOptions):
         CTrimOptions(c_string characters)
@@ -2701,6 +2707,11 @@ cdef extern from "arrow/compute/api.h" namespace "arrow::compute" nogil:
         CCountOptions(CCountMode mode)
         CCountMode mode
 
+    cdef cppclass CApproxCountDistinctOptions \
+            "arrow::compute::ApproxCountDistinctOptions"(CFunctionOptions):
+        CApproxCountDistinctOptions(int32_t precision)
+        int32_t precision
+
     cdef cppclass CModeOptions \
             "arrow::compute::ModeOptions"(CFunctionOptions):
         CModeOptions(int64_t n, c_bool skip_nulls, uint32_t min_count)
@@ -142,6 +142,7 @@ def test_exported_option_classes():
 )
 def test_option_class_equality(request):
     options = [
+        pc.ApproxCountDistinctOptions(),
         pc.ArraySortOptions(),
         pc.AssumeTimezoneOptions("UTC"),
         pc.CastOptions.safe(pa.int8()),
@@ -163,6 +164,7 @@ def test_option_class_equality(request):
                              field_metadata=[pa.KeyValueMetadata({"a": "1"}),
                                              pa.KeyValueMetadata({"b": "2"})]),
         pc.MapLookupOptions(pa.scalar(1), "first"),
+        pc.MatchAnySubstringOptions(["pattern", "other"]),
         pc.MatchSubstringOptions("pattern"),
         pc.ModeOptions(),
         pc.NullOptions(),
@@ -650,6 +652,17 @@ def test_match_substring_regex():
     assert expected.equals(result)
 
 
+def test_match_any_substring():
+    arr = pa.array(["ab", "abc", "ba", "c", None])
+    result = pc.match_any_substring(arr, ["bc", "ba"])
+    expected = pa.array([False, True, True, False, None])
+    assert expected.equals(result)
+
+    result = pc.match_any_substring_regex(arr, ["^a?b$", "C"], ignore_case=True)
+    expected = pa.array([True, True, False, True, None])
+    assert expected.equals(result)
+
+
 def test_trim():
     # \u3000 is unicode whitespace
     arr = pa.array([" foo", None, " \u3000foo bar \t"])
@@ -3762,6 +3775,14 @@ def test_count_distinct_options():
     assert pc.count_distinct(arr, 'all').as_py() == 4
 
 
+def test_approx_count_distinct():
+    arr = pa.array([1, 2, 3, None, None, 2])
+    assert pc.approx_count_distinct(arr).as_py() == 3
+    assert pc.approx_count_distinct(arr, precision=4).as_py() == 3
+    with pytest.raises(pa.ArrowInvalid, match="precision must be between"):
+        pc.approx_count_distinct(arr, precision=19)
+
+
 def test_utf8_normalize():
     arr = pa.array(["01²3"])
     assert pc.utf8_normalize(arr, form="NFC") == arr